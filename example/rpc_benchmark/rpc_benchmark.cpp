@@ -0,0 +1,138 @@
+#include <grpc++/grpc++.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "camera/camera.grpc.pb.h"
+
+// Measure the rpc round trip between mav_client and mav_server over tcp and over a unix
+// domain socket. Start mav_server with --rpc_socket first, e.g.
+//   mav_server --rpc_socket /run/mavcam.sock
+//   rpc_benchmark -r 50051 --rpc_socket /run/mavcam.sock -n 2000
+
+static auto constexpr default_rpc_port = 50051;
+static auto constexpr default_iterations = 1000;
+static auto constexpr warmup_iterations = 50;
+
+using Stub = mavcam::rpc::camera::CameraService::Stub;
+
+static void usage(const char *bin_name);
+static bool get_setting(Stub &stub);
+static bool first_status(Stub &stub);
+static bool run(const std::string &name, const std::string &target, int iterations);
+static void print_latency(const std::string &name, std::vector<double> &latency_us);
+
+int main(int argc, const char *argv[]) {
+    int rpc_port = default_rpc_port;
+    int iterations = default_iterations;
+    std::string rpc_socket;
+    for (int i = 1; i < argc; i++) {
+        const std::string current_arg = argv[i];
+        if (current_arg == "-r" && i + 1 < argc) {
+            rpc_port = std::atoi(argv[++i]);
+        } else if (current_arg == "-n" && i + 1 < argc) {
+            iterations = std::atoi(argv[++i]);
+        } else if (current_arg == "--rpc_socket" && i + 1 < argc) {
+            rpc_socket = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (iterations <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bool success = run("tcp", "0.0.0.0:" + std::to_string(rpc_port), iterations);
+    if (!rpc_socket.empty()) {
+        success = run("unix", "unix:" + rpc_socket, iterations) && success;
+    }
+    return success ? 0 : 1;
+}
+
+static void usage(const char *bin_name) {
+    std::cout << "Usage: " << bin_name << " [Options]" << '\n'
+              << '\n'
+              << "Options:" << '\n'
+              << "\t-r           : rpc port of mav_server, (default is " << default_rpc_port
+              << ")\n"
+              << "\t--rpc_socket : unix domain socket of mav_server" << '\n'
+              << "\t-n           : number of calls per measurement, (default is "
+              << default_iterations << ")\n";
+}
+
+static bool get_setting(Stub &stub) {
+    mavcam::rpc::camera::GetSettingRequest request;
+    request.mutable_setting()->set_setting_id("CAM_MODE");
+    mavcam::rpc::camera::GetSettingResponse response;
+    grpc::ClientContext context;
+    return stub.GetSetting(&context, request, &response).ok();
+}
+
+static bool first_status(Stub &stub) {
+    mavcam::rpc::camera::SubscribeStatusRequest request;
+    grpc::ClientContext context;
+    auto reader = stub.SubscribeStatus(&context, request);
+    mavcam::rpc::camera::StatusResponse response;
+    bool success = reader->Read(&response);
+    context.TryCancel();
+    reader->Finish();
+    return success;
+}
+
+static bool run(const std::string &name, const std::string &target, int iterations) {
+    auto channel = grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
+    auto stub = mavcam::rpc::camera::CameraService::NewStub(channel);
+
+    for (int i = 0; i < warmup_iterations; i++) {
+        if (!get_setting(*stub)) {
+            std::cout << "Cannot reach mav_server on " << target << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<double> unary_latency_us;
+    std::vector<double> stream_latency_us;
+    unary_latency_us.reserve(iterations);
+    stream_latency_us.reserve(iterations);
+    for (int i = 0; i < iterations; i++) {
+        auto start_time = std::chrono::steady_clock::now();
+        get_setting(*stub);
+        auto end_time = std::chrono::steady_clock::now();
+        unary_latency_us.push_back(
+            std::chrono::duration<double, std::micro>(end_time - start_time).count());
+    }
+    for (int i = 0; i < iterations; i++) {
+        auto start_time = std::chrono::steady_clock::now();
+        first_status(*stub);
+        auto end_time = std::chrono::steady_clock::now();
+        stream_latency_us.push_back(
+            std::chrono::duration<double, std::micro>(end_time - start_time).count());
+    }
+
+    std::cout << name << " (" << target << "), " << iterations << " calls" << std::endl;
+    print_latency("  GetSetting round trip     ", unary_latency_us);
+    print_latency("  SubscribeStatus first msg ", stream_latency_us);
+    return true;
+}
+
+static void print_latency(const std::string &name, std::vector<double> &latency_us) {
+    std::sort(latency_us.begin(), latency_us.end());
+    double sum = 0;
+    for (auto latency : latency_us) {
+        sum += latency;
+    }
+    auto percentile = [&latency_us](double p) {
+        return latency_us[static_cast<size_t>(p * (latency_us.size() - 1))];
+    };
+    std::cout << std::fixed << std::setprecision(1) << name << ": avg " << sum / latency_us.size()
+              << " us, p50 " << percentile(0.5) << " us, p99 " << percentile(0.99) << " us, max "
+              << latency_us.back() << " us" << std::endl;
+}
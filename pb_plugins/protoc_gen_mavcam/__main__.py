@@ -0,0 +1,38 @@
+import sys
+
+from google.protobuf.compiler import plugin_pb2
+
+from .autogen import AutoGen
+
+
+def _parameters(parameter):
+    """ Parses the key=value pairs protoc passes with --mavcam_opt """
+    parameters = {}
+    for entry in parameter.split(","):
+        if "=" in entry:
+            key, value = entry.split("=", 1)
+            parameters[key.strip()] = value.strip()
+    return parameters
+
+
+def main():
+    request = plugin_pb2.CodeGeneratorRequest.FromString(sys.stdin.buffer.read())
+    parameters = _parameters(request.parameter)
+    response = plugin_pb2.CodeGeneratorResponse()
+
+    if "template_path" not in parameters:
+        response.error = "template_path parameter is missing"
+    else:
+        files = {proto_file.name: proto_file for proto_file in request.proto_file}
+        for file_name in request.file_to_generate:
+            name, content = AutoGen(files[file_name], parameters["template_path"],
+                                    parameters.get("file_ext", "h")).generate()
+            output = response.file.add()
+            output.name = name
+            output.content = content
+
+    sys.stdout.buffer.write(response.SerializeToString())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,172 @@
+import os
+
+from jinja2 import Environment, FileSystemLoader
+
+from .docs import Docs
+from .name_parser import NameParser
+from .options import (ASYNC, ASYNC_TYPE, BOTH, DEFAULT_VALUE, EPSILON, IS_FINITE, SYNC,
+                      option_value)
+from .type_info import TypeInfo
+
+
+def indent(text, level):
+    """ Indents every non empty line of text by level times four spaces """
+    prefix = "    " * level
+    return "\n".join(prefix + line if line.strip() else line for line in str(text).split("\n"))
+
+
+class Rendered:
+    """ Entry of a file template, renders to its own template and keeps the name around """
+
+    def __init__(self, name, text):
+        self.name = name
+        self._text = text
+
+    def __str__(self):
+        return self._text
+
+
+class Field:
+    def __init__(self, field, description, parent_struct):
+        self.name = NameParser(field.name)
+        self.type_info = TypeInfo(field)
+        self.description = description
+        self.default_value = option_value(field.options, DEFAULT_VALUE)
+        self.epsilon = option_value(field.options, EPSILON)
+        self.parent_struct = parent_struct
+
+
+class AutoGen:
+    """ Renders one proto file with the templates of template_path """
+
+    def __init__(self, proto_file, template_path, file_ext):
+        self._file = proto_file
+        self._file_ext = file_ext
+        self._docs = Docs(proto_file.source_code_info)
+        self._env = Environment(loader=FileSystemLoader(template_path), keep_trailing_newline=True)
+        self._env.globals["indent"] = indent
+
+        self.package = NameParser(proto_file.package)
+        self.plugin_name = NameParser(proto_file.package.split(".")[-1])
+        self._messages = {message.name: (index, message) for index, message in
+                          enumerate(proto_file.message_type)}
+        # messages declaring nested enums, by the full name of the enum
+        self._enum_parents = {}
+        for message in proto_file.message_type:
+            for enum in message.enum_type:
+                self._enum_parents[".{}.{}.{}".format(proto_file.package, message.name,
+                                                      enum.name)] = message.name
+
+    def _render(self, template, **context):
+        return self._env.get_template(template).render(plugin_name=self.plugin_name,
+                                                       package=self.package, **context)
+
+    def _enum(self, enum, path, parent_struct=None):
+        prefix = NameParser(enum.name).upper_snake_case + "_"
+        values = []
+        for index, value in enumerate(enum.value):
+            name = value.name[len(prefix):] if value.name.startswith(prefix) else value.name
+            values.append({
+                "name": NameParser(name),
+                "description": self._docs.field_description(Docs.enum_value(path, index)),
+            })
+        return Rendered(NameParser(enum.name),
+                        self._render("enum.j2", name=NameParser(enum.name), values=values,
+                                     enum_description=self._docs.description(path),
+                                     parent_struct=parent_struct))
+
+    def _fields(self, message, path):
+        fields = []
+        for index, field in enumerate(message.field):
+            # repeated enums arrive as int, casting them back needs the message declaring the enum
+            parent = None
+            if field.label == field.LABEL_REPEATED:
+                parent = self._enum_parents.get(field.type_name)
+            fields.append(Field(field, self._docs.field_description(Docs.field(path, index)),
+                                Rendered(NameParser(parent), parent) if parent else None))
+        return fields
+
+    def enums(self):
+        return [self._enum(enum, Docs.enum(index)) for index, enum in
+                enumerate(self._file.enum_type)]
+
+    def structs(self):
+        structs = []
+        for index, message in enumerate(self._file.message_type):
+            if message.name.endswith("Request") or message.name.endswith("Response"):
+                continue
+            path = Docs.message(index)
+            name = NameParser(message.name)
+            nested_enums = {}
+            for enum_index, enum in enumerate(message.enum_type):
+                nested_enums[enum.name] = str(
+                    self._enum(enum, Docs.enum(enum_index, path), parent_struct=name))
+            structs.append(Rendered(name, self._render(
+                "struct.j2", name=name, fields=self._fields(message, path),
+                struct_description=self._docs.description(path), nested_enums=nested_enums)))
+        return structs
+
+    def _has_result(self, response):
+        result_type = "{}Result".format(self.plugin_name.upper_camel_case)
+        return any(field.type_name.split(".")[-1] == result_type for field in response.field)
+
+    def methods(self):
+        methods = []
+        result_type = "{}Result".format(self.plugin_name.upper_camel_case)
+        for service_index, service in enumerate(self._file.service):
+            service_path = Docs.service(service_index)
+            for index, method in enumerate(service.method):
+                request_index, request = self._messages[method.input_type.split(".")[-1]]
+                _, response = self._messages[method.output_type.split(".")[-1]]
+                params = self._fields(request, Docs.message(request_index))
+
+                returns = [field for field in response.field
+                           if field.type_name.split(".")[-1] != result_type]
+                async_type = option_value(method.options, ASYNC_TYPE)
+                if async_type is None:
+                    async_type = BOTH
+
+                if method.server_streaming:
+                    template = "stream.j2"
+                    name = method.name[len("Subscribe"):] if method.name.startswith(
+                        "Subscribe") else method.name
+                elif returns:
+                    template = "request.j2"
+                    name = method.name
+                else:
+                    template = "call.j2"
+                    name = method.name
+
+                context = {
+                    "name": NameParser(name),
+                    "params": params,
+                    "has_result": self._has_result(response),
+                    "is_sync": async_type in (SYNC, BOTH),
+                    "is_async": async_type in (ASYNC, BOTH),
+                    "is_finite": bool(option_value(method.options, IS_FINITE)),
+                    "method_description": self._docs.description(
+                        Docs.method(service_path, index)),
+                }
+                if returns:
+                    context["return_type"] = TypeInfo(returns[0])
+                    context["return_name"] = NameParser(returns[0].name)
+                methods.append(Rendered(NameParser(name), self._render(template, **context)))
+        return methods
+
+    def class_description(self):
+        descriptions = [self._docs.description(Docs.service(index))
+                        for index in range(len(self._file.service))]
+        return "\n".join(description for description in descriptions if description)
+
+    def generate(self):
+        """ Returns the name and the content of the generated file """
+        name = self.plugin_name.upper_camel_case
+        if self._file.service:
+            name = self._file.service[0].name.replace("Service", "")
+        has_result = "{}Result".format(self.plugin_name.upper_camel_case) in self._messages
+        content = self._render("file.j2", class_description=self.class_description(),
+                               has_result=has_result,
+                               enums=self.enums(), structs=self.structs(),
+                               methods=self.methods())
+        return os.path.join(self.plugin_name.lower_snake_case,
+                            "{}.{}".format(name, self._file_ext)), content
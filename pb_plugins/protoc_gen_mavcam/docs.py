@@ -0,0 +1,55 @@
+# paths of the source code info, see google/protobuf/descriptor.proto
+_MESSAGE_TYPE = 4
+_ENUM_TYPE = 5
+_SERVICE = 6
+_FIELD = 2
+_NESTED_ENUM = 4
+_ENUM_VALUE = 2
+_METHOD = 2
+
+
+class Docs:
+    """ Comments of the proto file, leading ones describe messages, enums, services and rpcs,
+    trailing ones describe fields and enum values """
+
+    def __init__(self, source_code_info):
+        self._leading = {}
+        self._trailing = {}
+        for location in source_code_info.location:
+            path = tuple(location.path)
+            if location.HasField("leading_comments"):
+                self._leading[path] = location.leading_comments
+            if location.HasField("trailing_comments"):
+                self._trailing[path] = location.trailing_comments
+
+    def description(self, path):
+        return self._leading.get(tuple(path), "").strip()
+
+    def field_description(self, path):
+        return self._trailing.get(tuple(path), "").rstrip()
+
+    @staticmethod
+    def message(index):
+        return [_MESSAGE_TYPE, index]
+
+    @staticmethod
+    def field(message_path, index):
+        return message_path + [_FIELD, index]
+
+    @staticmethod
+    def enum(index, message_path=None):
+        if message_path is None:
+            return [_ENUM_TYPE, index]
+        return message_path + [_NESTED_ENUM, index]
+
+    @staticmethod
+    def enum_value(enum_path, index):
+        return enum_path + [_ENUM_VALUE, index]
+
+    @staticmethod
+    def service(index):
+        return [_SERVICE, index]
+
+    @staticmethod
+    def method(service_path, index):
+        return service_path + [_METHOD, index]
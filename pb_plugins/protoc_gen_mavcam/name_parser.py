@@ -0,0 +1,42 @@
+import re
+
+
+class NameParser:
+    """ Spells one proto name in the cases used by the templates, e.g. "TakePhoto",
+    "interval_s" or "IN_PROGRESS" """
+
+    def __init__(self, name):
+        self._name = name
+        if "_" in name or name.isupper() or name.islower():
+            words = name.split("_")
+        else:
+            words = re.findall(r"[A-Z]+(?![a-z])|[A-Z]?[a-z0-9]+", name)
+        self._words = [word.lower() for word in words if word]
+
+    @property
+    def lower_snake_case(self):
+        return "_".join(self._words)
+
+    @property
+    def upper_snake_case(self):
+        return self.uppercase
+
+    @property
+    def uppercase(self):
+        return "_".join(word.upper() for word in self._words)
+
+    @property
+    def upper_camel_case(self):
+        return "".join(word.capitalize() for word in self._words)
+
+    @property
+    def lower_camel_case(self):
+        camel = self.upper_camel_case
+        return camel[:1].lower() + camel[1:]
+
+    @property
+    def upper_readable(self):
+        return " ".join(word.capitalize() for word in self._words)
+
+    def __str__(self):
+        return self._name
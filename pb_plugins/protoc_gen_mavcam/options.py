@@ -0,0 +1,55 @@
+import struct
+
+# numbers of the extensions declared in protos/mavcam_options.proto
+ASYNC_TYPE = 50000
+IS_FINITE = 50001
+DEFAULT_VALUE = 50000
+EPSILON = 50001
+
+ASYNC = 0
+SYNC = 1
+BOTH = 2
+
+
+def _read_varint(data, pos):
+    result = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        result |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return result, pos
+        shift += 7
+
+
+def option_value(options, number):
+    """ Raw value of an extension set on the options message, None if it is not set.
+
+    The mavcam options are not known to the protobuf runtime of the plugin, they are read
+    from the wire format instead: varints as int, 64 bit values as double, length delimited
+    values as str.
+    """
+    data = options.SerializeToString()
+    pos = 0
+    value = None
+    while pos < len(data):
+        key, pos = _read_varint(data, pos)
+        wire_type = key & 0x7
+        if wire_type == 0:
+            field_value, pos = _read_varint(data, pos)
+        elif wire_type == 1:
+            field_value = struct.unpack("<d", data[pos:pos + 8])[0]
+            pos += 8
+        elif wire_type == 2:
+            length, pos = _read_varint(data, pos)
+            field_value = data[pos:pos + length].decode("utf-8")
+            pos += length
+        elif wire_type == 5:
+            field_value = struct.unpack("<f", data[pos:pos + 4])[0]
+            pos += 4
+        else:
+            raise ValueError("Unsupported wire type {} in options".format(wire_type))
+        if key >> 3 == number:
+            value = field_value
+    return value
@@ -0,0 +1,57 @@
+from google.protobuf.descriptor_pb2 import FieldDescriptorProto
+
+_PRIMITIVES = {
+    FieldDescriptorProto.TYPE_DOUBLE: "double",
+    FieldDescriptorProto.TYPE_FLOAT: "float",
+    FieldDescriptorProto.TYPE_INT64: "int64_t",
+    FieldDescriptorProto.TYPE_UINT64: "uint64_t",
+    FieldDescriptorProto.TYPE_INT32: "int32_t",
+    FieldDescriptorProto.TYPE_FIXED64: "uint64_t",
+    FieldDescriptorProto.TYPE_FIXED32: "uint32_t",
+    FieldDescriptorProto.TYPE_BOOL: "bool",
+    FieldDescriptorProto.TYPE_STRING: "std::string",
+    FieldDescriptorProto.TYPE_BYTES: "std::vector<uint8_t>",
+    FieldDescriptorProto.TYPE_UINT32: "uint32_t",
+    FieldDescriptorProto.TYPE_SFIXED32: "int32_t",
+    FieldDescriptorProto.TYPE_SFIXED64: "int64_t",
+    FieldDescriptorProto.TYPE_SINT32: "int32_t",
+    FieldDescriptorProto.TYPE_SINT64: "int64_t",
+}
+
+
+class TypeInfo:
+    """ C++ type of one proto field, messages and enums are named without their scope """
+
+    def __init__(self, field):
+        self._field = field
+
+    @property
+    def is_primitive(self):
+        return self._field.type in _PRIMITIVES
+
+    @property
+    def is_enum(self):
+        return self._field.type == FieldDescriptorProto.TYPE_ENUM
+
+    @property
+    def is_repeated(self):
+        return self._field.label == FieldDescriptorProto.LABEL_REPEATED
+
+    @property
+    def inner_name(self):
+        if self.is_primitive:
+            return _PRIMITIVES[self._field.type]
+        return self._field.type_name.split(".")[-1]
+
+    @property
+    def name(self):
+        if self.is_repeated:
+            return "std::vector<{}>".format(self.inner_name)
+        return self.inner_name
+
+    @property
+    def type_name(self):
+        return self._field.type_name
+
+    def __str__(self):
+        return self.name
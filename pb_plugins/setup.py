@@ -0,0 +1,14 @@
+from setuptools import setup
+
+setup(
+    name="protoc-gen-mavcam",
+    version="1.0.0",
+    description="Protoc plugin rendering the MAVCam server plugin sources from the protos",
+    packages=["protoc_gen_mavcam"],
+    install_requires=["protobuf", "jinja2"],
+    entry_points={
+        "console_scripts": [
+            "protoc-gen-mavcam=protoc_gen_mavcam.__main__:main",
+        ],
+    },
+)
@@ -0,0 +1,63 @@
+#include "call_metrics.h"
+
+namespace base {
+
+void CallStats::record(std::chrono::steady_clock::duration latency, bool success) {
+    const auto latency_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    _count.fetch_add(1, std::memory_order_relaxed);
+    if (!success) {
+        _error_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    _total_latency_us.fetch_add(latency_us, std::memory_order_relaxed);
+    auto max_latency_us = _max_latency_us.load(std::memory_order_relaxed);
+    while (latency_us > max_latency_us &&
+           !_max_latency_us.compare_exchange_weak(max_latency_us, latency_us,
+                                                  std::memory_order_relaxed)) {
+    }
+    _latency_us.record(latency_us);
+}
+
+CallMetric CallStats::snapshot() const {
+    CallMetric metric;
+    metric.count = _count.load(std::memory_order_relaxed);
+    metric.error_count = _error_count.load(std::memory_order_relaxed);
+    metric.total_latency_us = _total_latency_us.load(std::memory_order_relaxed);
+    metric.max_latency_us = _max_latency_us.load(std::memory_order_relaxed);
+    // bucket bounds may overshoot the largest value actually seen
+    auto quantile = [&](double q) {
+        auto value = _latency_us.value_at_quantile(q);
+        return value < metric.max_latency_us ? value : metric.max_latency_us;
+    };
+    metric.p50_latency_us = quantile(0.5);
+    metric.p90_latency_us = quantile(0.9);
+    metric.p99_latency_us = quantile(0.99);
+    return metric;
+}
+
+CallStats &CallMetrics::stats(const std::string &name) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &stats = _stats[name];
+    if (!stats) {
+        stats = std::make_unique<CallStats>();
+    }
+    return *stats;
+}
+
+std::vector<CallMetric> CallMetrics::snapshot() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<CallMetric> metrics;
+    metrics.reserve(_stats.size());
+    for (const auto &entry : _stats) {
+        metrics.push_back(entry.second->snapshot());
+        metrics.back().name = entry.first;
+    }
+    return metrics;
+}
+
+CallMetrics &call_metrics() {
+    static CallMetrics metrics;
+    return metrics;
+}
+
+}  // namespace base
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "latency_histogram.h"
+
+namespace base {
+
+/**
+ * @brief Point in time copy of the counters of one call, latencies in microseconds.
+ */
+struct CallMetric {
+    std::string name{};
+    uint64_t count{0};
+    uint64_t error_count{0};
+    uint64_t total_latency_us{0};
+    uint64_t max_latency_us{0};
+    uint64_t p50_latency_us{0};
+    uint64_t p90_latency_us{0};
+    uint64_t p99_latency_us{0};
+};
+
+/**
+ * @brief Count, error count and latency histogram of one call, safe to record from any thread.
+ */
+class CallStats {
+public:
+    void record(std::chrono::steady_clock::duration latency, bool success);
+    CallMetric snapshot() const;
+private:
+    std::atomic<uint64_t> _count{0};
+    std::atomic<uint64_t> _error_count{0};
+    std::atomic<uint64_t> _total_latency_us{0};
+    std::atomic<uint64_t> _max_latency_us{0};
+    LatencyHistogram _latency_us;
+};
+
+/**
+ * @brief Named CallStats, entries are created on first use and never removed.
+ */
+class CallMetrics {
+public:
+    /**
+     * @brief Stats of the named call, the reference stays valid for the registry lifetime.
+     */
+    CallStats &stats(const std::string &name);
+    /**
+     * @brief Copy of every call recorded so far, sorted by name.
+     */
+    std::vector<CallMetric> snapshot() const;
+private:
+    mutable std::mutex _mutex;
+    std::map<std::string, std::unique_ptr<CallStats>> _stats;
+};
+
+/**
+ * @brief Registry shared by the rpc server and the camera backend.
+ */
+CallMetrics &call_metrics();
+
+}  // namespace base
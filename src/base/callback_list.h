@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace base {
+
+template <typename... Args>
+class CallbackList;
+
+/**
+ * @brief Opaque handle returned by CallbackList::subscribe, used to unsubscribe again.
+ */
+template <typename... Args>
+class Handle {
+public:
+    Handle() = default;
+
+    bool valid() const { return _id != 0; }
+
+    friend bool operator==(const Handle &lhs, const Handle &rhs) { return lhs._id == rhs._id; }
+    friend bool operator!=(const Handle &lhs, const Handle &rhs) { return lhs._id != rhs._id; }
+private:
+    explicit Handle(uint64_t id) : _id(id) {}
+
+    uint64_t _id{0};
+
+    friend class CallbackList<Args...>;
+};
+
+/**
+ * @brief Thread-safe list of subscribers notified on every change.
+ *
+ * Callbacks are invoked outside of the internal lock, so a callback is allowed to subscribe or
+ * unsubscribe (itself included). A callback unsubscribed while a notification is running may
+ * still receive that one last notification.
+ */
+template <typename... Args>
+class CallbackList {
+public:
+    using Callback = std::function<void(Args...)>;
+
+    Handle<Args...> subscribe(const Callback &callback) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto id = ++_last_id;
+        _callbacks.emplace_back(id, std::make_shared<Callback>(callback));
+        return Handle<Args...>(id);
+    }
+
+    void unsubscribe(Handle<Args...> handle) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto it = _callbacks.begin(); it != _callbacks.end(); ++it) {
+            if (it->first == handle._id) {
+                _callbacks.erase(it);
+                return;
+            }
+        }
+    }
+
+    void notify(Args... args) {
+        std::vector<std::shared_ptr<Callback>> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            callbacks.reserve(_callbacks.size());
+            for (const auto &entry : _callbacks) {
+                callbacks.push_back(entry.second);
+            }
+        }
+        for (const auto &callback : callbacks) {
+            (*callback)(args...);
+        }
+    }
+
+    bool empty() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _callbacks.empty();
+    }
+private:
+    mutable std::mutex _mutex;
+    uint64_t _last_id{0};
+    std::vector<std::pair<uint64_t, std::shared_ptr<Callback>>> _callbacks;
+};
+
+}  // namespace base
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "base/log.h"
+
+namespace base {
+
+/**
+ * @brief One row of a constexpr enum table, maps an enum to its rpc value and printable name.
+ */
+template <typename Enum, typename RpcEnum>
+struct EnumEntry {
+    Enum value;
+    RpcEnum rpc_value;
+    std::string_view name;
+};
+
+/**
+ * @brief Translate to the rpc value, unknown values log and map to the first row.
+ *
+ * Tables are emitted in declaration order, so the enum value is tried as index first.
+ */
+template <typename Enum, typename RpcEnum, std::size_t N>
+constexpr RpcEnum enum_to_rpc(const EnumEntry<Enum, RpcEnum> (&table)[N], Enum value) {
+    auto index = static_cast<std::size_t>(value);
+    if (index < N && table[index].value == value) {
+        return table[index].rpc_value;
+    }
+    for (const auto &entry : table) {
+        if (entry.value == value) {
+            return entry.rpc_value;
+        }
+    }
+    LogError() << "Unknown enum value: " << static_cast<int>(value);
+    return table[0].rpc_value;
+}
+
+/**
+ * @brief Translate from the rpc value, unknown values log and map to the first row.
+ */
+template <typename Enum, typename RpcEnum, std::size_t N>
+constexpr Enum enum_from_rpc(const EnumEntry<Enum, RpcEnum> (&table)[N], RpcEnum rpc_value) {
+    auto index = static_cast<std::size_t>(rpc_value);
+    if (index < N && table[index].rpc_value == rpc_value) {
+        return table[index].value;
+    }
+    for (const auto &entry : table) {
+        if (entry.rpc_value == rpc_value) {
+            return entry.value;
+        }
+    }
+    LogError() << "Unknown rpc enum value: " << static_cast<int>(rpc_value);
+    return table[0].value;
+}
+
+/**
+ * @brief Printable name of the value, "Unknown" if it is not in the table.
+ */
+template <typename Enum, typename RpcEnum, std::size_t N>
+constexpr std::string_view enum_name(const EnumEntry<Enum, RpcEnum> (&table)[N], Enum value) {
+    auto index = static_cast<std::size_t>(value);
+    if (index < N && table[index].value == value) {
+        return table[index].name;
+    }
+    for (const auto &entry : table) {
+        if (entry.value == value) {
+            return entry.name;
+        }
+    }
+    return "Unknown";
+}
+
+}  // namespace base
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace base {
+
+/**
+ * @brief Lock-free log-linear histogram in the spirit of HdrHistogram.
+ *
+ * Values below kSubBucketCount are counted exactly, every power of two above is split into
+ * kSubBucketCount linear buckets so a reported value is at most 1/16 above the recorded one.
+ * Values from 2^kMaxBits on land in the last bucket.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t kSubBucketBits = 4;
+    static constexpr uint32_t kSubBucketCount = 1u << kSubBucketBits;
+    // about 19 hours when recording microseconds
+    static constexpr uint32_t kMaxBits = 36;
+    static constexpr size_t kBucketCount = (kMaxBits - kSubBucketBits + 1) * kSubBucketCount;
+
+    void record(uint64_t value) {
+        _buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Highest value of the bucket holding the given quantile, 0 if nothing was recorded.
+     */
+    uint64_t value_at_quantile(double quantile) const {
+        std::array<uint64_t, kBucketCount> counts;
+        uint64_t total = 0;
+        for (size_t index = 0; index < kBucketCount; index++) {
+            counts[index] = _buckets[index].load(std::memory_order_relaxed);
+            total += counts[index];
+        }
+        if (total == 0) {
+            return 0;
+        }
+        if (quantile < 0.0) {
+            quantile = 0.0;
+        } else if (quantile > 1.0) {
+            quantile = 1.0;
+        }
+        auto rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(total)));
+        if (rank == 0) {
+            rank = 1;
+        }
+        uint64_t seen = 0;
+        for (size_t index = 0; index < kBucketCount; index++) {
+            seen += counts[index];
+            if (seen >= rank) {
+                return bucket_upper_bound(index);
+            }
+        }
+        return bucket_upper_bound(kBucketCount - 1);
+    }
+
+    static size_t bucket_index(uint64_t value) {
+        if (value < kSubBucketCount) {
+            return static_cast<size_t>(value);
+        }
+        const auto msb = static_cast<uint32_t>(63 - __builtin_clzll(value));
+        if (msb >= kMaxBits) {
+            return kBucketCount - 1;
+        }
+        const auto shift = msb - kSubBucketBits;
+        return (shift + 1) * kSubBucketCount +
+               static_cast<size_t>((value >> shift) & (kSubBucketCount - 1));
+    }
+
+    static uint64_t bucket_upper_bound(size_t index) {
+        if (index < kSubBucketCount) {
+            return index;
+        }
+        const auto shift = static_cast<uint32_t>(index / kSubBucketCount - 1);
+        const uint64_t lower = (kSubBucketCount + index % kSubBucketCount) << shift;
+        return lower + (uint64_t{1} << shift) - 1;
+    }
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> _buckets{};
+};
+
+}  // namespace base
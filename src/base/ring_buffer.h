@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace base {
+
+/**
+ * @brief Fixed capacity FIFO over storage allocated once at construction.
+ *
+ * push() refuses a value instead of growing when the ring is full, so a producer never
+ * allocates on the hot path. Not thread safe, the owner guards it with its own mutex.
+ */
+template <typename T>
+class RingBuffer final {
+public:
+    explicit RingBuffer(std::size_t capacity) : _slots(capacity > 0 ? capacity : 1) {}
+
+    /**
+     * @brief Append the value, returns false and leaves the ring unchanged if it is full.
+     */
+    bool push(T value) {
+        if (full()) {
+            return false;
+        }
+        _slots[(_head + _size) % _slots.size()] = std::move(value);
+        ++_size;
+        return true;
+    }
+
+    /**
+     * @brief Oldest value, the ring must not be empty.
+     */
+    T &front() { return _slots[_head]; }
+
+    /**
+     * @brief Drop the oldest value, the ring must not be empty.
+     */
+    void pop() {
+        _slots[_head] = T();
+        _head = (_head + 1) % _slots.size();
+        --_size;
+    }
+
+    std::size_t size() const { return _size; }
+    std::size_t capacity() const { return _slots.size(); }
+    bool empty() const { return _size == 0; }
+    bool full() const { return _size == _slots.size(); }
+private:
+    std::vector<T> _slots;
+    std::size_t _head{0};
+    std::size_t _size{0};
+};
+
+}  // namespace base
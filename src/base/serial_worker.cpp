@@ -0,0 +1,53 @@
+#include "serial_worker.h"
+
+#include <utility>
+
+namespace base {
+
+SerialWorker::SerialWorker() : _thread(&SerialWorker::run, this) {}
+
+SerialWorker::~SerialWorker() {
+    stop();
+}
+
+bool SerialWorker::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stopping) {
+            return false;
+        }
+        _tasks.push_back(std::move(task));
+    }
+    _condition.notify_one();
+    return true;
+}
+
+void SerialWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_one();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void SerialWorker::run() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty()) {
+                // stopping and drained
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
+
+}  // namespace base
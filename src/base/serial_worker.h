@@ -0,0 +1,39 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace base {
+
+/**
+ * @brief One thread running the posted tasks in order.
+ *
+ * The thread starts with the worker. stop() runs what is already queued and joins, tasks
+ * posted afterwards are refused so the caller can run them itself.
+ */
+class SerialWorker final {
+public:
+    SerialWorker();
+    ~SerialWorker();
+    SerialWorker(const SerialWorker &) = delete;
+    SerialWorker &operator=(const SerialWorker &) = delete;
+public:
+    /**
+     * @brief Queue a task, returns false once the worker is stopped.
+     */
+    bool post(std::function<void()> task);
+    void stop();
+private:
+    void run();
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::function<void()>> _tasks;
+    bool _stopping{false};
+    std::thread _thread;
+};
+
+}  // namespace base
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace base {
+
+/**
+ * @brief Key returned by SlotRegistry::add, a stale key never matches a reused slot.
+ */
+struct SlotKey {
+    uint32_t index{0};
+    uint32_t generation{0};
+
+    bool valid() const { return generation != 0; }
+};
+
+/**
+ * @brief Thread-safe registry with constant time add and remove.
+ *
+ * Removed slots are recycled through a free list, the generation counter of a slot is bumped
+ * on every removal so an old key cannot remove the new occupant. Once closed, add() refuses
+ * new entries so nothing registered after close() is missed.
+ */
+template <typename T>
+class SlotRegistry {
+public:
+    /**
+     * @brief Store the value, returns an invalid key if the registry is closed.
+     */
+    SlotKey add(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_closed) {
+            return SlotKey{};
+        }
+        uint32_t index;
+        if (!_free.empty()) {
+            index = _free.back();
+            _free.pop_back();
+        } else {
+            index = static_cast<uint32_t>(_slots.size());
+            _slots.emplace_back();
+        }
+        auto &slot = _slots[index];
+        slot.value = std::move(value);
+        slot.used = true;
+        return SlotKey{index, slot.generation};
+    }
+
+    /**
+     * @brief Drop the entry, returns false if it was already removed or taken by close().
+     */
+    bool remove(SlotKey key) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!key.valid() || key.index >= _slots.size()) {
+            return false;
+        }
+        auto &slot = _slots[key.index];
+        if (!slot.used || slot.generation != key.generation) {
+            return false;
+        }
+        release(slot, key.index);
+        return true;
+    }
+
+    /**
+     * @brief Refuse further entries and hand back everything still registered.
+     */
+    std::vector<T> close() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        std::vector<T> values;
+        for (uint32_t index = 0; index < _slots.size(); index++) {
+            auto &slot = _slots[index];
+            if (slot.used) {
+                values.push_back(std::move(slot.value));
+                release(slot, index);
+            }
+        }
+        return values;
+    }
+
+    bool closed() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _closed;
+    }
+private:
+    struct Slot {
+        T value{};
+        uint32_t generation{1};
+        bool used{false};
+    };
+
+    // called with _mutex held
+    void release(Slot &slot, uint32_t index) {
+        slot.value = T{};
+        slot.used = false;
+        // skip 0, it marks an invalid key
+        if (++slot.generation == 0) {
+            slot.generation = 1;
+        }
+        _free.push_back(index);
+    }
+private:
+    mutable std::mutex _mutex;
+    bool _closed{false};
+    std::vector<Slot> _slots;
+    std::vector<uint32_t> _free;
+};
+
+}  // namespace base
@@ -0,0 +1,127 @@
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include "boson-sdk-interface.h"
+#include "simulation.h"
+
+namespace mavcam {
+namespace simulator {
+
+/**
+ * @brief State of the simulated Boson camera behind the C interface, shared by every
+ * boson_extension_api handed out like the single uart it stands for.
+ *
+ * Call behaviour is read with the MAVCAM_SIM_BOSON prefix, e.g.
+ * MAVCAM_SIM_BOSON_LATENCY_UART_INITIALIZE. A failing call returns -1.
+ */
+struct SimulatedBoson {
+    SimulatedBoson()
+        : simulation("MAVCAM_SIM_BOSON",
+                     {
+                         // handshake and serial queries at 921600 baud
+                         {"UART_INITIALIZE", "normal:1200:150"},
+                         {"GET_BOSON_CAMERA_SN", "normal:15:3"},
+                         {"GET_BOSON_CAMERA_PN", "normal:15:3"},
+                         {"GET_BOSON_COLOR_MODE", "normal:15:3"},
+                         {"SET_BOSON_COLOR_MODE", "normal:20:4"},
+                         {"PROCESS_BOSON_RUN_FFC", "normal:500:50"},
+                     }) {}
+
+    /**
+     * @brief 0 if the call goes ahead after its latency, -1 if it fails or the uart is closed
+     */
+    int enter(const char *call, bool needs_uart = true) {
+        std::string failure;
+        if (!simulation.enter(call, failure)) {
+            return -1;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return !needs_uart || uart_open ? 0 : -1;
+    }
+
+    Simulation simulation;
+    std::mutex mutex;
+    bool uart_open{false};
+    ColorMode color_mode{WHITEHOT};
+};
+
+static SimulatedBoson &boson() {
+    // released when the library is unloaded
+    static SimulatedBoson simulated_boson;
+    return simulated_boson;
+}
+
+static int uart_boson_initialize(int /*port*/, int /*baud*/) {
+    if (boson().enter("UART_INITIALIZE", false) != 0) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(boson().mutex);
+    boson().uart_open = true;
+    return 0;
+}
+
+static int uart_boson_close() {
+    std::lock_guard<std::mutex> lock(boson().mutex);
+    boson().uart_open = false;
+    return 0;
+}
+
+static int get_boson_camera_sn(uint32_t *camera_sn) {
+    if (boson().enter("GET_BOSON_CAMERA_SN") != 0) {
+        return -1;
+    }
+    *camera_sn = 123456;
+    return 0;
+}
+
+static int get_boson_camera_pn(BOSON_SENSOR_PARTNUMBER *part_number) {
+    if (boson().enter("GET_BOSON_CAMERA_PN") != 0) {
+        return -1;
+    }
+    memset(part_number, 0, sizeof(*part_number));
+    const char simulated_part_number[] = "SIM640";
+    memcpy(part_number->value, simulated_part_number, sizeof(simulated_part_number));
+    return 0;
+}
+
+static int get_boson_color_mode(ColorMode *color_mode) {
+    if (boson().enter("GET_BOSON_COLOR_MODE") != 0) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(boson().mutex);
+    *color_mode = boson().color_mode;
+    return 0;
+}
+
+static int set_boson_color_mode(ColorMode color_mode) {
+    if (boson().enter("SET_BOSON_COLOR_MODE") != 0) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(boson().mutex);
+    boson().color_mode = color_mode;
+    return 0;
+}
+
+static int process_boson_run_ffc() {
+    return boson().enter("PROCESS_BOSON_RUN_FFC");
+}
+
+}  // namespace simulator
+}  // namespace mavcam
+
+// released by the caller with free() like the vendor one
+extern "C" struct boson_extension_api *create_boson_extension_api() {
+    auto *api = static_cast<struct boson_extension_api *>(calloc(1, sizeof(boson_extension_api)));
+    if (api == nullptr) {
+        return nullptr;
+    }
+    api->uart_boson_initialize = mavcam::simulator::uart_boson_initialize;
+    api->uart_boson_close = mavcam::simulator::uart_boson_close;
+    api->get_boson_camera_sn = mavcam::simulator::get_boson_camera_sn;
+    api->get_boson_camera_pn = mavcam::simulator::get_boson_camera_pn;
+    api->get_boson_color_mode = mavcam::simulator::get_boson_color_mode;
+    api->set_boson_color_mode = mavcam::simulator::set_boson_color_mode;
+    api->process_boson_run_ffc = mavcam::simulator::process_boson_run_ffc;
+    return api;
+}
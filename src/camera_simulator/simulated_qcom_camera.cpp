@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "mav_camera.h"
+#include "simulation.h"
+
+namespace mavcam {
+namespace simulator {
+
+using mav_camera::Result;
+
+/**
+ * @brief Stand-in for the Qualcomm camera library, keeps what it is set to and reports a
+ * synthetic storage.
+ *
+ * Besides the MAVCAM_SIM call behaviour, the storage is set up with MAVCAM_SIM_STORAGE_TOTAL_MIB,
+ * MAVCAM_SIM_STORAGE_USED_MIB, MAVCAM_SIM_PHOTO_MIB, MAVCAM_SIM_VIDEO_MIB_PER_S and
+ * MAVCAM_SIM_STORAGE_REPORT_MS. Photos and recording fill it, format_storage empties it.
+ */
+class SimulatedQcomCamera final : public mav_camera::MavCamera {
+public:
+    SimulatedQcomCamera();
+    ~SimulatedQcomCamera() override;
+
+    Result open(mav_camera::Options options) override;
+    Result close() override;
+    void set_log_path(std::string path) override;
+    Result take_photo() override;
+    Result start_video() override;
+    Result stop_video() override;
+    Result set_mode(mav_camera::Mode mode) override;
+    Result format_storage(int32_t storage_id) override;
+    Result get_information(mav_camera::Information &information) override;
+    std::pair<Result, float> get_exposure_value() override;
+    Result set_exposure_value(float exposure_value) override;
+    std::pair<Result, int32_t> get_framerate() override;
+    Result set_framerate(int32_t framerate) override;
+    std::pair<Result, int32_t> get_iso() override;
+    Result set_iso(int32_t iso) override;
+    std::pair<Result, std::string> get_shutter_speed() override;
+    Result set_shutter_speed(std::string shutter_speed) override;
+    std::tuple<Result, int32_t, int32_t> get_preview_resolution() override;
+    std::tuple<Result, int32_t, int32_t> get_video_resolution() override;
+    Result set_video_resolution(int32_t width, int32_t height) override;
+    Result set_snapshot_resolution(int32_t width, int32_t height) override;
+    std::pair<Result, mav_camera::PreivewStreamOutputType> get_preview_stream_output_type()
+        override;
+    Result set_preview_stream_output_type(mav_camera::PreivewStreamOutputType output_type)
+        override;
+    std::pair<Result, int32_t> get_white_balance() override;
+    Result set_white_balance(int32_t white_balance) override;
+    Result set_timestamp(int64_t timestamp) override;
+    void subscribe_storage_information(
+        std::function<void(Result, mav_camera::StorageInformation)> callback) override;
+private:
+    /**
+     * @brief run the call behaviour, Success or the injected failure
+     */
+    Result enter(const std::string &call);
+    /**
+     * @brief add the video recorded since the last call to the used storage, caller holds
+     * _mutex
+     */
+    void account_recording();
+    mav_camera::StorageInformation storage_information();
+    void run_storage_reports();
+    void stop_storage_reports();
+
+    Simulation _simulation;
+    std::mutex _mutex;
+    mav_camera::Options _options{};
+    bool _opened{false};
+    mav_camera::Mode _mode{mav_camera::Mode::Photo};
+    bool _recording{false};
+    std::chrono::steady_clock::time_point _recording_accounted;
+    float _exposure_value{0};
+    int32_t _framerate{30};
+    int32_t _iso{100};
+    std::string _shutter_speed{"1/100"};
+    int32_t _video_width{3840};
+    int32_t _video_height{2160};
+    mav_camera::PreivewStreamOutputType _output_type{
+        mav_camera::PreivewStreamOutputType::RGBStreamOnly};
+    int32_t _white_balance{mav_camera::kAutoWhitebalanceValue};
+    // synthetic storage
+    double _total_mib;
+    double _used_mib;
+    double _photo_mib;
+    double _video_mib_per_s;
+    std::chrono::milliseconds _report_interval;
+    std::function<void(Result, mav_camera::StorageInformation)> _storage_callback;
+    std::thread _storage_thread;
+    std::condition_variable _storage_cv;
+    bool _storage_changed{false};
+    bool _storage_thread_stop{false};
+};
+
+// roughly what the hardware takes, MAVCAM_SIM_LATENCY_<CALL> overrides them
+static Simulation::Defaults default_latencies() {
+    return {
+        {"OPEN", "normal:900:100"},        {"CLOSE", "normal:300:50"},
+        {"TAKE_PHOTO", "normal:250:30"},   {"START_VIDEO", "normal:120:20"},
+        {"STOP_VIDEO", "normal:150:20"},   {"SET_MODE", "normal:400:50"},
+        {"FORMAT_STORAGE", "fixed:2000"},  {"SET_VIDEO_RESOLUTION", "normal:300:40"},
+        {"SET_SNAPSHOT_RESOLUTION", "normal:200:30"},
+    };
+}
+
+static Result failure_result(const std::string &name) {
+    if (name == "timeout") {
+        return Result::Timeout;
+    } else if (name == "busy") {
+        return Result::Busy;
+    } else if (name == "denied") {
+        return Result::Denied;
+    } else if (name == "no_system") {
+        return Result::NoSystem;
+    } else if (name == "wrong_argument") {
+        return Result::WrongArgument;
+    }
+    return Result::Error;
+}
+
+SimulatedQcomCamera::SimulatedQcomCamera() : _simulation("MAVCAM_SIM", default_latencies()) {
+    _total_mib = _simulation.number("STORAGE_TOTAL_MIB", 60 * 1024);
+    _used_mib = std::min(_total_mib, _simulation.number("STORAGE_USED_MIB", 0));
+    _photo_mib = _simulation.number("PHOTO_MIB", 6);
+    _video_mib_per_s = _simulation.number("VIDEO_MIB_PER_S", 12);
+    _report_interval = std::chrono::milliseconds(
+        static_cast<int64_t>(_simulation.number("STORAGE_REPORT_MS", 1000)));
+}
+
+SimulatedQcomCamera::~SimulatedQcomCamera() {
+    stop_storage_reports();
+}
+
+Result SimulatedQcomCamera::enter(const std::string &call) {
+    std::string failure;
+    if (!_simulation.enter(call, failure)) {
+        return failure_result(failure);
+    }
+    return Result::Success;
+}
+
+Result SimulatedQcomCamera::open(mav_camera::Options options) {
+    auto result = enter("OPEN");
+    if (result != Result::Success) {
+        return result;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    _options = options;
+    _mode = options.init_mode;
+    _video_width = options.video_width;
+    _video_height = options.video_height;
+    _framerate = options.framerate;
+    _opened = true;
+    return Result::Success;
+}
+
+Result SimulatedQcomCamera::close() {
+    auto result = enter("CLOSE");
+    stop_storage_reports();
+    std::lock_guard<std::mutex> lock(_mutex);
+    account_recording();
+    _recording = false;
+    _opened = false;
+    return result;
+}
+
+void SimulatedQcomCamera::set_log_path(std::string /*path*/) {}
+
+Result SimulatedQcomCamera::take_photo() {
+    auto result = enter("TAKE_PHOTO");
+    if (result != Result::Success) {
+        return result;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_opened) {
+            return Result::NoSystem;
+        }
+        account_recording();
+        if (_used_mib + _photo_mib > _total_mib) {
+            return Result::Denied;
+        }
+        _used_mib += _photo_mib;
+        _storage_changed = true;
+    }
+    _storage_cv.notify_one();
+    return Result::Success;
+}
+
+Result SimulatedQcomCamera::start_video() {
+    auto result = enter("START_VIDEO");
+    if (result != Result::Success) {
+        return result;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_recording) {
+        return Result::InProgress;
+    }
+    _recording = true;
+    _recording_accounted = std::chrono::steady_clock::now();
+    return Result::Success;
+}
+
+Result SimulatedQcomCamera::stop_video() {
+    auto result = enter("STOP_VIDEO");
+    if (result != Result::Success) {
+        return result;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        account_recording();
+        _recording = false;
+        _storage_changed = true;
+    }
+    _storage_cv.notify_one();
+    return Result::Success;
+}
+
+Result SimulatedQcomCamera::set_mode(mav_camera::Mode mode) {
+    auto result = enter("SET_MODE");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _mode = mode;
+    }
+    return result;
+}
+
+Result SimulatedQcomCamera::format_storage(int32_t /*storage_id*/) {
+    auto result = enter("FORMAT_STORAGE");
+    if (result != Result::Success) {
+        return result;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _used_mib = 0;
+        _recording_accounted = std::chrono::steady_clock::now();
+        _storage_changed = true;
+    }
+    _storage_cv.notify_one();
+    return Result::Success;
+}
+
+Result SimulatedQcomCamera::get_information(mav_camera::Information &information) {
+    auto result = enter("GET_INFORMATION");
+    if (result == Result::Success) {
+        information.focal_length_mm = 4.5f;
+        information.horizontal_sensor_size_mm = 9.6f;
+        information.vertical_sensor_size_mm = 7.2f;
+        information.horizontal_resolution_px = 9248;
+        information.vertical_resolution_px = 6944;
+        information.lens_id = 0;
+    }
+    return result;
+}
+
+std::pair<Result, float> SimulatedQcomCamera::get_exposure_value() {
+    auto result = enter("GET_EXPOSURE_VALUE");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _exposure_value};
+}
+
+Result SimulatedQcomCamera::set_exposure_value(float exposure_value) {
+    auto result = enter("SET_EXPOSURE_VALUE");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _exposure_value = exposure_value;
+    }
+    return result;
+}
+
+std::pair<Result, int32_t> SimulatedQcomCamera::get_framerate() {
+    auto result = enter("GET_FRAMERATE");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _framerate};
+}
+
+Result SimulatedQcomCamera::set_framerate(int32_t framerate) {
+    auto result = enter("SET_FRAMERATE");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _framerate = framerate;
+    }
+    return result;
+}
+
+std::pair<Result, int32_t> SimulatedQcomCamera::get_iso() {
+    auto result = enter("GET_ISO");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _iso};
+}
+
+Result SimulatedQcomCamera::set_iso(int32_t iso) {
+    auto result = enter("SET_ISO");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _iso = iso;
+    }
+    return result;
+}
+
+std::pair<Result, std::string> SimulatedQcomCamera::get_shutter_speed() {
+    auto result = enter("GET_SHUTTER_SPEED");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _shutter_speed};
+}
+
+Result SimulatedQcomCamera::set_shutter_speed(std::string shutter_speed) {
+    auto result = enter("SET_SHUTTER_SPEED");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutter_speed = shutter_speed;
+    }
+    return result;
+}
+
+std::tuple<Result, int32_t, int32_t> SimulatedQcomCamera::get_preview_resolution() {
+    auto result = enter("GET_PREVIEW_RESOLUTION");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _options.preview_width, _options.preview_height};
+}
+
+std::tuple<Result, int32_t, int32_t> SimulatedQcomCamera::get_video_resolution() {
+    auto result = enter("GET_VIDEO_RESOLUTION");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _video_width, _video_height};
+}
+
+Result SimulatedQcomCamera::set_video_resolution(int32_t width, int32_t height) {
+    auto result = enter("SET_VIDEO_RESOLUTION");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _video_width = width;
+        _video_height = height;
+    }
+    return result;
+}
+
+Result SimulatedQcomCamera::set_snapshot_resolution(int32_t width, int32_t height) {
+    auto result = enter("SET_SNAPSHOT_RESOLUTION");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _options.snapshot_width = width;
+        _options.snapshot_height = height;
+    }
+    return result;
+}
+
+std::pair<Result, mav_camera::PreivewStreamOutputType>
+SimulatedQcomCamera::get_preview_stream_output_type() {
+    auto result = enter("GET_PREVIEW_STREAM_OUTPUT_TYPE");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _output_type};
+}
+
+Result SimulatedQcomCamera::set_preview_stream_output_type(
+    mav_camera::PreivewStreamOutputType output_type) {
+    auto result = enter("SET_PREVIEW_STREAM_OUTPUT_TYPE");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _output_type = output_type;
+    }
+    return result;
+}
+
+std::pair<Result, int32_t> SimulatedQcomCamera::get_white_balance() {
+    auto result = enter("GET_WHITE_BALANCE");
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {result, _white_balance};
+}
+
+Result SimulatedQcomCamera::set_white_balance(int32_t white_balance) {
+    auto result = enter("SET_WHITE_BALANCE");
+    if (result == Result::Success) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _white_balance = white_balance;
+    }
+    return result;
+}
+
+Result SimulatedQcomCamera::set_timestamp(int64_t /*timestamp*/) {
+    return enter("SET_TIMESTAMP");
+}
+
+void SimulatedQcomCamera::subscribe_storage_information(
+    std::function<void(Result, mav_camera::StorageInformation)> callback) {
+    stop_storage_reports();
+    _storage_callback = std::move(callback);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _storage_thread_stop = false;
+        _storage_changed = true;
+    }
+    _storage_thread = std::thread(&SimulatedQcomCamera::run_storage_reports, this);
+}
+
+void SimulatedQcomCamera::account_recording() {
+    if (!_recording) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed_s = std::chrono::duration<double>(now - _recording_accounted).count();
+    _used_mib = std::min(_total_mib, _used_mib + elapsed_s * _video_mib_per_s);
+    _recording_accounted = now;
+}
+
+mav_camera::StorageInformation SimulatedQcomCamera::storage_information() {
+    mav_camera::StorageInformation information;
+    information.used_storage_mib = static_cast<float>(_used_mib);
+    information.available_storage_mib = static_cast<float>(_total_mib - _used_mib);
+    information.total_storage_mib = static_cast<float>(_total_mib);
+    information.storage_status = mav_camera::StorageInformation::StorageStatus::Formatted;
+    information.storage_id = 1;
+    information.storage_type = mav_camera::StorageType::Microsd;
+    return information;
+}
+
+void SimulatedQcomCamera::run_storage_reports() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_storage_thread_stop) {
+        // a report on every change and every interval while recording or idle
+        _storage_cv.wait_for(lock, _report_interval,
+                             [this]() { return _storage_thread_stop || _storage_changed; });
+        if (_storage_thread_stop) {
+            break;
+        }
+        _storage_changed = false;
+        account_recording();
+        auto information = storage_information();
+        lock.unlock();
+        _storage_callback(Result::Success, information);
+        lock.lock();
+    }
+}
+
+void SimulatedQcomCamera::stop_storage_reports() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _storage_thread_stop = true;
+    }
+    _storage_cv.notify_all();
+    if (_storage_thread.joinable()) {
+        _storage_thread.join();
+    }
+}
+
+}  // namespace simulator
+}  // namespace mavcam
+
+extern "C" mav_camera::MavCamera *create_qcom_camera() {
+    return new mavcam::simulator::SimulatedQcomCamera();
+}
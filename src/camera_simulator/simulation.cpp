@@ -0,0 +1,174 @@
+#include "simulation.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace mavcam {
+namespace simulator {
+
+static std::vector<std::string> split(const std::string &text, char separator) {
+    std::vector<std::string> fields;
+    std::stringstream stream(text);
+    std::string field;
+    while (std::getline(stream, field, separator)) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+static bool parse_number(const std::string &text, double &number) {
+    if (text.empty()) {
+        return false;
+    }
+    char *end = nullptr;
+    number = std::strtod(text.c_str(), &end);
+    return *end == '\0' && number >= 0;
+}
+
+bool Latency::parse(const std::string &text, Latency &latency) {
+    auto fields = split(text, ':');
+    if (fields.empty()) {
+        return false;
+    }
+    Latency parsed;
+    std::size_t expected_fields = 2;
+    if (fields[0] == "fixed") {
+        parsed._kind = Kind::Fixed;
+    } else if (fields[0] == "uniform") {
+        parsed._kind = Kind::Uniform;
+        expected_fields = 3;
+    } else if (fields[0] == "normal") {
+        parsed._kind = Kind::Normal;
+        expected_fields = 3;
+    } else if (fields[0] == "exp") {
+        parsed._kind = Kind::Exponential;
+    } else {
+        return false;
+    }
+    if (fields.size() != expected_fields || !parse_number(fields[1], parsed._first_ms) ||
+        (expected_fields == 3 && !parse_number(fields[2], parsed._second_ms))) {
+        return false;
+    }
+    if (parsed._kind == Kind::Uniform && parsed._second_ms < parsed._first_ms) {
+        return false;
+    }
+    latency = parsed;
+    return true;
+}
+
+std::chrono::microseconds Latency::sample(std::mt19937_64 &generator) const {
+    double latency_ms = _first_ms;
+    switch (_kind) {
+        case Kind::Fixed:
+            break;
+        case Kind::Uniform:
+            latency_ms = std::uniform_real_distribution<double>(_first_ms, _second_ms)(generator);
+            break;
+        case Kind::Normal:
+            if (_second_ms > 0) {
+                latency_ms = std::normal_distribution<double>(_first_ms, _second_ms)(generator);
+            }
+            break;
+        case Kind::Exponential:
+            if (_first_ms > 0) {
+                latency_ms = std::exponential_distribution<double>(1 / _first_ms)(generator);
+            }
+            break;
+    }
+    return std::chrono::microseconds(static_cast<int64_t>(std::max(0.0, latency_ms) * 1000));
+}
+
+Simulation::Simulation(std::string prefix, Defaults default_latencies)
+    : _prefix(std::move(prefix)), _default_latencies(std::move(default_latencies)) {
+    auto seed = variable("SEED");
+    if (seed.empty()) {
+        _generator.seed(std::random_device()());
+    } else {
+        _generator.seed(std::strtoull(seed.c_str(), nullptr, 10));
+    }
+}
+
+bool Simulation::enter(const std::string &call, std::string &failure_result) {
+    std::chrono::microseconds latency;
+    bool fail = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto &call_behaviour = behaviour(call);
+        latency = call_behaviour.latency.sample(_generator);
+        if (call_behaviour.failure.probability > 0 &&
+            std::uniform_real_distribution<double>(0, 1)(_generator) <
+                call_behaviour.failure.probability) {
+            fail = true;
+            failure_result = call_behaviour.failure.result;
+        }
+    }
+    if (latency.count() > 0) {
+        std::this_thread::sleep_for(latency);
+    }
+    return !fail;
+}
+
+double Simulation::number(const std::string &name, double fallback) const {
+    auto text = variable(name);
+    double value = 0;
+    if (text.empty()) {
+        return fallback;
+    }
+    if (!parse_number(text, value)) {
+        std::cerr << "Ignore invalid " << _prefix << "_" << name << " " << text << std::endl;
+        return fallback;
+    }
+    return value;
+}
+
+const Simulation::CallBehaviour &Simulation::behaviour(const std::string &call) {
+    auto it = _behaviours.find(call);
+    if (it != _behaviours.end()) {
+        return it->second;
+    }
+    CallBehaviour call_behaviour;
+    std::string latency_text = variable("LATENCY_" + call);
+    if (latency_text.empty()) {
+        latency_text = variable("LATENCY");
+    }
+    if (latency_text.empty()) {
+        auto default_latency = std::find_if(
+            _default_latencies.begin(), _default_latencies.end(),
+            [&call](const std::pair<std::string, std::string> &entry) {
+                return entry.first == call;
+            });
+        if (default_latency != _default_latencies.end()) {
+            latency_text = default_latency->second;
+        }
+    }
+    if (!latency_text.empty() && !Latency::parse(latency_text, call_behaviour.latency)) {
+        std::cerr << "Ignore invalid latency " << latency_text << " of " << call << std::endl;
+    }
+
+    std::string failure_text = variable("FAILURE_" + call);
+    if (failure_text.empty()) {
+        failure_text = variable("FAILURE");
+    }
+    if (!failure_text.empty()) {
+        auto fields = split(failure_text, ':');
+        double probability = 0;
+        if (fields.size() > 2 || !parse_number(fields[0], probability) || probability > 1) {
+            std::cerr << "Ignore invalid failure " << failure_text << " of " << call << std::endl;
+        } else {
+            call_behaviour.failure.probability = probability;
+            call_behaviour.failure.result = fields.size() == 2 ? fields[1] : "error";
+        }
+    }
+    return _behaviours.emplace(call, call_behaviour).first->second;
+}
+
+std::string Simulation::variable(const std::string &name) const {
+    const char *value = getenv((_prefix + "_" + name).c_str());
+    return value == nullptr ? std::string() : std::string(value);
+}
+
+}  // namespace simulator
+}  // namespace mavcam
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mavcam {
+namespace simulator {
+
+/**
+ * @brief Latency of one simulated vendor call, drawn again on every call.
+ *
+ * Written as fixed:MS, uniform:MIN_MS:MAX_MS, normal:MEAN_MS:STDDEV_MS or exp:MEAN_MS.
+ */
+class Latency final {
+public:
+    /**
+     * @brief read the text form, false if it is malformed
+     */
+    static bool parse(const std::string &text, Latency &latency);
+    std::chrono::microseconds sample(std::mt19937_64 &generator) const;
+private:
+    enum class Kind { Fixed, Uniform, Normal, Exponential };
+    Kind _kind{Kind::Fixed};
+    double _first_ms{0};
+    double _second_ms{0};
+};
+
+/**
+ * @brief How one simulated call fails.
+ */
+struct Failure {
+    // chance of a call failing, 0 never and 1 always
+    double probability{0};
+    // what the call answers when it fails, e.g. timeout, the library maps it to its result
+    std::string result;
+};
+
+/**
+ * @brief Latency and failure injection of the calls of one simulated library, read from the
+ * environment the first time a call is made.
+ *
+ * For a library with prefix MAVCAM_SIM and a call TAKE_PHOTO:
+ *  - MAVCAM_SIM_LATENCY_TAKE_PHOTO, else MAVCAM_SIM_LATENCY, else the library default
+ *  - MAVCAM_SIM_FAILURE_TAKE_PHOTO, else MAVCAM_SIM_FAILURE, as PROBABILITY[:RESULT]
+ *  - MAVCAM_SIM_SEED seeds the draws so a run can be repeated
+ *
+ * Thread safe.
+ */
+class Simulation final {
+public:
+    using Defaults = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @brief default_latencies maps call names to the latency used without an environment
+     * override, calls missing there answer at once
+     */
+    Simulation(std::string prefix, Defaults default_latencies);
+    Simulation(const Simulation &) = delete;
+    Simulation &operator=(const Simulation &) = delete;
+
+    /**
+     * @brief sleep for the latency of the call, false with the failure result set if it is
+     * to fail
+     */
+    bool enter(const std::string &call, std::string &failure_result);
+    /**
+     * @brief a number from the environment, fallback if it is unset or malformed
+     */
+    double number(const std::string &name, double fallback) const;
+private:
+    struct CallBehaviour {
+        Latency latency;
+        Failure failure;
+    };
+
+    const CallBehaviour &behaviour(const std::string &call);
+    std::string variable(const std::string &name) const;
+
+    const std::string _prefix;
+    const Defaults _default_latencies;
+    std::mutex _mutex;
+    std::mt19937_64 _generator;
+    std::unordered_map<std::string, CallBehaviour> _behaviours;
+};
+
+}  // namespace simulator
+}  // namespace mavcam
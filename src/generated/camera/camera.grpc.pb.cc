@@ -47,6 +47,9 @@ static const char* CameraService_method_names[] = {
   "/mavcam.rpc.camera.CameraService/SelectCamera",
   "/mavcam.rpc.camera.CameraService/ResetSettings",
   "/mavcam.rpc.camera.CameraService/SetTimestamp",
+  "/mavcam.rpc.camera.CameraService/SetSettings",
+  "/mavcam.rpc.camera.CameraService/GetMetrics",
+  "/mavcam.rpc.camera.CameraService/StartBurst",
 };
 
 std::unique_ptr< CameraService::Stub> CameraService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -79,6 +82,9 @@ CameraService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_SelectCamera_(CameraService_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ResetSettings_(CameraService_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SetTimestamp_(CameraService_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetSettings_(CameraService_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetMetrics_(CameraService_method_names[24], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StartBurst_(CameraService_method_names[25], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status CameraService::Stub::Prepare(::grpc::ClientContext* context, const ::mavcam::rpc::camera::PrepareRequest& request, ::mavcam::rpc::camera::PrepareResponse* response) {
@@ -561,6 +567,75 @@ void CameraService::Stub::async::SetTimestamp(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::Status CameraService::Stub::SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::mavcam::rpc::camera::SetSettingsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetSettings_, context, request, response);
+}
+
+void CameraService::Stub::async::SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetSettings_, context, request, response, std::move(f));
+}
+
+void CameraService::Stub::async::SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetSettings_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>* CameraService::Stub::PrepareAsyncSetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavcam::rpc::camera::SetSettingsResponse, ::mavcam::rpc::camera::SetSettingsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetSettings_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>* CameraService::Stub::AsyncSetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetSettingsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CameraService::Stub::GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::mavcam::rpc::camera::GetMetricsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetMetrics_, context, request, response);
+}
+
+void CameraService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, std::move(f));
+}
+
+void CameraService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>* CameraService::Stub::PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavcam::rpc::camera::GetMetricsResponse, ::mavcam::rpc::camera::GetMetricsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetMetrics_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>* CameraService::Stub::AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetMetricsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status CameraService::Stub::StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::mavcam::rpc::camera::StartBurstResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_StartBurst_, context, request, response);
+}
+
+void CameraService::Stub::async::StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StartBurst_, context, request, response, std::move(f));
+}
+
+void CameraService::Stub::async::StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StartBurst_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>* CameraService::Stub::PrepareAsyncStartBurstRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavcam::rpc::camera::StartBurstResponse, ::mavcam::rpc::camera::StartBurstRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_StartBurst_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>* CameraService::Stub::AsyncStartBurstRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStartBurstRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 CameraService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       CameraService_method_names[0],
@@ -792,6 +867,36 @@ CameraService::Service::Service() {
              ::mavcam::rpc::camera::SetTimestampResponse* resp) {
                return service->SetTimestamp(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CameraService_method_names[23],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CameraService::Service, ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CameraService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavcam::rpc::camera::SetSettingsRequest* req,
+             ::mavcam::rpc::camera::SetSettingsResponse* resp) {
+               return service->SetSettings(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CameraService_method_names[24],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CameraService::Service, ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CameraService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavcam::rpc::camera::GetMetricsRequest* req,
+             ::mavcam::rpc::camera::GetMetricsResponse* resp) {
+               return service->GetMetrics(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      CameraService_method_names[25],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< CameraService::Service, ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](CameraService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavcam::rpc::camera::StartBurstRequest* req,
+             ::mavcam::rpc::camera::StartBurstResponse* resp) {
+               return service->StartBurst(ctx, req, resp);
+             }, this)));
 }
 
 CameraService::Service::~Service() {
@@ -958,6 +1063,27 @@ CameraService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status CameraService::Service::SetSettings(::grpc::ServerContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CameraService::Service::GetMetrics(::grpc::ServerContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status CameraService::Service::StartBurst(::grpc::ServerContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace mavcam
 }  // namespace rpc
@@ -276,6 +276,34 @@ class CameraService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetTimestampResponse>> PrepareAsyncSetTimestamp(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetTimestampResponse>>(PrepareAsyncSetTimestampRaw(context, request, cq));
     }
+    //
+    // Apply several settings at once, dependent settings are applied first.
+    //
+    // Only setting_id of setting and option_id of option needs to be set.
+    virtual ::grpc::Status SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::mavcam::rpc::camera::SetSettingsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetSettingsResponse>> AsyncSetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetSettingsResponse>>(AsyncSetSettingsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetSettingsResponse>> PrepareAsyncSetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetSettingsResponse>>(PrepareAsyncSetSettingsRaw(context, request, cq));
+    }
+    // Per method call counts and latency percentiles recorded by the server.
+    virtual ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::mavcam::rpc::camera::GetMetricsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::GetMetricsResponse>> AsyncGetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::GetMetricsResponse>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::GetMetricsResponse>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::GetMetricsResponse>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
+    // Take count photos from one request, interval_s apart or as fast as the sensor
+    // allows with 0. Each photo is reported through SubscribeCaptureInfo.
+    virtual ::grpc::Status StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::mavcam::rpc::camera::StartBurstResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::StartBurstResponse>> AsyncStartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::StartBurstResponse>>(AsyncStartBurstRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::StartBurstResponse>> PrepareAsyncStartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::StartBurstResponse>>(PrepareAsyncStartBurstRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -374,6 +402,19 @@ class CameraService final {
       // Set camera timestamp.
       virtual void SetTimestamp(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest* request, ::mavcam::rpc::camera::SetTimestampResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SetTimestamp(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest* request, ::mavcam::rpc::camera::SetTimestampResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Apply several settings at once, dependent settings are applied first.
+      //
+      // Only setting_id of setting and option_id of option needs to be set.
+      virtual void SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Per method call counts and latency percentiles recorded by the server.
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Take count photos from one request, interval_s apart or as fast as the sensor
+      // allows with 0. Each photo is reported through SubscribeCaptureInfo.
+      virtual void StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -432,6 +473,12 @@ class CameraService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::ResetSettingsResponse>* PrepareAsyncResetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::ResetSettingsRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetTimestampResponse>* AsyncSetTimestampRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetTimestampResponse>* PrepareAsyncSetTimestampRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetSettingsResponse>* AsyncSetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::SetSettingsResponse>* PrepareAsyncSetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::GetMetricsResponse>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::GetMetricsResponse>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::StartBurstResponse>* AsyncStartBurstRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavcam::rpc::camera::StartBurstResponse>* PrepareAsyncStartBurstRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -611,6 +658,27 @@ class CameraService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetTimestampResponse>> PrepareAsyncSetTimestamp(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetTimestampResponse>>(PrepareAsyncSetTimestampRaw(context, request, cq));
     }
+    ::grpc::Status SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::mavcam::rpc::camera::SetSettingsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>> AsyncSetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>>(AsyncSetSettingsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>> PrepareAsyncSetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>>(PrepareAsyncSetSettingsRaw(context, request, cq));
+    }
+    ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::mavcam::rpc::camera::GetMetricsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>> AsyncGetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
+    ::grpc::Status StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::mavcam::rpc::camera::StartBurstResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>> AsyncStartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>>(AsyncStartBurstRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>> PrepareAsyncStartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>>(PrepareAsyncStartBurstRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -653,6 +721,12 @@ class CameraService final {
       void ResetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::ResetSettingsRequest* request, ::mavcam::rpc::camera::ResetSettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetTimestamp(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest* request, ::mavcam::rpc::camera::SetTimestampResponse* response, std::function<void(::grpc::Status)>) override;
       void SetTimestamp(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest* request, ::mavcam::rpc::camera::SetTimestampResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetSettings(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response, std::function<void(::grpc::Status)>) override;
+      void StartBurst(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -717,6 +791,12 @@ class CameraService final {
     ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::ResetSettingsResponse>* PrepareAsyncResetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::ResetSettingsRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetTimestampResponse>* AsyncSetTimestampRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetTimestampResponse>* PrepareAsyncSetTimestampRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetTimestampRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>* AsyncSetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::SetSettingsResponse>* PrepareAsyncSetSettingsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::SetSettingsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::GetMetricsResponse>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>* AsyncStartBurstRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavcam::rpc::camera::StartBurstResponse>* PrepareAsyncStartBurstRaw(::grpc::ClientContext* context, const ::mavcam::rpc::camera::StartBurstRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Prepare_;
     const ::grpc::internal::RpcMethod rpcmethod_TakePhoto_;
     const ::grpc::internal::RpcMethod rpcmethod_StartPhotoInterval_;
@@ -740,6 +820,9 @@ class CameraService final {
     const ::grpc::internal::RpcMethod rpcmethod_SelectCamera_;
     const ::grpc::internal::RpcMethod rpcmethod_ResetSettings_;
     const ::grpc::internal::RpcMethod rpcmethod_SetTimestamp_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetSettings_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMetrics_;
+    const ::grpc::internal::RpcMethod rpcmethod_StartBurst_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -826,6 +909,16 @@ class CameraService final {
     //
     // Set camera timestamp.
     virtual ::grpc::Status SetTimestamp(::grpc::ServerContext* context, const ::mavcam::rpc::camera::SetTimestampRequest* request, ::mavcam::rpc::camera::SetTimestampResponse* response);
+    //
+    // Apply several settings at once, dependent settings are applied first.
+    //
+    // Only setting_id of setting and option_id of option needs to be set.
+    virtual ::grpc::Status SetSettings(::grpc::ServerContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response);
+    // Per method call counts and latency percentiles recorded by the server.
+    virtual ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response);
+    // Take count photos from one request, interval_s apart or as fast as the sensor
+    // allows with 0. Each photo is reported through SubscribeCaptureInfo.
+    virtual ::grpc::Status StartBurst(::grpc::ServerContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Prepare : public BaseClass {
@@ -1287,7 +1380,67 @@ class CameraService final {
       ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Prepare<WithAsyncMethod_TakePhoto<WithAsyncMethod_StartPhotoInterval<WithAsyncMethod_StopPhotoInterval<WithAsyncMethod_StartVideo<WithAsyncMethod_StopVideo<WithAsyncMethod_StartVideoStreaming<WithAsyncMethod_StopVideoStreaming<WithAsyncMethod_SetMode<WithAsyncMethod_ListPhotos<WithAsyncMethod_SubscribeMode<WithAsyncMethod_SubscribeInformation<WithAsyncMethod_SubscribeVideoStreamInfo<WithAsyncMethod_SubscribeCaptureInfo<WithAsyncMethod_SubscribeStatus<WithAsyncMethod_SubscribeCurrentSettings<WithAsyncMethod_SubscribePossibleSettingOptions<WithAsyncMethod_SetSetting<WithAsyncMethod_GetSetting<WithAsyncMethod_FormatStorage<WithAsyncMethod_SelectCamera<WithAsyncMethod_ResetSettings<WithAsyncMethod_SetTimestamp<Service > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_SetSettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SetSettings() {
+      ::grpc::Service::MarkMethodAsync(23);
+    }
+    ~WithAsyncMethod_SetSettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetSettings(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetSettings(::grpc::ServerContext* context, ::mavcam::rpc::camera::SetSettingsRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavcam::rpc::camera::SetSettingsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodAsync(24);
+    }
+    ~WithAsyncMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::mavcam::rpc::camera::GetMetricsRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavcam::rpc::camera::GetMetricsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_StartBurst : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StartBurst() {
+      ::grpc::Service::MarkMethodAsync(25);
+    }
+    ~WithAsyncMethod_StartBurst() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartBurst(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStartBurst(::grpc::ServerContext* context, ::mavcam::rpc::camera::StartBurstRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavcam::rpc::camera::StartBurstResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Prepare<WithAsyncMethod_TakePhoto<WithAsyncMethod_StartPhotoInterval<WithAsyncMethod_StopPhotoInterval<WithAsyncMethod_StartVideo<WithAsyncMethod_StopVideo<WithAsyncMethod_StartVideoStreaming<WithAsyncMethod_StopVideoStreaming<WithAsyncMethod_SetMode<WithAsyncMethod_ListPhotos<WithAsyncMethod_SubscribeMode<WithAsyncMethod_SubscribeInformation<WithAsyncMethod_SubscribeVideoStreamInfo<WithAsyncMethod_SubscribeCaptureInfo<WithAsyncMethod_SubscribeStatus<WithAsyncMethod_SubscribeCurrentSettings<WithAsyncMethod_SubscribePossibleSettingOptions<WithAsyncMethod_SetSetting<WithAsyncMethod_GetSetting<WithAsyncMethod_FormatStorage<WithAsyncMethod_SelectCamera<WithAsyncMethod_ResetSettings<WithAsyncMethod_SetTimestamp<WithAsyncMethod_SetSettings<WithAsyncMethod_GetMetrics<WithAsyncMethod_StartBurst<Service > > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Prepare : public BaseClass {
    private:
@@ -1874,7 +2027,88 @@ class CameraService final {
     virtual ::grpc::ServerUnaryReactor* SetTimestamp(
       ::grpc::CallbackServerContext* /*context*/, const ::mavcam::rpc::camera::SetTimestampRequest* /*request*/, ::mavcam::rpc::camera::SetTimestampResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Prepare<WithCallbackMethod_TakePhoto<WithCallbackMethod_StartPhotoInterval<WithCallbackMethod_StopPhotoInterval<WithCallbackMethod_StartVideo<WithCallbackMethod_StopVideo<WithCallbackMethod_StartVideoStreaming<WithCallbackMethod_StopVideoStreaming<WithCallbackMethod_SetMode<WithCallbackMethod_ListPhotos<WithCallbackMethod_SubscribeMode<WithCallbackMethod_SubscribeInformation<WithCallbackMethod_SubscribeVideoStreamInfo<WithCallbackMethod_SubscribeCaptureInfo<WithCallbackMethod_SubscribeStatus<WithCallbackMethod_SubscribeCurrentSettings<WithCallbackMethod_SubscribePossibleSettingOptions<WithCallbackMethod_SetSetting<WithCallbackMethod_GetSetting<WithCallbackMethod_FormatStorage<WithCallbackMethod_SelectCamera<WithCallbackMethod_ResetSettings<WithCallbackMethod_SetTimestamp<Service > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_SetSettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetSettings() {
+      ::grpc::Service::MarkMethodCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavcam::rpc::camera::SetSettingsRequest* request, ::mavcam::rpc::camera::SetSettingsResponse* response) { return this->SetSettings(context, request, response); }));}
+    void SetMessageAllocatorFor_SetSettings(
+        ::grpc::MessageAllocator< ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(23);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetSettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetSettings(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetSettings(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodCallback(24,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavcam::rpc::camera::GetMetricsRequest* request, ::mavcam::rpc::camera::GetMetricsResponse* response) { return this->GetMetrics(context, request, response); }));}
+    void SetMessageAllocatorFor_GetMetrics(
+        ::grpc::MessageAllocator< ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(24);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StartBurst : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StartBurst() {
+      ::grpc::Service::MarkMethodCallback(25,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavcam::rpc::camera::StartBurstRequest* request, ::mavcam::rpc::camera::StartBurstResponse* response) { return this->StartBurst(context, request, response); }));}
+    void SetMessageAllocatorFor_StartBurst(
+        ::grpc::MessageAllocator< ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(25);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_StartBurst() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartBurst(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StartBurst(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Prepare<WithCallbackMethod_TakePhoto<WithCallbackMethod_StartPhotoInterval<WithCallbackMethod_StopPhotoInterval<WithCallbackMethod_StartVideo<WithCallbackMethod_StopVideo<WithCallbackMethod_StartVideoStreaming<WithCallbackMethod_StopVideoStreaming<WithCallbackMethod_SetMode<WithCallbackMethod_ListPhotos<WithCallbackMethod_SubscribeMode<WithCallbackMethod_SubscribeInformation<WithCallbackMethod_SubscribeVideoStreamInfo<WithCallbackMethod_SubscribeCaptureInfo<WithCallbackMethod_SubscribeStatus<WithCallbackMethod_SubscribeCurrentSettings<WithCallbackMethod_SubscribePossibleSettingOptions<WithCallbackMethod_SetSetting<WithCallbackMethod_GetSetting<WithCallbackMethod_FormatStorage<WithCallbackMethod_SelectCamera<WithCallbackMethod_ResetSettings<WithCallbackMethod_SetTimestamp<WithCallbackMethod_SetSettings<WithCallbackMethod_GetMetrics<WithCallbackMethod_StartBurst<Service > > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Prepare : public BaseClass {
@@ -2268,6 +2502,57 @@ class CameraService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_SetSettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetSettings() {
+      ::grpc::Service::MarkMethodGeneric(23);
+    }
+    ~WithGenericMethod_SetSettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetSettings(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodGeneric(24);
+    }
+    ~WithGenericMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StartBurst : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StartBurst() {
+      ::grpc::Service::MarkMethodGeneric(25);
+    }
+    ~WithGenericMethod_StartBurst() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartBurst(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Prepare : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2728,6 +3013,66 @@ class CameraService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_SetSettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetSettings() {
+      ::grpc::Service::MarkMethodRaw(23);
+    }
+    ~WithRawMethod_SetSettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetSettings(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetSettings(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRaw(24);
+    }
+    ~WithRawMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StartBurst : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StartBurst() {
+      ::grpc::Service::MarkMethodRaw(25);
+    }
+    ~WithRawMethod_StartBurst() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartBurst(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStartBurst(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Prepare : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -3234,6 +3579,72 @@ class CameraService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_SetSettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetSettings() {
+      ::grpc::Service::MarkMethodRawCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetSettings(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetSettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetSettings(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetSettings(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRawCallback(24,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetMetrics(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StartBurst : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StartBurst() {
+      ::grpc::Service::MarkMethodRawCallback(25,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->StartBurst(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_StartBurst() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartBurst(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StartBurst(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Prepare : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -3665,7 +4076,88 @@ class CameraService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedSetTimestamp(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavcam::rpc::camera::SetTimestampRequest,::mavcam::rpc::camera::SetTimestampResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Prepare<WithStreamedUnaryMethod_TakePhoto<WithStreamedUnaryMethod_StartPhotoInterval<WithStreamedUnaryMethod_StopPhotoInterval<WithStreamedUnaryMethod_StartVideo<WithStreamedUnaryMethod_StopVideo<WithStreamedUnaryMethod_StartVideoStreaming<WithStreamedUnaryMethod_StopVideoStreaming<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_ListPhotos<WithStreamedUnaryMethod_SetSetting<WithStreamedUnaryMethod_GetSetting<WithStreamedUnaryMethod_FormatStorage<WithStreamedUnaryMethod_SelectCamera<WithStreamedUnaryMethod_ResetSettings<WithStreamedUnaryMethod_SetTimestamp<Service > > > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetSettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetSettings() {
+      ::grpc::Service::MarkMethodStreamed(23,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavcam::rpc::camera::SetSettingsRequest, ::mavcam::rpc::camera::SetSettingsResponse>* streamer) {
+                       return this->StreamedSetSettings(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetSettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetSettings(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::SetSettingsRequest* /*request*/, ::mavcam::rpc::camera::SetSettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetSettings(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavcam::rpc::camera::SetSettingsRequest,::mavcam::rpc::camera::SetSettingsResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodStreamed(24,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavcam::rpc::camera::GetMetricsRequest, ::mavcam::rpc::camera::GetMetricsResponse>* streamer) {
+                       return this->StreamedGetMetrics(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::GetMetricsRequest* /*request*/, ::mavcam::rpc::camera::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMetrics(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavcam::rpc::camera::GetMetricsRequest,::mavcam::rpc::camera::GetMetricsResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_StartBurst : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_StartBurst() {
+      ::grpc::Service::MarkMethodStreamed(25,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavcam::rpc::camera::StartBurstRequest, ::mavcam::rpc::camera::StartBurstResponse>* streamer) {
+                       return this->StreamedStartBurst(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_StartBurst() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StartBurst(::grpc::ServerContext* /*context*/, const ::mavcam::rpc::camera::StartBurstRequest* /*request*/, ::mavcam::rpc::camera::StartBurstResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedStartBurst(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavcam::rpc::camera::StartBurstRequest,::mavcam::rpc::camera::StartBurstResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Prepare<WithStreamedUnaryMethod_TakePhoto<WithStreamedUnaryMethod_StartPhotoInterval<WithStreamedUnaryMethod_StopPhotoInterval<WithStreamedUnaryMethod_StartVideo<WithStreamedUnaryMethod_StopVideo<WithStreamedUnaryMethod_StartVideoStreaming<WithStreamedUnaryMethod_StopVideoStreaming<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_ListPhotos<WithStreamedUnaryMethod_SetSetting<WithStreamedUnaryMethod_GetSetting<WithStreamedUnaryMethod_FormatStorage<WithStreamedUnaryMethod_SelectCamera<WithStreamedUnaryMethod_ResetSettings<WithStreamedUnaryMethod_SetTimestamp<WithStreamedUnaryMethod_SetSettings<WithStreamedUnaryMethod_GetMetrics<WithStreamedUnaryMethod_StartBurst<Service > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_SubscribeMode : public BaseClass {
    private:
@@ -3856,7 +4348,7 @@ class CameraService final {
     virtual ::grpc::Status StreamedSubscribePossibleSettingOptions(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::mavcam::rpc::camera::SubscribePossibleSettingOptionsRequest,::mavcam::rpc::camera::PossibleSettingOptionsResponse>* server_split_streamer) = 0;
   };
   typedef WithSplitStreamingMethod_SubscribeMode<WithSplitStreamingMethod_SubscribeInformation<WithSplitStreamingMethod_SubscribeVideoStreamInfo<WithSplitStreamingMethod_SubscribeCaptureInfo<WithSplitStreamingMethod_SubscribeStatus<WithSplitStreamingMethod_SubscribeCurrentSettings<WithSplitStreamingMethod_SubscribePossibleSettingOptions<Service > > > > > > > SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Prepare<WithStreamedUnaryMethod_TakePhoto<WithStreamedUnaryMethod_StartPhotoInterval<WithStreamedUnaryMethod_StopPhotoInterval<WithStreamedUnaryMethod_StartVideo<WithStreamedUnaryMethod_StopVideo<WithStreamedUnaryMethod_StartVideoStreaming<WithStreamedUnaryMethod_StopVideoStreaming<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_ListPhotos<WithSplitStreamingMethod_SubscribeMode<WithSplitStreamingMethod_SubscribeInformation<WithSplitStreamingMethod_SubscribeVideoStreamInfo<WithSplitStreamingMethod_SubscribeCaptureInfo<WithSplitStreamingMethod_SubscribeStatus<WithSplitStreamingMethod_SubscribeCurrentSettings<WithSplitStreamingMethod_SubscribePossibleSettingOptions<WithStreamedUnaryMethod_SetSetting<WithStreamedUnaryMethod_GetSetting<WithStreamedUnaryMethod_FormatStorage<WithStreamedUnaryMethod_SelectCamera<WithStreamedUnaryMethod_ResetSettings<WithStreamedUnaryMethod_SetTimestamp<Service > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_Prepare<WithStreamedUnaryMethod_TakePhoto<WithStreamedUnaryMethod_StartPhotoInterval<WithStreamedUnaryMethod_StopPhotoInterval<WithStreamedUnaryMethod_StartVideo<WithStreamedUnaryMethod_StopVideo<WithStreamedUnaryMethod_StartVideoStreaming<WithStreamedUnaryMethod_StopVideoStreaming<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_ListPhotos<WithSplitStreamingMethod_SubscribeMode<WithSplitStreamingMethod_SubscribeInformation<WithSplitStreamingMethod_SubscribeVideoStreamInfo<WithSplitStreamingMethod_SubscribeCaptureInfo<WithSplitStreamingMethod_SubscribeStatus<WithSplitStreamingMethod_SubscribeCurrentSettings<WithSplitStreamingMethod_SubscribePossibleSettingOptions<WithStreamedUnaryMethod_SetSetting<WithStreamedUnaryMethod_GetSetting<WithStreamedUnaryMethod_FormatStorage<WithStreamedUnaryMethod_SelectCamera<WithStreamedUnaryMethod_ResetSettings<WithStreamedUnaryMethod_SetTimestamp<WithStreamedUnaryMethod_SetSettings<WithStreamedUnaryMethod_GetMetrics<WithStreamedUnaryMethod_StartBurst<Service > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace camera
@@ -270,6 +270,26 @@ struct StartPhotoIntervalRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartPhotoIntervalRequestDefaultTypeInternal _StartPhotoIntervalRequest_default_instance_;
 
+inline constexpr StartBurstRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : count_{0},
+        interval_s_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StartBurstRequest::StartBurstRequest(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct StartBurstRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartBurstRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartBurstRequestDefaultTypeInternal() {}
+  union {
+    StartBurstRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartBurstRequestDefaultTypeInternal _StartBurstRequest_default_instance_;
+
 inline constexpr SetTimestampRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : timestamp_{::int64_t{0}},
@@ -496,6 +516,19 @@ struct InformationDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InformationDefaultTypeInternal _Information_default_instance_;
 
+template <typename>
+PROTOBUF_CONSTEXPR GetMetricsRequest::GetMetricsRequest(::_pbi::ConstantInitialized) {}
+struct GetMetricsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetMetricsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetMetricsRequestDefaultTypeInternal() {}
+  union {
+    GetMetricsRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetMetricsRequestDefaultTypeInternal _GetMetricsRequest_default_instance_;
+
 inline constexpr FormatStorageRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : storage_id_{0},
@@ -558,6 +591,56 @@ struct CameraResultDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraResultDefaultTypeInternal _CameraResult_default_instance_;
 
+inline constexpr CallMetric::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        count_{::uint64_t{0u}},
+        error_count_{::uint64_t{0u}},
+        total_latency_us_{::uint64_t{0u}},
+        max_latency_us_{::uint64_t{0u}},
+        p50_latency_us_{::uint64_t{0u}},
+        p90_latency_us_{::uint64_t{0u}},
+        p99_latency_us_{::uint64_t{0u}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR CallMetric::CallMetric(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct CallMetricDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallMetricDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallMetricDefaultTypeInternal() {}
+  union {
+    CallMetric _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallMetricDefaultTypeInternal _CallMetric_default_instance_;
+
+inline constexpr AppliedSetting::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : setting_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        result_{static_cast< ::mavcam::rpc::camera::CameraResult_Result >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR AppliedSetting::AppliedSetting(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct AppliedSettingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppliedSettingDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppliedSettingDefaultTypeInternal() {}
+  union {
+    AppliedSetting _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppliedSettingDefaultTypeInternal _AppliedSetting_default_instance_;
+
 inline constexpr VideoStreamInfo::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -732,6 +815,25 @@ struct StartPhotoIntervalResponseDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartPhotoIntervalResponseDefaultTypeInternal _StartPhotoIntervalResponse_default_instance_;
 
+inline constexpr StartBurstResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        camera_result_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StartBurstResponse::StartBurstResponse(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct StartBurstResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartBurstResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartBurstResponseDefaultTypeInternal() {}
+  union {
+    StartBurstResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartBurstResponseDefaultTypeInternal _StartBurstResponse_default_instance_;
+
 inline constexpr SettingOptions::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : options_{},
@@ -803,6 +905,26 @@ struct SetTimestampResponseDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetTimestampResponseDefaultTypeInternal _SetTimestampResponse_default_instance_;
 
+inline constexpr SetSettingsResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        applied_settings_{},
+        camera_result_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR SetSettingsResponse::SetSettingsResponse(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct SetSettingsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetSettingsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetSettingsResponseDefaultTypeInternal() {}
+  union {
+    SetSettingsResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetSettingsResponseDefaultTypeInternal _SetSettingsResponse_default_instance_;
+
 inline constexpr SetSettingResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -917,6 +1039,26 @@ struct InformationResponseDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InformationResponseDefaultTypeInternal _InformationResponse_default_instance_;
 
+inline constexpr GetMetricsResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        call_metrics_{},
+        camera_result_{nullptr} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR GetMetricsResponse::GetMetricsResponse(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct GetMetricsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetMetricsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetMetricsResponseDefaultTypeInternal() {}
+  union {
+    GetMetricsResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetMetricsResponseDefaultTypeInternal _GetMetricsResponse_default_instance_;
+
 inline constexpr FormatStorageResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -982,6 +1124,25 @@ struct VideoStreamInfoResponseDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VideoStreamInfoResponseDefaultTypeInternal _VideoStreamInfoResponse_default_instance_;
 
+inline constexpr SetSettingsRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : settings_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR SetSettingsRequest::SetSettingsRequest(::_pbi::ConstantInitialized)
+    : _impl_(::_pbi::ConstantInitialized()) {}
+struct SetSettingsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetSettingsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetSettingsRequestDefaultTypeInternal() {}
+  union {
+    SetSettingsRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetSettingsRequestDefaultTypeInternal _SetSettingsRequest_default_instance_;
+
 inline constexpr SetSettingRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -1119,7 +1280,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
 }  // namespace camera
 }  // namespace rpc
 }  // namespace mavcam
-static ::_pb::Metadata file_level_metadata_camera_2fcamera_2eproto[58];
+static ::_pb::Metadata file_level_metadata_camera_2fcamera_2eproto[66];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_camera_2fcamera_2eproto[8];
 static constexpr const ::_pb::ServiceDescriptor**
     file_level_service_descriptors_camera_2fcamera_2eproto = nullptr;
@@ -1199,6 +1360,26 @@ const ::uint32_t TableStruct_camera_2fcamera_2eproto::offsets[] PROTOBUF_SECTION
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StopPhotoIntervalResponse, _impl_.camera_result_),
     0,
     ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartBurstRequest, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartBurstRequest, _impl_.count_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartBurstRequest, _impl_.interval_s_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartBurstResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartBurstResponse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartBurstResponse, _impl_.camera_result_),
+    0,
+    ~0u,  // no _has_bits_
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::StartVideoRequest, _internal_metadata_),
     ~0u,  // no _extensions_
     ~0u,  // no _oneof_case_
@@ -1454,6 +1635,47 @@ const ::uint32_t TableStruct_camera_2fcamera_2eproto::offsets[] PROTOBUF_SECTION
     ~0u,  // no sizeof(Split)
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingResponse, _impl_.camera_result_),
     0,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingsRequest, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingsRequest, _impl_.settings_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingsResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingsResponse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingsResponse, _impl_.camera_result_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SetSettingsResponse, _impl_.applied_settings_),
+    0,
+    ~0u,
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetMetricsRequest, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetMetricsResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetMetricsResponse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetMetricsResponse, _impl_.camera_result_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetMetricsResponse, _impl_.call_metrics_),
+    0,
+    ~0u,
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetSettingRequest, _impl_._has_bits_),
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::GetSettingRequest, _internal_metadata_),
     ~0u,  // no _extensions_
@@ -1706,6 +1928,32 @@ const ::uint32_t TableStruct_camera_2fcamera_2eproto::offsets[] PROTOBUF_SECTION
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SettingOptions, _impl_.options_),
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::SettingOptions, _impl_.is_range_),
     ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::AppliedSetting, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::AppliedSetting, _impl_.result_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::AppliedSetting, _impl_.setting_id_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.name_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.count_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.error_count_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.total_latency_us_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.max_latency_us_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.p50_latency_us_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.p90_latency_us_),
+    PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::CallMetric, _impl_.p99_latency_us_),
+    ~0u,  // no _has_bits_
     PROTOBUF_FIELD_OFFSET(::mavcam::rpc::camera::Information, _internal_metadata_),
     ~0u,  // no _extensions_
     ~0u,  // no _oneof_case_
@@ -1737,56 +1985,64 @@ static const ::_pbi::MigrationSchema
         {45, 54, -1, sizeof(::mavcam::rpc::camera::StartPhotoIntervalResponse)},
         {55, -1, -1, sizeof(::mavcam::rpc::camera::StopPhotoIntervalRequest)},
         {63, 72, -1, sizeof(::mavcam::rpc::camera::StopPhotoIntervalResponse)},
-        {73, -1, -1, sizeof(::mavcam::rpc::camera::StartVideoRequest)},
-        {81, 90, -1, sizeof(::mavcam::rpc::camera::StartVideoResponse)},
-        {91, -1, -1, sizeof(::mavcam::rpc::camera::StopVideoRequest)},
-        {99, 108, -1, sizeof(::mavcam::rpc::camera::StopVideoResponse)},
-        {109, -1, -1, sizeof(::mavcam::rpc::camera::StartVideoStreamingRequest)},
-        {118, 127, -1, sizeof(::mavcam::rpc::camera::StartVideoStreamingResponse)},
-        {128, -1, -1, sizeof(::mavcam::rpc::camera::StopVideoStreamingRequest)},
-        {137, 146, -1, sizeof(::mavcam::rpc::camera::StopVideoStreamingResponse)},
-        {147, -1, -1, sizeof(::mavcam::rpc::camera::SetModeRequest)},
-        {156, 165, -1, sizeof(::mavcam::rpc::camera::SetModeResponse)},
-        {166, -1, -1, sizeof(::mavcam::rpc::camera::ListPhotosRequest)},
-        {175, 185, -1, sizeof(::mavcam::rpc::camera::ListPhotosResponse)},
-        {187, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeInformationRequest)},
-        {195, 204, -1, sizeof(::mavcam::rpc::camera::InformationResponse)},
-        {205, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeModeRequest)},
-        {213, -1, -1, sizeof(::mavcam::rpc::camera::ModeResponse)},
-        {222, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeVideoStreamInfoRequest)},
-        {230, -1, -1, sizeof(::mavcam::rpc::camera::VideoStreamInfoResponse)},
-        {239, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeCaptureInfoRequest)},
-        {247, 256, -1, sizeof(::mavcam::rpc::camera::CaptureInfoResponse)},
-        {257, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeStatusRequest)},
-        {265, 274, -1, sizeof(::mavcam::rpc::camera::StatusResponse)},
-        {275, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeCurrentSettingsRequest)},
-        {283, -1, -1, sizeof(::mavcam::rpc::camera::CurrentSettingsResponse)},
-        {292, -1, -1, sizeof(::mavcam::rpc::camera::SubscribePossibleSettingOptionsRequest)},
-        {300, -1, -1, sizeof(::mavcam::rpc::camera::PossibleSettingOptionsResponse)},
-        {309, 318, -1, sizeof(::mavcam::rpc::camera::SetSettingRequest)},
-        {319, 328, -1, sizeof(::mavcam::rpc::camera::SetSettingResponse)},
-        {329, 338, -1, sizeof(::mavcam::rpc::camera::GetSettingRequest)},
-        {339, 349, -1, sizeof(::mavcam::rpc::camera::GetSettingResponse)},
-        {351, -1, -1, sizeof(::mavcam::rpc::camera::FormatStorageRequest)},
-        {360, 369, -1, sizeof(::mavcam::rpc::camera::FormatStorageResponse)},
-        {370, 379, -1, sizeof(::mavcam::rpc::camera::SelectCameraResponse)},
-        {380, -1, -1, sizeof(::mavcam::rpc::camera::SelectCameraRequest)},
-        {389, -1, -1, sizeof(::mavcam::rpc::camera::ResetSettingsRequest)},
-        {397, 406, -1, sizeof(::mavcam::rpc::camera::ResetSettingsResponse)},
-        {407, -1, -1, sizeof(::mavcam::rpc::camera::SetTimestampRequest)},
-        {416, 425, -1, sizeof(::mavcam::rpc::camera::SetTimestampResponse)},
-        {426, -1, -1, sizeof(::mavcam::rpc::camera::CameraResult)},
-        {436, -1, -1, sizeof(::mavcam::rpc::camera::Position)},
-        {448, -1, -1, sizeof(::mavcam::rpc::camera::Quaternion)},
-        {460, -1, -1, sizeof(::mavcam::rpc::camera::EulerAngle)},
-        {471, 486, -1, sizeof(::mavcam::rpc::camera::CaptureInfo)},
-        {493, -1, -1, sizeof(::mavcam::rpc::camera::VideoStreamSettings)},
-        {508, 520, -1, sizeof(::mavcam::rpc::camera::VideoStreamInfo)},
-        {524, -1, -1, sizeof(::mavcam::rpc::camera::Status)},
-        {542, -1, -1, sizeof(::mavcam::rpc::camera::Option)},
-        {552, 564, -1, sizeof(::mavcam::rpc::camera::Setting)},
-        {568, -1, -1, sizeof(::mavcam::rpc::camera::SettingOptions)},
-        {580, -1, -1, sizeof(::mavcam::rpc::camera::Information)},
+        {73, -1, -1, sizeof(::mavcam::rpc::camera::StartBurstRequest)},
+        {83, 92, -1, sizeof(::mavcam::rpc::camera::StartBurstResponse)},
+        {93, -1, -1, sizeof(::mavcam::rpc::camera::StartVideoRequest)},
+        {101, 110, -1, sizeof(::mavcam::rpc::camera::StartVideoResponse)},
+        {111, -1, -1, sizeof(::mavcam::rpc::camera::StopVideoRequest)},
+        {119, 128, -1, sizeof(::mavcam::rpc::camera::StopVideoResponse)},
+        {129, -1, -1, sizeof(::mavcam::rpc::camera::StartVideoStreamingRequest)},
+        {138, 147, -1, sizeof(::mavcam::rpc::camera::StartVideoStreamingResponse)},
+        {148, -1, -1, sizeof(::mavcam::rpc::camera::StopVideoStreamingRequest)},
+        {157, 166, -1, sizeof(::mavcam::rpc::camera::StopVideoStreamingResponse)},
+        {167, -1, -1, sizeof(::mavcam::rpc::camera::SetModeRequest)},
+        {176, 185, -1, sizeof(::mavcam::rpc::camera::SetModeResponse)},
+        {186, -1, -1, sizeof(::mavcam::rpc::camera::ListPhotosRequest)},
+        {195, 205, -1, sizeof(::mavcam::rpc::camera::ListPhotosResponse)},
+        {207, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeInformationRequest)},
+        {215, 224, -1, sizeof(::mavcam::rpc::camera::InformationResponse)},
+        {225, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeModeRequest)},
+        {233, -1, -1, sizeof(::mavcam::rpc::camera::ModeResponse)},
+        {242, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeVideoStreamInfoRequest)},
+        {250, -1, -1, sizeof(::mavcam::rpc::camera::VideoStreamInfoResponse)},
+        {259, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeCaptureInfoRequest)},
+        {267, 276, -1, sizeof(::mavcam::rpc::camera::CaptureInfoResponse)},
+        {277, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeStatusRequest)},
+        {285, 294, -1, sizeof(::mavcam::rpc::camera::StatusResponse)},
+        {295, -1, -1, sizeof(::mavcam::rpc::camera::SubscribeCurrentSettingsRequest)},
+        {303, -1, -1, sizeof(::mavcam::rpc::camera::CurrentSettingsResponse)},
+        {312, -1, -1, sizeof(::mavcam::rpc::camera::SubscribePossibleSettingOptionsRequest)},
+        {320, -1, -1, sizeof(::mavcam::rpc::camera::PossibleSettingOptionsResponse)},
+        {329, 338, -1, sizeof(::mavcam::rpc::camera::SetSettingRequest)},
+        {339, 348, -1, sizeof(::mavcam::rpc::camera::SetSettingResponse)},
+        {349, -1, -1, sizeof(::mavcam::rpc::camera::SetSettingsRequest)},
+        {358, 368, -1, sizeof(::mavcam::rpc::camera::SetSettingsResponse)},
+        {370, -1, -1, sizeof(::mavcam::rpc::camera::GetMetricsRequest)},
+        {378, 388, -1, sizeof(::mavcam::rpc::camera::GetMetricsResponse)},
+        {390, 399, -1, sizeof(::mavcam::rpc::camera::GetSettingRequest)},
+        {400, 410, -1, sizeof(::mavcam::rpc::camera::GetSettingResponse)},
+        {412, -1, -1, sizeof(::mavcam::rpc::camera::FormatStorageRequest)},
+        {421, 430, -1, sizeof(::mavcam::rpc::camera::FormatStorageResponse)},
+        {431, 440, -1, sizeof(::mavcam::rpc::camera::SelectCameraResponse)},
+        {441, -1, -1, sizeof(::mavcam::rpc::camera::SelectCameraRequest)},
+        {450, -1, -1, sizeof(::mavcam::rpc::camera::ResetSettingsRequest)},
+        {458, 467, -1, sizeof(::mavcam::rpc::camera::ResetSettingsResponse)},
+        {468, -1, -1, sizeof(::mavcam::rpc::camera::SetTimestampRequest)},
+        {477, 486, -1, sizeof(::mavcam::rpc::camera::SetTimestampResponse)},
+        {487, -1, -1, sizeof(::mavcam::rpc::camera::CameraResult)},
+        {497, -1, -1, sizeof(::mavcam::rpc::camera::Position)},
+        {509, -1, -1, sizeof(::mavcam::rpc::camera::Quaternion)},
+        {521, -1, -1, sizeof(::mavcam::rpc::camera::EulerAngle)},
+        {532, 547, -1, sizeof(::mavcam::rpc::camera::CaptureInfo)},
+        {554, -1, -1, sizeof(::mavcam::rpc::camera::VideoStreamSettings)},
+        {569, 581, -1, sizeof(::mavcam::rpc::camera::VideoStreamInfo)},
+        {585, -1, -1, sizeof(::mavcam::rpc::camera::Status)},
+        {603, -1, -1, sizeof(::mavcam::rpc::camera::Option)},
+        {613, 625, -1, sizeof(::mavcam::rpc::camera::Setting)},
+        {629, -1, -1, sizeof(::mavcam::rpc::camera::SettingOptions)},
+        {641, -1, -1, sizeof(::mavcam::rpc::camera::AppliedSetting)},
+        {651, -1, -1, sizeof(::mavcam::rpc::camera::CallMetric)},
+        {667, -1, -1, sizeof(::mavcam::rpc::camera::Information)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -1798,6 +2054,8 @@ static const ::_pb::Message* const file_default_instances[] = {
     &::mavcam::rpc::camera::_StartPhotoIntervalResponse_default_instance_._instance,
     &::mavcam::rpc::camera::_StopPhotoIntervalRequest_default_instance_._instance,
     &::mavcam::rpc::camera::_StopPhotoIntervalResponse_default_instance_._instance,
+    &::mavcam::rpc::camera::_StartBurstRequest_default_instance_._instance,
+    &::mavcam::rpc::camera::_StartBurstResponse_default_instance_._instance,
     &::mavcam::rpc::camera::_StartVideoRequest_default_instance_._instance,
     &::mavcam::rpc::camera::_StartVideoResponse_default_instance_._instance,
     &::mavcam::rpc::camera::_StopVideoRequest_default_instance_._instance,
@@ -1826,6 +2084,10 @@ static const ::_pb::Message* const file_default_instances[] = {
     &::mavcam::rpc::camera::_PossibleSettingOptionsResponse_default_instance_._instance,
     &::mavcam::rpc::camera::_SetSettingRequest_default_instance_._instance,
     &::mavcam::rpc::camera::_SetSettingResponse_default_instance_._instance,
+    &::mavcam::rpc::camera::_SetSettingsRequest_default_instance_._instance,
+    &::mavcam::rpc::camera::_SetSettingsResponse_default_instance_._instance,
+    &::mavcam::rpc::camera::_GetMetricsRequest_default_instance_._instance,
+    &::mavcam::rpc::camera::_GetMetricsResponse_default_instance_._instance,
     &::mavcam::rpc::camera::_GetSettingRequest_default_instance_._instance,
     &::mavcam::rpc::camera::_GetSettingResponse_default_instance_._instance,
     &::mavcam::rpc::camera::_FormatStorageRequest_default_instance_._instance,
@@ -1847,6 +2109,8 @@ static const ::_pb::Message* const file_default_instances[] = {
     &::mavcam::rpc::camera::_Option_default_instance_._instance,
     &::mavcam::rpc::camera::_Setting_default_instance_._instance,
     &::mavcam::rpc::camera::_SettingOptions_default_instance_._instance,
+    &::mavcam::rpc::camera::_AppliedSetting_default_instance_._instance,
+    &::mavcam::rpc::camera::_CallMetric_default_instance_._instance,
     &::mavcam::rpc::camera::_Information_default_instance_._instance,
 };
 const char descriptor_table_protodef_camera_2fcamera_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -1862,217 +2126,243 @@ const char descriptor_table_protodef_camera_2fcamera_2eproto[] PROTOBUF_SECTION_
     "cam.rpc.camera.CameraResult\"\032\n\030StopPhoto"
     "IntervalRequest\"S\n\031StopPhotoIntervalResp"
     "onse\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc"
-    ".camera.CameraResult\"\023\n\021StartVideoReques"
-    "t\"L\n\022StartVideoResponse\0226\n\rcamera_result"
-    "\030\001 \001(\0132\037.mavcam.rpc.camera.CameraResult\""
-    "\022\n\020StopVideoRequest\"K\n\021StopVideoResponse"
-    "\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc.cam"
-    "era.CameraResult\"/\n\032StartVideoStreamingR"
-    "equest\022\021\n\tstream_id\030\001 \001(\005\"U\n\033StartVideoS"
-    "treamingResponse\0226\n\rcamera_result\030\001 \001(\0132"
-    "\037.mavcam.rpc.camera.CameraResult\".\n\031Stop"
-    "VideoStreamingRequest\022\021\n\tstream_id\030\001 \001(\005"
-    "\"T\n\032StopVideoStreamingResponse\0226\n\rcamera"
+    ".camera.CameraResult\"6\n\021StartBurstReques"
+    "t\022\r\n\005count\030\001 \001(\005\022\022\n\ninterval_s\030\002 \001(\002\"L\n\022"
+    "StartBurstResponse\0226\n\rcamera_result\030\001 \001("
+    "\0132\037.mavcam.rpc.camera.CameraResult\"\023\n\021St"
+    "artVideoRequest\"L\n\022StartVideoResponse\0226\n"
+    "\rcamera_result\030\001 \001(\0132\037.mavcam.rpc.camera"
+    ".CameraResult\"\022\n\020StopVideoRequest\"K\n\021Sto"
+    "pVideoResponse\0226\n\rcamera_result\030\001 \001(\0132\037."
+    "mavcam.rpc.camera.CameraResult\"/\n\032StartV"
+    "ideoStreamingRequest\022\021\n\tstream_id\030\001 \001(\005\""
+    "U\n\033StartVideoStreamingResponse\0226\n\rcamera"
     "_result\030\001 \001(\0132\037.mavcam.rpc.camera.Camera"
-    "Result\"7\n\016SetModeRequest\022%\n\004mode\030\001 \001(\0162\027"
-    ".mavcam.rpc.camera.Mode\"I\n\017SetModeRespon"
-    "se\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc.c"
-    "amera.CameraResult\"I\n\021ListPhotosRequest\022"
-    "4\n\014photos_range\030\001 \001(\0162\036.mavcam.rpc.camer"
-    "a.PhotosRange\"\203\001\n\022ListPhotosResponse\0226\n\r"
-    "camera_result\030\001 \001(\0132\037.mavcam.rpc.camera."
-    "CameraResult\0225\n\rcapture_infos\030\002 \003(\0132\036.ma"
-    "vcam.rpc.camera.CaptureInfo\"\035\n\033Subscribe"
-    "InformationRequest\"J\n\023InformationRespons"
-    "e\0223\n\013information\030\001 \001(\0132\036.mavcam.rpc.came"
-    "ra.Information\"\026\n\024SubscribeModeRequest\"5"
-    "\n\014ModeResponse\022%\n\004mode\030\001 \001(\0162\027.mavcam.rp"
-    "c.camera.Mode\"!\n\037SubscribeVideoStreamInf"
-    "oRequest\"Y\n\027VideoStreamInfoResponse\022>\n\022v"
-    "ideo_stream_infos\030\001 \003(\0132\".mavcam.rpc.cam"
-    "era.VideoStreamInfo\"\035\n\033SubscribeCaptureI"
-    "nfoRequest\"K\n\023CaptureInfoResponse\0224\n\014cap"
-    "ture_info\030\001 \001(\0132\036.mavcam.rpc.camera.Capt"
-    "ureInfo\"\030\n\026SubscribeStatusRequest\"B\n\016Sta"
-    "tusResponse\0220\n\rcamera_status\030\001 \001(\0132\031.mav"
-    "cam.rpc.camera.Status\"!\n\037SubscribeCurren"
-    "tSettingsRequest\"O\n\027CurrentSettingsRespo"
-    "nse\0224\n\020current_settings\030\001 \003(\0132\032.mavcam.r"
-    "pc.camera.Setting\"(\n&SubscribePossibleSe"
-    "ttingOptionsRequest\"\\\n\036PossibleSettingOp"
-    "tionsResponse\022:\n\017setting_options\030\001 \003(\0132!"
-    ".mavcam.rpc.camera.SettingOptions\"@\n\021Set"
+    "Result\".\n\031StopVideoStreamingRequest\022\021\n\ts"
+    "tream_id\030\001 \001(\005\"T\n\032StopVideoStreamingResp"
+    "onse\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc"
+    ".camera.CameraResult\"7\n\016SetModeRequest\022%"
+    "\n\004mode\030\001 \001(\0162\027.mavcam.rpc.camera.Mode\"I\n"
+    "\017SetModeResponse\0226\n\rcamera_result\030\001 \001(\0132"
+    "\037.mavcam.rpc.camera.CameraResult\"I\n\021List"
+    "PhotosRequest\0224\n\014photos_range\030\001 \001(\0162\036.ma"
+    "vcam.rpc.camera.PhotosRange\"\203\001\n\022ListPhot"
+    "osResponse\0226\n\rcamera_result\030\001 \001(\0132\037.mavc"
+    "am.rpc.camera.CameraResult\0225\n\rcapture_in"
+    "fos\030\002 \003(\0132\036.mavcam.rpc.camera.CaptureInf"
+    "o\"\035\n\033SubscribeInformationRequest\"J\n\023Info"
+    "rmationResponse\0223\n\013information\030\001 \001(\0132\036.m"
+    "avcam.rpc.camera.Information\"\026\n\024Subscrib"
+    "eModeRequest\"5\n\014ModeResponse\022%\n\004mode\030\001 \001"
+    "(\0162\027.mavcam.rpc.camera.Mode\"!\n\037Subscribe"
+    "VideoStreamInfoRequest\"Y\n\027VideoStreamInf"
+    "oResponse\022>\n\022video_stream_infos\030\001 \003(\0132\"."
+    "mavcam.rpc.camera.VideoStreamInfo\"\035\n\033Sub"
+    "scribeCaptureInfoRequest\"K\n\023CaptureInfoR"
+    "esponse\0224\n\014capture_info\030\001 \001(\0132\036.mavcam.r"
+    "pc.camera.CaptureInfo\"\030\n\026SubscribeStatus"
+    "Request\"B\n\016StatusResponse\0220\n\rcamera_stat"
+    "us\030\001 \001(\0132\031.mavcam.rpc.camera.Status\"!\n\037S"
+    "ubscribeCurrentSettingsRequest\"O\n\027Curren"
+    "tSettingsResponse\0224\n\020current_settings\030\001 "
+    "\003(\0132\032.mavcam.rpc.camera.Setting\"(\n&Subsc"
+    "ribePossibleSettingOptionsRequest\"\\\n\036Pos"
+    "sibleSettingOptionsResponse\022:\n\017setting_o"
+    "ptions\030\001 \003(\0132!.mavcam.rpc.camera.Setting"
+    "Options\"@\n\021SetSettingRequest\022+\n\007setting\030"
+    "\001 \001(\0132\032.mavcam.rpc.camera.Setting\"L\n\022Set"
+    "SettingResponse\0226\n\rcamera_result\030\001 \001(\0132\037"
+    ".mavcam.rpc.camera.CameraResult\"B\n\022SetSe"
+    "ttingsRequest\022,\n\010settings\030\001 \003(\0132\032.mavcam"
+    ".rpc.camera.Setting\"\212\001\n\023SetSettingsRespo"
+    "nse\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc."
+    "camera.CameraResult\022;\n\020applied_settings\030"
+    "\002 \003(\0132!.mavcam.rpc.camera.AppliedSetting"
+    "\"\023\n\021GetMetricsRequest\"\201\001\n\022GetMetricsResp"
+    "onse\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc"
+    ".camera.CameraResult\0223\n\014call_metrics\030\002 \003"
+    "(\0132\035.mavcam.rpc.camera.CallMetric\"@\n\021Get"
     "SettingRequest\022+\n\007setting\030\001 \001(\0132\032.mavcam"
-    ".rpc.camera.Setting\"L\n\022SetSettingRespons"
+    ".rpc.camera.Setting\"y\n\022GetSettingRespons"
     "e\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc.ca"
-    "mera.CameraResult\"@\n\021GetSettingRequest\022+"
-    "\n\007setting\030\001 \001(\0132\032.mavcam.rpc.camera.Sett"
-    "ing\"y\n\022GetSettingResponse\0226\n\rcamera_resu"
-    "lt\030\001 \001(\0132\037.mavcam.rpc.camera.CameraResul"
-    "t\022+\n\007setting\030\002 \001(\0132\032.mavcam.rpc.camera.S"
-    "etting\"*\n\024FormatStorageRequest\022\022\n\nstorag"
-    "e_id\030\001 \001(\005\"O\n\025FormatStorageResponse\0226\n\rc"
-    "amera_result\030\001 \001(\0132\037.mavcam.rpc.camera.C"
-    "ameraResult\"N\n\024SelectCameraResponse\0226\n\rc"
-    "amera_result\030\001 \001(\0132\037.mavcam.rpc.camera.C"
-    "ameraResult\"(\n\023SelectCameraRequest\022\021\n\tca"
-    "mera_id\030\001 \001(\005\"\026\n\024ResetSettingsRequest\"O\n"
-    "\025ResetSettingsResponse\0226\n\rcamera_result\030"
-    "\001 \001(\0132\037.mavcam.rpc.camera.CameraResult\"("
-    "\n\023SetTimestampRequest\022\021\n\ttimestamp\030\001 \001(\003"
-    "\"N\n\024SetTimestampResponse\0226\n\rcamera_resul"
-    "t\030\001 \001(\0132\037.mavcam.rpc.camera.CameraResult"
-    "\"\301\002\n\014CameraResult\0226\n\006result\030\001 \001(\0162&.mavc"
-    "am.rpc.camera.CameraResult.Result\022\022\n\nres"
-    "ult_str\030\002 \001(\t\"\344\001\n\006Result\022\022\n\016RESULT_UNKNO"
-    "WN\020\000\022\022\n\016RESULT_SUCCESS\020\001\022\026\n\022RESULT_IN_PR"
-    "OGRESS\020\002\022\017\n\013RESULT_BUSY\020\003\022\021\n\rRESULT_DENI"
-    "ED\020\004\022\020\n\014RESULT_ERROR\020\005\022\022\n\016RESULT_TIMEOUT"
-    "\020\006\022\031\n\025RESULT_WRONG_ARGUMENT\020\007\022\024\n\020RESULT_"
-    "NO_SYSTEM\020\010\022\037\n\033RESULT_PROTOCOL_UNSUPPORT"
-    "ED\020\t\"q\n\010Position\022\024\n\014latitude_deg\030\001 \001(\001\022\025"
-    "\n\rlongitude_deg\030\002 \001(\001\022\033\n\023absolute_altitu"
-    "de_m\030\003 \001(\002\022\033\n\023relative_altitude_m\030\004 \001(\002\""
-    "8\n\nQuaternion\022\t\n\001w\030\001 \001(\002\022\t\n\001x\030\002 \001(\002\022\t\n\001y"
-    "\030\003 \001(\002\022\t\n\001z\030\004 \001(\002\"B\n\nEulerAngle\022\020\n\010roll_"
-    "deg\030\001 \001(\002\022\021\n\tpitch_deg\030\002 \001(\002\022\017\n\007yaw_deg\030"
-    "\003 \001(\002\"\377\001\n\013CaptureInfo\022-\n\010position\030\001 \001(\0132"
-    "\033.mavcam.rpc.camera.Position\022:\n\023attitude"
-    "_quaternion\030\002 \001(\0132\035.mavcam.rpc.camera.Qu"
-    "aternion\022;\n\024attitude_euler_angle\030\003 \001(\0132\035"
-    ".mavcam.rpc.camera.EulerAngle\022\023\n\013time_ut"
-    "c_us\030\004 \001(\004\022\022\n\nis_success\030\005 \001(\010\022\r\n\005index\030"
-    "\006 \001(\005\022\020\n\010file_url\030\007 \001(\t\"\305\001\n\023VideoStreamS"
-    "ettings\022\025\n\rframe_rate_hz\030\001 \001(\002\022!\n\031horizo"
-    "ntal_resolution_pix\030\002 \001(\r\022\037\n\027vertical_re"
-    "solution_pix\030\003 \001(\r\022\024\n\014bit_rate_b_s\030\004 \001(\r"
-    "\022\024\n\014rotation_deg\030\005 \001(\r\022\013\n\003uri\030\006 \001(\t\022\032\n\022h"
-    "orizontal_fov_deg\030\007 \001(\002\"\325\003\n\017VideoStreamI"
-    "nfo\022\021\n\tstream_id\030\001 \001(\005\0228\n\010settings\030\002 \001(\013"
-    "2&.mavcam.rpc.camera.VideoStreamSettings"
-    "\022D\n\006status\030\003 \001(\01624.mavcam.rpc.camera.Vid"
-    "eoStreamInfo.VideoStreamStatus\022H\n\010spectr"
-    "um\030\004 \001(\01626.mavcam.rpc.camera.VideoStream"
-    "Info.VideoStreamSpectrum\"]\n\021VideoStreamS"
-    "tatus\022#\n\037VIDEO_STREAM_STATUS_NOT_RUNNING"
-    "\020\000\022#\n\037VIDEO_STREAM_STATUS_IN_PROGRESS\020\001\""
-    "\205\001\n\023VideoStreamSpectrum\022!\n\035VIDEO_STREAM_"
-    "SPECTRUM_UNKNOWN\020\000\022\'\n#VIDEO_STREAM_SPECT"
-    "RUM_VISIBLE_LIGHT\020\001\022\"\n\036VIDEO_STREAM_SPEC"
-    "TRUM_INFRARED\020\002\"\207\005\n\006Status\022\020\n\010video_on\030\001"
-    " \001(\010\022\031\n\021photo_interval_on\030\002 \001(\010\022\030\n\020used_"
-    "storage_mib\030\003 \001(\002\022\035\n\025available_storage_m"
-    "ib\030\004 \001(\002\022\031\n\021total_storage_mib\030\005 \001(\002\022\030\n\020r"
-    "ecording_time_s\030\006 \001(\002\022\031\n\021media_folder_na"
-    "me\030\007 \001(\t\022\?\n\016storage_status\030\010 \001(\0162\'.mavca"
-    "m.rpc.camera.Status.StorageStatus\022\022\n\nsto"
-    "rage_id\030\t \001(\r\022;\n\014storage_type\030\n \001(\0162%.ma"
-    "vcam.rpc.camera.Status.StorageType\"\221\001\n\rS"
-    "torageStatus\022 \n\034STORAGE_STATUS_NOT_AVAIL"
-    "ABLE\020\000\022\036\n\032STORAGE_STATUS_UNFORMATTED\020\001\022\034"
-    "\n\030STORAGE_STATUS_FORMATTED\020\002\022 \n\034STORAGE_"
-    "STATUS_NOT_SUPPORTED\020\003\"\240\001\n\013StorageType\022\030"
-    "\n\024STORAGE_TYPE_UNKNOWN\020\000\022\032\n\026STORAGE_TYPE"
-    "_USB_STICK\020\001\022\023\n\017STORAGE_TYPE_SD\020\002\022\030\n\024STO"
-    "RAGE_TYPE_MICROSD\020\003\022\023\n\017STORAGE_TYPE_HD\020\007"
-    "\022\027\n\022STORAGE_TYPE_OTHER\020\376\001\"7\n\006Option\022\021\n\to"
-    "ption_id\030\001 \001(\t\022\032\n\022option_description\030\002 \001"
-    "(\t\"w\n\007Setting\022\022\n\nsetting_id\030\001 \001(\t\022\033\n\023set"
-    "ting_description\030\002 \001(\t\022)\n\006option\030\003 \001(\0132\031"
-    ".mavcam.rpc.camera.Option\022\020\n\010is_range\030\004 "
-    "\001(\010\"\177\n\016SettingOptions\022\022\n\nsetting_id\030\001 \001("
-    "\t\022\033\n\023setting_description\030\002 \001(\t\022*\n\007option"
-    "s\030\003 \003(\0132\031.mavcam.rpc.camera.Option\022\020\n\010is"
-    "_range\030\004 \001(\010\"\220\007\n\013Information\022\023\n\013vendor_n"
-    "ame\030\001 \001(\t\022\022\n\nmodel_name\030\002 \001(\t\022\030\n\020firmwar"
-    "e_version\030\003 \001(\t\022\027\n\017focal_length_mm\030\004 \001(\002"
-    "\022!\n\031horizontal_sensor_size_mm\030\005 \001(\002\022\037\n\027v"
-    "ertical_sensor_size_mm\030\006 \001(\002\022 \n\030horizont"
-    "al_resolution_px\030\007 \001(\r\022\036\n\026vertical_resol"
-    "ution_px\030\010 \001(\r\022\017\n\007lens_id\030\t \001(\r\022\037\n\027defin"
-    "ition_file_version\030\n \001(\r\022\033\n\023definition_f"
-    "ile_uri\030\013 \001(\t\022G\n\020camera_cap_flags\030\014 \003(\0162"
-    "-.mavcam.rpc.camera.Information.CameraCa"
-    "pFlags\"\206\004\n\016CameraCapFlags\022\"\n\036CAMERA_CAP_"
-    "FLAGS_CAPTURE_VIDEO\020\000\022\"\n\036CAMERA_CAP_FLAG"
-    "S_CAPTURE_IMAGE\020\001\022\036\n\032CAMERA_CAP_FLAGS_HA"
-    "S_MODES\020\002\0224\n0CAMERA_CAP_FLAGS_CAN_CAPTUR"
-    "E_IMAGE_IN_VIDEO_MODE\020\003\0224\n0CAMERA_CAP_FL"
-    "AGS_CAN_CAPTURE_VIDEO_IN_IMAGE_MODE\020\004\022*\n"
-    "&CAMERA_CAP_FLAGS_HAS_IMAGE_SURVEY_MODE\020"
-    "\005\022#\n\037CAMERA_CAP_FLAGS_HAS_BASIC_ZOOM\020\006\022$"
-    "\n CAMERA_CAP_FLAGS_HAS_BASIC_FOCUS\020\007\022%\n!"
-    "CAMERA_CAP_FLAGS_HAS_VIDEO_STREAM\020\010\022\'\n#C"
-    "AMERA_CAP_FLAGS_HAS_TRACKING_POINT\020\t\022+\n\'"
-    "CAMERA_CAP_FLAGS_HAS_TRACKING_RECTANGLE\020"
-    "\n\022,\n(CAMERA_CAP_FLAGS_HAS_TRACKING_GEO_S"
-    "TATUS\020\013*8\n\004Mode\022\020\n\014MODE_UNKNOWN\020\000\022\016\n\nMOD"
-    "E_PHOTO\020\001\022\016\n\nMODE_VIDEO\020\002*F\n\013PhotosRange"
-    "\022\024\n\020PHOTOS_RANGE_ALL\020\000\022!\n\035PHOTOS_RANGE_S"
-    "INCE_CONNECTION\020\0012\234\023\n\rCameraService\022R\n\007P"
-    "repare\022!.mavcam.rpc.camera.PrepareReques"
-    "t\032\".mavcam.rpc.camera.PrepareResponse\"\000\022"
-    "X\n\tTakePhoto\022#.mavcam.rpc.camera.TakePho"
-    "toRequest\032$.mavcam.rpc.camera.TakePhotoR"
-    "esponse\"\000\022s\n\022StartPhotoInterval\022,.mavcam"
-    ".rpc.camera.StartPhotoIntervalRequest\032-."
-    "mavcam.rpc.camera.StartPhotoIntervalResp"
-    "onse\"\000\022p\n\021StopPhotoInterval\022+.mavcam.rpc"
-    ".camera.StopPhotoIntervalRequest\032,.mavca"
-    "m.rpc.camera.StopPhotoIntervalResponse\"\000"
-    "\022[\n\nStartVideo\022$.mavcam.rpc.camera.Start"
-    "VideoRequest\032%.mavcam.rpc.camera.StartVi"
-    "deoResponse\"\000\022X\n\tStopVideo\022#.mavcam.rpc."
-    "camera.StopVideoRequest\032$.mavcam.rpc.cam"
-    "era.StopVideoResponse\"\000\022z\n\023StartVideoStr"
-    "eaming\022-.mavcam.rpc.camera.StartVideoStr"
-    "eamingRequest\032..mavcam.rpc.camera.StartV"
-    "ideoStreamingResponse\"\004\200\265\030\001\022w\n\022StopVideo"
-    "Streaming\022,.mavcam.rpc.camera.StopVideoS"
-    "treamingRequest\032-.mavcam.rpc.camera.Stop"
-    "VideoStreamingResponse\"\004\200\265\030\001\022R\n\007SetMode\022"
-    "!.mavcam.rpc.camera.SetModeRequest\032\".mav"
-    "cam.rpc.camera.SetModeResponse\"\000\022[\n\nList"
-    "Photos\022$.mavcam.rpc.camera.ListPhotosReq"
-    "uest\032%.mavcam.rpc.camera.ListPhotosRespo"
-    "nse\"\000\022]\n\rSubscribeMode\022\'.mavcam.rpc.came"
-    "ra.SubscribeModeRequest\032\037.mavcam.rpc.cam"
-    "era.ModeResponse\"\0000\001\022r\n\024SubscribeInforma"
-    "tion\022..mavcam.rpc.camera.SubscribeInform"
-    "ationRequest\032&.mavcam.rpc.camera.Informa"
-    "tionResponse\"\0000\001\022~\n\030SubscribeVideoStream"
-    "Info\0222.mavcam.rpc.camera.SubscribeVideoS"
-    "treamInfoRequest\032*.mavcam.rpc.camera.Vid"
-    "eoStreamInfoResponse\"\0000\001\022v\n\024SubscribeCap"
-    "tureInfo\022..mavcam.rpc.camera.SubscribeCa"
-    "ptureInfoRequest\032&.mavcam.rpc.camera.Cap"
-    "tureInfoResponse\"\004\200\265\030\0000\001\022c\n\017SubscribeSta"
-    "tus\022).mavcam.rpc.camera.SubscribeStatusR"
-    "equest\032!.mavcam.rpc.camera.StatusRespons"
-    "e\"\0000\001\022\202\001\n\030SubscribeCurrentSettings\0222.mav"
-    "cam.rpc.camera.SubscribeCurrentSettingsR"
-    "equest\032*.mavcam.rpc.camera.CurrentSettin"
-    "gsResponse\"\004\200\265\030\0000\001\022\223\001\n\037SubscribePossible"
-    "SettingOptions\0229.mavcam.rpc.camera.Subsc"
-    "ribePossibleSettingOptionsRequest\0321.mavc"
-    "am.rpc.camera.PossibleSettingOptionsResp"
-    "onse\"\0000\001\022[\n\nSetSetting\022$.mavcam.rpc.came"
-    "ra.SetSettingRequest\032%.mavcam.rpc.camera"
-    ".SetSettingResponse\"\000\022[\n\nGetSetting\022$.ma"
-    "vcam.rpc.camera.GetSettingRequest\032%.mavc"
-    "am.rpc.camera.GetSettingResponse\"\000\022d\n\rFo"
-    "rmatStorage\022\'.mavcam.rpc.camera.FormatSt"
-    "orageRequest\032(.mavcam.rpc.camera.FormatS"
-    "torageResponse\"\000\022e\n\014SelectCamera\022&.mavca"
-    "m.rpc.camera.SelectCameraRequest\032\'.mavca"
-    "m.rpc.camera.SelectCameraResponse\"\004\200\265\030\001\022"
-    "d\n\rResetSettings\022\'.mavcam.rpc.camera.Res"
-    "etSettingsRequest\032(.mavcam.rpc.camera.Re"
-    "setSettingsResponse\"\000\022a\n\014SetTimestamp\022&."
-    "mavcam.rpc.camera.SetTimestampRequest\032\'."
-    "mavcam.rpc.camera.SetTimestampResponse\"\000"
-    "B\037\n\020io.mavcam.cameraB\013CameraProtob\006proto"
-    "3"
+    "mera.CameraResult\022+\n\007setting\030\002 \001(\0132\032.mav"
+    "cam.rpc.camera.Setting\"*\n\024FormatStorageR"
+    "equest\022\022\n\nstorage_id\030\001 \001(\005\"O\n\025FormatStor"
+    "ageResponse\0226\n\rcamera_result\030\001 \001(\0132\037.mav"
+    "cam.rpc.camera.CameraResult\"N\n\024SelectCam"
+    "eraResponse\0226\n\rcamera_result\030\001 \001(\0132\037.mav"
+    "cam.rpc.camera.CameraResult\"(\n\023SelectCam"
+    "eraRequest\022\021\n\tcamera_id\030\001 \001(\005\"\026\n\024ResetSe"
+    "ttingsRequest\"O\n\025ResetSettingsResponse\0226"
+    "\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc.camer"
+    "a.CameraResult\"(\n\023SetTimestampRequest\022\021\n"
+    "\ttimestamp\030\001 \001(\003\"N\n\024SetTimestampResponse"
+    "\0226\n\rcamera_result\030\001 \001(\0132\037.mavcam.rpc.cam"
+    "era.CameraResult\"\301\002\n\014CameraResult\0226\n\006res"
+    "ult\030\001 \001(\0162&.mavcam.rpc.camera.CameraResu"
+    "lt.Result\022\022\n\nresult_str\030\002 \001(\t\"\344\001\n\006Result"
+    "\022\022\n\016RESULT_UNKNOWN\020\000\022\022\n\016RESULT_SUCCESS\020\001"
+    "\022\026\n\022RESULT_IN_PROGRESS\020\002\022\017\n\013RESULT_BUSY\020"
+    "\003\022\021\n\rRESULT_DENIED\020\004\022\020\n\014RESULT_ERROR\020\005\022\022"
+    "\n\016RESULT_TIMEOUT\020\006\022\031\n\025RESULT_WRONG_ARGUM"
+    "ENT\020\007\022\024\n\020RESULT_NO_SYSTEM\020\010\022\037\n\033RESULT_PR"
+    "OTOCOL_UNSUPPORTED\020\t\"q\n\010Position\022\024\n\014lati"
+    "tude_deg\030\001 \001(\001\022\025\n\rlongitude_deg\030\002 \001(\001\022\033\n"
+    "\023absolute_altitude_m\030\003 \001(\002\022\033\n\023relative_a"
+    "ltitude_m\030\004 \001(\002\"8\n\nQuaternion\022\t\n\001w\030\001 \001(\002"
+    "\022\t\n\001x\030\002 \001(\002\022\t\n\001y\030\003 \001(\002\022\t\n\001z\030\004 \001(\002\"B\n\nEul"
+    "erAngle\022\020\n\010roll_deg\030\001 \001(\002\022\021\n\tpitch_deg\030\002"
+    " \001(\002\022\017\n\007yaw_deg\030\003 \001(\002\"\377\001\n\013CaptureInfo\022-\n"
+    "\010position\030\001 \001(\0132\033.mavcam.rpc.camera.Posi"
+    "tion\022:\n\023attitude_quaternion\030\002 \001(\0132\035.mavc"
+    "am.rpc.camera.Quaternion\022;\n\024attitude_eul"
+    "er_angle\030\003 \001(\0132\035.mavcam.rpc.camera.Euler"
+    "Angle\022\023\n\013time_utc_us\030\004 \001(\004\022\022\n\nis_success"
+    "\030\005 \001(\010\022\r\n\005index\030\006 \001(\005\022\020\n\010file_url\030\007 \001(\t\""
+    "\305\001\n\023VideoStreamSettings\022\025\n\rframe_rate_hz"
+    "\030\001 \001(\002\022!\n\031horizontal_resolution_pix\030\002 \001("
+    "\r\022\037\n\027vertical_resolution_pix\030\003 \001(\r\022\024\n\014bi"
+    "t_rate_b_s\030\004 \001(\r\022\024\n\014rotation_deg\030\005 \001(\r\022\013"
+    "\n\003uri\030\006 \001(\t\022\032\n\022horizontal_fov_deg\030\007 \001(\002\""
+    "\325\003\n\017VideoStreamInfo\022\021\n\tstream_id\030\001 \001(\005\0228"
+    "\n\010settings\030\002 \001(\0132&.mavcam.rpc.camera.Vid"
+    "eoStreamSettings\022D\n\006status\030\003 \001(\01624.mavca"
+    "m.rpc.camera.VideoStreamInfo.VideoStream"
+    "Status\022H\n\010spectrum\030\004 \001(\01626.mavcam.rpc.ca"
+    "mera.VideoStreamInfo.VideoStreamSpectrum"
+    "\"]\n\021VideoStreamStatus\022#\n\037VIDEO_STREAM_ST"
+    "ATUS_NOT_RUNNING\020\000\022#\n\037VIDEO_STREAM_STATU"
+    "S_IN_PROGRESS\020\001\"\205\001\n\023VideoStreamSpectrum\022"
+    "!\n\035VIDEO_STREAM_SPECTRUM_UNKNOWN\020\000\022\'\n#VI"
+    "DEO_STREAM_SPECTRUM_VISIBLE_LIGHT\020\001\022\"\n\036V"
+    "IDEO_STREAM_SPECTRUM_INFRARED\020\002\"\207\005\n\006Stat"
+    "us\022\020\n\010video_on\030\001 \001(\010\022\031\n\021photo_interval_o"
+    "n\030\002 \001(\010\022\030\n\020used_storage_mib\030\003 \001(\002\022\035\n\025ava"
+    "ilable_storage_mib\030\004 \001(\002\022\031\n\021total_storag"
+    "e_mib\030\005 \001(\002\022\030\n\020recording_time_s\030\006 \001(\002\022\031\n"
+    "\021media_folder_name\030\007 \001(\t\022\?\n\016storage_stat"
+    "us\030\010 \001(\0162\'.mavcam.rpc.camera.Status.Stor"
+    "ageStatus\022\022\n\nstorage_id\030\t \001(\r\022;\n\014storage"
+    "_type\030\n \001(\0162%.mavcam.rpc.camera.Status.S"
+    "torageType\"\221\001\n\rStorageStatus\022 \n\034STORAGE_"
+    "STATUS_NOT_AVAILABLE\020\000\022\036\n\032STORAGE_STATUS"
+    "_UNFORMATTED\020\001\022\034\n\030STORAGE_STATUS_FORMATT"
+    "ED\020\002\022 \n\034STORAGE_STATUS_NOT_SUPPORTED\020\003\"\240"
+    "\001\n\013StorageType\022\030\n\024STORAGE_TYPE_UNKNOWN\020\000"
+    "\022\032\n\026STORAGE_TYPE_USB_STICK\020\001\022\023\n\017STORAGE_"
+    "TYPE_SD\020\002\022\030\n\024STORAGE_TYPE_MICROSD\020\003\022\023\n\017S"
+    "TORAGE_TYPE_HD\020\007\022\027\n\022STORAGE_TYPE_OTHER\020\376"
+    "\001\"7\n\006Option\022\021\n\toption_id\030\001 \001(\t\022\032\n\022option"
+    "_description\030\002 \001(\t\"w\n\007Setting\022\022\n\nsetting"
+    "_id\030\001 \001(\t\022\033\n\023setting_description\030\002 \001(\t\022)"
+    "\n\006option\030\003 \001(\0132\031.mavcam.rpc.camera.Optio"
+    "n\022\020\n\010is_range\030\004 \001(\010\"\177\n\016SettingOptions\022\022\n"
+    "\nsetting_id\030\001 \001(\t\022\033\n\023setting_description"
+    "\030\002 \001(\t\022*\n\007options\030\003 \003(\0132\031.mavcam.rpc.cam"
+    "era.Option\022\020\n\010is_range\030\004 \001(\010\"\\\n\016AppliedS"
+    "etting\0226\n\006result\030\001 \001(\0162&.mavcam.rpc.came"
+    "ra.CameraResult.Result\022\022\n\nsetting_id\030\002 \001"
+    "(\t\"\270\001\n\nCallMetric\022\014\n\004name\030\001 \001(\t\022\r\n\005count"
+    "\030\002 \001(\004\022\023\n\013error_count\030\003 \001(\004\022\030\n\020total_lat"
+    "ency_us\030\004 \001(\004\022\026\n\016max_latency_us\030\005 \001(\004\022\026\n"
+    "\016p50_latency_us\030\006 \001(\004\022\026\n\016p90_latency_us\030"
+    "\007 \001(\004\022\026\n\016p99_latency_us\030\010 \001(\004\"\220\007\n\013Inform"
+    "ation\022\023\n\013vendor_name\030\001 \001(\t\022\022\n\nmodel_name"
+    "\030\002 \001(\t\022\030\n\020firmware_version\030\003 \001(\t\022\027\n\017foca"
+    "l_length_mm\030\004 \001(\002\022!\n\031horizontal_sensor_s"
+    "ize_mm\030\005 \001(\002\022\037\n\027vertical_sensor_size_mm\030"
+    "\006 \001(\002\022 \n\030horizontal_resolution_px\030\007 \001(\r\022"
+    "\036\n\026vertical_resolution_px\030\010 \001(\r\022\017\n\007lens_"
+    "id\030\t \001(\r\022\037\n\027definition_file_version\030\n \001("
+    "\r\022\033\n\023definition_file_uri\030\013 \001(\t\022G\n\020camera"
+    "_cap_flags\030\014 \003(\0162-.mavcam.rpc.camera.Inf"
+    "ormation.CameraCapFlags\"\206\004\n\016CameraCapFla"
+    "gs\022\"\n\036CAMERA_CAP_FLAGS_CAPTURE_VIDEO\020\000\022\""
+    "\n\036CAMERA_CAP_FLAGS_CAPTURE_IMAGE\020\001\022\036\n\032CA"
+    "MERA_CAP_FLAGS_HAS_MODES\020\002\0224\n0CAMERA_CAP"
+    "_FLAGS_CAN_CAPTURE_IMAGE_IN_VIDEO_MODE\020\003"
+    "\0224\n0CAMERA_CAP_FLAGS_CAN_CAPTURE_VIDEO_I"
+    "N_IMAGE_MODE\020\004\022*\n&CAMERA_CAP_FLAGS_HAS_I"
+    "MAGE_SURVEY_MODE\020\005\022#\n\037CAMERA_CAP_FLAGS_H"
+    "AS_BASIC_ZOOM\020\006\022$\n CAMERA_CAP_FLAGS_HAS_"
+    "BASIC_FOCUS\020\007\022%\n!CAMERA_CAP_FLAGS_HAS_VI"
+    "DEO_STREAM\020\010\022\'\n#CAMERA_CAP_FLAGS_HAS_TRA"
+    "CKING_POINT\020\t\022+\n\'CAMERA_CAP_FLAGS_HAS_TR"
+    "ACKING_RECTANGLE\020\n\022,\n(CAMERA_CAP_FLAGS_H"
+    "AS_TRACKING_GEO_STATUS\020\013*8\n\004Mode\022\020\n\014MODE"
+    "_UNKNOWN\020\000\022\016\n\nMODE_PHOTO\020\001\022\016\n\nMODE_VIDEO"
+    "\020\002*F\n\013PhotosRange\022\024\n\020PHOTOS_RANGE_ALL\020\000\022"
+    "!\n\035PHOTOS_RANGE_SINCE_CONNECTION\020\0012\266\025\n\rC"
+    "ameraService\022R\n\007Prepare\022!.mavcam.rpc.cam"
+    "era.PrepareRequest\032\".mavcam.rpc.camera.P"
+    "repareResponse\"\000\022X\n\tTakePhoto\022#.mavcam.r"
+    "pc.camera.TakePhotoRequest\032$.mavcam.rpc."
+    "camera.TakePhotoResponse\"\000\022s\n\022StartPhoto"
+    "Interval\022,.mavcam.rpc.camera.StartPhotoI"
+    "ntervalRequest\032-.mavcam.rpc.camera.Start"
+    "PhotoIntervalResponse\"\000\022p\n\021StopPhotoInte"
+    "rval\022+.mavcam.rpc.camera.StopPhotoInterv"
+    "alRequest\032,.mavcam.rpc.camera.StopPhotoI"
+    "ntervalResponse\"\000\022[\n\nStartVideo\022$.mavcam"
+    ".rpc.camera.StartVideoRequest\032%.mavcam.r"
+    "pc.camera.StartVideoResponse\"\000\022X\n\tStopVi"
+    "deo\022#.mavcam.rpc.camera.StopVideoRequest"
+    "\032$.mavcam.rpc.camera.StopVideoResponse\"\000"
+    "\022z\n\023StartVideoStreaming\022-.mavcam.rpc.cam"
+    "era.StartVideoStreamingRequest\032..mavcam."
+    "rpc.camera.StartVideoStreamingResponse\"\004"
+    "\200\265\030\001\022w\n\022StopVideoStreaming\022,.mavcam.rpc."
+    "camera.StopVideoStreamingRequest\032-.mavca"
+    "m.rpc.camera.StopVideoStreamingResponse\""
+    "\004\200\265\030\001\022R\n\007SetMode\022!.mavcam.rpc.camera.Set"
+    "ModeRequest\032\".mavcam.rpc.camera.SetModeR"
+    "esponse\"\000\022[\n\nListPhotos\022$.mavcam.rpc.cam"
+    "era.ListPhotosRequest\032%.mavcam.rpc.camer"
+    "a.ListPhotosResponse\"\000\022]\n\rSubscribeMode\022"
+    "\'.mavcam.rpc.camera.SubscribeModeRequest"
+    "\032\037.mavcam.rpc.camera.ModeResponse\"\0000\001\022r\n"
+    "\024SubscribeInformation\022..mavcam.rpc.camer"
+    "a.SubscribeInformationRequest\032&.mavcam.r"
+    "pc.camera.InformationResponse\"\0000\001\022~\n\030Sub"
+    "scribeVideoStreamInfo\0222.mavcam.rpc.camer"
+    "a.SubscribeVideoStreamInfoRequest\032*.mavc"
+    "am.rpc.camera.VideoStreamInfoResponse\"\0000"
+    "\001\022v\n\024SubscribeCaptureInfo\022..mavcam.rpc.c"
+    "amera.SubscribeCaptureInfoRequest\032&.mavc"
+    "am.rpc.camera.CaptureInfoResponse\"\004\200\265\030\0000"
+    "\001\022c\n\017SubscribeStatus\022).mavcam.rpc.camera"
+    ".SubscribeStatusRequest\032!.mavcam.rpc.cam"
+    "era.StatusResponse\"\0000\001\022\202\001\n\030SubscribeCurr"
+    "entSettings\0222.mavcam.rpc.camera.Subscrib"
+    "eCurrentSettingsRequest\032*.mavcam.rpc.cam"
+    "era.CurrentSettingsResponse\"\004\200\265\030\0000\001\022\223\001\n\037"
+    "SubscribePossibleSettingOptions\0229.mavcam"
+    ".rpc.camera.SubscribePossibleSettingOpti"
+    "onsRequest\0321.mavcam.rpc.camera.PossibleS"
+    "ettingOptionsResponse\"\0000\001\022[\n\nSetSetting\022"
+    "$.mavcam.rpc.camera.SetSettingRequest\032%."
+    "mavcam.rpc.camera.SetSettingResponse\"\000\022["
+    "\n\nGetSetting\022$.mavcam.rpc.camera.GetSett"
+    "ingRequest\032%.mavcam.rpc.camera.GetSettin"
+    "gResponse\"\000\022d\n\rFormatStorage\022\'.mavcam.rp"
+    "c.camera.FormatStorageRequest\032(.mavcam.r"
+    "pc.camera.FormatStorageResponse\"\000\022e\n\014Sel"
+    "ectCamera\022&.mavcam.rpc.camera.SelectCame"
+    "raRequest\032\'.mavcam.rpc.camera.SelectCame"
+    "raResponse\"\004\200\265\030\001\022d\n\rResetSettings\022\'.mavc"
+    "am.rpc.camera.ResetSettingsRequest\032(.mav"
+    "cam.rpc.camera.ResetSettingsResponse\"\000\022a"
+    "\n\014SetTimestamp\022&.mavcam.rpc.camera.SetTi"
+    "mestampRequest\032\'.mavcam.rpc.camera.SetTi"
+    "mestampResponse\"\000\022^\n\013SetSettings\022%.mavca"
+    "m.rpc.camera.SetSettingsRequest\032&.mavcam"
+    ".rpc.camera.SetSettingsResponse\"\000\022[\n\nGet"
+    "Metrics\022$.mavcam.rpc.camera.GetMetricsRe"
+    "quest\032%.mavcam.rpc.camera.GetMetricsResp"
+    "onse\"\000\022[\n\nStartBurst\022$.mavcam.rpc.camera"
+    ".StartBurstRequest\032%.mavcam.rpc.camera.S"
+    "tartBurstResponse\"\000B\037\n\020io.mavcam.cameraB"
+    "\013CameraProtob\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_camera_2fcamera_2eproto_deps[1] =
     {
@@ -2082,13 +2372,13 @@ static ::absl::once_flag descriptor_table_camera_2fcamera_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_camera_2fcamera_2eproto = {
     false,
     false,
-    8881,
+    9940,
     descriptor_table_protodef_camera_2fcamera_2eproto,
     "camera/camera.proto",
     &descriptor_table_camera_2fcamera_2eproto_once,
     descriptor_table_camera_2fcamera_2eproto_deps,
     1,
-    58,
+    66,
     schemas,
     file_default_instances,
     TableStruct_camera_2fcamera_2eproto::offsets,
@@ -3399,119 +3689,58 @@ void StopPhotoIntervalResponse::InternalSwap(StopPhotoIntervalResponse* PROTOBUF
 }
 // ===================================================================
 
-class StartVideoRequest::_Internal {
- public:
-};
-
-StartVideoRequest::StartVideoRequest(::google::protobuf::Arena* arena)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoRequest)
-}
-StartVideoRequest::StartVideoRequest(
-    ::google::protobuf::Arena* arena,
-    const StartVideoRequest& from)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  StartVideoRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartVideoRequest)
-}
-
-
-
-
-
-
-
-
-
-::google::protobuf::Metadata StartVideoRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[8]);
-}
-// ===================================================================
-
-class StartVideoResponse::_Internal {
+class StartBurstRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<StartVideoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StartVideoResponse* msg);
-  static void set_has_camera_result(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::CameraResult& StartVideoResponse::_Internal::camera_result(const StartVideoResponse* msg) {
-  return *msg->_impl_.camera_result_;
-}
-StartVideoResponse::StartVideoResponse(::google::protobuf::Arena* arena)
+StartBurstRequest::StartBurstRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartBurstRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE StartVideoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-StartVideoResponse::StartVideoResponse(
-    ::google::protobuf::Arena* arena,
-    const StartVideoResponse& from)
-    : ::google::protobuf::Message(arena) {
-  StartVideoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
-                : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartVideoResponse)
+StartBurstRequest::StartBurstRequest(
+    ::google::protobuf::Arena* arena, const StartBurstRequest& from)
+    : StartBurstRequest(arena) {
+  MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE StartVideoResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartBurstRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void StartVideoResponse::SharedCtor(::_pb::Arena* arena) {
+inline void StartBurstRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_result_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, count_),
+           0,
+           offsetof(Impl_, interval_s_) -
+               offsetof(Impl_, count_) +
+               sizeof(Impl_::interval_s_));
 }
-StartVideoResponse::~StartVideoResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartVideoResponse)
+StartBurstRequest::~StartBurstRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartBurstRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StartVideoResponse::SharedDtor() {
+inline void StartBurstRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StartVideoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartVideoResponse)
+PROTOBUF_NOINLINE void StartBurstRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartBurstRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
-    _impl_.camera_result_->Clear();
-  }
-  _impl_._has_bits_.Clear();
+  ::memset(&_impl_.count_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.interval_s_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.interval_s_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StartVideoResponse::_InternalParse(
+const char* StartBurstRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -3519,48 +3748,65 @@ const char* StartVideoResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoResponse::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> StartBurstRequest::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_StartVideoResponse_default_instance_._instance,
-    ::_pbi::TcParser::GenericFallback,  // fallback
-  }, {{
-    // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_.camera_result_)}},
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_StartBurstRequest_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // float interval_s = 2;
+    {::_pbi::TcParser::FastF32S1,
+     {21, 63, 0, PROTOBUF_FIELD_OFFSET(StartBurstRequest, _impl_.interval_s_)}},
+    // int32 count = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StartBurstRequest, _impl_.count_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(StartBurstRequest, _impl_.count_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
-  }}, {{
+    // int32 count = 1;
+    {PROTOBUF_FIELD_OFFSET(StartBurstRequest, _impl_.count_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // float interval_s = 2;
+    {PROTOBUF_FIELD_OFFSET(StartBurstRequest, _impl_.interval_s_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+  }},
+  // no aux_entries
+  {{
   }},
 };
 
-::uint8_t* StartVideoResponse::_InternalSerialize(
+::uint8_t* StartBurstRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartVideoResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartBurstRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.CameraResult camera_result = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::camera_result(this),
-        _Internal::camera_result(this).GetCachedSize(), target, stream);
+  // int32 count = 1;
+  if (this->_internal_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_count(), target);
+  }
+
+  // float interval_s = 2;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_interval_s = this->_internal_interval_s();
+  ::uint32_t raw_interval_s;
+  memcpy(&raw_interval_s, &tmp_interval_s, sizeof(tmp_interval_s));
+  if (raw_interval_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        2, this->_internal_interval_s(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -3568,144 +3814,129 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartVideoResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartBurstRequest)
   return target;
 }
 
-::size_t StartVideoResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartVideoResponse)
+::size_t StartBurstRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartBurstRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.CameraResult camera_result = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
+  // int32 count = 1;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_count());
+  }
+
+  // float interval_s = 2;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_interval_s = this->_internal_interval_s();
+  ::uint32_t raw_interval_s;
+  memcpy(&raw_interval_s, &tmp_interval_s, sizeof(tmp_interval_s));
+  if (raw_interval_s != 0) {
+    total_size += 5;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StartVideoResponse::_class_data_ = {
-    StartVideoResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData StartBurstRequest::_class_data_ = {
+    StartBurstRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StartVideoResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StartBurstRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void StartVideoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StartVideoResponse*>(&to_msg);
-  auto& from = static_cast<const StartVideoResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartVideoResponse)
+void StartBurstRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StartBurstRequest*>(&to_msg);
+  auto& from = static_cast<const StartBurstRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartBurstRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
-        from._internal_camera_result());
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_interval_s = from._internal_interval_s();
+  ::uint32_t raw_interval_s;
+  memcpy(&raw_interval_s, &tmp_interval_s, sizeof(tmp_interval_s));
+  if (raw_interval_s != 0) {
+    _this->_internal_set_interval_s(from._internal_interval_s());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StartVideoResponse::CopyFrom(const StartVideoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartVideoResponse)
+void StartBurstRequest::CopyFrom(const StartBurstRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartBurstRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StartVideoResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool StartBurstRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StartVideoResponse::AccessCachedSize() const {
+::_pbi::CachedSize* StartBurstRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StartVideoResponse::InternalSwap(StartVideoResponse* PROTOBUF_RESTRICT other) {
+void StartBurstRequest::InternalSwap(StartBurstRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.camera_result_, other->_impl_.camera_result_);
-}
-
-::google::protobuf::Metadata StartVideoResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[9]);
-}
-// ===================================================================
-
-class StopVideoRequest::_Internal {
- public:
-};
-
-StopVideoRequest::StopVideoRequest(::google::protobuf::Arena* arena)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoRequest)
-}
-StopVideoRequest::StopVideoRequest(
-    ::google::protobuf::Arena* arena,
-    const StopVideoRequest& from)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  StopVideoRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StopVideoRequest)
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StartBurstRequest, _impl_.interval_s_)
+      + sizeof(StartBurstRequest::_impl_.interval_s_)
+      - PROTOBUF_FIELD_OFFSET(StartBurstRequest, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
 }
 
-
-
-
-
-
-
-
-
-::google::protobuf::Metadata StopVideoRequest::GetMetadata() const {
+::google::protobuf::Metadata StartBurstRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[10]);
+      file_level_metadata_camera_2fcamera_2eproto[8]);
 }
 // ===================================================================
 
-class StopVideoResponse::_Internal {
+class StartBurstResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<StopVideoResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<StartBurstResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StopVideoResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(StartBurstResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StartBurstResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& StopVideoResponse::_Internal::camera_result(const StopVideoResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& StartBurstResponse::_Internal::camera_result(const StartBurstResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-StopVideoResponse::StopVideoResponse(::google::protobuf::Arena* arena)
+StartBurstResponse::StartBurstResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartBurstResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StopVideoResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartBurstResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-StopVideoResponse::StopVideoResponse(
+StartBurstResponse::StartBurstResponse(
     ::google::protobuf::Arena* arena,
-    const StopVideoResponse& from)
+    const StartBurstResponse& from)
     : ::google::protobuf::Message(arena) {
-  StopVideoResponse* const _this = this;
+  StartBurstResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -3715,30 +3946,30 @@ StopVideoResponse::StopVideoResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StopVideoResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartBurstResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StopVideoResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartBurstResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void StopVideoResponse::SharedCtor(::_pb::Arena* arena) {
+inline void StartBurstResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-StopVideoResponse::~StopVideoResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StopVideoResponse)
+StartBurstResponse::~StartBurstResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartBurstResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StopVideoResponse::SharedDtor() {
+inline void StartBurstResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StopVideoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StopVideoResponse)
+PROTOBUF_NOINLINE void StartBurstResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartBurstResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -3753,7 +3984,7 @@ PROTOBUF_NOINLINE void StopVideoResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StopVideoResponse::_InternalParse(
+const char* StartBurstResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -3761,9 +3992,9 @@ const char* StopVideoResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartBurstResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(StartBurstResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -3772,17 +4003,17 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_StopVideoResponse_default_instance_._instance,
+    &_StartBurstResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StartBurstResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(StartBurstResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
@@ -3790,10 +4021,10 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoResponse::_table_ = {
   }},
 };
 
-::uint8_t* StopVideoResponse::_InternalSerialize(
+::uint8_t* StartBurstResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StopVideoResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartBurstResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -3810,12 +4041,12 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StopVideoResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartBurstResponse)
   return target;
 }
 
-::size_t StopVideoResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StopVideoResponse)
+::size_t StartBurstResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartBurstResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -3832,18 +4063,18 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoResponse::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StopVideoResponse::_class_data_ = {
-    StopVideoResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData StartBurstResponse::_class_data_ = {
+    StartBurstResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StopVideoResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StartBurstResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void StopVideoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StopVideoResponse*>(&to_msg);
-  auto& from = static_cast<const StopVideoResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StopVideoResponse)
+void StartBurstResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StartBurstResponse*>(&to_msg);
+  auto& from = static_cast<const StartBurstResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartBurstResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -3855,79 +4086,147 @@ void StopVideoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::g
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StopVideoResponse::CopyFrom(const StopVideoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StopVideoResponse)
+void StartBurstResponse::CopyFrom(const StartBurstResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartBurstResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StopVideoResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool StartBurstResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StopVideoResponse::AccessCachedSize() const {
+::_pbi::CachedSize* StartBurstResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StopVideoResponse::InternalSwap(StopVideoResponse* PROTOBUF_RESTRICT other) {
+void StartBurstResponse::InternalSwap(StartBurstResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata StopVideoResponse::GetMetadata() const {
+::google::protobuf::Metadata StartBurstResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[11]);
+      file_level_metadata_camera_2fcamera_2eproto[9]);
 }
 // ===================================================================
 
-class StartVideoStreamingRequest::_Internal {
+class StartVideoRequest::_Internal {
  public:
 };
 
-StartVideoStreamingRequest::StartVideoStreamingRequest(::google::protobuf::Arena* arena)
+StartVideoRequest::StartVideoRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoRequest)
+}
+StartVideoRequest::StartVideoRequest(
+    ::google::protobuf::Arena* arena,
+    const StartVideoRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  StartVideoRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartVideoRequest)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata StartVideoRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[10]);
+}
+// ===================================================================
+
+class StartVideoResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StartVideoResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StartVideoResponse* msg);
+  static void set_has_camera_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::mavcam::rpc::camera::CameraResult& StartVideoResponse::_Internal::camera_result(const StartVideoResponse* msg) {
+  return *msg->_impl_.camera_result_;
+}
+StartVideoResponse::StartVideoResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoStreamingRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoResponse)
 }
-StartVideoStreamingRequest::StartVideoStreamingRequest(
-    ::google::protobuf::Arena* arena, const StartVideoStreamingRequest& from)
-    : StartVideoStreamingRequest(arena) {
-  MergeFrom(from);
+inline PROTOBUF_NDEBUG_INLINE StartVideoResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+StartVideoResponse::StartVideoResponse(
+    ::google::protobuf::Arena* arena,
+    const StartVideoResponse& from)
+    : ::google::protobuf::Message(arena) {
+  StartVideoResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartVideoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StartVideoStreamingRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartVideoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void StartVideoStreamingRequest::SharedCtor(::_pb::Arena* arena) {
+inline void StartVideoResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.stream_id_ = {};
+  _impl_.camera_result_ = {};
 }
-StartVideoStreamingRequest::~StartVideoStreamingRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartVideoStreamingRequest)
+StartVideoResponse::~StartVideoResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartVideoResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StartVideoStreamingRequest::SharedDtor() {
+inline void StartVideoResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StartVideoStreamingRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartVideoStreamingRequest)
+PROTOBUF_NOINLINE void StartVideoResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartVideoResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.stream_id_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+    _impl_.camera_result_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StartVideoStreamingRequest::_InternalParse(
+const char* StartVideoResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -3935,47 +4234,48 @@ const char* StartVideoStreamingRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StartVideoStreamingRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
     1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_StartVideoStreamingRequest_default_instance_._instance,
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_StartVideoResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // int32 stream_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StartVideoStreamingRequest, _impl_.stream_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(StartVideoStreamingRequest, _impl_.stream_id_)}},
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // int32 stream_id = 1;
-    {PROTOBUF_FIELD_OFFSET(StartVideoStreamingRequest, _impl_.stream_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {PROTOBUF_FIELD_OFFSET(StartVideoResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+  }}, {{
   }},
 };
 
-::uint8_t* StartVideoStreamingRequest::_InternalSerialize(
+::uint8_t* StartVideoResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartVideoStreamingRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartVideoResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // int32 stream_id = 1;
-  if (this->_internal_stream_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<1>(
-            stream, this->_internal_stream_id(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::camera_result(this),
+        _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -3983,106 +4283,144 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StartVideoStreamingRequest::_table_ =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartVideoStreamingRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartVideoResponse)
   return target;
 }
 
-::size_t StartVideoStreamingRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartVideoStreamingRequest)
+::size_t StartVideoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartVideoResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 stream_id = 1;
-  if (this->_internal_stream_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_stream_id());
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StartVideoStreamingRequest::_class_data_ = {
-    StartVideoStreamingRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData StartVideoResponse::_class_data_ = {
+    StartVideoResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StartVideoStreamingRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StartVideoResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void StartVideoStreamingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StartVideoStreamingRequest*>(&to_msg);
-  auto& from = static_cast<const StartVideoStreamingRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartVideoStreamingRequest)
+void StartVideoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StartVideoResponse*>(&to_msg);
+  auto& from = static_cast<const StartVideoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartVideoResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_stream_id() != 0) {
-    _this->_internal_set_stream_id(from._internal_stream_id());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+        from._internal_camera_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StartVideoStreamingRequest::CopyFrom(const StartVideoStreamingRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartVideoStreamingRequest)
+void StartVideoResponse::CopyFrom(const StartVideoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartVideoResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StartVideoStreamingRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool StartVideoResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StartVideoStreamingRequest::AccessCachedSize() const {
+::_pbi::CachedSize* StartVideoResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StartVideoStreamingRequest::InternalSwap(StartVideoStreamingRequest* PROTOBUF_RESTRICT other) {
+void StartVideoResponse::InternalSwap(StartVideoResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.stream_id_, other->_impl_.stream_id_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata StartVideoStreamingRequest::GetMetadata() const {
+::google::protobuf::Metadata StartVideoResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[11]);
+}
+// ===================================================================
+
+class StopVideoRequest::_Internal {
+ public:
+};
+
+StopVideoRequest::StopVideoRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoRequest)
+}
+StopVideoRequest::StopVideoRequest(
+    ::google::protobuf::Arena* arena,
+    const StopVideoRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  StopVideoRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StopVideoRequest)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata StopVideoRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[12]);
 }
 // ===================================================================
 
-class StartVideoStreamingResponse::_Internal {
+class StopVideoResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<StartVideoStreamingResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<StopVideoResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StartVideoStreamingResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StopVideoResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& StartVideoStreamingResponse::_Internal::camera_result(const StartVideoStreamingResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& StopVideoResponse::_Internal::camera_result(const StopVideoResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-StartVideoStreamingResponse::StartVideoStreamingResponse(::google::protobuf::Arena* arena)
+StopVideoResponse::StopVideoResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoStreamingResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StartVideoStreamingResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StopVideoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-StartVideoStreamingResponse::StartVideoStreamingResponse(
+StopVideoResponse::StopVideoResponse(
     ::google::protobuf::Arena* arena,
-    const StartVideoStreamingResponse& from)
+    const StopVideoResponse& from)
     : ::google::protobuf::Message(arena) {
-  StartVideoStreamingResponse* const _this = this;
+  StopVideoResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -4092,30 +4430,30 @@ StartVideoStreamingResponse::StartVideoStreamingResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartVideoStreamingResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StopVideoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StartVideoStreamingResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StopVideoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void StartVideoStreamingResponse::SharedCtor(::_pb::Arena* arena) {
+inline void StopVideoResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-StartVideoStreamingResponse::~StartVideoStreamingResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartVideoStreamingResponse)
+StopVideoResponse::~StopVideoResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StopVideoResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StartVideoStreamingResponse::SharedDtor() {
+inline void StopVideoResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StartVideoStreamingResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartVideoStreamingResponse)
+PROTOBUF_NOINLINE void StopVideoResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StopVideoResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -4130,7 +4468,7 @@ PROTOBUF_NOINLINE void StartVideoStreamingResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StartVideoStreamingResponse::_InternalParse(
+const char* StopVideoResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -4138,9 +4476,9 @@ const char* StartVideoStreamingResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoStreamingResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -4149,17 +4487,17 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoStreamingResponse::_table_ =
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_StartVideoStreamingResponse_default_instance_._instance,
+    &_StopVideoResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(StopVideoResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
@@ -4167,10 +4505,10 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoStreamingResponse::_table_ =
   }},
 };
 
-::uint8_t* StartVideoStreamingResponse::_InternalSerialize(
+::uint8_t* StopVideoResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartVideoStreamingResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StopVideoResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -4187,12 +4525,12 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoStreamingResponse::_table_ =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartVideoStreamingResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StopVideoResponse)
   return target;
 }
 
-::size_t StartVideoStreamingResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartVideoStreamingResponse)
+::size_t StopVideoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StopVideoResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -4209,18 +4547,18 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoStreamingResponse::_table_ =
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StartVideoStreamingResponse::_class_data_ = {
-    StartVideoStreamingResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData StopVideoResponse::_class_data_ = {
+    StopVideoResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StartVideoStreamingResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StopVideoResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void StartVideoStreamingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StartVideoStreamingResponse*>(&to_msg);
-  auto& from = static_cast<const StartVideoStreamingResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartVideoStreamingResponse)
+void StopVideoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StopVideoResponse*>(&to_msg);
+  auto& from = static_cast<const StopVideoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StopVideoResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4232,69 +4570,69 @@ void StartVideoStreamingResponse::MergeImpl(::google::protobuf::Message& to_msg,
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StartVideoStreamingResponse::CopyFrom(const StartVideoStreamingResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartVideoStreamingResponse)
+void StopVideoResponse::CopyFrom(const StopVideoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StopVideoResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StartVideoStreamingResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool StopVideoResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StartVideoStreamingResponse::AccessCachedSize() const {
+::_pbi::CachedSize* StopVideoResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StartVideoStreamingResponse::InternalSwap(StartVideoStreamingResponse* PROTOBUF_RESTRICT other) {
+void StopVideoResponse::InternalSwap(StopVideoResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata StartVideoStreamingResponse::GetMetadata() const {
+::google::protobuf::Metadata StopVideoResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[13]);
 }
 // ===================================================================
 
-class StopVideoStreamingRequest::_Internal {
+class StartVideoStreamingRequest::_Internal {
  public:
 };
 
-StopVideoStreamingRequest::StopVideoStreamingRequest(::google::protobuf::Arena* arena)
+StartVideoStreamingRequest::StartVideoStreamingRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoStreamingRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoStreamingRequest)
 }
-StopVideoStreamingRequest::StopVideoStreamingRequest(
-    ::google::protobuf::Arena* arena, const StopVideoStreamingRequest& from)
-    : StopVideoStreamingRequest(arena) {
+StartVideoStreamingRequest::StartVideoStreamingRequest(
+    ::google::protobuf::Arena* arena, const StartVideoStreamingRequest& from)
+    : StartVideoStreamingRequest(arena) {
   MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE StopVideoStreamingRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartVideoStreamingRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void StopVideoStreamingRequest::SharedCtor(::_pb::Arena* arena) {
+inline void StartVideoStreamingRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.stream_id_ = {};
 }
-StopVideoStreamingRequest::~StopVideoStreamingRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StopVideoStreamingRequest)
+StartVideoStreamingRequest::~StartVideoStreamingRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartVideoStreamingRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StopVideoStreamingRequest::SharedDtor() {
+inline void StartVideoStreamingRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StopVideoStreamingRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StopVideoStreamingRequest)
+PROTOBUF_NOINLINE void StartVideoStreamingRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartVideoStreamingRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -4304,7 +4642,7 @@ PROTOBUF_NOINLINE void StopVideoStreamingRequest::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StopVideoStreamingRequest::_InternalParse(
+const char* StartVideoStreamingRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -4312,7 +4650,7 @@ const char* StopVideoStreamingRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StopVideoStreamingRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StartVideoStreamingRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
@@ -4323,17 +4661,17 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StopVideoStreamingRequest::_table_ = {
     1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_StopVideoStreamingRequest_default_instance_._instance,
+    &_StartVideoStreamingRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // int32 stream_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StopVideoStreamingRequest, _impl_.stream_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(StopVideoStreamingRequest, _impl_.stream_id_)}},
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StartVideoStreamingRequest, _impl_.stream_id_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(StartVideoStreamingRequest, _impl_.stream_id_)}},
   }}, {{
     65535, 65535
   }}, {{
     // int32 stream_id = 1;
-    {PROTOBUF_FIELD_OFFSET(StopVideoStreamingRequest, _impl_.stream_id_), 0, 0,
+    {PROTOBUF_FIELD_OFFSET(StartVideoStreamingRequest, _impl_.stream_id_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
@@ -4341,10 +4679,10 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StopVideoStreamingRequest::_table_ = {
   }},
 };
 
-::uint8_t* StopVideoStreamingRequest::_InternalSerialize(
+::uint8_t* StartVideoStreamingRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StopVideoStreamingRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartVideoStreamingRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -4360,12 +4698,12 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StopVideoStreamingRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StopVideoStreamingRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartVideoStreamingRequest)
   return target;
 }
 
-::size_t StopVideoStreamingRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StopVideoStreamingRequest)
+::size_t StartVideoStreamingRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartVideoStreamingRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -4381,18 +4719,18 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StopVideoStreamingRequest::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StopVideoStreamingRequest::_class_data_ = {
-    StopVideoStreamingRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData StartVideoStreamingRequest::_class_data_ = {
+    StartVideoStreamingRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StopVideoStreamingRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StartVideoStreamingRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void StopVideoStreamingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StopVideoStreamingRequest*>(&to_msg);
-  auto& from = static_cast<const StopVideoStreamingRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StopVideoStreamingRequest)
+void StartVideoStreamingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StartVideoStreamingRequest*>(&to_msg);
+  auto& from = static_cast<const StartVideoStreamingRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartVideoStreamingRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4403,63 +4741,63 @@ void StopVideoStreamingRequest::MergeImpl(::google::protobuf::Message& to_msg, c
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StopVideoStreamingRequest::CopyFrom(const StopVideoStreamingRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StopVideoStreamingRequest)
+void StartVideoStreamingRequest::CopyFrom(const StartVideoStreamingRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartVideoStreamingRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StopVideoStreamingRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool StartVideoStreamingRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StopVideoStreamingRequest::AccessCachedSize() const {
+::_pbi::CachedSize* StartVideoStreamingRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StopVideoStreamingRequest::InternalSwap(StopVideoStreamingRequest* PROTOBUF_RESTRICT other) {
+void StartVideoStreamingRequest::InternalSwap(StartVideoStreamingRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
         swap(_impl_.stream_id_, other->_impl_.stream_id_);
 }
 
-::google::protobuf::Metadata StopVideoStreamingRequest::GetMetadata() const {
+::google::protobuf::Metadata StartVideoStreamingRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[14]);
 }
 // ===================================================================
 
-class StopVideoStreamingResponse::_Internal {
+class StartVideoStreamingResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<StopVideoStreamingResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<StartVideoStreamingResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StopVideoStreamingResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StartVideoStreamingResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& StopVideoStreamingResponse::_Internal::camera_result(const StopVideoStreamingResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& StartVideoStreamingResponse::_Internal::camera_result(const StartVideoStreamingResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-StopVideoStreamingResponse::StopVideoStreamingResponse(::google::protobuf::Arena* arena)
+StartVideoStreamingResponse::StartVideoStreamingResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoStreamingResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StartVideoStreamingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StopVideoStreamingResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartVideoStreamingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-StopVideoStreamingResponse::StopVideoStreamingResponse(
+StartVideoStreamingResponse::StartVideoStreamingResponse(
     ::google::protobuf::Arena* arena,
-    const StopVideoStreamingResponse& from)
+    const StartVideoStreamingResponse& from)
     : ::google::protobuf::Message(arena) {
-  StopVideoStreamingResponse* const _this = this;
+  StartVideoStreamingResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -4469,30 +4807,30 @@ StopVideoStreamingResponse::StopVideoStreamingResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StopVideoStreamingResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StartVideoStreamingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StopVideoStreamingResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StartVideoStreamingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void StopVideoStreamingResponse::SharedCtor(::_pb::Arena* arena) {
+inline void StartVideoStreamingResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-StopVideoStreamingResponse::~StopVideoStreamingResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StopVideoStreamingResponse)
+StartVideoStreamingResponse::~StartVideoStreamingResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StartVideoStreamingResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StopVideoStreamingResponse::SharedDtor() {
+inline void StartVideoStreamingResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StopVideoStreamingResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StopVideoStreamingResponse)
+PROTOBUF_NOINLINE void StartVideoStreamingResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StartVideoStreamingResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -4507,7 +4845,7 @@ PROTOBUF_NOINLINE void StopVideoStreamingResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StopVideoStreamingResponse::_InternalParse(
+const char* StartVideoStreamingResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -4515,9 +4853,9 @@ const char* StopVideoStreamingResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoStreamingResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StartVideoStreamingResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -4526,17 +4864,17 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoStreamingResponse::_table_ =
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_StopVideoStreamingResponse_default_instance_._instance,
+    &_StartVideoStreamingResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(StartVideoStreamingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
@@ -4544,10 +4882,10 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoStreamingResponse::_table_ =
   }},
 };
 
-::uint8_t* StopVideoStreamingResponse::_InternalSerialize(
+::uint8_t* StartVideoStreamingResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StopVideoStreamingResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StartVideoStreamingResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -4564,12 +4902,12 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoStreamingResponse::_table_ =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StopVideoStreamingResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StartVideoStreamingResponse)
   return target;
 }
 
-::size_t StopVideoStreamingResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StopVideoStreamingResponse)
+::size_t StartVideoStreamingResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StartVideoStreamingResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -4586,18 +4924,18 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoStreamingResponse::_table_ =
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StopVideoStreamingResponse::_class_data_ = {
-    StopVideoStreamingResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData StartVideoStreamingResponse::_class_data_ = {
+    StartVideoStreamingResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StopVideoStreamingResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StartVideoStreamingResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void StopVideoStreamingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StopVideoStreamingResponse*>(&to_msg);
-  auto& from = static_cast<const StopVideoStreamingResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StopVideoStreamingResponse)
+void StartVideoStreamingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StartVideoStreamingResponse*>(&to_msg);
+  auto& from = static_cast<const StartVideoStreamingResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StartVideoStreamingResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4609,79 +4947,79 @@ void StopVideoStreamingResponse::MergeImpl(::google::protobuf::Message& to_msg,
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StopVideoStreamingResponse::CopyFrom(const StopVideoStreamingResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StopVideoStreamingResponse)
+void StartVideoStreamingResponse::CopyFrom(const StartVideoStreamingResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StartVideoStreamingResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StopVideoStreamingResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool StartVideoStreamingResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StopVideoStreamingResponse::AccessCachedSize() const {
+::_pbi::CachedSize* StartVideoStreamingResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StopVideoStreamingResponse::InternalSwap(StopVideoStreamingResponse* PROTOBUF_RESTRICT other) {
+void StartVideoStreamingResponse::InternalSwap(StartVideoStreamingResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata StopVideoStreamingResponse::GetMetadata() const {
+::google::protobuf::Metadata StartVideoStreamingResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[15]);
 }
 // ===================================================================
 
-class SetModeRequest::_Internal {
+class StopVideoStreamingRequest::_Internal {
  public:
 };
 
-SetModeRequest::SetModeRequest(::google::protobuf::Arena* arena)
+StopVideoStreamingRequest::StopVideoStreamingRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetModeRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoStreamingRequest)
 }
-SetModeRequest::SetModeRequest(
-    ::google::protobuf::Arena* arena, const SetModeRequest& from)
-    : SetModeRequest(arena) {
+StopVideoStreamingRequest::StopVideoStreamingRequest(
+    ::google::protobuf::Arena* arena, const StopVideoStreamingRequest& from)
+    : StopVideoStreamingRequest(arena) {
   MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE SetModeRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StopVideoStreamingRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void SetModeRequest::SharedCtor(::_pb::Arena* arena) {
+inline void StopVideoStreamingRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.mode_ = {};
+  _impl_.stream_id_ = {};
 }
-SetModeRequest::~SetModeRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetModeRequest)
+StopVideoStreamingRequest::~StopVideoStreamingRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StopVideoStreamingRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SetModeRequest::SharedDtor() {
+inline void StopVideoStreamingRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SetModeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetModeRequest)
+PROTOBUF_NOINLINE void StopVideoStreamingRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StopVideoStreamingRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.mode_ = 0;
+  _impl_.stream_id_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SetModeRequest::_InternalParse(
+const char* StopVideoStreamingRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -4689,7 +5027,7 @@ const char* SetModeRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetModeRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> StopVideoStreamingRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
@@ -4700,36 +5038,36 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetModeRequest::_table_ = {
     1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_SetModeRequest_default_instance_._instance,
+    &_StopVideoStreamingRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.Mode mode = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SetModeRequest, _impl_.mode_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SetModeRequest, _impl_.mode_)}},
+    // int32 stream_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(StopVideoStreamingRequest, _impl_.stream_id_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(StopVideoStreamingRequest, _impl_.stream_id_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.Mode mode = 1;
-    {PROTOBUF_FIELD_OFFSET(SetModeRequest, _impl_.mode_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // int32 stream_id = 1;
+    {PROTOBUF_FIELD_OFFSET(StopVideoStreamingRequest, _impl_.stream_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
   }},
 };
 
-::uint8_t* SetModeRequest::_InternalSerialize(
+::uint8_t* StopVideoStreamingRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetModeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StopVideoStreamingRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // .mavcam.rpc.camera.Mode mode = 1;
-  if (this->_internal_mode() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        1, this->_internal_mode(), target);
+  // int32 stream_id = 1;
+  if (this->_internal_stream_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_stream_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -4737,106 +5075,106 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetModeRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetModeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StopVideoStreamingRequest)
   return target;
 }
 
-::size_t SetModeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetModeRequest)
+::size_t StopVideoStreamingRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StopVideoStreamingRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.Mode mode = 1;
-  if (this->_internal_mode() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_mode());
+  // int32 stream_id = 1;
+  if (this->_internal_stream_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_stream_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SetModeRequest::_class_data_ = {
-    SetModeRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData StopVideoStreamingRequest::_class_data_ = {
+    StopVideoStreamingRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SetModeRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StopVideoStreamingRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void SetModeRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SetModeRequest*>(&to_msg);
-  auto& from = static_cast<const SetModeRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetModeRequest)
+void StopVideoStreamingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StopVideoStreamingRequest*>(&to_msg);
+  auto& from = static_cast<const StopVideoStreamingRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StopVideoStreamingRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_mode() != 0) {
-    _this->_internal_set_mode(from._internal_mode());
+  if (from._internal_stream_id() != 0) {
+    _this->_internal_set_stream_id(from._internal_stream_id());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetModeRequest::CopyFrom(const SetModeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetModeRequest)
+void StopVideoStreamingRequest::CopyFrom(const StopVideoStreamingRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StopVideoStreamingRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SetModeRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool StopVideoStreamingRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SetModeRequest::AccessCachedSize() const {
+::_pbi::CachedSize* StopVideoStreamingRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SetModeRequest::InternalSwap(SetModeRequest* PROTOBUF_RESTRICT other) {
+void StopVideoStreamingRequest::InternalSwap(StopVideoStreamingRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.mode_, other->_impl_.mode_);
+        swap(_impl_.stream_id_, other->_impl_.stream_id_);
 }
 
-::google::protobuf::Metadata SetModeRequest::GetMetadata() const {
+::google::protobuf::Metadata StopVideoStreamingRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[16]);
 }
 // ===================================================================
 
-class SetModeResponse::_Internal {
+class StopVideoStreamingResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<SetModeResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<StopVideoStreamingResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetModeResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const StopVideoStreamingResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& SetModeResponse::_Internal::camera_result(const SetModeResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& StopVideoStreamingResponse::_Internal::camera_result(const StopVideoStreamingResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-SetModeResponse::SetModeResponse(::google::protobuf::Arena* arena)
+StopVideoStreamingResponse::StopVideoStreamingResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetModeResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StopVideoStreamingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SetModeResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StopVideoStreamingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-SetModeResponse::SetModeResponse(
+StopVideoStreamingResponse::StopVideoStreamingResponse(
     ::google::protobuf::Arena* arena,
-    const SetModeResponse& from)
+    const StopVideoStreamingResponse& from)
     : ::google::protobuf::Message(arena) {
-  SetModeResponse* const _this = this;
+  StopVideoStreamingResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -4846,30 +5184,30 @@ SetModeResponse::SetModeResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetModeResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StopVideoStreamingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SetModeResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StopVideoStreamingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void SetModeResponse::SharedCtor(::_pb::Arena* arena) {
+inline void StopVideoStreamingResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-SetModeResponse::~SetModeResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetModeResponse)
+StopVideoStreamingResponse::~StopVideoStreamingResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StopVideoStreamingResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SetModeResponse::SharedDtor() {
+inline void StopVideoStreamingResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SetModeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetModeResponse)
+PROTOBUF_NOINLINE void StopVideoStreamingResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StopVideoStreamingResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -4884,7 +5222,7 @@ PROTOBUF_NOINLINE void SetModeResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SetModeResponse::_InternalParse(
+const char* StopVideoStreamingResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -4892,9 +5230,9 @@ const char* SetModeResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetModeResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StopVideoStreamingResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -4903,17 +5241,17 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetModeResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_SetModeResponse_default_instance_._instance,
+    &_StopVideoStreamingResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(StopVideoStreamingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
@@ -4921,10 +5259,10 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetModeResponse::_table_ = {
   }},
 };
 
-::uint8_t* SetModeResponse::_InternalSerialize(
+::uint8_t* StopVideoStreamingResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetModeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StopVideoStreamingResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -4941,12 +5279,12 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetModeResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetModeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StopVideoStreamingResponse)
   return target;
 }
 
-::size_t SetModeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetModeResponse)
+::size_t StopVideoStreamingResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StopVideoStreamingResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -4963,18 +5301,18 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetModeResponse::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SetModeResponse::_class_data_ = {
-    SetModeResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData StopVideoStreamingResponse::_class_data_ = {
+    StopVideoStreamingResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SetModeResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StopVideoStreamingResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void SetModeResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SetModeResponse*>(&to_msg);
-  auto& from = static_cast<const SetModeResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetModeResponse)
+void StopVideoStreamingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StopVideoStreamingResponse*>(&to_msg);
+  auto& from = static_cast<const StopVideoStreamingResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StopVideoStreamingResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4986,79 +5324,79 @@ void SetModeResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::goo
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetModeResponse::CopyFrom(const SetModeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetModeResponse)
+void StopVideoStreamingResponse::CopyFrom(const StopVideoStreamingResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StopVideoStreamingResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SetModeResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool StopVideoStreamingResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SetModeResponse::AccessCachedSize() const {
+::_pbi::CachedSize* StopVideoStreamingResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SetModeResponse::InternalSwap(SetModeResponse* PROTOBUF_RESTRICT other) {
+void StopVideoStreamingResponse::InternalSwap(StopVideoStreamingResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata SetModeResponse::GetMetadata() const {
+::google::protobuf::Metadata StopVideoStreamingResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[17]);
 }
 // ===================================================================
 
-class ListPhotosRequest::_Internal {
+class SetModeRequest::_Internal {
  public:
 };
 
-ListPhotosRequest::ListPhotosRequest(::google::protobuf::Arena* arena)
+SetModeRequest::SetModeRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ListPhotosRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetModeRequest)
 }
-ListPhotosRequest::ListPhotosRequest(
-    ::google::protobuf::Arena* arena, const ListPhotosRequest& from)
-    : ListPhotosRequest(arena) {
+SetModeRequest::SetModeRequest(
+    ::google::protobuf::Arena* arena, const SetModeRequest& from)
+    : SetModeRequest(arena) {
   MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE ListPhotosRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetModeRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void ListPhotosRequest::SharedCtor(::_pb::Arena* arena) {
+inline void SetModeRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.photos_range_ = {};
+  _impl_.mode_ = {};
 }
-ListPhotosRequest::~ListPhotosRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ListPhotosRequest)
+SetModeRequest::~SetModeRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetModeRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void ListPhotosRequest::SharedDtor() {
+inline void SetModeRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void ListPhotosRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ListPhotosRequest)
+PROTOBUF_NOINLINE void SetModeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetModeRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.photos_range_ = 0;
+  _impl_.mode_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* ListPhotosRequest::_InternalParse(
+const char* SetModeRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -5066,7 +5404,7 @@ const char* ListPhotosRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ListPhotosRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetModeRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
@@ -5077,17 +5415,17 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ListPhotosRequest::_table_ = {
     1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_ListPhotosRequest_default_instance_._instance,
+    &_SetModeRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.PhotosRange photos_range = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListPhotosRequest, _impl_.photos_range_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListPhotosRequest, _impl_.photos_range_)}},
+    // .mavcam.rpc.camera.Mode mode = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SetModeRequest, _impl_.mode_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SetModeRequest, _impl_.mode_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.PhotosRange photos_range = 1;
-    {PROTOBUF_FIELD_OFFSET(ListPhotosRequest, _impl_.photos_range_), 0, 0,
+    // .mavcam.rpc.camera.Mode mode = 1;
+    {PROTOBUF_FIELD_OFFSET(SetModeRequest, _impl_.mode_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
   }},
   // no aux_entries
@@ -5095,18 +5433,18 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ListPhotosRequest::_table_ = {
   }},
 };
 
-::uint8_t* ListPhotosRequest::_InternalSerialize(
+::uint8_t* SetModeRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ListPhotosRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetModeRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // .mavcam.rpc.camera.PhotosRange photos_range = 1;
-  if (this->_internal_photos_range() != 0) {
+  // .mavcam.rpc.camera.Mode mode = 1;
+  if (this->_internal_mode() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        1, this->_internal_photos_range(), target);
+        1, this->_internal_mode(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -5114,107 +5452,106 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ListPhotosRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ListPhotosRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetModeRequest)
   return target;
 }
 
-::size_t ListPhotosRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ListPhotosRequest)
+::size_t SetModeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetModeRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.PhotosRange photos_range = 1;
-  if (this->_internal_photos_range() != 0) {
+  // .mavcam.rpc.camera.Mode mode = 1;
+  if (this->_internal_mode() != 0) {
     total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_photos_range());
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_mode());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData ListPhotosRequest::_class_data_ = {
-    ListPhotosRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData SetModeRequest::_class_data_ = {
+    SetModeRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* ListPhotosRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetModeRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void ListPhotosRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<ListPhotosRequest*>(&to_msg);
-  auto& from = static_cast<const ListPhotosRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ListPhotosRequest)
+void SetModeRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetModeRequest*>(&to_msg);
+  auto& from = static_cast<const SetModeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetModeRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_photos_range() != 0) {
-    _this->_internal_set_photos_range(from._internal_photos_range());
+  if (from._internal_mode() != 0) {
+    _this->_internal_set_mode(from._internal_mode());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ListPhotosRequest::CopyFrom(const ListPhotosRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ListPhotosRequest)
+void SetModeRequest::CopyFrom(const SetModeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetModeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool ListPhotosRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetModeRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* ListPhotosRequest::AccessCachedSize() const {
+::_pbi::CachedSize* SetModeRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void ListPhotosRequest::InternalSwap(ListPhotosRequest* PROTOBUF_RESTRICT other) {
+void SetModeRequest::InternalSwap(SetModeRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.photos_range_, other->_impl_.photos_range_);
+  swap(_impl_.mode_, other->_impl_.mode_);
 }
 
-::google::protobuf::Metadata ListPhotosRequest::GetMetadata() const {
+::google::protobuf::Metadata SetModeRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[18]);
 }
 // ===================================================================
 
-class ListPhotosResponse::_Internal {
+class SetModeResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<ListPhotosResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<SetModeResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const ListPhotosResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetModeResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& ListPhotosResponse::_Internal::camera_result(const ListPhotosResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& SetModeResponse::_Internal::camera_result(const SetModeResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-ListPhotosResponse::ListPhotosResponse(::google::protobuf::Arena* arena)
+SetModeResponse::SetModeResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ListPhotosResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetModeResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE ListPhotosResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetModeResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        capture_infos_{visibility, arena, from.capture_infos_} {}
+        _cached_size_{0} {}
 
-ListPhotosResponse::ListPhotosResponse(
+SetModeResponse::SetModeResponse(
     ::google::protobuf::Arena* arena,
-    const ListPhotosResponse& from)
+    const SetModeResponse& from)
     : ::google::protobuf::Message(arena) {
-  ListPhotosResponse* const _this = this;
+  SetModeResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -5224,37 +5561,35 @@ ListPhotosResponse::ListPhotosResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.ListPhotosResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetModeResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE ListPhotosResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetModeResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        capture_infos_{visibility, arena} {}
+      : _cached_size_{0} {}
 
-inline void ListPhotosResponse::SharedCtor(::_pb::Arena* arena) {
+inline void SetModeResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-ListPhotosResponse::~ListPhotosResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ListPhotosResponse)
+SetModeResponse::~SetModeResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetModeResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void ListPhotosResponse::SharedDtor() {
+inline void SetModeResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void ListPhotosResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ListPhotosResponse)
+PROTOBUF_NOINLINE void SetModeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetModeResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.capture_infos_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     ABSL_DCHECK(_impl_.camera_result_ != nullptr);
@@ -5264,7 +5599,7 @@ PROTOBUF_NOINLINE void ListPhotosResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* ListPhotosResponse::_InternalParse(
+const char* SetModeResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -5272,46 +5607,39 @@ const char* ListPhotosResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> ListPhotosResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetModeResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
+    1,  // num_field_entries
+    1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_ListPhotosResponse_default_instance_._instance,
+    &_SetModeResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.capture_infos_)}},
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(SetModeResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
-    {PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.capture_infos_), -1, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CaptureInfo>()},
   }}, {{
   }},
 };
 
-::uint8_t* ListPhotosResponse::_InternalSerialize(
+::uint8_t* SetModeResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ListPhotosResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetModeResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -5323,37 +5651,23 @@ const ::_pbi::TcParseTable<1, 2, 2, 0, 2> ListPhotosResponse::_table_ = {
         _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
-  // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_capture_infos_size()); i < n; i++) {
-    const auto& repfield = this->_internal_capture_infos().Get(i);
-    target = ::google::protobuf::internal::WireFormatLite::
-        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ListPhotosResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetModeResponse)
   return target;
 }
 
-::size_t ListPhotosResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ListPhotosResponse)
+::size_t SetModeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetModeResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
-  total_size += 1UL * this->_internal_capture_infos_size();
-  for (const auto& msg : this->_internal_capture_infos()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-  }
   // .mavcam.rpc.camera.CameraResult camera_result = 1;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
@@ -5364,24 +5678,22 @@ const ::_pbi::TcParseTable<1, 2, 2, 0, 2> ListPhotosResponse::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData ListPhotosResponse::_class_data_ = {
-    ListPhotosResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData SetModeResponse::_class_data_ = {
+    SetModeResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* ListPhotosResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetModeResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void ListPhotosResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<ListPhotosResponse*>(&to_msg);
-  auto& from = static_cast<const ListPhotosResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ListPhotosResponse)
+void SetModeResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetModeResponse*>(&to_msg);
+  auto& from = static_cast<const SetModeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetModeResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_capture_infos()->MergeFrom(
-      from._internal_capture_infos());
   if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
     _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
         from._internal_camera_result());
@@ -5389,148 +5701,79 @@ void ListPhotosResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ListPhotosResponse::CopyFrom(const ListPhotosResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ListPhotosResponse)
+void SetModeResponse::CopyFrom(const SetModeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetModeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool ListPhotosResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetModeResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* ListPhotosResponse::AccessCachedSize() const {
+::_pbi::CachedSize* SetModeResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void ListPhotosResponse::InternalSwap(ListPhotosResponse* PROTOBUF_RESTRICT other) {
+void SetModeResponse::InternalSwap(SetModeResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.capture_infos_.InternalSwap(&other->_impl_.capture_infos_);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata ListPhotosResponse::GetMetadata() const {
+::google::protobuf::Metadata SetModeResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[19]);
 }
 // ===================================================================
 
-class SubscribeInformationRequest::_Internal {
- public:
-};
-
-SubscribeInformationRequest::SubscribeInformationRequest(::google::protobuf::Arena* arena)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeInformationRequest)
-}
-SubscribeInformationRequest::SubscribeInformationRequest(
-    ::google::protobuf::Arena* arena,
-    const SubscribeInformationRequest& from)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribeInformationRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeInformationRequest)
-}
-
-
-
-
-
-
-
-
-
-::google::protobuf::Metadata SubscribeInformationRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[20]);
-}
-// ===================================================================
-
-class InformationResponse::_Internal {
+class ListPhotosRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<InformationResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::Information& information(const InformationResponse* msg);
-  static void set_has_information(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::Information& InformationResponse::_Internal::information(const InformationResponse* msg) {
-  return *msg->_impl_.information_;
-}
-InformationResponse::InformationResponse(::google::protobuf::Arena* arena)
+ListPhotosRequest::ListPhotosRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.InformationResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ListPhotosRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE InformationResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-InformationResponse::InformationResponse(
-    ::google::protobuf::Arena* arena,
-    const InformationResponse& from)
-    : ::google::protobuf::Message(arena) {
-  InformationResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.information_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Information>(arena, *from._impl_.information_)
-                : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.InformationResponse)
+ListPhotosRequest::ListPhotosRequest(
+    ::google::protobuf::Arena* arena, const ListPhotosRequest& from)
+    : ListPhotosRequest(arena) {
+  MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE InformationResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE ListPhotosRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void InformationResponse::SharedCtor(::_pb::Arena* arena) {
+inline void ListPhotosRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.information_ = {};
+  _impl_.photos_range_ = {};
 }
-InformationResponse::~InformationResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.InformationResponse)
+ListPhotosRequest::~ListPhotosRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ListPhotosRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void InformationResponse::SharedDtor() {
+inline void ListPhotosRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.information_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void InformationResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.InformationResponse)
+PROTOBUF_NOINLINE void ListPhotosRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ListPhotosRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.information_ != nullptr);
-    _impl_.information_->Clear();
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.photos_range_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* InformationResponse::_InternalParse(
+const char* ListPhotosRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -5538,48 +5781,47 @@ const char* InformationResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> InformationResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ListPhotosRequest::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
     1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_InformationResponse_default_instance_._instance,
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_ListPhotosRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.Information information = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_.information_)}},
+    // .mavcam.rpc.camera.PhotosRange photos_range = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListPhotosRequest, _impl_.photos_range_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListPhotosRequest, _impl_.photos_range_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.Information information = 1;
-    {PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_.information_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Information>()},
-  }}, {{
+    // .mavcam.rpc.camera.PhotosRange photos_range = 1;
+    {PROTOBUF_FIELD_OFFSET(ListPhotosRequest, _impl_.photos_range_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
   }},
 };
 
-::uint8_t* InformationResponse::_InternalSerialize(
+::uint8_t* ListPhotosRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.InformationResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ListPhotosRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.Information information = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::information(this),
-        _Internal::information(this).GetCachedSize(), target, stream);
+  // .mavcam.rpc.camera.PhotosRange photos_range = 1;
+  if (this->_internal_photos_range() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_photos_range(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -5587,159 +5829,157 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> InformationResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.InformationResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ListPhotosRequest)
   return target;
 }
 
-::size_t InformationResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.InformationResponse)
+::size_t ListPhotosRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ListPhotosRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.Information information = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.information_);
+  // .mavcam.rpc.camera.PhotosRange photos_range = 1;
+  if (this->_internal_photos_range() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_photos_range());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData InformationResponse::_class_data_ = {
-    InformationResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData ListPhotosRequest::_class_data_ = {
+    ListPhotosRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* InformationResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* ListPhotosRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void InformationResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<InformationResponse*>(&to_msg);
-  auto& from = static_cast<const InformationResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.InformationResponse)
+void ListPhotosRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ListPhotosRequest*>(&to_msg);
+  auto& from = static_cast<const ListPhotosRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ListPhotosRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_information()->::mavcam::rpc::camera::Information::MergeFrom(
-        from._internal_information());
+  if (from._internal_photos_range() != 0) {
+    _this->_internal_set_photos_range(from._internal_photos_range());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InformationResponse::CopyFrom(const InformationResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.InformationResponse)
+void ListPhotosRequest::CopyFrom(const ListPhotosRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ListPhotosRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool InformationResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool ListPhotosRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* InformationResponse::AccessCachedSize() const {
+::_pbi::CachedSize* ListPhotosRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void InformationResponse::InternalSwap(InformationResponse* PROTOBUF_RESTRICT other) {
+void ListPhotosRequest::InternalSwap(ListPhotosRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.information_, other->_impl_.information_);
+  swap(_impl_.photos_range_, other->_impl_.photos_range_);
 }
 
-::google::protobuf::Metadata InformationResponse::GetMetadata() const {
+::google::protobuf::Metadata ListPhotosRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[21]);
+      file_level_metadata_camera_2fcamera_2eproto[20]);
 }
 // ===================================================================
 
-class SubscribeModeRequest::_Internal {
+class ListPhotosResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<ListPhotosResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const ListPhotosResponse* msg);
+  static void set_has_camera_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-SubscribeModeRequest::SubscribeModeRequest(::google::protobuf::Arena* arena)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeModeRequest)
+const ::mavcam::rpc::camera::CameraResult& ListPhotosResponse::_Internal::camera_result(const ListPhotosResponse* msg) {
+  return *msg->_impl_.camera_result_;
 }
-SubscribeModeRequest::SubscribeModeRequest(
-    ::google::protobuf::Arena* arena,
-    const SubscribeModeRequest& from)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribeModeRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeModeRequest)
-}
-
-
-
-
-
-
-
-
-
-::google::protobuf::Metadata SubscribeModeRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[22]);
-}
-// ===================================================================
-
-class ModeResponse::_Internal {
- public:
-};
-
-ModeResponse::ModeResponse(::google::protobuf::Arena* arena)
+ListPhotosResponse::ListPhotosResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ModeResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ListPhotosResponse)
 }
-ModeResponse::ModeResponse(
-    ::google::protobuf::Arena* arena, const ModeResponse& from)
-    : ModeResponse(arena) {
-  MergeFrom(from);
+inline PROTOBUF_NDEBUG_INLINE ListPhotosResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        capture_infos_{visibility, arena, from.capture_infos_} {}
+
+ListPhotosResponse::ListPhotosResponse(
+    ::google::protobuf::Arena* arena,
+    const ListPhotosResponse& from)
+    : ::google::protobuf::Message(arena) {
+  ListPhotosResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.ListPhotosResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE ModeResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE ListPhotosResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+      : _cached_size_{0},
+        capture_infos_{visibility, arena} {}
 
-inline void ModeResponse::SharedCtor(::_pb::Arena* arena) {
+inline void ListPhotosResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.mode_ = {};
+  _impl_.camera_result_ = {};
 }
-ModeResponse::~ModeResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ModeResponse)
+ListPhotosResponse::~ListPhotosResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ListPhotosResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void ModeResponse::SharedDtor() {
+inline void ListPhotosResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void ModeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ModeResponse)
+PROTOBUF_NOINLINE void ListPhotosResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ListPhotosResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.mode_ = 0;
+  _impl_.capture_infos_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+    _impl_.camera_result_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* ModeResponse::_InternalParse(
+const char* ListPhotosResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -5747,47 +5987,63 @@ const char* ModeResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ModeResponse::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> ListPhotosResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_ModeResponse_default_instance_._instance,
+    2,  // num_field_entries
+    2,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_ListPhotosResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.Mode mode = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ModeResponse, _impl_.mode_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ModeResponse, _impl_.mode_)}},
+    // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.capture_infos_)}},
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.Mode mode = 1;
-    {PROTOBUF_FIELD_OFFSET(ModeResponse, _impl_.mode_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-  }},
-  // no aux_entries
-  {{
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
+    {PROTOBUF_FIELD_OFFSET(ListPhotosResponse, _impl_.capture_infos_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CaptureInfo>()},
+  }}, {{
   }},
 };
 
-::uint8_t* ModeResponse::_InternalSerialize(
+::uint8_t* ListPhotosResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ModeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ListPhotosResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // .mavcam.rpc.camera.Mode mode = 1;
-  if (this->_internal_mode() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        1, this->_internal_mode(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::camera_result(this),
+        _Internal::camera_result(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_capture_infos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_capture_infos().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -5795,94 +6051,106 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ModeResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ModeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ListPhotosResponse)
   return target;
 }
 
-::size_t ModeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ModeResponse)
+::size_t ListPhotosResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ListPhotosResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.Mode mode = 1;
-  if (this->_internal_mode() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_mode());
+  // repeated .mavcam.rpc.camera.CaptureInfo capture_infos = 2;
+  total_size += 1UL * this->_internal_capture_infos_size();
+  for (const auto& msg : this->_internal_capture_infos()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData ModeResponse::_class_data_ = {
-    ModeResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData ListPhotosResponse::_class_data_ = {
+    ListPhotosResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* ModeResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* ListPhotosResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void ModeResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<ModeResponse*>(&to_msg);
-  auto& from = static_cast<const ModeResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ModeResponse)
+void ListPhotosResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ListPhotosResponse*>(&to_msg);
+  auto& from = static_cast<const ListPhotosResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ListPhotosResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_mode() != 0) {
-    _this->_internal_set_mode(from._internal_mode());
+  _this->_internal_mutable_capture_infos()->MergeFrom(
+      from._internal_capture_infos());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+        from._internal_camera_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ModeResponse::CopyFrom(const ModeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ModeResponse)
+void ListPhotosResponse::CopyFrom(const ListPhotosResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ListPhotosResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool ModeResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool ListPhotosResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* ModeResponse::AccessCachedSize() const {
+::_pbi::CachedSize* ListPhotosResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void ModeResponse::InternalSwap(ModeResponse* PROTOBUF_RESTRICT other) {
+void ListPhotosResponse::InternalSwap(ListPhotosResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.mode_, other->_impl_.mode_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.capture_infos_.InternalSwap(&other->_impl_.capture_infos_);
+  swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata ModeResponse::GetMetadata() const {
+::google::protobuf::Metadata ListPhotosResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[23]);
+      file_level_metadata_camera_2fcamera_2eproto[21]);
 }
 // ===================================================================
 
-class SubscribeVideoStreamInfoRequest::_Internal {
+class SubscribeInformationRequest::_Internal {
  public:
 };
 
-SubscribeVideoStreamInfoRequest::SubscribeVideoStreamInfoRequest(::google::protobuf::Arena* arena)
+SubscribeInformationRequest::SubscribeInformationRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeVideoStreamInfoRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeInformationRequest)
 }
-SubscribeVideoStreamInfoRequest::SubscribeVideoStreamInfoRequest(
+SubscribeInformationRequest::SubscribeInformationRequest(
     ::google::protobuf::Arena* arena,
-    const SubscribeVideoStreamInfoRequest& from)
+    const SubscribeInformationRequest& from)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribeVideoStreamInfoRequest* const _this = this;
+  SubscribeInformationRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeVideoStreamInfoRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeInformationRequest)
 }
 
 
@@ -5893,71 +6161,91 @@ SubscribeVideoStreamInfoRequest::SubscribeVideoStreamInfoRequest(
 
 
 
-::google::protobuf::Metadata SubscribeVideoStreamInfoRequest::GetMetadata() const {
+::google::protobuf::Metadata SubscribeInformationRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[24]);
+      file_level_metadata_camera_2fcamera_2eproto[22]);
 }
 // ===================================================================
 
-class VideoStreamInfoResponse::_Internal {
+class InformationResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<InformationResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::Information& information(const InformationResponse* msg);
+  static void set_has_information(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-VideoStreamInfoResponse::VideoStreamInfoResponse(::google::protobuf::Arena* arena)
+const ::mavcam::rpc::camera::Information& InformationResponse::_Internal::information(const InformationResponse* msg) {
+  return *msg->_impl_.information_;
+}
+InformationResponse::InformationResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.VideoStreamInfoResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.InformationResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE VideoStreamInfoResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE InformationResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : video_stream_infos_{visibility, arena, from.video_stream_infos_},
+      : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-VideoStreamInfoResponse::VideoStreamInfoResponse(
+InformationResponse::InformationResponse(
     ::google::protobuf::Arena* arena,
-    const VideoStreamInfoResponse& from)
+    const InformationResponse& from)
     : ::google::protobuf::Message(arena) {
-  VideoStreamInfoResponse* const _this = this;
+  InformationResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.information_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Information>(arena, *from._impl_.information_)
+                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.VideoStreamInfoResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.InformationResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE VideoStreamInfoResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE InformationResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : video_stream_infos_{visibility, arena},
-        _cached_size_{0} {}
+      : _cached_size_{0} {}
 
-inline void VideoStreamInfoResponse::SharedCtor(::_pb::Arena* arena) {
+inline void InformationResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.information_ = {};
 }
-VideoStreamInfoResponse::~VideoStreamInfoResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.VideoStreamInfoResponse)
+InformationResponse::~InformationResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.InformationResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void VideoStreamInfoResponse::SharedDtor() {
+inline void InformationResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.information_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void VideoStreamInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.VideoStreamInfoResponse)
+PROTOBUF_NOINLINE void InformationResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.InformationResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.video_stream_infos_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.information_ != nullptr);
+    _impl_.information_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* VideoStreamInfoResponse::_InternalParse(
+const char* InformationResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -5965,9 +6253,9 @@ const char* VideoStreamInfoResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> VideoStreamInfoResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> InformationResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -5976,37 +6264,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> VideoStreamInfoResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_VideoStreamInfoResponse_default_instance_._instance,
+    &_InformationResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfoResponse, _impl_.video_stream_infos_)}},
+    // .mavcam.rpc.camera.Information information = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_.information_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamInfoResponse, _impl_.video_stream_infos_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.Information information = 1;
+    {PROTOBUF_FIELD_OFFSET(InformationResponse, _impl_.information_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::VideoStreamInfo>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Information>()},
   }}, {{
   }},
 };
 
-::uint8_t* VideoStreamInfoResponse::_InternalSerialize(
+::uint8_t* InformationResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.VideoStreamInfoResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.InformationResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_video_stream_infos_size()); i < n; i++) {
-    const auto& repfield = this->_internal_video_stream_infos().Get(i);
-    target = ::google::protobuf::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.Information information = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::information(this),
+        _Internal::information(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -6014,93 +6302,97 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> VideoStreamInfoResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.VideoStreamInfoResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.InformationResponse)
   return target;
 }
 
-::size_t VideoStreamInfoResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.VideoStreamInfoResponse)
+::size_t InformationResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.InformationResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
-  total_size += 1UL * this->_internal_video_stream_infos_size();
-  for (const auto& msg : this->_internal_video_stream_infos()) {
+  // .mavcam.rpc.camera.Information information = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.information_);
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData VideoStreamInfoResponse::_class_data_ = {
-    VideoStreamInfoResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData InformationResponse::_class_data_ = {
+    InformationResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* VideoStreamInfoResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* InformationResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void VideoStreamInfoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<VideoStreamInfoResponse*>(&to_msg);
-  auto& from = static_cast<const VideoStreamInfoResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.VideoStreamInfoResponse)
+void InformationResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<InformationResponse*>(&to_msg);
+  auto& from = static_cast<const InformationResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.InformationResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_video_stream_infos()->MergeFrom(
-      from._internal_video_stream_infos());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_information()->::mavcam::rpc::camera::Information::MergeFrom(
+        from._internal_information());
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void VideoStreamInfoResponse::CopyFrom(const VideoStreamInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.VideoStreamInfoResponse)
+void InformationResponse::CopyFrom(const InformationResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.InformationResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool VideoStreamInfoResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool InformationResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* VideoStreamInfoResponse::AccessCachedSize() const {
+::_pbi::CachedSize* InformationResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void VideoStreamInfoResponse::InternalSwap(VideoStreamInfoResponse* PROTOBUF_RESTRICT other) {
+void InformationResponse::InternalSwap(InformationResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.video_stream_infos_.InternalSwap(&other->_impl_.video_stream_infos_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.information_, other->_impl_.information_);
 }
 
-::google::protobuf::Metadata VideoStreamInfoResponse::GetMetadata() const {
+::google::protobuf::Metadata InformationResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[25]);
+      file_level_metadata_camera_2fcamera_2eproto[23]);
 }
 // ===================================================================
 
-class SubscribeCaptureInfoRequest::_Internal {
+class SubscribeModeRequest::_Internal {
  public:
 };
 
-SubscribeCaptureInfoRequest::SubscribeCaptureInfoRequest(::google::protobuf::Arena* arena)
+SubscribeModeRequest::SubscribeModeRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeCaptureInfoRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeModeRequest)
 }
-SubscribeCaptureInfoRequest::SubscribeCaptureInfoRequest(
+SubscribeModeRequest::SubscribeModeRequest(
     ::google::protobuf::Arena* arena,
-    const SubscribeCaptureInfoRequest& from)
+    const SubscribeModeRequest& from)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribeCaptureInfoRequest* const _this = this;
+  SubscribeModeRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeCaptureInfoRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeModeRequest)
 }
 
 
@@ -6111,91 +6403,58 @@ SubscribeCaptureInfoRequest::SubscribeCaptureInfoRequest(
 
 
 
-::google::protobuf::Metadata SubscribeCaptureInfoRequest::GetMetadata() const {
+::google::protobuf::Metadata SubscribeModeRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[26]);
+      file_level_metadata_camera_2fcamera_2eproto[24]);
 }
 // ===================================================================
 
-class CaptureInfoResponse::_Internal {
+class ModeResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<CaptureInfoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CaptureInfo& capture_info(const CaptureInfoResponse* msg);
-  static void set_has_capture_info(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::CaptureInfo& CaptureInfoResponse::_Internal::capture_info(const CaptureInfoResponse* msg) {
-  return *msg->_impl_.capture_info_;
-}
-CaptureInfoResponse::CaptureInfoResponse(::google::protobuf::Arena* arena)
+ModeResponse::ModeResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CaptureInfoResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ModeResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CaptureInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-CaptureInfoResponse::CaptureInfoResponse(
-    ::google::protobuf::Arena* arena,
-    const CaptureInfoResponse& from)
-    : ::google::protobuf::Message(arena) {
-  CaptureInfoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.capture_info_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::CaptureInfo>(arena, *from._impl_.capture_info_)
-                : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CaptureInfoResponse)
+ModeResponse::ModeResponse(
+    ::google::protobuf::Arena* arena, const ModeResponse& from)
+    : ModeResponse(arena) {
+  MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE CaptureInfoResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE ModeResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void CaptureInfoResponse::SharedCtor(::_pb::Arena* arena) {
+inline void ModeResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.capture_info_ = {};
+  _impl_.mode_ = {};
 }
-CaptureInfoResponse::~CaptureInfoResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CaptureInfoResponse)
+ModeResponse::~ModeResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ModeResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void CaptureInfoResponse::SharedDtor() {
+inline void ModeResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.capture_info_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void CaptureInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CaptureInfoResponse)
+PROTOBUF_NOINLINE void ModeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ModeResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.capture_info_ != nullptr);
-    _impl_.capture_info_->Clear();
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.mode_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* CaptureInfoResponse::_InternalParse(
+const char* ModeResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -6203,48 +6462,47 @@ const char* CaptureInfoResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CaptureInfoResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> ModeResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
     1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_CaptureInfoResponse_default_instance_._instance,
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_ModeResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_.capture_info_)}},
+    // .mavcam.rpc.camera.Mode mode = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ModeResponse, _impl_.mode_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ModeResponse, _impl_.mode_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_.capture_info_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CaptureInfo>()},
-  }}, {{
+    // .mavcam.rpc.camera.Mode mode = 1;
+    {PROTOBUF_FIELD_OFFSET(ModeResponse, _impl_.mode_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
   }},
 };
 
-::uint8_t* CaptureInfoResponse::_InternalSerialize(
+::uint8_t* ModeResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CaptureInfoResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ModeResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::capture_info(this),
-        _Internal::capture_info(this).GetCachedSize(), target, stream);
+  // .mavcam.rpc.camera.Mode mode = 1;
+  if (this->_internal_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_mode(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -6252,97 +6510,94 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CaptureInfoResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CaptureInfoResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ModeResponse)
   return target;
 }
 
-::size_t CaptureInfoResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CaptureInfoResponse)
+::size_t ModeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ModeResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.capture_info_);
-  }
+  // .mavcam.rpc.camera.Mode mode = 1;
+  if (this->_internal_mode() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_mode());
+  }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData CaptureInfoResponse::_class_data_ = {
-    CaptureInfoResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData ModeResponse::_class_data_ = {
+    ModeResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* CaptureInfoResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* ModeResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void CaptureInfoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<CaptureInfoResponse*>(&to_msg);
-  auto& from = static_cast<const CaptureInfoResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CaptureInfoResponse)
+void ModeResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ModeResponse*>(&to_msg);
+  auto& from = static_cast<const ModeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ModeResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_capture_info()->::mavcam::rpc::camera::CaptureInfo::MergeFrom(
-        from._internal_capture_info());
+  if (from._internal_mode() != 0) {
+    _this->_internal_set_mode(from._internal_mode());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CaptureInfoResponse::CopyFrom(const CaptureInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CaptureInfoResponse)
+void ModeResponse::CopyFrom(const ModeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ModeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool CaptureInfoResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool ModeResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* CaptureInfoResponse::AccessCachedSize() const {
+::_pbi::CachedSize* ModeResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void CaptureInfoResponse::InternalSwap(CaptureInfoResponse* PROTOBUF_RESTRICT other) {
+void ModeResponse::InternalSwap(ModeResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.capture_info_, other->_impl_.capture_info_);
+  swap(_impl_.mode_, other->_impl_.mode_);
 }
 
-::google::protobuf::Metadata CaptureInfoResponse::GetMetadata() const {
+::google::protobuf::Metadata ModeResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[27]);
+      file_level_metadata_camera_2fcamera_2eproto[25]);
 }
 // ===================================================================
 
-class SubscribeStatusRequest::_Internal {
+class SubscribeVideoStreamInfoRequest::_Internal {
  public:
 };
 
-SubscribeStatusRequest::SubscribeStatusRequest(::google::protobuf::Arena* arena)
+SubscribeVideoStreamInfoRequest::SubscribeVideoStreamInfoRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeStatusRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeVideoStreamInfoRequest)
 }
-SubscribeStatusRequest::SubscribeStatusRequest(
+SubscribeVideoStreamInfoRequest::SubscribeVideoStreamInfoRequest(
     ::google::protobuf::Arena* arena,
-    const SubscribeStatusRequest& from)
+    const SubscribeVideoStreamInfoRequest& from)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribeStatusRequest* const _this = this;
+  SubscribeVideoStreamInfoRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeStatusRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeVideoStreamInfoRequest)
 }
 
 
@@ -6353,91 +6608,71 @@ SubscribeStatusRequest::SubscribeStatusRequest(
 
 
 
-::google::protobuf::Metadata SubscribeStatusRequest::GetMetadata() const {
+::google::protobuf::Metadata SubscribeVideoStreamInfoRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[28]);
+      file_level_metadata_camera_2fcamera_2eproto[26]);
 }
 // ===================================================================
 
-class StatusResponse::_Internal {
+class VideoStreamInfoResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<StatusResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::Status& camera_status(const StatusResponse* msg);
-  static void set_has_camera_status(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::Status& StatusResponse::_Internal::camera_status(const StatusResponse* msg) {
-  return *msg->_impl_.camera_status_;
-}
-StatusResponse::StatusResponse(::google::protobuf::Arena* arena)
+VideoStreamInfoResponse::VideoStreamInfoResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StatusResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.VideoStreamInfoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StatusResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE VideoStreamInfoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : _has_bits_{from._has_bits_},
+      : video_stream_infos_{visibility, arena, from.video_stream_infos_},
         _cached_size_{0} {}
 
-StatusResponse::StatusResponse(
+VideoStreamInfoResponse::VideoStreamInfoResponse(
     ::google::protobuf::Arena* arena,
-    const StatusResponse& from)
+    const VideoStreamInfoResponse& from)
     : ::google::protobuf::Message(arena) {
-  StatusResponse* const _this = this;
+  VideoStreamInfoResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.camera_status_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Status>(arena, *from._impl_.camera_status_)
-                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StatusResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.VideoStreamInfoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE StatusResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE VideoStreamInfoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+      : video_stream_infos_{visibility, arena},
+        _cached_size_{0} {}
 
-inline void StatusResponse::SharedCtor(::_pb::Arena* arena) {
+inline void VideoStreamInfoResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_status_ = {};
 }
-StatusResponse::~StatusResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StatusResponse)
+VideoStreamInfoResponse::~VideoStreamInfoResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.VideoStreamInfoResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void StatusResponse::SharedDtor() {
+inline void VideoStreamInfoResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.camera_status_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void StatusResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StatusResponse)
+PROTOBUF_NOINLINE void VideoStreamInfoResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.VideoStreamInfoResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.camera_status_ != nullptr);
-    _impl_.camera_status_->Clear();
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.video_stream_infos_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* StatusResponse::_InternalParse(
+const char* VideoStreamInfoResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -6445,9 +6680,9 @@ const char* StatusResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StatusResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> VideoStreamInfoResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -6456,37 +6691,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StatusResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_StatusResponse_default_instance_._instance,
+    &_VideoStreamInfoResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.Status camera_status = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_.camera_status_)}},
+    // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfoResponse, _impl_.video_stream_infos_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.Status camera_status = 1;
-    {PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_.camera_status_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamInfoResponse, _impl_.video_stream_infos_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Status>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::VideoStreamInfo>()},
   }}, {{
   }},
 };
 
-::uint8_t* StatusResponse::_InternalSerialize(
+::uint8_t* VideoStreamInfoResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StatusResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.VideoStreamInfoResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.Status camera_status = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::camera_status(this),
-        _Internal::camera_status(this).GetCachedSize(), target, stream);
+  // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_video_stream_infos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_video_stream_infos().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -6494,97 +6729,93 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StatusResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StatusResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.VideoStreamInfoResponse)
   return target;
 }
 
-::size_t StatusResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StatusResponse)
+::size_t VideoStreamInfoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.VideoStreamInfoResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.Status camera_status = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
+  total_size += 1UL * this->_internal_video_stream_infos_size();
+  for (const auto& msg : this->_internal_video_stream_infos()) {
     total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_status_);
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
   }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData StatusResponse::_class_data_ = {
-    StatusResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData VideoStreamInfoResponse::_class_data_ = {
+    VideoStreamInfoResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* StatusResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* VideoStreamInfoResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void StatusResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<StatusResponse*>(&to_msg);
-  auto& from = static_cast<const StatusResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StatusResponse)
+void VideoStreamInfoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<VideoStreamInfoResponse*>(&to_msg);
+  auto& from = static_cast<const VideoStreamInfoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.VideoStreamInfoResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_camera_status()->::mavcam::rpc::camera::Status::MergeFrom(
-        from._internal_camera_status());
-  }
+  _this->_internal_mutable_video_stream_infos()->MergeFrom(
+      from._internal_video_stream_infos());
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StatusResponse::CopyFrom(const StatusResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StatusResponse)
+void VideoStreamInfoResponse::CopyFrom(const VideoStreamInfoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.VideoStreamInfoResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool StatusResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool VideoStreamInfoResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* StatusResponse::AccessCachedSize() const {
+::_pbi::CachedSize* VideoStreamInfoResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void StatusResponse::InternalSwap(StatusResponse* PROTOBUF_RESTRICT other) {
+void VideoStreamInfoResponse::InternalSwap(VideoStreamInfoResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.camera_status_, other->_impl_.camera_status_);
+  _impl_.video_stream_infos_.InternalSwap(&other->_impl_.video_stream_infos_);
 }
 
-::google::protobuf::Metadata StatusResponse::GetMetadata() const {
+::google::protobuf::Metadata VideoStreamInfoResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[29]);
+      file_level_metadata_camera_2fcamera_2eproto[27]);
 }
 // ===================================================================
 
-class SubscribeCurrentSettingsRequest::_Internal {
+class SubscribeCaptureInfoRequest::_Internal {
  public:
 };
 
-SubscribeCurrentSettingsRequest::SubscribeCurrentSettingsRequest(::google::protobuf::Arena* arena)
+SubscribeCaptureInfoRequest::SubscribeCaptureInfoRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeCurrentSettingsRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeCaptureInfoRequest)
 }
-SubscribeCurrentSettingsRequest::SubscribeCurrentSettingsRequest(
+SubscribeCaptureInfoRequest::SubscribeCaptureInfoRequest(
     ::google::protobuf::Arena* arena,
-    const SubscribeCurrentSettingsRequest& from)
+    const SubscribeCaptureInfoRequest& from)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribeCurrentSettingsRequest* const _this = this;
+  SubscribeCaptureInfoRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeCurrentSettingsRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeCaptureInfoRequest)
 }
 
 
@@ -6595,71 +6826,91 @@ SubscribeCurrentSettingsRequest::SubscribeCurrentSettingsRequest(
 
 
 
-::google::protobuf::Metadata SubscribeCurrentSettingsRequest::GetMetadata() const {
+::google::protobuf::Metadata SubscribeCaptureInfoRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[30]);
+      file_level_metadata_camera_2fcamera_2eproto[28]);
 }
 // ===================================================================
 
-class CurrentSettingsResponse::_Internal {
+class CaptureInfoResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<CaptureInfoResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CaptureInfo& capture_info(const CaptureInfoResponse* msg);
+  static void set_has_capture_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-CurrentSettingsResponse::CurrentSettingsResponse(::google::protobuf::Arena* arena)
+const ::mavcam::rpc::camera::CaptureInfo& CaptureInfoResponse::_Internal::capture_info(const CaptureInfoResponse* msg) {
+  return *msg->_impl_.capture_info_;
+}
+CaptureInfoResponse::CaptureInfoResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CurrentSettingsResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CaptureInfoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CurrentSettingsResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CaptureInfoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : current_settings_{visibility, arena, from.current_settings_},
+      : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-CurrentSettingsResponse::CurrentSettingsResponse(
+CaptureInfoResponse::CaptureInfoResponse(
     ::google::protobuf::Arena* arena,
-    const CurrentSettingsResponse& from)
+    const CaptureInfoResponse& from)
     : ::google::protobuf::Message(arena) {
-  CurrentSettingsResponse* const _this = this;
+  CaptureInfoResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.capture_info_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::CaptureInfo>(arena, *from._impl_.capture_info_)
+                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CurrentSettingsResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CaptureInfoResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CurrentSettingsResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CaptureInfoResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : current_settings_{visibility, arena},
-        _cached_size_{0} {}
+      : _cached_size_{0} {}
 
-inline void CurrentSettingsResponse::SharedCtor(::_pb::Arena* arena) {
+inline void CaptureInfoResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.capture_info_ = {};
 }
-CurrentSettingsResponse::~CurrentSettingsResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CurrentSettingsResponse)
+CaptureInfoResponse::~CaptureInfoResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CaptureInfoResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void CurrentSettingsResponse::SharedDtor() {
+inline void CaptureInfoResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.capture_info_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void CurrentSettingsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CurrentSettingsResponse)
+PROTOBUF_NOINLINE void CaptureInfoResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CaptureInfoResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.current_settings_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.capture_info_ != nullptr);
+    _impl_.capture_info_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* CurrentSettingsResponse::_InternalParse(
+const char* CaptureInfoResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -6667,9 +6918,9 @@ const char* CurrentSettingsResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CurrentSettingsResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CaptureInfoResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -6678,37 +6929,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CurrentSettingsResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_CurrentSettingsResponse_default_instance_._instance,
+    &_CaptureInfoResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // repeated .mavcam.rpc.camera.Setting current_settings = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CurrentSettingsResponse, _impl_.current_settings_)}},
+    // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_.capture_info_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // repeated .mavcam.rpc.camera.Setting current_settings = 1;
-    {PROTOBUF_FIELD_OFFSET(CurrentSettingsResponse, _impl_.current_settings_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfoResponse, _impl_.capture_info_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CaptureInfo>()},
   }}, {{
   }},
 };
 
-::uint8_t* CurrentSettingsResponse::_InternalSerialize(
+::uint8_t* CaptureInfoResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CurrentSettingsResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CaptureInfoResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.Setting current_settings = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_current_settings_size()); i < n; i++) {
-    const auto& repfield = this->_internal_current_settings().Get(i);
-    target = ::google::protobuf::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::capture_info(this),
+        _Internal::capture_info(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -6716,93 +6967,97 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CurrentSettingsResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CurrentSettingsResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CaptureInfoResponse)
   return target;
 }
 
-::size_t CurrentSettingsResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CurrentSettingsResponse)
+::size_t CaptureInfoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CaptureInfoResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.Setting current_settings = 1;
-  total_size += 1UL * this->_internal_current_settings_size();
-  for (const auto& msg : this->_internal_current_settings()) {
+  // .mavcam.rpc.camera.CaptureInfo capture_info = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.capture_info_);
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData CurrentSettingsResponse::_class_data_ = {
-    CurrentSettingsResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData CaptureInfoResponse::_class_data_ = {
+    CaptureInfoResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* CurrentSettingsResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* CaptureInfoResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void CurrentSettingsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<CurrentSettingsResponse*>(&to_msg);
-  auto& from = static_cast<const CurrentSettingsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CurrentSettingsResponse)
+void CaptureInfoResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<CaptureInfoResponse*>(&to_msg);
+  auto& from = static_cast<const CaptureInfoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CaptureInfoResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_current_settings()->MergeFrom(
-      from._internal_current_settings());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_capture_info()->::mavcam::rpc::camera::CaptureInfo::MergeFrom(
+        from._internal_capture_info());
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CurrentSettingsResponse::CopyFrom(const CurrentSettingsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CurrentSettingsResponse)
+void CaptureInfoResponse::CopyFrom(const CaptureInfoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CaptureInfoResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool CurrentSettingsResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool CaptureInfoResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* CurrentSettingsResponse::AccessCachedSize() const {
+::_pbi::CachedSize* CaptureInfoResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void CurrentSettingsResponse::InternalSwap(CurrentSettingsResponse* PROTOBUF_RESTRICT other) {
+void CaptureInfoResponse::InternalSwap(CaptureInfoResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.current_settings_.InternalSwap(&other->_impl_.current_settings_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.capture_info_, other->_impl_.capture_info_);
 }
 
-::google::protobuf::Metadata CurrentSettingsResponse::GetMetadata() const {
+::google::protobuf::Metadata CaptureInfoResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[31]);
+      file_level_metadata_camera_2fcamera_2eproto[29]);
 }
 // ===================================================================
 
-class SubscribePossibleSettingOptionsRequest::_Internal {
+class SubscribeStatusRequest::_Internal {
  public:
 };
 
-SubscribePossibleSettingOptionsRequest::SubscribePossibleSettingOptionsRequest(::google::protobuf::Arena* arena)
+SubscribeStatusRequest::SubscribeStatusRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribePossibleSettingOptionsRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeStatusRequest)
 }
-SubscribePossibleSettingOptionsRequest::SubscribePossibleSettingOptionsRequest(
+SubscribeStatusRequest::SubscribeStatusRequest(
     ::google::protobuf::Arena* arena,
-    const SubscribePossibleSettingOptionsRequest& from)
+    const SubscribeStatusRequest& from)
     : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  SubscribePossibleSettingOptionsRequest* const _this = this;
+  SubscribeStatusRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribePossibleSettingOptionsRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeStatusRequest)
 }
 
 
@@ -6813,71 +7068,91 @@ SubscribePossibleSettingOptionsRequest::SubscribePossibleSettingOptionsRequest(
 
 
 
-::google::protobuf::Metadata SubscribePossibleSettingOptionsRequest::GetMetadata() const {
+::google::protobuf::Metadata SubscribeStatusRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[32]);
+      file_level_metadata_camera_2fcamera_2eproto[30]);
 }
 // ===================================================================
 
-class PossibleSettingOptionsResponse::_Internal {
+class StatusResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<StatusResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::Status& camera_status(const StatusResponse* msg);
+  static void set_has_camera_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-PossibleSettingOptionsResponse::PossibleSettingOptionsResponse(::google::protobuf::Arena* arena)
+const ::mavcam::rpc::camera::Status& StatusResponse::_Internal::camera_status(const StatusResponse* msg) {
+  return *msg->_impl_.camera_status_;
+}
+StatusResponse::StatusResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.StatusResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE PossibleSettingOptionsResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StatusResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : setting_options_{visibility, arena, from.setting_options_},
+      : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-PossibleSettingOptionsResponse::PossibleSettingOptionsResponse(
+StatusResponse::StatusResponse(
     ::google::protobuf::Arena* arena,
-    const PossibleSettingOptionsResponse& from)
+    const StatusResponse& from)
     : ::google::protobuf::Message(arena) {
-  PossibleSettingOptionsResponse* const _this = this;
+  StatusResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.camera_status_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Status>(arena, *from._impl_.camera_status_)
+                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.StatusResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE PossibleSettingOptionsResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE StatusResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : setting_options_{visibility, arena},
-        _cached_size_{0} {}
+      : _cached_size_{0} {}
 
-inline void PossibleSettingOptionsResponse::SharedCtor(::_pb::Arena* arena) {
+inline void StatusResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.camera_status_ = {};
 }
-PossibleSettingOptionsResponse::~PossibleSettingOptionsResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+StatusResponse::~StatusResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.StatusResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void PossibleSettingOptionsResponse::SharedDtor() {
+inline void StatusResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.camera_status_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void PossibleSettingOptionsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+PROTOBUF_NOINLINE void StatusResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.StatusResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.setting_options_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_status_ != nullptr);
+    _impl_.camera_status_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* PossibleSettingOptionsResponse::_InternalParse(
+const char* StatusResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -6885,9 +7160,9 @@ const char* PossibleSettingOptionsResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> PossibleSettingOptionsResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> StatusResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -6896,37 +7171,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> PossibleSettingOptionsResponse::_table
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_PossibleSettingOptionsResponse_default_instance_._instance,
+    &_StatusResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
-    {::_pbi::TcParser::FastMtR1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(PossibleSettingOptionsResponse, _impl_.setting_options_)}},
+    // .mavcam.rpc.camera.Status camera_status = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_.camera_status_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
-    {PROTOBUF_FIELD_OFFSET(PossibleSettingOptionsResponse, _impl_.setting_options_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.Status camera_status = 1;
+    {PROTOBUF_FIELD_OFFSET(StatusResponse, _impl_.camera_status_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::SettingOptions>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Status>()},
   }}, {{
   }},
 };
 
-::uint8_t* PossibleSettingOptionsResponse::_InternalSerialize(
+::uint8_t* StatusResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.StatusResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_setting_options_size()); i < n; i++) {
-    const auto& repfield = this->_internal_setting_options().Get(i);
-    target = ::google::protobuf::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.Status camera_status = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::camera_status(this),
+        _Internal::camera_status(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -6934,153 +7209,172 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> PossibleSettingOptionsResponse::_table
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.StatusResponse)
   return target;
 }
 
-::size_t PossibleSettingOptionsResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+::size_t StatusResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.StatusResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
-  total_size += 1UL * this->_internal_setting_options_size();
-  for (const auto& msg : this->_internal_setting_options()) {
+  // .mavcam.rpc.camera.Status camera_status = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_status_);
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData PossibleSettingOptionsResponse::_class_data_ = {
-    PossibleSettingOptionsResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData StatusResponse::_class_data_ = {
+    StatusResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* PossibleSettingOptionsResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* StatusResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void PossibleSettingOptionsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<PossibleSettingOptionsResponse*>(&to_msg);
-  auto& from = static_cast<const PossibleSettingOptionsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+void StatusResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<StatusResponse*>(&to_msg);
+  auto& from = static_cast<const StatusResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.StatusResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_setting_options()->MergeFrom(
-      from._internal_setting_options());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_status()->::mavcam::rpc::camera::Status::MergeFrom(
+        from._internal_camera_status());
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PossibleSettingOptionsResponse::CopyFrom(const PossibleSettingOptionsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+void StatusResponse::CopyFrom(const StatusResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.StatusResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool PossibleSettingOptionsResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool StatusResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* PossibleSettingOptionsResponse::AccessCachedSize() const {
+::_pbi::CachedSize* StatusResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void PossibleSettingOptionsResponse::InternalSwap(PossibleSettingOptionsResponse* PROTOBUF_RESTRICT other) {
+void StatusResponse::InternalSwap(StatusResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.setting_options_.InternalSwap(&other->_impl_.setting_options_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.camera_status_, other->_impl_.camera_status_);
 }
 
-::google::protobuf::Metadata PossibleSettingOptionsResponse::GetMetadata() const {
+::google::protobuf::Metadata StatusResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[33]);
+      file_level_metadata_camera_2fcamera_2eproto[31]);
 }
 // ===================================================================
 
-class SetSettingRequest::_Internal {
+class SubscribeCurrentSettingsRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<SetSettingRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::Setting& setting(const SetSettingRequest* msg);
-  static void set_has_setting(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::Setting& SetSettingRequest::_Internal::setting(const SetSettingRequest* msg) {
-  return *msg->_impl_.setting_;
+SubscribeCurrentSettingsRequest::SubscribeCurrentSettingsRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribeCurrentSettingsRequest)
 }
-SetSettingRequest::SetSettingRequest(::google::protobuf::Arena* arena)
+SubscribeCurrentSettingsRequest::SubscribeCurrentSettingsRequest(
+    ::google::protobuf::Arena* arena,
+    const SubscribeCurrentSettingsRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  SubscribeCurrentSettingsRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribeCurrentSettingsRequest)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata SubscribeCurrentSettingsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[32]);
+}
+// ===================================================================
+
+class CurrentSettingsResponse::_Internal {
+ public:
+};
+
+CurrentSettingsResponse::CurrentSettingsResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetSettingRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CurrentSettingsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SetSettingRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CurrentSettingsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : _has_bits_{from._has_bits_},
+      : current_settings_{visibility, arena, from.current_settings_},
         _cached_size_{0} {}
 
-SetSettingRequest::SetSettingRequest(
+CurrentSettingsResponse::CurrentSettingsResponse(
     ::google::protobuf::Arena* arena,
-    const SetSettingRequest& from)
+    const CurrentSettingsResponse& from)
     : ::google::protobuf::Message(arena) {
-  SetSettingRequest* const _this = this;
+  CurrentSettingsResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.setting_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Setting>(arena, *from._impl_.setting_)
-                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetSettingRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CurrentSettingsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SetSettingRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CurrentSettingsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+      : current_settings_{visibility, arena},
+        _cached_size_{0} {}
 
-inline void SetSettingRequest::SharedCtor(::_pb::Arena* arena) {
+inline void CurrentSettingsResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.setting_ = {};
 }
-SetSettingRequest::~SetSettingRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetSettingRequest)
+CurrentSettingsResponse::~CurrentSettingsResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CurrentSettingsResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SetSettingRequest::SharedDtor() {
+inline void CurrentSettingsResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.setting_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SetSettingRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetSettingRequest)
+PROTOBUF_NOINLINE void CurrentSettingsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CurrentSettingsResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.setting_ != nullptr);
-    _impl_.setting_->Clear();
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.current_settings_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SetSettingRequest::_InternalParse(
+const char* CurrentSettingsResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -7088,9 +7382,9 @@ const char* SetSettingRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> CurrentSettingsResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -7099,37 +7393,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingRequest::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_SetSettingRequest_default_instance_._instance,
+    &_CurrentSettingsResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.Setting setting = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_.setting_)}},
+    // repeated .mavcam.rpc.camera.Setting current_settings = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CurrentSettingsResponse, _impl_.current_settings_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.Setting setting = 1;
-    {PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_.setting_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .mavcam.rpc.camera.Setting current_settings = 1;
+    {PROTOBUF_FIELD_OFFSET(CurrentSettingsResponse, _impl_.current_settings_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
   }}, {{
   }},
 };
 
-::uint8_t* SetSettingRequest::_InternalSerialize(
+::uint8_t* CurrentSettingsResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetSettingRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CurrentSettingsResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.Setting setting = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::setting(this),
-        _Internal::setting(this).GetCachedSize(), target, stream);
+  // repeated .mavcam.rpc.camera.Setting current_settings = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_current_settings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_current_settings().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -7137,157 +7431,168 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetSettingRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CurrentSettingsResponse)
   return target;
 }
 
-::size_t SetSettingRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetSettingRequest)
+::size_t CurrentSettingsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CurrentSettingsResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.Setting setting = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  // repeated .mavcam.rpc.camera.Setting current_settings = 1;
+  total_size += 1UL * this->_internal_current_settings_size();
+  for (const auto& msg : this->_internal_current_settings()) {
     total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.setting_);
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
   }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SetSettingRequest::_class_data_ = {
-    SetSettingRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData CurrentSettingsResponse::_class_data_ = {
+    CurrentSettingsResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SetSettingRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* CurrentSettingsResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void SetSettingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SetSettingRequest*>(&to_msg);
-  auto& from = static_cast<const SetSettingRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetSettingRequest)
+void CurrentSettingsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<CurrentSettingsResponse*>(&to_msg);
+  auto& from = static_cast<const CurrentSettingsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CurrentSettingsResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_setting()->::mavcam::rpc::camera::Setting::MergeFrom(
-        from._internal_setting());
-  }
+  _this->_internal_mutable_current_settings()->MergeFrom(
+      from._internal_current_settings());
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetSettingRequest::CopyFrom(const SetSettingRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetSettingRequest)
+void CurrentSettingsResponse::CopyFrom(const CurrentSettingsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CurrentSettingsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SetSettingRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool CurrentSettingsResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SetSettingRequest::AccessCachedSize() const {
+::_pbi::CachedSize* CurrentSettingsResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SetSettingRequest::InternalSwap(SetSettingRequest* PROTOBUF_RESTRICT other) {
+void CurrentSettingsResponse::InternalSwap(CurrentSettingsResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.setting_, other->_impl_.setting_);
+  _impl_.current_settings_.InternalSwap(&other->_impl_.current_settings_);
 }
 
-::google::protobuf::Metadata SetSettingRequest::GetMetadata() const {
+::google::protobuf::Metadata CurrentSettingsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[34]);
+      file_level_metadata_camera_2fcamera_2eproto[33]);
 }
 // ===================================================================
 
-class SetSettingResponse::_Internal {
+class SubscribePossibleSettingOptionsRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<SetSettingResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetSettingResponse* msg);
-  static void set_has_camera_result(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::CameraResult& SetSettingResponse::_Internal::camera_result(const SetSettingResponse* msg) {
-  return *msg->_impl_.camera_result_;
-}
-SetSettingResponse::SetSettingResponse(::google::protobuf::Arena* arena)
-    : ::google::protobuf::Message(arena) {
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetSettingResponse)
+SubscribePossibleSettingOptionsRequest::SubscribePossibleSettingOptionsRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SubscribePossibleSettingOptionsRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE SetSettingResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-SetSettingResponse::SetSettingResponse(
+SubscribePossibleSettingOptionsRequest::SubscribePossibleSettingOptionsRequest(
     ::google::protobuf::Arena* arena,
-    const SetSettingResponse& from)
-    : ::google::protobuf::Message(arena) {
-  SetSettingResponse* const _this = this;
+    const SubscribePossibleSettingOptionsRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  SubscribePossibleSettingOptionsRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
-                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetSettingResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SubscribePossibleSettingOptionsRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE SetSettingResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
 
-inline void SetSettingResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_result_ = {};
-}
-SetSettingResponse::~SetSettingResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetSettingResponse)
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata SubscribePossibleSettingOptionsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[34]);
+}
+// ===================================================================
+
+class PossibleSettingOptionsResponse::_Internal {
+ public:
+};
+
+PossibleSettingOptionsResponse::PossibleSettingOptionsResponse(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE PossibleSettingOptionsResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : setting_options_{visibility, arena, from.setting_options_},
+        _cached_size_{0} {}
+
+PossibleSettingOptionsResponse::PossibleSettingOptionsResponse(
+    ::google::protobuf::Arena* arena,
+    const PossibleSettingOptionsResponse& from)
+    : ::google::protobuf::Message(arena) {
+  PossibleSettingOptionsResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.PossibleSettingOptionsResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE PossibleSettingOptionsResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : setting_options_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void PossibleSettingOptionsResponse::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+PossibleSettingOptionsResponse::~PossibleSettingOptionsResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SetSettingResponse::SharedDtor() {
+inline void PossibleSettingOptionsResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SetSettingResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetSettingResponse)
+PROTOBUF_NOINLINE void PossibleSettingOptionsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
-    _impl_.camera_result_->Clear();
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.setting_options_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SetSettingResponse::_InternalParse(
+const char* PossibleSettingOptionsResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -7295,9 +7600,9 @@ const char* SetSettingResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> PossibleSettingOptionsResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -7306,37 +7611,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_SetSettingResponse_default_instance_._instance,
+    &_PossibleSettingOptionsResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_.camera_result_)}},
+    // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(PossibleSettingOptionsResponse, _impl_.setting_options_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
+    {PROTOBUF_FIELD_OFFSET(PossibleSettingOptionsResponse, _impl_.setting_options_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::SettingOptions>()},
   }}, {{
   }},
 };
 
-::uint8_t* SetSettingResponse::_InternalSerialize(
+::uint8_t* PossibleSettingOptionsResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetSettingResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.CameraResult camera_result = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::camera_result(this),
-        _Internal::camera_result(this).GetCachedSize(), target, stream);
+  // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_setting_options_size()); i < n; i++) {
+    const auto& repfield = this->_internal_setting_options().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -7344,109 +7649,105 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetSettingResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   return target;
 }
 
-::size_t SetSettingResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetSettingResponse)
+::size_t PossibleSettingOptionsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.CameraResult camera_result = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  // repeated .mavcam.rpc.camera.SettingOptions setting_options = 1;
+  total_size += 1UL * this->_internal_setting_options_size();
+  for (const auto& msg : this->_internal_setting_options()) {
     total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
   }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SetSettingResponse::_class_data_ = {
-    SetSettingResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData PossibleSettingOptionsResponse::_class_data_ = {
+    PossibleSettingOptionsResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SetSettingResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* PossibleSettingOptionsResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void SetSettingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SetSettingResponse*>(&to_msg);
-  auto& from = static_cast<const SetSettingResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetSettingResponse)
+void PossibleSettingOptionsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<PossibleSettingOptionsResponse*>(&to_msg);
+  auto& from = static_cast<const PossibleSettingOptionsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
-        from._internal_camera_result());
-  }
+  _this->_internal_mutable_setting_options()->MergeFrom(
+      from._internal_setting_options());
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetSettingResponse::CopyFrom(const SetSettingResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetSettingResponse)
+void PossibleSettingOptionsResponse::CopyFrom(const PossibleSettingOptionsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.PossibleSettingOptionsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SetSettingResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool PossibleSettingOptionsResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SetSettingResponse::AccessCachedSize() const {
+::_pbi::CachedSize* PossibleSettingOptionsResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SetSettingResponse::InternalSwap(SetSettingResponse* PROTOBUF_RESTRICT other) {
+void PossibleSettingOptionsResponse::InternalSwap(PossibleSettingOptionsResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.camera_result_, other->_impl_.camera_result_);
+  _impl_.setting_options_.InternalSwap(&other->_impl_.setting_options_);
 }
 
-::google::protobuf::Metadata SetSettingResponse::GetMetadata() const {
+::google::protobuf::Metadata PossibleSettingOptionsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[35]);
 }
 // ===================================================================
 
-class GetSettingRequest::_Internal {
+class SetSettingRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<GetSettingRequest>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<SetSettingRequest>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::Setting& setting(const GetSettingRequest* msg);
+    8 * PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::Setting& setting(const SetSettingRequest* msg);
   static void set_has_setting(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::Setting& GetSettingRequest::_Internal::setting(const GetSettingRequest* msg) {
+const ::mavcam::rpc::camera::Setting& SetSettingRequest::_Internal::setting(const SetSettingRequest* msg) {
   return *msg->_impl_.setting_;
 }
-GetSettingRequest::GetSettingRequest(::google::protobuf::Arena* arena)
+SetSettingRequest::SetSettingRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.GetSettingRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetSettingRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE GetSettingRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-GetSettingRequest::GetSettingRequest(
+SetSettingRequest::SetSettingRequest(
     ::google::protobuf::Arena* arena,
-    const GetSettingRequest& from)
+    const SetSettingRequest& from)
     : ::google::protobuf::Message(arena) {
-  GetSettingRequest* const _this = this;
+  SetSettingRequest* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -7456,30 +7757,30 @@ GetSettingRequest::GetSettingRequest(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::Setting>(arena, *from._impl_.setting_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.GetSettingRequest)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetSettingRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE GetSettingRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void GetSettingRequest::SharedCtor(::_pb::Arena* arena) {
+inline void SetSettingRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.setting_ = {};
 }
-GetSettingRequest::~GetSettingRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.GetSettingRequest)
+SetSettingRequest::~SetSettingRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetSettingRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void GetSettingRequest::SharedDtor() {
+inline void SetSettingRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.setting_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void GetSettingRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.GetSettingRequest)
+PROTOBUF_NOINLINE void SetSettingRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetSettingRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -7494,7 +7795,7 @@ PROTOBUF_NOINLINE void GetSettingRequest::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* GetSettingRequest::_InternalParse(
+const char* SetSettingRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -7502,9 +7803,9 @@ const char* GetSettingRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetSettingRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingRequest::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -7513,17 +7814,17 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetSettingRequest::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_GetSettingRequest_default_instance_._instance,
+    &_SetSettingRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // .mavcam.rpc.camera.Setting setting = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_.setting_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_.setting_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.Setting setting = 1;
-    {PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_.setting_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(SetSettingRequest, _impl_.setting_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
@@ -7531,10 +7832,10 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetSettingRequest::_table_ = {
   }},
 };
 
-::uint8_t* GetSettingRequest::_InternalSerialize(
+::uint8_t* SetSettingRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.GetSettingRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetSettingRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -7551,12 +7852,12 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetSettingRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.GetSettingRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetSettingRequest)
   return target;
 }
 
-::size_t GetSettingRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.GetSettingRequest)
+::size_t SetSettingRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetSettingRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -7573,18 +7874,18 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetSettingRequest::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData GetSettingRequest::_class_data_ = {
-    GetSettingRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData SetSettingRequest::_class_data_ = {
+    SetSettingRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* GetSettingRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetSettingRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void GetSettingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<GetSettingRequest*>(&to_msg);
-  auto& from = static_cast<const GetSettingRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.GetSettingRequest)
+void SetSettingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetSettingRequest*>(&to_msg);
+  auto& from = static_cast<const SetSettingRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetSettingRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -7596,71 +7897,64 @@ void GetSettingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::g
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetSettingRequest::CopyFrom(const GetSettingRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.GetSettingRequest)
+void SetSettingRequest::CopyFrom(const SetSettingRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetSettingRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool GetSettingRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetSettingRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* GetSettingRequest::AccessCachedSize() const {
+::_pbi::CachedSize* SetSettingRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void GetSettingRequest::InternalSwap(GetSettingRequest* PROTOBUF_RESTRICT other) {
+void SetSettingRequest::InternalSwap(SetSettingRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   swap(_impl_.setting_, other->_impl_.setting_);
 }
 
-::google::protobuf::Metadata GetSettingRequest::GetMetadata() const {
+::google::protobuf::Metadata SetSettingRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[36]);
 }
 // ===================================================================
 
-class GetSettingResponse::_Internal {
+class SetSettingResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<GetSettingResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<SetSettingResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const GetSettingResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetSettingResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static const ::mavcam::rpc::camera::Setting& setting(const GetSettingResponse* msg);
-  static void set_has_setting(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
 };
 
-const ::mavcam::rpc::camera::CameraResult& GetSettingResponse::_Internal::camera_result(const GetSettingResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& SetSettingResponse::_Internal::camera_result(const SetSettingResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-const ::mavcam::rpc::camera::Setting& GetSettingResponse::_Internal::setting(const GetSettingResponse* msg) {
-  return *msg->_impl_.setting_;
-}
-GetSettingResponse::GetSettingResponse(::google::protobuf::Arena* arena)
+SetSettingResponse::SetSettingResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.GetSettingResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetSettingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE GetSettingResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-GetSettingResponse::GetSettingResponse(
+SetSettingResponse::SetSettingResponse(
     ::google::protobuf::Arena* arena,
-    const GetSettingResponse& from)
+    const SetSettingResponse& from)
     : ::google::protobuf::Message(arena) {
-  GetSettingResponse* const _this = this;
+  SetSettingResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -7669,61 +7963,46 @@ GetSettingResponse::GetSettingResponse(
   _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
-  _impl_.setting_ = (cached_has_bits & 0x00000002u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Setting>(arena, *from._impl_.setting_)
-                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.GetSettingResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetSettingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE GetSettingResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void GetSettingResponse::SharedCtor(::_pb::Arena* arena) {
+inline void SetSettingResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, camera_result_),
-           0,
-           offsetof(Impl_, setting_) -
-               offsetof(Impl_, camera_result_) +
-               sizeof(Impl_::setting_));
+  _impl_.camera_result_ = {};
 }
-GetSettingResponse::~GetSettingResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.GetSettingResponse)
+SetSettingResponse::~SetSettingResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetSettingResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void GetSettingResponse::SharedDtor() {
+inline void SetSettingResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
-  delete _impl_.setting_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void GetSettingResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.GetSettingResponse)
+PROTOBUF_NOINLINE void SetSettingResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetSettingResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.camera_result_ != nullptr);
-      _impl_.camera_result_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.setting_ != nullptr);
-      _impl_.setting_->Clear();
-    }
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+    _impl_.camera_result_->Clear();
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* GetSettingResponse::_InternalParse(
+const char* SetSettingResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -7731,46 +8010,39 @@ const char* GetSettingResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetSettingResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
+    1,  // num_field_entries
+    1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_GetSettingResponse_default_instance_._instance,
+    &_SetSettingResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.Setting setting = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.setting_)}},
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .mavcam.rpc.camera.Setting setting = 2;
-    {PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.setting_), _Internal::kHasBitsOffset + 1, 1,
+    {PROTOBUF_FIELD_OFFSET(SetSettingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
   }}, {{
   }},
 };
 
-::uint8_t* GetSettingResponse::_InternalSerialize(
+::uint8_t* SetSettingResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.GetSettingResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetSettingResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -7782,156 +8054,142 @@ const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetSettingResponse::_table_ = {
         _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
-  // .mavcam.rpc.camera.Setting setting = 2;
-  if (cached_has_bits & 0x00000002u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        2, _Internal::setting(this),
-        _Internal::setting(this).GetCachedSize(), target, stream);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.GetSettingResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetSettingResponse)
   return target;
 }
 
-::size_t GetSettingResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.GetSettingResponse)
+::size_t SetSettingResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetSettingResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    if (cached_has_bits & 0x00000001u) {
-      total_size +=
-          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
-    }
-
-    // .mavcam.rpc.camera.Setting setting = 2;
-    if (cached_has_bits & 0x00000002u) {
-      total_size +=
-          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.setting_);
-    }
-
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData GetSettingResponse::_class_data_ = {
-    GetSettingResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData SetSettingResponse::_class_data_ = {
+    SetSettingResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* GetSettingResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetSettingResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void GetSettingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<GetSettingResponse*>(&to_msg);
-  auto& from = static_cast<const GetSettingResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.GetSettingResponse)
+void SetSettingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetSettingResponse*>(&to_msg);
+  auto& from = static_cast<const SetSettingResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetSettingResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
-          from._internal_camera_result());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_mutable_setting()->::mavcam::rpc::camera::Setting::MergeFrom(
-          from._internal_setting());
-    }
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+        from._internal_camera_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetSettingResponse::CopyFrom(const GetSettingResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.GetSettingResponse)
+void SetSettingResponse::CopyFrom(const SetSettingResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetSettingResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool GetSettingResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetSettingResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* GetSettingResponse::AccessCachedSize() const {
+::_pbi::CachedSize* SetSettingResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void GetSettingResponse::InternalSwap(GetSettingResponse* PROTOBUF_RESTRICT other) {
+void SetSettingResponse::InternalSwap(SetSettingResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.setting_)
-      + sizeof(GetSettingResponse::_impl_.setting_)
-      - PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.camera_result_)>(
-          reinterpret_cast<char*>(&_impl_.camera_result_),
-          reinterpret_cast<char*>(&other->_impl_.camera_result_));
+  swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata GetSettingResponse::GetMetadata() const {
+::google::protobuf::Metadata SetSettingResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[37]);
 }
 // ===================================================================
 
-class FormatStorageRequest::_Internal {
+class SetSettingsRequest::_Internal {
  public:
 };
 
-FormatStorageRequest::FormatStorageRequest(::google::protobuf::Arena* arena)
+SetSettingsRequest::SetSettingsRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.FormatStorageRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetSettingsRequest)
 }
-FormatStorageRequest::FormatStorageRequest(
-    ::google::protobuf::Arena* arena, const FormatStorageRequest& from)
-    : FormatStorageRequest(arena) {
-  MergeFrom(from);
+inline PROTOBUF_NDEBUG_INLINE SetSettingsRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : settings_{visibility, arena, from.settings_},
+        _cached_size_{0} {}
+
+SetSettingsRequest::SetSettingsRequest(
+    ::google::protobuf::Arena* arena,
+    const SetSettingsRequest& from)
+    : ::google::protobuf::Message(arena) {
+  SetSettingsRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetSettingsRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE FormatStorageRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingsRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+      : settings_{visibility, arena},
+        _cached_size_{0} {}
 
-inline void FormatStorageRequest::SharedCtor(::_pb::Arena* arena) {
+inline void SetSettingsRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.storage_id_ = {};
 }
-FormatStorageRequest::~FormatStorageRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.FormatStorageRequest)
+SetSettingsRequest::~SetSettingsRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetSettingsRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void FormatStorageRequest::SharedDtor() {
+inline void SetSettingsRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void FormatStorageRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.FormatStorageRequest)
+PROTOBUF_NOINLINE void SetSettingsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetSettingsRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.storage_id_ = 0;
+  _impl_.settings_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* FormatStorageRequest::_InternalParse(
+const char* SetSettingsRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -7939,7 +8197,7 @@ const char* FormatStorageRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> FormatStorageRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetSettingsRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
@@ -7948,38 +8206,39 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> FormatStorageRequest::_table_ = {
     4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
     1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_FormatStorageRequest_default_instance_._instance,
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_SetSettingsRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // int32 storage_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FormatStorageRequest, _impl_.storage_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(FormatStorageRequest, _impl_.storage_id_)}},
+    // repeated .mavcam.rpc.camera.Setting settings = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(SetSettingsRequest, _impl_.settings_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // int32 storage_id = 1;
-    {PROTOBUF_FIELD_OFFSET(FormatStorageRequest, _impl_.storage_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
+    // repeated .mavcam.rpc.camera.Setting settings = 1;
+    {PROTOBUF_FIELD_OFFSET(SetSettingsRequest, _impl_.settings_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
+  }}, {{
   }},
 };
 
-::uint8_t* FormatStorageRequest::_InternalSerialize(
+::uint8_t* SetSettingsRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.FormatStorageRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetSettingsRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // int32 storage_id = 1;
-  if (this->_internal_storage_id() != 0) {
+  // repeated .mavcam.rpc.camera.Setting settings = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_settings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_settings().Get(i);
     target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<1>(
-            stream, this->_internal_storage_id(), target);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -7987,106 +8246,106 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> FormatStorageRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.FormatStorageRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetSettingsRequest)
   return target;
 }
 
-::size_t FormatStorageRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.FormatStorageRequest)
+::size_t SetSettingsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetSettingsRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 storage_id = 1;
-  if (this->_internal_storage_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_storage_id());
+  // repeated .mavcam.rpc.camera.Setting settings = 1;
+  total_size += 1UL * this->_internal_settings_size();
+  for (const auto& msg : this->_internal_settings()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
   }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData FormatStorageRequest::_class_data_ = {
-    FormatStorageRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData SetSettingsRequest::_class_data_ = {
+    SetSettingsRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* FormatStorageRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetSettingsRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void FormatStorageRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<FormatStorageRequest*>(&to_msg);
-  auto& from = static_cast<const FormatStorageRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.FormatStorageRequest)
+void SetSettingsRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetSettingsRequest*>(&to_msg);
+  auto& from = static_cast<const SetSettingsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetSettingsRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_storage_id() != 0) {
-    _this->_internal_set_storage_id(from._internal_storage_id());
-  }
+  _this->_internal_mutable_settings()->MergeFrom(
+      from._internal_settings());
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void FormatStorageRequest::CopyFrom(const FormatStorageRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.FormatStorageRequest)
+void SetSettingsRequest::CopyFrom(const SetSettingsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetSettingsRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool FormatStorageRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetSettingsRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* FormatStorageRequest::AccessCachedSize() const {
+::_pbi::CachedSize* SetSettingsRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void FormatStorageRequest::InternalSwap(FormatStorageRequest* PROTOBUF_RESTRICT other) {
+void SetSettingsRequest::InternalSwap(SetSettingsRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.storage_id_, other->_impl_.storage_id_);
+  _impl_.settings_.InternalSwap(&other->_impl_.settings_);
 }
 
-::google::protobuf::Metadata FormatStorageRequest::GetMetadata() const {
+::google::protobuf::Metadata SetSettingsRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[38]);
 }
 // ===================================================================
 
-class FormatStorageResponse::_Internal {
+class SetSettingsResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<FormatStorageResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<SetSettingsResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const FormatStorageResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(SetSettingsResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetSettingsResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& FormatStorageResponse::_Internal::camera_result(const FormatStorageResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& SetSettingsResponse::_Internal::camera_result(const SetSettingsResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-FormatStorageResponse::FormatStorageResponse(::google::protobuf::Arena* arena)
+SetSettingsResponse::SetSettingsResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.FormatStorageResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetSettingsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE FormatStorageResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
+        _cached_size_{0},
+        applied_settings_{visibility, arena, from.applied_settings_} {}
 
-FormatStorageResponse::FormatStorageResponse(
+SetSettingsResponse::SetSettingsResponse(
     ::google::protobuf::Arena* arena,
-    const FormatStorageResponse& from)
+    const SetSettingsResponse& from)
     : ::google::protobuf::Message(arena) {
-  FormatStorageResponse* const _this = this;
+  SetSettingsResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -8096,35 +8355,37 @@ FormatStorageResponse::FormatStorageResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.FormatStorageResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetSettingsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE FormatStorageResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetSettingsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+      : _cached_size_{0},
+        applied_settings_{visibility, arena} {}
 
-inline void FormatStorageResponse::SharedCtor(::_pb::Arena* arena) {
+inline void SetSettingsResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-FormatStorageResponse::~FormatStorageResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.FormatStorageResponse)
+SetSettingsResponse::~SetSettingsResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetSettingsResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void FormatStorageResponse::SharedDtor() {
+inline void SetSettingsResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void FormatStorageResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.FormatStorageResponse)
+PROTOBUF_NOINLINE void SetSettingsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetSettingsResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.applied_settings_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     ABSL_DCHECK(_impl_.camera_result_ != nullptr);
@@ -8134,7 +8395,7 @@ PROTOBUF_NOINLINE void FormatStorageResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* FormatStorageResponse::_InternalParse(
+const char* SetSettingsResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -8142,39 +8403,46 @@ const char* FormatStorageResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> FormatStorageResponse::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> SetSettingsResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(SetSettingsResponse, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
+    2,  // num_field_entries
+    2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_FormatStorageResponse_default_instance_._instance,
+    &_SetSettingsResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
+    // repeated .mavcam.rpc.camera.AppliedSetting applied_settings = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(SetSettingsResponse, _impl_.applied_settings_)}},
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetSettingsResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(SetSettingsResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .mavcam.rpc.camera.AppliedSetting applied_settings = 2;
+    {PROTOBUF_FIELD_OFFSET(SetSettingsResponse, _impl_.applied_settings_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::AppliedSetting>()},
   }}, {{
   }},
 };
 
-::uint8_t* FormatStorageResponse::_InternalSerialize(
+::uint8_t* SetSettingsResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.FormatStorageResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetSettingsResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -8186,23 +8454,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> FormatStorageResponse::_table_ = {
         _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
+  // repeated .mavcam.rpc.camera.AppliedSetting applied_settings = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_applied_settings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_applied_settings().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.FormatStorageResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetSettingsResponse)
   return target;
 }
 
-::size_t FormatStorageResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.FormatStorageResponse)
+::size_t SetSettingsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetSettingsResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .mavcam.rpc.camera.AppliedSetting applied_settings = 2;
+  total_size += 1UL * this->_internal_applied_settings_size();
+  for (const auto& msg : this->_internal_applied_settings()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
   // .mavcam.rpc.camera.CameraResult camera_result = 1;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
@@ -8213,22 +8495,24 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> FormatStorageResponse::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData FormatStorageResponse::_class_data_ = {
-    FormatStorageResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData SetSettingsResponse::_class_data_ = {
+    SetSettingsResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* FormatStorageResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetSettingsResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void FormatStorageResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<FormatStorageResponse*>(&to_msg);
-  auto& from = static_cast<const FormatStorageResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.FormatStorageResponse)
+void SetSettingsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetSettingsResponse*>(&to_msg);
+  auto& from = static_cast<const SetSettingsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetSettingsResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_internal_mutable_applied_settings()->MergeFrom(
+      from._internal_applied_settings());
   if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
     _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
         from._internal_camera_result());
@@ -8236,64 +8520,101 @@ void FormatStorageResponse::MergeImpl(::google::protobuf::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void FormatStorageResponse::CopyFrom(const FormatStorageResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.FormatStorageResponse)
+void SetSettingsResponse::CopyFrom(const SetSettingsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetSettingsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool FormatStorageResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetSettingsResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* FormatStorageResponse::AccessCachedSize() const {
+::_pbi::CachedSize* SetSettingsResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void FormatStorageResponse::InternalSwap(FormatStorageResponse* PROTOBUF_RESTRICT other) {
+void SetSettingsResponse::InternalSwap(SetSettingsResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.applied_settings_.InternalSwap(&other->_impl_.applied_settings_);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata FormatStorageResponse::GetMetadata() const {
+::google::protobuf::Metadata SetSettingsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[39]);
 }
 // ===================================================================
 
-class SelectCameraResponse::_Internal {
+class GetMetricsRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<SelectCameraResponse>()._impl_._has_bits_);
+};
+
+GetMetricsRequest::GetMetricsRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.GetMetricsRequest)
+}
+GetMetricsRequest::GetMetricsRequest(
+    ::google::protobuf::Arena* arena,
+    const GetMetricsRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  GetMetricsRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.GetMetricsRequest)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata GetMetricsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[40]);
+}
+// ===================================================================
+
+class GetMetricsResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetMetricsResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SelectCameraResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(GetMetricsResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const GetMetricsResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& SelectCameraResponse::_Internal::camera_result(const SelectCameraResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& GetMetricsResponse::_Internal::camera_result(const GetMetricsResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-SelectCameraResponse::SelectCameraResponse(::google::protobuf::Arena* arena)
+GetMetricsResponse::GetMetricsResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SelectCameraResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.GetMetricsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SelectCameraResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE GetMetricsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
+        _cached_size_{0},
+        call_metrics_{visibility, arena, from.call_metrics_} {}
 
-SelectCameraResponse::SelectCameraResponse(
+GetMetricsResponse::GetMetricsResponse(
     ::google::protobuf::Arena* arena,
-    const SelectCameraResponse& from)
+    const GetMetricsResponse& from)
     : ::google::protobuf::Message(arena) {
-  SelectCameraResponse* const _this = this;
+  GetMetricsResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -8303,35 +8624,37 @@ SelectCameraResponse::SelectCameraResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SelectCameraResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.GetMetricsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SelectCameraResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE GetMetricsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
+      : _cached_size_{0},
+        call_metrics_{visibility, arena} {}
 
-inline void SelectCameraResponse::SharedCtor(::_pb::Arena* arena) {
+inline void GetMetricsResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-SelectCameraResponse::~SelectCameraResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SelectCameraResponse)
+GetMetricsResponse::~GetMetricsResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.GetMetricsResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SelectCameraResponse::SharedDtor() {
+inline void GetMetricsResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SelectCameraResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SelectCameraResponse)
+PROTOBUF_NOINLINE void GetMetricsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.GetMetricsResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.call_metrics_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     ABSL_DCHECK(_impl_.camera_result_ != nullptr);
@@ -8341,7 +8664,7 @@ PROTOBUF_NOINLINE void SelectCameraResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SelectCameraResponse::_InternalParse(
+const char* GetMetricsResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -8349,39 +8672,46 @@ const char* SelectCameraResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SelectCameraResponse::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetMetricsResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(GetMetricsResponse, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
+    2,  // num_field_entries
+    2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_SelectCameraResponse_default_instance_._instance,
+    &_GetMetricsResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
+    // repeated .mavcam.rpc.camera.CallMetric call_metrics = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 1, PROTOBUF_FIELD_OFFSET(GetMetricsResponse, _impl_.call_metrics_)}},
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetMetricsResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(GetMetricsResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // repeated .mavcam.rpc.camera.CallMetric call_metrics = 2;
+    {PROTOBUF_FIELD_OFFSET(GetMetricsResponse, _impl_.call_metrics_), -1, 1,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CallMetric>()},
   }}, {{
   }},
 };
 
-::uint8_t* SelectCameraResponse::_InternalSerialize(
+::uint8_t* GetMetricsResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SelectCameraResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.GetMetricsResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -8393,23 +8723,37 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SelectCameraResponse::_table_ = {
         _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
+  // repeated .mavcam.rpc.camera.CallMetric call_metrics = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_call_metrics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_call_metrics().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SelectCameraResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.GetMetricsResponse)
   return target;
 }
 
-::size_t SelectCameraResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SelectCameraResponse)
+::size_t GetMetricsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.GetMetricsResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .mavcam.rpc.camera.CallMetric call_metrics = 2;
+  total_size += 1UL * this->_internal_call_metrics_size();
+  for (const auto& msg : this->_internal_call_metrics()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
   // .mavcam.rpc.camera.CameraResult camera_result = 1;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
@@ -8420,22 +8764,24 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SelectCameraResponse::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SelectCameraResponse::_class_data_ = {
-    SelectCameraResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData GetMetricsResponse::_class_data_ = {
+    GetMetricsResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SelectCameraResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* GetMetricsResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void SelectCameraResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SelectCameraResponse*>(&to_msg);
-  auto& from = static_cast<const SelectCameraResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SelectCameraResponse)
+void GetMetricsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<GetMetricsResponse*>(&to_msg);
+  auto& from = static_cast<const GetMetricsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.GetMetricsResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_internal_mutable_call_metrics()->MergeFrom(
+      from._internal_call_metrics());
   if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
     _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
         from._internal_camera_result());
@@ -8443,79 +8789,113 @@ void SelectCameraResponse::MergeImpl(::google::protobuf::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SelectCameraResponse::CopyFrom(const SelectCameraResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SelectCameraResponse)
+void GetMetricsResponse::CopyFrom(const GetMetricsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.GetMetricsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SelectCameraResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool GetMetricsResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SelectCameraResponse::AccessCachedSize() const {
+::_pbi::CachedSize* GetMetricsResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SelectCameraResponse::InternalSwap(SelectCameraResponse* PROTOBUF_RESTRICT other) {
+void GetMetricsResponse::InternalSwap(GetMetricsResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.call_metrics_.InternalSwap(&other->_impl_.call_metrics_);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata SelectCameraResponse::GetMetadata() const {
+::google::protobuf::Metadata GetMetricsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[40]);
+      file_level_metadata_camera_2fcamera_2eproto[41]);
 }
 // ===================================================================
 
-class SelectCameraRequest::_Internal {
+class GetSettingRequest::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetSettingRequest>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::Setting& setting(const GetSettingRequest* msg);
+  static void set_has_setting(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-SelectCameraRequest::SelectCameraRequest(::google::protobuf::Arena* arena)
+const ::mavcam::rpc::camera::Setting& GetSettingRequest::_Internal::setting(const GetSettingRequest* msg) {
+  return *msg->_impl_.setting_;
+}
+GetSettingRequest::GetSettingRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SelectCameraRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.GetSettingRequest)
 }
-SelectCameraRequest::SelectCameraRequest(
-    ::google::protobuf::Arena* arena, const SelectCameraRequest& from)
-    : SelectCameraRequest(arena) {
-  MergeFrom(from);
+inline PROTOBUF_NDEBUG_INLINE GetSettingRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+GetSettingRequest::GetSettingRequest(
+    ::google::protobuf::Arena* arena,
+    const GetSettingRequest& from)
+    : ::google::protobuf::Message(arena) {
+  GetSettingRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.setting_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Setting>(arena, *from._impl_.setting_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.GetSettingRequest)
 }
-inline PROTOBUF_NDEBUG_INLINE SelectCameraRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE GetSettingRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void SelectCameraRequest::SharedCtor(::_pb::Arena* arena) {
+inline void GetSettingRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_id_ = {};
+  _impl_.setting_ = {};
 }
-SelectCameraRequest::~SelectCameraRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SelectCameraRequest)
+GetSettingRequest::~GetSettingRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.GetSettingRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SelectCameraRequest::SharedDtor() {
+inline void GetSettingRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.setting_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SelectCameraRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SelectCameraRequest)
+PROTOBUF_NOINLINE void GetSettingRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.GetSettingRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.camera_id_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.setting_ != nullptr);
+    _impl_.setting_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SelectCameraRequest::_InternalParse(
+const char* GetSettingRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -8523,189 +8903,165 @@ const char* SelectCameraRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SelectCameraRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetSettingRequest::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
     1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_SelectCameraRequest_default_instance_._instance,
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_GetSettingRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // int32 camera_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SelectCameraRequest, _impl_.camera_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SelectCameraRequest, _impl_.camera_id_)}},
+    // .mavcam.rpc.camera.Setting setting = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_.setting_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // int32 camera_id = 1;
-    {PROTOBUF_FIELD_OFFSET(SelectCameraRequest, _impl_.camera_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
+    // .mavcam.rpc.camera.Setting setting = 1;
+    {PROTOBUF_FIELD_OFFSET(GetSettingRequest, _impl_.setting_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
+  }}, {{
   }},
 };
 
-::uint8_t* SelectCameraRequest::_InternalSerialize(
+::uint8_t* GetSettingRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SelectCameraRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.GetSettingRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // int32 camera_id = 1;
-  if (this->_internal_camera_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<1>(
-            stream, this->_internal_camera_id(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.Setting setting = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::setting(this),
+        _Internal::setting(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SelectCameraRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.GetSettingRequest)
   return target;
 }
 
-::size_t SelectCameraRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SelectCameraRequest)
+::size_t GetSettingRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.GetSettingRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 camera_id = 1;
-  if (this->_internal_camera_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_camera_id());
+  // .mavcam.rpc.camera.Setting setting = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.setting_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SelectCameraRequest::_class_data_ = {
-    SelectCameraRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData GetSettingRequest::_class_data_ = {
+    GetSettingRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SelectCameraRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* GetSettingRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void SelectCameraRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SelectCameraRequest*>(&to_msg);
-  auto& from = static_cast<const SelectCameraRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SelectCameraRequest)
+void GetSettingRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<GetSettingRequest*>(&to_msg);
+  auto& from = static_cast<const GetSettingRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.GetSettingRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_camera_id() != 0) {
-    _this->_internal_set_camera_id(from._internal_camera_id());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_setting()->::mavcam::rpc::camera::Setting::MergeFrom(
+        from._internal_setting());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SelectCameraRequest::CopyFrom(const SelectCameraRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SelectCameraRequest)
+void GetSettingRequest::CopyFrom(const GetSettingRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.GetSettingRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SelectCameraRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool GetSettingRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SelectCameraRequest::AccessCachedSize() const {
+::_pbi::CachedSize* GetSettingRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SelectCameraRequest::InternalSwap(SelectCameraRequest* PROTOBUF_RESTRICT other) {
+void GetSettingRequest::InternalSwap(GetSettingRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.camera_id_, other->_impl_.camera_id_);
-}
-
-::google::protobuf::Metadata SelectCameraRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[41]);
-}
-// ===================================================================
-
-class ResetSettingsRequest::_Internal {
- public:
-};
-
-ResetSettingsRequest::ResetSettingsRequest(::google::protobuf::Arena* arena)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ResetSettingsRequest)
-}
-ResetSettingsRequest::ResetSettingsRequest(
-    ::google::protobuf::Arena* arena,
-    const ResetSettingsRequest& from)
-    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
-  ResetSettingsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.ResetSettingsRequest)
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.setting_, other->_impl_.setting_);
 }
 
-
-
-
-
-
-
-
-
-::google::protobuf::Metadata ResetSettingsRequest::GetMetadata() const {
+::google::protobuf::Metadata GetSettingRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[42]);
 }
 // ===================================================================
 
-class ResetSettingsResponse::_Internal {
+class GetSettingResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<ResetSettingsResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<GetSettingResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const ResetSettingsResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const GetSettingResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static const ::mavcam::rpc::camera::Setting& setting(const GetSettingResponse* msg);
+  static void set_has_setting(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
-const ::mavcam::rpc::camera::CameraResult& ResetSettingsResponse::_Internal::camera_result(const ResetSettingsResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& GetSettingResponse::_Internal::camera_result(const GetSettingResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-ResetSettingsResponse::ResetSettingsResponse(::google::protobuf::Arena* arena)
+const ::mavcam::rpc::camera::Setting& GetSettingResponse::_Internal::setting(const GetSettingResponse* msg) {
+  return *msg->_impl_.setting_;
+}
+GetSettingResponse::GetSettingResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ResetSettingsResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.GetSettingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE ResetSettingsResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE GetSettingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-ResetSettingsResponse::ResetSettingsResponse(
+GetSettingResponse::GetSettingResponse(
     ::google::protobuf::Arena* arena,
-    const ResetSettingsResponse& from)
+    const GetSettingResponse& from)
     : ::google::protobuf::Message(arena) {
-  ResetSettingsResponse* const _this = this;
+  GetSettingResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -8714,46 +9070,61 @@ ResetSettingsResponse::ResetSettingsResponse(
   _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
+  _impl_.setting_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Setting>(arena, *from._impl_.setting_)
+                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.ResetSettingsResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.GetSettingResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE ResetSettingsResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE GetSettingResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void ResetSettingsResponse::SharedCtor(::_pb::Arena* arena) {
+inline void GetSettingResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.camera_result_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, camera_result_),
+           0,
+           offsetof(Impl_, setting_) -
+               offsetof(Impl_, camera_result_) +
+               sizeof(Impl_::setting_));
 }
-ResetSettingsResponse::~ResetSettingsResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ResetSettingsResponse)
+GetSettingResponse::~GetSettingResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.GetSettingResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void ResetSettingsResponse::SharedDtor() {
+inline void GetSettingResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
+  delete _impl_.setting_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void ResetSettingsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ResetSettingsResponse)
+PROTOBUF_NOINLINE void GetSettingResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.GetSettingResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
-    _impl_.camera_result_->Clear();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+      _impl_.camera_result_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.setting_ != nullptr);
+      _impl_.setting_->Clear();
+    }
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* ResetSettingsResponse::_InternalParse(
+const char* GetSettingResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -8761,39 +9132,46 @@ const char* ResetSettingsResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> ResetSettingsResponse::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetSettingResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
+    2,  // num_field_entries
+    2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_ResetSettingsResponse_default_instance_._instance,
+    &_GetSettingResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
+    // .mavcam.rpc.camera.Setting setting = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1, PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.setting_)}},
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.Setting setting = 2;
+    {PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.setting_), _Internal::kHasBitsOffset + 1, 1,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Setting>()},
   }}, {{
   }},
 };
 
-::uint8_t* ResetSettingsResponse::_InternalSerialize(
+::uint8_t* GetSettingResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ResetSettingsResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.GetSettingResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -8805,129 +9183,156 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> ResetSettingsResponse::_table_ = {
         _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
+  // .mavcam.rpc.camera.Setting setting = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::setting(this),
+        _Internal::setting(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ResetSettingsResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.GetSettingResponse)
   return target;
 }
 
-::size_t ResetSettingsResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ResetSettingsResponse)
+::size_t GetSettingResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.GetSettingResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.CameraResult camera_result = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
+    }
 
+    // .mavcam.rpc.camera.Setting setting = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.setting_);
+    }
+
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData ResetSettingsResponse::_class_data_ = {
-    ResetSettingsResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData GetSettingResponse::_class_data_ = {
+    GetSettingResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* ResetSettingsResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* GetSettingResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void ResetSettingsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<ResetSettingsResponse*>(&to_msg);
-  auto& from = static_cast<const ResetSettingsResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ResetSettingsResponse)
+void GetSettingResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<GetSettingResponse*>(&to_msg);
+  auto& from = static_cast<const GetSettingResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.GetSettingResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
-        from._internal_camera_result());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+          from._internal_camera_result());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_setting()->::mavcam::rpc::camera::Setting::MergeFrom(
+          from._internal_setting());
+    }
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ResetSettingsResponse::CopyFrom(const ResetSettingsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ResetSettingsResponse)
+void GetSettingResponse::CopyFrom(const GetSettingResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.GetSettingResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool ResetSettingsResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool GetSettingResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* ResetSettingsResponse::AccessCachedSize() const {
+::_pbi::CachedSize* GetSettingResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void ResetSettingsResponse::InternalSwap(ResetSettingsResponse* PROTOBUF_RESTRICT other) {
+void GetSettingResponse::InternalSwap(GetSettingResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.camera_result_, other->_impl_.camera_result_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.setting_)
+      + sizeof(GetSettingResponse::_impl_.setting_)
+      - PROTOBUF_FIELD_OFFSET(GetSettingResponse, _impl_.camera_result_)>(
+          reinterpret_cast<char*>(&_impl_.camera_result_),
+          reinterpret_cast<char*>(&other->_impl_.camera_result_));
 }
 
-::google::protobuf::Metadata ResetSettingsResponse::GetMetadata() const {
+::google::protobuf::Metadata GetSettingResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[43]);
 }
 // ===================================================================
 
-class SetTimestampRequest::_Internal {
+class FormatStorageRequest::_Internal {
  public:
 };
 
-SetTimestampRequest::SetTimestampRequest(::google::protobuf::Arena* arena)
+FormatStorageRequest::FormatStorageRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetTimestampRequest)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.FormatStorageRequest)
 }
-SetTimestampRequest::SetTimestampRequest(
-    ::google::protobuf::Arena* arena, const SetTimestampRequest& from)
-    : SetTimestampRequest(arena) {
+FormatStorageRequest::FormatStorageRequest(
+    ::google::protobuf::Arena* arena, const FormatStorageRequest& from)
+    : FormatStorageRequest(arena) {
   MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE SetTimestampRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE FormatStorageRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void SetTimestampRequest::SharedCtor(::_pb::Arena* arena) {
+inline void FormatStorageRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.timestamp_ = {};
+  _impl_.storage_id_ = {};
 }
-SetTimestampRequest::~SetTimestampRequest() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetTimestampRequest)
+FormatStorageRequest::~FormatStorageRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.FormatStorageRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SetTimestampRequest::SharedDtor() {
+inline void FormatStorageRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SetTimestampRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetTimestampRequest)
+PROTOBUF_NOINLINE void FormatStorageRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.FormatStorageRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.timestamp_ = ::int64_t{0};
+  _impl_.storage_id_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SetTimestampRequest::_InternalParse(
+const char* FormatStorageRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -8935,7 +9340,7 @@ const char* SetTimestampRequest::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetTimestampRequest::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> FormatStorageRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
@@ -8946,36 +9351,36 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetTimestampRequest::_table_ = {
     1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_SetTimestampRequest_default_instance_._instance,
+    &_FormatStorageRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // int64 timestamp = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SetTimestampRequest, _impl_.timestamp_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SetTimestampRequest, _impl_.timestamp_)}},
+    // int32 storage_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FormatStorageRequest, _impl_.storage_id_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(FormatStorageRequest, _impl_.storage_id_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // int64 timestamp = 1;
-    {PROTOBUF_FIELD_OFFSET(SetTimestampRequest, _impl_.timestamp_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int32 storage_id = 1;
+    {PROTOBUF_FIELD_OFFSET(FormatStorageRequest, _impl_.storage_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
   }},
 };
 
-::uint8_t* SetTimestampRequest::_InternalSerialize(
+::uint8_t* FormatStorageRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetTimestampRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.FormatStorageRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // int64 timestamp = 1;
-  if (this->_internal_timestamp() != 0) {
+  // int32 storage_id = 1;
+  if (this->_internal_storage_id() != 0) {
     target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt64ToArrayWithField<1>(
-            stream, this->_internal_timestamp(), target);
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_storage_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -8983,106 +9388,106 @@ const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetTimestampRequest::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetTimestampRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.FormatStorageRequest)
   return target;
 }
 
-::size_t SetTimestampRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetTimestampRequest)
+::size_t FormatStorageRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.FormatStorageRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int64 timestamp = 1;
-  if (this->_internal_timestamp() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-        this->_internal_timestamp());
+  // int32 storage_id = 1;
+  if (this->_internal_storage_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_storage_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SetTimestampRequest::_class_data_ = {
-    SetTimestampRequest::MergeImpl,
+const ::google::protobuf::Message::ClassData FormatStorageRequest::_class_data_ = {
+    FormatStorageRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SetTimestampRequest::GetClassData() const {
+const ::google::protobuf::Message::ClassData* FormatStorageRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void SetTimestampRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SetTimestampRequest*>(&to_msg);
-  auto& from = static_cast<const SetTimestampRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetTimestampRequest)
+void FormatStorageRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<FormatStorageRequest*>(&to_msg);
+  auto& from = static_cast<const FormatStorageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.FormatStorageRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_timestamp() != 0) {
-    _this->_internal_set_timestamp(from._internal_timestamp());
+  if (from._internal_storage_id() != 0) {
+    _this->_internal_set_storage_id(from._internal_storage_id());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetTimestampRequest::CopyFrom(const SetTimestampRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetTimestampRequest)
+void FormatStorageRequest::CopyFrom(const FormatStorageRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.FormatStorageRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SetTimestampRequest::IsInitialized() const {
+PROTOBUF_NOINLINE bool FormatStorageRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SetTimestampRequest::AccessCachedSize() const {
+::_pbi::CachedSize* FormatStorageRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SetTimestampRequest::InternalSwap(SetTimestampRequest* PROTOBUF_RESTRICT other) {
+void FormatStorageRequest::InternalSwap(FormatStorageRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.timestamp_, other->_impl_.timestamp_);
+        swap(_impl_.storage_id_, other->_impl_.storage_id_);
 }
 
-::google::protobuf::Metadata SetTimestampRequest::GetMetadata() const {
+::google::protobuf::Metadata FormatStorageRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[44]);
 }
 // ===================================================================
 
-class SetTimestampResponse::_Internal {
+class FormatStorageResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<SetTimestampResponse>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<FormatStorageResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetTimestampResponse* msg);
+    8 * PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const FormatStorageResponse* msg);
   static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-const ::mavcam::rpc::camera::CameraResult& SetTimestampResponse::_Internal::camera_result(const SetTimestampResponse* msg) {
+const ::mavcam::rpc::camera::CameraResult& FormatStorageResponse::_Internal::camera_result(const FormatStorageResponse* msg) {
   return *msg->_impl_.camera_result_;
 }
-SetTimestampResponse::SetTimestampResponse(::google::protobuf::Arena* arena)
+FormatStorageResponse::FormatStorageResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetTimestampResponse)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.FormatStorageResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SetTimestampResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE FormatStorageResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-SetTimestampResponse::SetTimestampResponse(
+FormatStorageResponse::FormatStorageResponse(
     ::google::protobuf::Arena* arena,
-    const SetTimestampResponse& from)
+    const FormatStorageResponse& from)
     : ::google::protobuf::Message(arena) {
-  SetTimestampResponse* const _this = this;
+  FormatStorageResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
@@ -9092,30 +9497,30 @@ SetTimestampResponse::SetTimestampResponse(
                 ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetTimestampResponse)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.FormatStorageResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE SetTimestampResponse::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE FormatStorageResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void SetTimestampResponse::SharedCtor(::_pb::Arena* arena) {
+inline void FormatStorageResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   _impl_.camera_result_ = {};
 }
-SetTimestampResponse::~SetTimestampResponse() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetTimestampResponse)
+FormatStorageResponse::~FormatStorageResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.FormatStorageResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SetTimestampResponse::SharedDtor() {
+inline void FormatStorageResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SetTimestampResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetTimestampResponse)
+PROTOBUF_NOINLINE void FormatStorageResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.FormatStorageResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -9130,7 +9535,7 @@ PROTOBUF_NOINLINE void SetTimestampResponse::Clear() {
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SetTimestampResponse::_InternalParse(
+const char* FormatStorageResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -9138,9 +9543,9 @@ const char* SetTimestampResponse::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetTimestampResponse::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> FormatStorageResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_._has_bits_),
     0, // no _extensions_
     1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
@@ -9149,17 +9554,17 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetTimestampResponse::_table_ = {
     1,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_SetTimestampResponse_default_instance_._instance,
+    &_FormatStorageResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_.camera_result_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
     // .mavcam.rpc.camera.CameraResult camera_result = 1;
-    {PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    {PROTOBUF_FIELD_OFFSET(FormatStorageResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
   }}, {{
     {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
@@ -9167,10 +9572,10 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetTimestampResponse::_table_ = {
   }},
 };
 
-::uint8_t* SetTimestampResponse::_InternalSerialize(
+::uint8_t* FormatStorageResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetTimestampResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.FormatStorageResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
@@ -9187,12 +9592,12 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetTimestampResponse::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetTimestampResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.FormatStorageResponse)
   return target;
 }
 
-::size_t SetTimestampResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetTimestampResponse)
+::size_t FormatStorageResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.FormatStorageResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
@@ -9209,18 +9614,18 @@ const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetTimestampResponse::_table_ = {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SetTimestampResponse::_class_data_ = {
-    SetTimestampResponse::MergeImpl,
+const ::google::protobuf::Message::ClassData FormatStorageResponse::_class_data_ = {
+    FormatStorageResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SetTimestampResponse::GetClassData() const {
+const ::google::protobuf::Message::ClassData* FormatStorageResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void SetTimestampResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SetTimestampResponse*>(&to_msg);
-  auto& from = static_cast<const SetTimestampResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetTimestampResponse)
+void FormatStorageResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<FormatStorageResponse*>(&to_msg);
+  auto& from = static_cast<const FormatStorageResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.FormatStorageResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -9232,96 +9637,112 @@ void SetTimestampResponse::MergeImpl(::google::protobuf::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetTimestampResponse::CopyFrom(const SetTimestampResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetTimestampResponse)
+void FormatStorageResponse::CopyFrom(const FormatStorageResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.FormatStorageResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SetTimestampResponse::IsInitialized() const {
+PROTOBUF_NOINLINE bool FormatStorageResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SetTimestampResponse::AccessCachedSize() const {
+::_pbi::CachedSize* FormatStorageResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SetTimestampResponse::InternalSwap(SetTimestampResponse* PROTOBUF_RESTRICT other) {
+void FormatStorageResponse::InternalSwap(FormatStorageResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata SetTimestampResponse::GetMetadata() const {
+::google::protobuf::Metadata FormatStorageResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[45]);
 }
 // ===================================================================
 
-class CameraResult::_Internal {
+class SelectCameraResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<SelectCameraResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SelectCameraResponse* msg);
+  static void set_has_camera_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-CameraResult::CameraResult(::google::protobuf::Arena* arena)
+const ::mavcam::rpc::camera::CameraResult& SelectCameraResponse::_Internal::camera_result(const SelectCameraResponse* msg) {
+  return *msg->_impl_.camera_result_;
+}
+SelectCameraResponse::SelectCameraResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CameraResult)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SelectCameraResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CameraResult::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SelectCameraResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : result_str_(arena, from.result_str_),
+      : _has_bits_{from._has_bits_},
         _cached_size_{0} {}
 
-CameraResult::CameraResult(
+SelectCameraResponse::SelectCameraResponse(
     ::google::protobuf::Arena* arena,
-    const CameraResult& from)
+    const SelectCameraResponse& from)
     : ::google::protobuf::Message(arena) {
-  CameraResult* const _this = this;
+  SelectCameraResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  _impl_.result_ = from._impl_.result_;
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
+                : nullptr;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CameraResult)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SelectCameraResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CameraResult::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SelectCameraResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : result_str_(arena),
-        _cached_size_{0} {}
+      : _cached_size_{0} {}
 
-inline void CameraResult::SharedCtor(::_pb::Arena* arena) {
+inline void SelectCameraResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.result_ = {};
+  _impl_.camera_result_ = {};
 }
-CameraResult::~CameraResult() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CameraResult)
+SelectCameraResponse::~SelectCameraResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SelectCameraResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void CameraResult::SharedDtor() {
+inline void SelectCameraResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.result_str_.Destroy();
+  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void CameraResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CameraResult)
+PROTOBUF_NOINLINE void SelectCameraResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SelectCameraResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.result_str_.ClearToEmpty();
-  _impl_.result_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+    _impl_.camera_result_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* CameraResult::_InternalParse(
+const char* SelectCameraResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -9329,64 +9750,48 @@ const char* CameraResult::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 49, 2> CameraResult::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SelectCameraResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_CameraResult_default_instance_._instance,
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_SelectCameraResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // string result_str = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_str_)}},
-    // .mavcam.rpc.camera.CameraResult.Result result = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CameraResult, _impl_.result_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_)}},
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.CameraResult.Result result = 1;
-    {PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // string result_str = 2;
-    {PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_str_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\36\0\12\0\0\0\0\0"
-    "mavcam.rpc.camera.CameraResult"
-    "result_str"
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {PROTOBUF_FIELD_OFFSET(SelectCameraResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+  }}, {{
   }},
 };
 
-::uint8_t* CameraResult::_InternalSerialize(
+::uint8_t* SelectCameraResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CameraResult)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SelectCameraResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // .mavcam.rpc.camera.CameraResult.Result result = 1;
-  if (this->_internal_result() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        1, this->_internal_result(), target);
-  }
-
-  // string result_str = 2;
-  if (!this->_internal_result_str().empty()) {
-    const std::string& _s = this->_internal_result_str();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.CameraResult.result_str");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::camera_result(this),
+        _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -9394,140 +9799,124 @@ const ::_pbi::TcParseTable<1, 2, 0, 49, 2> CameraResult::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CameraResult)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SelectCameraResponse)
   return target;
 }
 
-::size_t CameraResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CameraResult)
+::size_t SelectCameraResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SelectCameraResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string result_str = 2;
-  if (!this->_internal_result_str().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_result_str());
-  }
-
-  // .mavcam.rpc.camera.CameraResult.Result result = 1;
-  if (this->_internal_result() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_result());
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData CameraResult::_class_data_ = {
-    CameraResult::MergeImpl,
+const ::google::protobuf::Message::ClassData SelectCameraResponse::_class_data_ = {
+    SelectCameraResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* CameraResult::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SelectCameraResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void CameraResult::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<CameraResult*>(&to_msg);
-  auto& from = static_cast<const CameraResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CameraResult)
+void SelectCameraResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SelectCameraResponse*>(&to_msg);
+  auto& from = static_cast<const SelectCameraResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SelectCameraResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_result_str().empty()) {
-    _this->_internal_set_result_str(from._internal_result_str());
-  }
-  if (from._internal_result() != 0) {
-    _this->_internal_set_result(from._internal_result());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+        from._internal_camera_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CameraResult::CopyFrom(const CameraResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CameraResult)
+void SelectCameraResponse::CopyFrom(const SelectCameraResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SelectCameraResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool CameraResult::IsInitialized() const {
+PROTOBUF_NOINLINE bool SelectCameraResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* CameraResult::AccessCachedSize() const {
+::_pbi::CachedSize* SelectCameraResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void CameraResult::InternalSwap(CameraResult* PROTOBUF_RESTRICT other) {
+void SelectCameraResponse::InternalSwap(SelectCameraResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.result_str_, &other->_impl_.result_str_, arena);
-  swap(_impl_.result_, other->_impl_.result_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata CameraResult::GetMetadata() const {
+::google::protobuf::Metadata SelectCameraResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[46]);
 }
 // ===================================================================
 
-class Position::_Internal {
+class SelectCameraRequest::_Internal {
  public:
 };
 
-Position::Position(::google::protobuf::Arena* arena)
+SelectCameraRequest::SelectCameraRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Position)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SelectCameraRequest)
 }
-Position::Position(
-    ::google::protobuf::Arena* arena, const Position& from)
-    : Position(arena) {
+SelectCameraRequest::SelectCameraRequest(
+    ::google::protobuf::Arena* arena, const SelectCameraRequest& from)
+    : SelectCameraRequest(arena) {
   MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE Position::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SelectCameraRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void Position::SharedCtor(::_pb::Arena* arena) {
+inline void SelectCameraRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, latitude_deg_),
-           0,
-           offsetof(Impl_, relative_altitude_m_) -
-               offsetof(Impl_, latitude_deg_) +
-               sizeof(Impl_::relative_altitude_m_));
+  _impl_.camera_id_ = {};
 }
-Position::~Position() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Position)
+SelectCameraRequest::~SelectCameraRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SelectCameraRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void Position::SharedDtor() {
+inline void SelectCameraRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void Position::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Position)
+PROTOBUF_NOINLINE void SelectCameraRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SelectCameraRequest)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.latitude_deg_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.relative_altitude_m_) -
-      reinterpret_cast<char*>(&_impl_.latitude_deg_)) + sizeof(_impl_.relative_altitude_m_));
+  _impl_.camera_id_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* Position::_InternalParse(
+const char* SelectCameraRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -9535,303 +9924,237 @@ const char* Position::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 0, 2> Position::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SelectCameraRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
+    1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_Position_default_instance_._instance,
+    &_SelectCameraRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // float relative_altitude_m = 4;
-    {::_pbi::TcParser::FastF32S1,
-     {37, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.relative_altitude_m_)}},
-    // double latitude_deg = 1;
-    {::_pbi::TcParser::FastF64S1,
-     {9, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.latitude_deg_)}},
-    // double longitude_deg = 2;
-    {::_pbi::TcParser::FastF64S1,
-     {17, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.longitude_deg_)}},
-    // float absolute_altitude_m = 3;
-    {::_pbi::TcParser::FastF32S1,
-     {29, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.absolute_altitude_m_)}},
+    // int32 camera_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SelectCameraRequest, _impl_.camera_id_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SelectCameraRequest, _impl_.camera_id_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // double latitude_deg = 1;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.latitude_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // double longitude_deg = 2;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.longitude_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
-    // float absolute_altitude_m = 3;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.absolute_altitude_m_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float relative_altitude_m = 4;
-    {PROTOBUF_FIELD_OFFSET(Position, _impl_.relative_altitude_m_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // int32 camera_id = 1;
+    {PROTOBUF_FIELD_OFFSET(SelectCameraRequest, _impl_.camera_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
   }},
 };
 
-::uint8_t* Position::_InternalSerialize(
+::uint8_t* SelectCameraRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Position)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SelectCameraRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // double latitude_deg = 1;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
-  double tmp_latitude_deg = this->_internal_latitude_deg();
-  ::uint64_t raw_latitude_deg;
-  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
-  if (raw_latitude_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        1, this->_internal_latitude_deg(), target);
+  // int32 camera_id = 1;
+  if (this->_internal_camera_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_camera_id(), target);
   }
 
-  // double longitude_deg = 2;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
-  double tmp_longitude_deg = this->_internal_longitude_deg();
-  ::uint64_t raw_longitude_deg;
-  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
-  if (raw_longitude_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-        2, this->_internal_longitude_deg(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SelectCameraRequest)
+  return target;
+}
 
-  // float absolute_altitude_m = 3;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_absolute_altitude_m = this->_internal_absolute_altitude_m();
-  ::uint32_t raw_absolute_altitude_m;
-  memcpy(&raw_absolute_altitude_m, &tmp_absolute_altitude_m, sizeof(tmp_absolute_altitude_m));
-  if (raw_absolute_altitude_m != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        3, this->_internal_absolute_altitude_m(), target);
-  }
-
-  // float relative_altitude_m = 4;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_relative_altitude_m = this->_internal_relative_altitude_m();
-  ::uint32_t raw_relative_altitude_m;
-  memcpy(&raw_relative_altitude_m, &tmp_relative_altitude_m, sizeof(tmp_relative_altitude_m));
-  if (raw_relative_altitude_m != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        4, this->_internal_relative_altitude_m(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Position)
-  return target;
-}
-
-::size_t Position::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Position)
+::size_t SelectCameraRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SelectCameraRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // double latitude_deg = 1;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
-  double tmp_latitude_deg = this->_internal_latitude_deg();
-  ::uint64_t raw_latitude_deg;
-  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
-  if (raw_latitude_deg != 0) {
-    total_size += 9;
-  }
-
-  // double longitude_deg = 2;
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
-  double tmp_longitude_deg = this->_internal_longitude_deg();
-  ::uint64_t raw_longitude_deg;
-  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
-  if (raw_longitude_deg != 0) {
-    total_size += 9;
-  }
-
-  // float absolute_altitude_m = 3;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_absolute_altitude_m = this->_internal_absolute_altitude_m();
-  ::uint32_t raw_absolute_altitude_m;
-  memcpy(&raw_absolute_altitude_m, &tmp_absolute_altitude_m, sizeof(tmp_absolute_altitude_m));
-  if (raw_absolute_altitude_m != 0) {
-    total_size += 5;
-  }
-
-  // float relative_altitude_m = 4;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_relative_altitude_m = this->_internal_relative_altitude_m();
-  ::uint32_t raw_relative_altitude_m;
-  memcpy(&raw_relative_altitude_m, &tmp_relative_altitude_m, sizeof(tmp_relative_altitude_m));
-  if (raw_relative_altitude_m != 0) {
-    total_size += 5;
+  // int32 camera_id = 1;
+  if (this->_internal_camera_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_camera_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData Position::_class_data_ = {
-    Position::MergeImpl,
+const ::google::protobuf::Message::ClassData SelectCameraRequest::_class_data_ = {
+    SelectCameraRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* Position::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SelectCameraRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void Position::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<Position*>(&to_msg);
-  auto& from = static_cast<const Position&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Position)
+void SelectCameraRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SelectCameraRequest*>(&to_msg);
+  auto& from = static_cast<const SelectCameraRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SelectCameraRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
-  double tmp_latitude_deg = from._internal_latitude_deg();
-  ::uint64_t raw_latitude_deg;
-  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
-  if (raw_latitude_deg != 0) {
-    _this->_internal_set_latitude_deg(from._internal_latitude_deg());
-  }
-  static_assert(sizeof(::uint64_t) == sizeof(double),
-                "Code assumes ::uint64_t and double are the same size.");
-  double tmp_longitude_deg = from._internal_longitude_deg();
-  ::uint64_t raw_longitude_deg;
-  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
-  if (raw_longitude_deg != 0) {
-    _this->_internal_set_longitude_deg(from._internal_longitude_deg());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_absolute_altitude_m = from._internal_absolute_altitude_m();
-  ::uint32_t raw_absolute_altitude_m;
-  memcpy(&raw_absolute_altitude_m, &tmp_absolute_altitude_m, sizeof(tmp_absolute_altitude_m));
-  if (raw_absolute_altitude_m != 0) {
-    _this->_internal_set_absolute_altitude_m(from._internal_absolute_altitude_m());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_relative_altitude_m = from._internal_relative_altitude_m();
-  ::uint32_t raw_relative_altitude_m;
-  memcpy(&raw_relative_altitude_m, &tmp_relative_altitude_m, sizeof(tmp_relative_altitude_m));
-  if (raw_relative_altitude_m != 0) {
-    _this->_internal_set_relative_altitude_m(from._internal_relative_altitude_m());
+  if (from._internal_camera_id() != 0) {
+    _this->_internal_set_camera_id(from._internal_camera_id());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Position::CopyFrom(const Position& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Position)
+void SelectCameraRequest::CopyFrom(const SelectCameraRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SelectCameraRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool Position::IsInitialized() const {
+PROTOBUF_NOINLINE bool SelectCameraRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* Position::AccessCachedSize() const {
+::_pbi::CachedSize* SelectCameraRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void Position::InternalSwap(Position* PROTOBUF_RESTRICT other) {
+void SelectCameraRequest::InternalSwap(SelectCameraRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Position, _impl_.relative_altitude_m_)
-      + sizeof(Position::_impl_.relative_altitude_m_)
-      - PROTOBUF_FIELD_OFFSET(Position, _impl_.latitude_deg_)>(
-          reinterpret_cast<char*>(&_impl_.latitude_deg_),
-          reinterpret_cast<char*>(&other->_impl_.latitude_deg_));
+        swap(_impl_.camera_id_, other->_impl_.camera_id_);
 }
 
-::google::protobuf::Metadata Position::GetMetadata() const {
+::google::protobuf::Metadata SelectCameraRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
       file_level_metadata_camera_2fcamera_2eproto[47]);
 }
 // ===================================================================
 
-class Quaternion::_Internal {
+class ResetSettingsRequest::_Internal {
  public:
 };
 
-Quaternion::Quaternion(::google::protobuf::Arena* arena)
+ResetSettingsRequest::ResetSettingsRequest(::google::protobuf::Arena* arena)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ResetSettingsRequest)
+}
+ResetSettingsRequest::ResetSettingsRequest(
+    ::google::protobuf::Arena* arena,
+    const ResetSettingsRequest& from)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+  ResetSettingsRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.ResetSettingsRequest)
+}
+
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata ResetSettingsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[48]);
+}
+// ===================================================================
+
+class ResetSettingsResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResetSettingsResponse>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const ResetSettingsResponse* msg);
+  static void set_has_camera_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::mavcam::rpc::camera::CameraResult& ResetSettingsResponse::_Internal::camera_result(const ResetSettingsResponse* msg) {
+  return *msg->_impl_.camera_result_;
+}
+ResetSettingsResponse::ResetSettingsResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Quaternion)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.ResetSettingsResponse)
 }
-Quaternion::Quaternion(
-    ::google::protobuf::Arena* arena, const Quaternion& from)
-    : Quaternion(arena) {
-  MergeFrom(from);
+inline PROTOBUF_NDEBUG_INLINE ResetSettingsResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+ResetSettingsResponse::ResetSettingsResponse(
+    ::google::protobuf::Arena* arena,
+    const ResetSettingsResponse& from)
+    : ::google::protobuf::Message(arena) {
+  ResetSettingsResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
+                : nullptr;
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.ResetSettingsResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE Quaternion::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE ResetSettingsResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void Quaternion::SharedCtor(::_pb::Arena* arena) {
+inline void ResetSettingsResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, w_),
-           0,
-           offsetof(Impl_, z_) -
-               offsetof(Impl_, w_) +
-               sizeof(Impl_::z_));
+  _impl_.camera_result_ = {};
 }
-Quaternion::~Quaternion() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Quaternion)
+ResetSettingsResponse::~ResetSettingsResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.ResetSettingsResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void Quaternion::SharedDtor() {
+inline void ResetSettingsResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void Quaternion::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Quaternion)
+PROTOBUF_NOINLINE void ResetSettingsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.ResetSettingsResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.w_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.z_) -
-      reinterpret_cast<char*>(&_impl_.w_)) + sizeof(_impl_.z_));
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+    _impl_.camera_result_->Clear();
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* Quaternion::_InternalParse(
+const char* ResetSettingsResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -9839,106 +10162,48 @@ const char* Quaternion::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 0, 2> Quaternion::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> ResetSettingsResponse::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_._has_bits_),
     0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_Quaternion_default_instance_._instance,
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_ResetSettingsResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // float z = 4;
-    {::_pbi::TcParser::FastF32S1,
-     {37, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.z_)}},
-    // float w = 1;
-    {::_pbi::TcParser::FastF32S1,
-     {13, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.w_)}},
-    // float x = 2;
-    {::_pbi::TcParser::FastF32S1,
-     {21, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.x_)}},
-    // float y = 3;
-    {::_pbi::TcParser::FastF32S1,
-     {29, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.y_)}},
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // float w = 1;
-    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.w_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float x = 2;
-    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.x_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float y = 3;
-    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.y_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float z = 4;
-    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.z_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-  }},
-  // no aux_entries
-  {{
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {PROTOBUF_FIELD_OFFSET(ResetSettingsResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
+  }}, {{
   }},
 };
 
-::uint8_t* Quaternion::_InternalSerialize(
+::uint8_t* ResetSettingsResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Quaternion)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.ResetSettingsResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // float w = 1;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_w = this->_internal_w();
-  ::uint32_t raw_w;
-  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
-  if (raw_w != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        1, this->_internal_w(), target);
-  }
-
-  // float x = 2;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_x = this->_internal_x();
-  ::uint32_t raw_x;
-  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
-  if (raw_x != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        2, this->_internal_x(), target);
-  }
-
-  // float y = 3;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_y = this->_internal_y();
-  ::uint32_t raw_y;
-  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
-  if (raw_y != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        3, this->_internal_y(), target);
-  }
-
-  // float z = 4;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_z = this->_internal_z();
-  ::uint32_t raw_z;
-  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
-  if (raw_z != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        4, this->_internal_z(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::camera_result(this),
+        _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -9946,196 +10211,124 @@ const ::_pbi::TcParseTable<2, 4, 0, 0, 2> Quaternion::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Quaternion)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.ResetSettingsResponse)
   return target;
 }
 
-::size_t Quaternion::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Quaternion)
+::size_t ResetSettingsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.ResetSettingsResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float w = 1;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_w = this->_internal_w();
-  ::uint32_t raw_w;
-  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
-  if (raw_w != 0) {
-    total_size += 5;
-  }
-
-  // float x = 2;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_x = this->_internal_x();
-  ::uint32_t raw_x;
-  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
-  if (raw_x != 0) {
-    total_size += 5;
-  }
-
-  // float y = 3;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_y = this->_internal_y();
-  ::uint32_t raw_y;
-  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
-  if (raw_y != 0) {
-    total_size += 5;
-  }
-
-  // float z = 4;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_z = this->_internal_z();
-  ::uint32_t raw_z;
-  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
-  if (raw_z != 0) {
-    total_size += 5;
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData Quaternion::_class_data_ = {
-    Quaternion::MergeImpl,
+const ::google::protobuf::Message::ClassData ResetSettingsResponse::_class_data_ = {
+    ResetSettingsResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* Quaternion::GetClassData() const {
+const ::google::protobuf::Message::ClassData* ResetSettingsResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void Quaternion::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<Quaternion*>(&to_msg);
-  auto& from = static_cast<const Quaternion&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Quaternion)
+void ResetSettingsResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<ResetSettingsResponse*>(&to_msg);
+  auto& from = static_cast<const ResetSettingsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.ResetSettingsResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_w = from._internal_w();
-  ::uint32_t raw_w;
-  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
-  if (raw_w != 0) {
-    _this->_internal_set_w(from._internal_w());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_x = from._internal_x();
-  ::uint32_t raw_x;
-  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
-  if (raw_x != 0) {
-    _this->_internal_set_x(from._internal_x());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_y = from._internal_y();
-  ::uint32_t raw_y;
-  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
-  if (raw_y != 0) {
-    _this->_internal_set_y(from._internal_y());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_z = from._internal_z();
-  ::uint32_t raw_z;
-  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
-  if (raw_z != 0) {
-    _this->_internal_set_z(from._internal_z());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+        from._internal_camera_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Quaternion::CopyFrom(const Quaternion& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Quaternion)
+void ResetSettingsResponse::CopyFrom(const ResetSettingsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.ResetSettingsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool Quaternion::IsInitialized() const {
+PROTOBUF_NOINLINE bool ResetSettingsResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* Quaternion::AccessCachedSize() const {
+::_pbi::CachedSize* ResetSettingsResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void Quaternion::InternalSwap(Quaternion* PROTOBUF_RESTRICT other) {
+void ResetSettingsResponse::InternalSwap(ResetSettingsResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.z_)
-      + sizeof(Quaternion::_impl_.z_)
-      - PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.w_)>(
-          reinterpret_cast<char*>(&_impl_.w_),
-          reinterpret_cast<char*>(&other->_impl_.w_));
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata Quaternion::GetMetadata() const {
+::google::protobuf::Metadata ResetSettingsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[48]);
+      file_level_metadata_camera_2fcamera_2eproto[49]);
 }
 // ===================================================================
 
-class EulerAngle::_Internal {
+class SetTimestampRequest::_Internal {
  public:
 };
 
-EulerAngle::EulerAngle(::google::protobuf::Arena* arena)
+SetTimestampRequest::SetTimestampRequest(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.EulerAngle)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetTimestampRequest)
 }
-EulerAngle::EulerAngle(
-    ::google::protobuf::Arena* arena, const EulerAngle& from)
-    : EulerAngle(arena) {
+SetTimestampRequest::SetTimestampRequest(
+    ::google::protobuf::Arena* arena, const SetTimestampRequest& from)
+    : SetTimestampRequest(arena) {
   MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE EulerAngle::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetTimestampRequest::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void EulerAngle::SharedCtor(::_pb::Arena* arena) {
+inline void SetTimestampRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, roll_deg_),
-           0,
-           offsetof(Impl_, yaw_deg_) -
-               offsetof(Impl_, roll_deg_) +
-               sizeof(Impl_::yaw_deg_));
+  _impl_.timestamp_ = {};
 }
-EulerAngle::~EulerAngle() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.EulerAngle)
+SetTimestampRequest::~SetTimestampRequest() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetTimestampRequest)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void EulerAngle::SharedDtor() {
+inline void SetTimestampRequest::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void EulerAngle::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.EulerAngle)
-  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+PROTOBUF_NOINLINE void SetTimestampRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetTimestampRequest)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.roll_deg_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.yaw_deg_) -
-      reinterpret_cast<char*>(&_impl_.roll_deg_)) + sizeof(_impl_.yaw_deg_));
+  _impl_.timestamp_ = ::int64_t{0};
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* EulerAngle::_InternalParse(
+const char* SetTimestampRequest::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -10143,89 +10336,47 @@ const char* EulerAngle::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> EulerAngle::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> SetTimestampRequest::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
+    1,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_EulerAngle_default_instance_._instance,
+    &_SetTimestampRequest_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // float roll_deg = 1;
-    {::_pbi::TcParser::FastF32S1,
-     {13, 63, 0, PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.roll_deg_)}},
-    // float pitch_deg = 2;
-    {::_pbi::TcParser::FastF32S1,
-     {21, 63, 0, PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.pitch_deg_)}},
-    // float yaw_deg = 3;
-    {::_pbi::TcParser::FastF32S1,
-     {29, 63, 0, PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.yaw_deg_)}},
+    // int64 timestamp = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SetTimestampRequest, _impl_.timestamp_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SetTimestampRequest, _impl_.timestamp_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // float roll_deg = 1;
-    {PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.roll_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float pitch_deg = 2;
-    {PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.pitch_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float yaw_deg = 3;
-    {PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.yaw_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // int64 timestamp = 1;
+    {PROTOBUF_FIELD_OFFSET(SetTimestampRequest, _impl_.timestamp_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
   }},
   // no aux_entries
   {{
   }},
 };
 
-::uint8_t* EulerAngle::_InternalSerialize(
+::uint8_t* SetTimestampRequest::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.EulerAngle)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetTimestampRequest)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // float roll_deg = 1;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_roll_deg = this->_internal_roll_deg();
-  ::uint32_t raw_roll_deg;
-  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
-  if (raw_roll_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        1, this->_internal_roll_deg(), target);
-  }
-
-  // float pitch_deg = 2;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_pitch_deg = this->_internal_pitch_deg();
-  ::uint32_t raw_pitch_deg;
-  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
-  if (raw_pitch_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        2, this->_internal_pitch_deg(), target);
-  }
-
-  // float yaw_deg = 3;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_yaw_deg = this->_internal_yaw_deg();
-  ::uint32_t raw_yaw_deg;
-  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
-  if (raw_yaw_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        3, this->_internal_yaw_deg(), target);
+  // int64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt64ToArrayWithField<1>(
+            stream, this->_internal_timestamp(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -10233,255 +10384,154 @@ const ::_pbi::TcParseTable<2, 3, 0, 0, 2> EulerAngle::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.EulerAngle)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetTimestampRequest)
   return target;
 }
 
-::size_t EulerAngle::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.EulerAngle)
+::size_t SetTimestampRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetTimestampRequest)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float roll_deg = 1;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_roll_deg = this->_internal_roll_deg();
-  ::uint32_t raw_roll_deg;
-  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
-  if (raw_roll_deg != 0) {
-    total_size += 5;
-  }
-
-  // float pitch_deg = 2;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_pitch_deg = this->_internal_pitch_deg();
-  ::uint32_t raw_pitch_deg;
-  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
-  if (raw_pitch_deg != 0) {
-    total_size += 5;
-  }
-
-  // float yaw_deg = 3;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_yaw_deg = this->_internal_yaw_deg();
-  ::uint32_t raw_yaw_deg;
-  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
-  if (raw_yaw_deg != 0) {
-    total_size += 5;
+  // int64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+        this->_internal_timestamp());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData EulerAngle::_class_data_ = {
-    EulerAngle::MergeImpl,
+const ::google::protobuf::Message::ClassData SetTimestampRequest::_class_data_ = {
+    SetTimestampRequest::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* EulerAngle::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetTimestampRequest::GetClassData() const {
   return &_class_data_;
 }
 
-void EulerAngle::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<EulerAngle*>(&to_msg);
-  auto& from = static_cast<const EulerAngle&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.EulerAngle)
+void SetTimestampRequest::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetTimestampRequest*>(&to_msg);
+  auto& from = static_cast<const SetTimestampRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetTimestampRequest)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_roll_deg = from._internal_roll_deg();
-  ::uint32_t raw_roll_deg;
-  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
-  if (raw_roll_deg != 0) {
-    _this->_internal_set_roll_deg(from._internal_roll_deg());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_pitch_deg = from._internal_pitch_deg();
-  ::uint32_t raw_pitch_deg;
-  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
-  if (raw_pitch_deg != 0) {
-    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_yaw_deg = from._internal_yaw_deg();
-  ::uint32_t raw_yaw_deg;
-  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
-  if (raw_yaw_deg != 0) {
-    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void EulerAngle::CopyFrom(const EulerAngle& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.EulerAngle)
+void SetTimestampRequest::CopyFrom(const SetTimestampRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetTimestampRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool EulerAngle::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetTimestampRequest::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* EulerAngle::AccessCachedSize() const {
+::_pbi::CachedSize* SetTimestampRequest::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void EulerAngle::InternalSwap(EulerAngle* PROTOBUF_RESTRICT other) {
+void SetTimestampRequest::InternalSwap(SetTimestampRequest* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.yaw_deg_)
-      + sizeof(EulerAngle::_impl_.yaw_deg_)
-      - PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.roll_deg_)>(
-          reinterpret_cast<char*>(&_impl_.roll_deg_),
-          reinterpret_cast<char*>(&other->_impl_.roll_deg_));
+        swap(_impl_.timestamp_, other->_impl_.timestamp_);
 }
 
-::google::protobuf::Metadata EulerAngle::GetMetadata() const {
+::google::protobuf::Metadata SetTimestampRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[49]);
+      file_level_metadata_camera_2fcamera_2eproto[50]);
 }
 // ===================================================================
 
-class CaptureInfo::_Internal {
+class SetTimestampResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<CaptureInfo>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<SetTimestampResponse>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::Position& position(const CaptureInfo* msg);
-  static void set_has_position(HasBits* has_bits) {
+    8 * PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::CameraResult& camera_result(const SetTimestampResponse* msg);
+  static void set_has_camera_result(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static const ::mavcam::rpc::camera::Quaternion& attitude_quaternion(const CaptureInfo* msg);
-  static void set_has_attitude_quaternion(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static const ::mavcam::rpc::camera::EulerAngle& attitude_euler_angle(const CaptureInfo* msg);
-  static void set_has_attitude_euler_angle(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
 };
 
-const ::mavcam::rpc::camera::Position& CaptureInfo::_Internal::position(const CaptureInfo* msg) {
-  return *msg->_impl_.position_;
-}
-const ::mavcam::rpc::camera::Quaternion& CaptureInfo::_Internal::attitude_quaternion(const CaptureInfo* msg) {
-  return *msg->_impl_.attitude_quaternion_;
-}
-const ::mavcam::rpc::camera::EulerAngle& CaptureInfo::_Internal::attitude_euler_angle(const CaptureInfo* msg) {
-  return *msg->_impl_.attitude_euler_angle_;
+const ::mavcam::rpc::camera::CameraResult& SetTimestampResponse::_Internal::camera_result(const SetTimestampResponse* msg) {
+  return *msg->_impl_.camera_result_;
 }
-CaptureInfo::CaptureInfo(::google::protobuf::Arena* arena)
+SetTimestampResponse::SetTimestampResponse(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CaptureInfo)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SetTimestampResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CaptureInfo::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetTimestampResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
       : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        file_url_(arena, from.file_url_) {}
+        _cached_size_{0} {}
 
-CaptureInfo::CaptureInfo(
+SetTimestampResponse::SetTimestampResponse(
     ::google::protobuf::Arena* arena,
-    const CaptureInfo& from)
+    const SetTimestampResponse& from)
     : ::google::protobuf::Message(arena) {
-  CaptureInfo* const _this = this;
+  SetTimestampResponse* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
   ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.position_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Position>(arena, *from._impl_.position_)
-                : nullptr;
-  _impl_.attitude_quaternion_ = (cached_has_bits & 0x00000002u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Quaternion>(arena, *from._impl_.attitude_quaternion_)
-                : nullptr;
-  _impl_.attitude_euler_angle_ = (cached_has_bits & 0x00000004u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::EulerAngle>(arena, *from._impl_.attitude_euler_angle_)
+  _impl_.camera_result_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(arena, *from._impl_.camera_result_)
                 : nullptr;
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, time_utc_us_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, time_utc_us_),
-           offsetof(Impl_, index_) -
-               offsetof(Impl_, time_utc_us_) +
-               sizeof(Impl_::index_));
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CaptureInfo)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SetTimestampResponse)
 }
-inline PROTOBUF_NDEBUG_INLINE CaptureInfo::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SetTimestampResponse::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        file_url_(arena) {}
+      : _cached_size_{0} {}
 
-inline void CaptureInfo::SharedCtor(::_pb::Arena* arena) {
+inline void SetTimestampResponse::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, position_),
-           0,
-           offsetof(Impl_, index_) -
-               offsetof(Impl_, position_) +
-               sizeof(Impl_::index_));
+  _impl_.camera_result_ = {};
 }
-CaptureInfo::~CaptureInfo() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CaptureInfo)
+SetTimestampResponse::~SetTimestampResponse() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SetTimestampResponse)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void CaptureInfo::SharedDtor() {
+inline void SetTimestampResponse::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.file_url_.Destroy();
-  delete _impl_.position_;
-  delete _impl_.attitude_quaternion_;
-  delete _impl_.attitude_euler_angle_;
+  delete _impl_.camera_result_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void CaptureInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CaptureInfo)
+PROTOBUF_NOINLINE void SetTimestampResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SetTimestampResponse)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.file_url_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.position_ != nullptr);
-      _impl_.position_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.attitude_quaternion_ != nullptr);
-      _impl_.attitude_quaternion_->Clear();
-    }
-    if (cached_has_bits & 0x00000004u) {
-      ABSL_DCHECK(_impl_.attitude_euler_angle_ != nullptr);
-      _impl_.attitude_euler_angle_->Clear();
-    }
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.camera_result_ != nullptr);
+    _impl_.camera_result_->Clear();
   }
-  ::memset(&_impl_.time_utc_us_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.index_) -
-      reinterpret_cast<char*>(&_impl_.time_utc_us_)) + sizeof(_impl_.index_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* CaptureInfo::_InternalParse(
+const char* SetTimestampResponse::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -10489,133 +10539,48 @@ const char* CaptureInfo::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 7, 3, 46, 2> CaptureInfo::_table_ = {
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetTimestampResponse::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_._has_bits_),
+    PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_._has_bits_),
     0, // no _extensions_
-    7, 56,  // max_field_number, fast_idx_mask
+    1, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967168,  // skipmap
+    4294967294,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    7,  // num_field_entries
-    3,  // num_aux_entries
+    1,  // num_field_entries
+    1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
-    &_CaptureInfo_default_instance_._instance,
+    &_SetTimestampResponse_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .mavcam.rpc.camera.Position position = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.position_)}},
-    // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_quaternion_)}},
-    // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
     {::_pbi::TcParser::FastMtS1,
-     {26, 2, 2, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_euler_angle_)}},
-    // uint64 time_utc_us = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CaptureInfo, _impl_.time_utc_us_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.time_utc_us_)}},
-    // bool is_success = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(CaptureInfo, _impl_.is_success_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.is_success_)}},
-    // int32 index = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CaptureInfo, _impl_.index_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.index_)}},
-    // string file_url = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.file_url_)}},
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_.camera_result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // .mavcam.rpc.camera.Position position = 1;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.position_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_quaternion_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_euler_angle_), _Internal::kHasBitsOffset + 2, 2,
+    // .mavcam.rpc.camera.CameraResult camera_result = 1;
+    {PROTOBUF_FIELD_OFFSET(SetTimestampResponse, _impl_.camera_result_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // uint64 time_utc_us = 4;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.time_utc_us_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // bool is_success = 5;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.is_success_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // int32 index = 6;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.index_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // string file_url = 7;
-    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.file_url_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Position>()},
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Quaternion>()},
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::EulerAngle>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::CameraResult>()},
   }}, {{
-    "\35\0\0\0\0\0\0\10"
-    "mavcam.rpc.camera.CaptureInfo"
-    "file_url"
   }},
 };
 
-::uint8_t* CaptureInfo::_InternalSerialize(
+::uint8_t* SetTimestampResponse::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CaptureInfo)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SetTimestampResponse)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.Position position = 1;
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
   if (cached_has_bits & 0x00000001u) {
     target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, _Internal::position(this),
-        _Internal::position(this).GetCachedSize(), target, stream);
-  }
-
-  // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
-  if (cached_has_bits & 0x00000002u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        2, _Internal::attitude_quaternion(this),
-        _Internal::attitude_quaternion(this).GetCachedSize(), target, stream);
-  }
-
-  // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
-  if (cached_has_bits & 0x00000004u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        3, _Internal::attitude_euler_angle(this),
-        _Internal::attitude_euler_angle(this).GetCachedSize(), target, stream);
-  }
-
-  // uint64 time_utc_us = 4;
-  if (this->_internal_time_utc_us() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-        4, this->_internal_time_utc_us(), target);
-  }
-
-  // bool is_success = 5;
-  if (this->_internal_is_success() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        5, this->_internal_is_success(), target);
-  }
-
-  // int32 index = 6;
-  if (this->_internal_index() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<6>(
-            stream, this->_internal_index(), target);
-  }
-
-  // string file_url = 7;
-  if (!this->_internal_file_url().empty()) {
-    const std::string& _s = this->_internal_file_url();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.CaptureInfo.file_url");
-    target = stream->WriteStringMaybeAliased(7, _s, target);
+        1, _Internal::camera_result(this),
+        _Internal::camera_result(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -10623,222 +10588,141 @@ const ::_pbi::TcParseTable<3, 7, 3, 46, 2> CaptureInfo::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CaptureInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SetTimestampResponse)
   return target;
 }
 
-::size_t CaptureInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CaptureInfo)
+::size_t SetTimestampResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SetTimestampResponse)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string file_url = 7;
-  if (!this->_internal_file_url().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_file_url());
-  }
-
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
-    // .mavcam.rpc.camera.Position position = 1;
-    if (cached_has_bits & 0x00000001u) {
-      total_size +=
-          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.position_);
-    }
-
-    // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
-    if (cached_has_bits & 0x00000002u) {
-      total_size +=
-          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.attitude_quaternion_);
-    }
-
-    // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
-    if (cached_has_bits & 0x00000004u) {
-      total_size +=
-          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.attitude_euler_angle_);
-    }
-
-  }
-  // uint64 time_utc_us = 4;
-  if (this->_internal_time_utc_us() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-        this->_internal_time_utc_us());
-  }
-
-  // bool is_success = 5;
-  if (this->_internal_is_success() != 0) {
-    total_size += 2;
-  }
-
-  // int32 index = 6;
-  if (this->_internal_index() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_index());
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.camera_result_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData CaptureInfo::_class_data_ = {
-    CaptureInfo::MergeImpl,
+const ::google::protobuf::Message::ClassData SetTimestampResponse::_class_data_ = {
+    SetTimestampResponse::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* CaptureInfo::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SetTimestampResponse::GetClassData() const {
   return &_class_data_;
 }
 
-void CaptureInfo::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<CaptureInfo*>(&to_msg);
-  auto& from = static_cast<const CaptureInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CaptureInfo)
+void SetTimestampResponse::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SetTimestampResponse*>(&to_msg);
+  auto& from = static_cast<const SetTimestampResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SetTimestampResponse)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_file_url().empty()) {
-    _this->_internal_set_file_url(from._internal_file_url());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_mutable_position()->::mavcam::rpc::camera::Position::MergeFrom(
-          from._internal_position());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_mutable_attitude_quaternion()->::mavcam::rpc::camera::Quaternion::MergeFrom(
-          from._internal_attitude_quaternion());
-    }
-    if (cached_has_bits & 0x00000004u) {
-      _this->_internal_mutable_attitude_euler_angle()->::mavcam::rpc::camera::EulerAngle::MergeFrom(
-          from._internal_attitude_euler_angle());
-    }
-  }
-  if (from._internal_time_utc_us() != 0) {
-    _this->_internal_set_time_utc_us(from._internal_time_utc_us());
-  }
-  if (from._internal_is_success() != 0) {
-    _this->_internal_set_is_success(from._internal_is_success());
-  }
-  if (from._internal_index() != 0) {
-    _this->_internal_set_index(from._internal_index());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_camera_result()->::mavcam::rpc::camera::CameraResult::MergeFrom(
+        from._internal_camera_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CaptureInfo::CopyFrom(const CaptureInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CaptureInfo)
+void SetTimestampResponse::CopyFrom(const SetTimestampResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SetTimestampResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool CaptureInfo::IsInitialized() const {
+PROTOBUF_NOINLINE bool SetTimestampResponse::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* CaptureInfo::AccessCachedSize() const {
+::_pbi::CachedSize* SetTimestampResponse::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void CaptureInfo::InternalSwap(CaptureInfo* PROTOBUF_RESTRICT other) {
+void SetTimestampResponse::InternalSwap(SetTimestampResponse* PROTOBUF_RESTRICT other) {
   using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.file_url_, &other->_impl_.file_url_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.index_)
-      + sizeof(CaptureInfo::_impl_.index_)
-      - PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.position_)>(
-          reinterpret_cast<char*>(&_impl_.position_),
-          reinterpret_cast<char*>(&other->_impl_.position_));
+  swap(_impl_.camera_result_, other->_impl_.camera_result_);
 }
 
-::google::protobuf::Metadata CaptureInfo::GetMetadata() const {
+::google::protobuf::Metadata SetTimestampResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[50]);
+      file_level_metadata_camera_2fcamera_2eproto[51]);
 }
 // ===================================================================
 
-class VideoStreamSettings::_Internal {
+class CameraResult::_Internal {
  public:
 };
 
-VideoStreamSettings::VideoStreamSettings(::google::protobuf::Arena* arena)
+CameraResult::CameraResult(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.VideoStreamSettings)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CameraResult)
 }
-inline PROTOBUF_NDEBUG_INLINE VideoStreamSettings::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CameraResult::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : uri_(arena, from.uri_),
+      : result_str_(arena, from.result_str_),
         _cached_size_{0} {}
 
-VideoStreamSettings::VideoStreamSettings(
+CameraResult::CameraResult(
     ::google::protobuf::Arena* arena,
-    const VideoStreamSettings& from)
+    const CameraResult& from)
     : ::google::protobuf::Message(arena) {
-  VideoStreamSettings* const _this = this;
+  CameraResult* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, frame_rate_hz_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, frame_rate_hz_),
-           offsetof(Impl_, horizontal_fov_deg_) -
-               offsetof(Impl_, frame_rate_hz_) +
-               sizeof(Impl_::horizontal_fov_deg_));
+  _impl_.result_ = from._impl_.result_;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.VideoStreamSettings)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CameraResult)
 }
-inline PROTOBUF_NDEBUG_INLINE VideoStreamSettings::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CameraResult::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : uri_(arena),
+      : result_str_(arena),
         _cached_size_{0} {}
 
-inline void VideoStreamSettings::SharedCtor(::_pb::Arena* arena) {
+inline void CameraResult::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, frame_rate_hz_),
-           0,
-           offsetof(Impl_, horizontal_fov_deg_) -
-               offsetof(Impl_, frame_rate_hz_) +
-               sizeof(Impl_::horizontal_fov_deg_));
+  _impl_.result_ = {};
 }
-VideoStreamSettings::~VideoStreamSettings() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.VideoStreamSettings)
+CameraResult::~CameraResult() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CameraResult)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void VideoStreamSettings::SharedDtor() {
+inline void CameraResult::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.uri_.Destroy();
+  _impl_.result_str_.Destroy();
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void VideoStreamSettings::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.VideoStreamSettings)
+PROTOBUF_NOINLINE void CameraResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CameraResult)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.uri_.ClearToEmpty();
-  ::memset(&_impl_.frame_rate_hz_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.horizontal_fov_deg_) -
-      reinterpret_cast<char*>(&_impl_.frame_rate_hz_)) + sizeof(_impl_.horizontal_fov_deg_));
+  _impl_.result_str_.ClearToEmpty();
+  _impl_.result_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* VideoStreamSettings::_InternalParse(
+const char* CameraResult::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -10846,140 +10730,64 @@ const char* VideoStreamSettings::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 7, 0, 49, 2> VideoStreamSettings::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 49, 2> CameraResult::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    7, 56,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967168,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    7,  // num_field_entries
+    2,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_VideoStreamSettings_default_instance_._instance,
+    &_CameraResult_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // float frame_rate_hz = 1;
-    {::_pbi::TcParser::FastF32S1,
-     {13, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.frame_rate_hz_)}},
-    // uint32 horizontal_resolution_pix = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.horizontal_resolution_pix_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_resolution_pix_)}},
-    // uint32 vertical_resolution_pix = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.vertical_resolution_pix_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.vertical_resolution_pix_)}},
-    // uint32 bit_rate_b_s = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.bit_rate_b_s_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.bit_rate_b_s_)}},
-    // uint32 rotation_deg = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.rotation_deg_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.rotation_deg_)}},
-    // string uri = 6;
+    // string result_str = 2;
     {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.uri_)}},
-    // float horizontal_fov_deg = 7;
-    {::_pbi::TcParser::FastF32S1,
-     {61, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_fov_deg_)}},
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_str_)}},
+    // .mavcam.rpc.camera.CameraResult.Result result = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CameraResult, _impl_.result_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // float frame_rate_hz = 1;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.frame_rate_hz_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // uint32 horizontal_resolution_pix = 2;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_resolution_pix_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-    // uint32 vertical_resolution_pix = 3;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.vertical_resolution_pix_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-    // uint32 bit_rate_b_s = 4;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.bit_rate_b_s_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-    // uint32 rotation_deg = 5;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.rotation_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-    // string uri = 6;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.uri_), 0, 0,
+    // .mavcam.rpc.camera.CameraResult.Result result = 1;
+    {PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // string result_str = 2;
+    {PROTOBUF_FIELD_OFFSET(CameraResult, _impl_.result_str_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // float horizontal_fov_deg = 7;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_fov_deg_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
   }},
   // no aux_entries
   {{
-    "\45\0\0\0\0\0\3\0"
-    "mavcam.rpc.camera.VideoStreamSettings"
-    "uri"
+    "\36\0\12\0\0\0\0\0"
+    "mavcam.rpc.camera.CameraResult"
+    "result_str"
   }},
 };
 
-::uint8_t* VideoStreamSettings::_InternalSerialize(
+::uint8_t* CameraResult::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.VideoStreamSettings)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CameraResult)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // float frame_rate_hz = 1;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_frame_rate_hz = this->_internal_frame_rate_hz();
-  ::uint32_t raw_frame_rate_hz;
-  memcpy(&raw_frame_rate_hz, &tmp_frame_rate_hz, sizeof(tmp_frame_rate_hz));
-  if (raw_frame_rate_hz != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        1, this->_internal_frame_rate_hz(), target);
-  }
-
-  // uint32 horizontal_resolution_pix = 2;
-  if (this->_internal_horizontal_resolution_pix() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-        2, this->_internal_horizontal_resolution_pix(), target);
-  }
-
-  // uint32 vertical_resolution_pix = 3;
-  if (this->_internal_vertical_resolution_pix() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-        3, this->_internal_vertical_resolution_pix(), target);
-  }
-
-  // uint32 bit_rate_b_s = 4;
-  if (this->_internal_bit_rate_b_s() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-        4, this->_internal_bit_rate_b_s(), target);
-  }
-
-  // uint32 rotation_deg = 5;
-  if (this->_internal_rotation_deg() != 0) {
+  // .mavcam.rpc.camera.CameraResult.Result result = 1;
+  if (this->_internal_result() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-        5, this->_internal_rotation_deg(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_result(), target);
   }
 
-  // string uri = 6;
-  if (!this->_internal_uri().empty()) {
-    const std::string& _s = this->_internal_uri();
+  // string result_str = 2;
+  if (!this->_internal_result_str().empty()) {
+    const std::string& _s = this->_internal_result_str();
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.VideoStreamSettings.uri");
-    target = stream->WriteStringMaybeAliased(6, _s, target);
-  }
-
-  // float horizontal_fov_deg = 7;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_horizontal_fov_deg = this->_internal_horizontal_fov_deg();
-  ::uint32_t raw_horizontal_fov_deg;
-  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
-  if (raw_horizontal_fov_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        7, this->_internal_horizontal_fov_deg(), target);
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.CameraResult.result_str");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -10987,249 +10795,140 @@ const ::_pbi::TcParseTable<3, 7, 0, 49, 2> VideoStreamSettings::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.VideoStreamSettings)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CameraResult)
   return target;
 }
 
-::size_t VideoStreamSettings::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.VideoStreamSettings)
+::size_t CameraResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CameraResult)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uri = 6;
-  if (!this->_internal_uri().empty()) {
+  // string result_str = 2;
+  if (!this->_internal_result_str().empty()) {
     total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_uri());
-  }
-
-  // float frame_rate_hz = 1;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_frame_rate_hz = this->_internal_frame_rate_hz();
-  ::uint32_t raw_frame_rate_hz;
-  memcpy(&raw_frame_rate_hz, &tmp_frame_rate_hz, sizeof(tmp_frame_rate_hz));
-  if (raw_frame_rate_hz != 0) {
-    total_size += 5;
+                                    this->_internal_result_str());
   }
 
-  // uint32 horizontal_resolution_pix = 2;
-  if (this->_internal_horizontal_resolution_pix() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-        this->_internal_horizontal_resolution_pix());
+  // .mavcam.rpc.camera.CameraResult.Result result = 1;
+  if (this->_internal_result() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_result());
   }
 
-  // uint32 vertical_resolution_pix = 3;
-  if (this->_internal_vertical_resolution_pix() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-        this->_internal_vertical_resolution_pix());
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // uint32 bit_rate_b_s = 4;
-  if (this->_internal_bit_rate_b_s() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-        this->_internal_bit_rate_b_s());
-  }
-
-  // uint32 rotation_deg = 5;
-  if (this->_internal_rotation_deg() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-        this->_internal_rotation_deg());
-  }
-
-  // float horizontal_fov_deg = 7;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_horizontal_fov_deg = this->_internal_horizontal_fov_deg();
-  ::uint32_t raw_horizontal_fov_deg;
-  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
-  if (raw_horizontal_fov_deg != 0) {
-    total_size += 5;
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
-
-const ::google::protobuf::Message::ClassData VideoStreamSettings::_class_data_ = {
-    VideoStreamSettings::MergeImpl,
+const ::google::protobuf::Message::ClassData CameraResult::_class_data_ = {
+    CameraResult::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* VideoStreamSettings::GetClassData() const {
+const ::google::protobuf::Message::ClassData* CameraResult::GetClassData() const {
   return &_class_data_;
 }
 
-void VideoStreamSettings::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<VideoStreamSettings*>(&to_msg);
-  auto& from = static_cast<const VideoStreamSettings&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.VideoStreamSettings)
+void CameraResult::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<CameraResult*>(&to_msg);
+  auto& from = static_cast<const CameraResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CameraResult)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_uri().empty()) {
-    _this->_internal_set_uri(from._internal_uri());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_frame_rate_hz = from._internal_frame_rate_hz();
-  ::uint32_t raw_frame_rate_hz;
-  memcpy(&raw_frame_rate_hz, &tmp_frame_rate_hz, sizeof(tmp_frame_rate_hz));
-  if (raw_frame_rate_hz != 0) {
-    _this->_internal_set_frame_rate_hz(from._internal_frame_rate_hz());
-  }
-  if (from._internal_horizontal_resolution_pix() != 0) {
-    _this->_internal_set_horizontal_resolution_pix(from._internal_horizontal_resolution_pix());
-  }
-  if (from._internal_vertical_resolution_pix() != 0) {
-    _this->_internal_set_vertical_resolution_pix(from._internal_vertical_resolution_pix());
-  }
-  if (from._internal_bit_rate_b_s() != 0) {
-    _this->_internal_set_bit_rate_b_s(from._internal_bit_rate_b_s());
-  }
-  if (from._internal_rotation_deg() != 0) {
-    _this->_internal_set_rotation_deg(from._internal_rotation_deg());
+  if (!from._internal_result_str().empty()) {
+    _this->_internal_set_result_str(from._internal_result_str());
   }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_horizontal_fov_deg = from._internal_horizontal_fov_deg();
-  ::uint32_t raw_horizontal_fov_deg;
-  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
-  if (raw_horizontal_fov_deg != 0) {
-    _this->_internal_set_horizontal_fov_deg(from._internal_horizontal_fov_deg());
+  if (from._internal_result() != 0) {
+    _this->_internal_set_result(from._internal_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void VideoStreamSettings::CopyFrom(const VideoStreamSettings& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.VideoStreamSettings)
+void CameraResult::CopyFrom(const CameraResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CameraResult)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool VideoStreamSettings::IsInitialized() const {
+PROTOBUF_NOINLINE bool CameraResult::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* VideoStreamSettings::AccessCachedSize() const {
+::_pbi::CachedSize* CameraResult::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void VideoStreamSettings::InternalSwap(VideoStreamSettings* PROTOBUF_RESTRICT other) {
+void CameraResult::InternalSwap(CameraResult* PROTOBUF_RESTRICT other) {
   using std::swap;
   auto* arena = GetArena();
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uri_, &other->_impl_.uri_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_fov_deg_)
-      + sizeof(VideoStreamSettings::_impl_.horizontal_fov_deg_)
-      - PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.frame_rate_hz_)>(
-          reinterpret_cast<char*>(&_impl_.frame_rate_hz_),
-          reinterpret_cast<char*>(&other->_impl_.frame_rate_hz_));
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.result_str_, &other->_impl_.result_str_, arena);
+  swap(_impl_.result_, other->_impl_.result_);
 }
 
-::google::protobuf::Metadata VideoStreamSettings::GetMetadata() const {
+::google::protobuf::Metadata CameraResult::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[51]);
+      file_level_metadata_camera_2fcamera_2eproto[52]);
 }
 // ===================================================================
 
-class VideoStreamInfo::_Internal {
+class Position::_Internal {
  public:
-  using HasBits = decltype(std::declval<VideoStreamInfo>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::VideoStreamSettings& settings(const VideoStreamInfo* msg);
-  static void set_has_settings(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::VideoStreamSettings& VideoStreamInfo::_Internal::settings(const VideoStreamInfo* msg) {
-  return *msg->_impl_.settings_;
-}
-VideoStreamInfo::VideoStreamInfo(::google::protobuf::Arena* arena)
+Position::Position(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.VideoStreamInfo)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Position)
 }
-inline PROTOBUF_NDEBUG_INLINE VideoStreamInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-VideoStreamInfo::VideoStreamInfo(
-    ::google::protobuf::Arena* arena,
-    const VideoStreamInfo& from)
-    : ::google::protobuf::Message(arena) {
-  VideoStreamInfo* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.settings_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::VideoStreamSettings>(arena, *from._impl_.settings_)
-                : nullptr;
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, stream_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, stream_id_),
-           offsetof(Impl_, spectrum_) -
-               offsetof(Impl_, stream_id_) +
-               sizeof(Impl_::spectrum_));
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.VideoStreamInfo)
+Position::Position(
+    ::google::protobuf::Arena* arena, const Position& from)
+    : Position(arena) {
+  MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE VideoStreamInfo::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE Position::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : _cached_size_{0} {}
 
-inline void VideoStreamInfo::SharedCtor(::_pb::Arena* arena) {
+inline void Position::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, settings_),
+               offsetof(Impl_, latitude_deg_),
            0,
-           offsetof(Impl_, spectrum_) -
-               offsetof(Impl_, settings_) +
-               sizeof(Impl_::spectrum_));
+           offsetof(Impl_, relative_altitude_m_) -
+               offsetof(Impl_, latitude_deg_) +
+               sizeof(Impl_::relative_altitude_m_));
 }
-VideoStreamInfo::~VideoStreamInfo() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.VideoStreamInfo)
+Position::~Position() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Position)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void VideoStreamInfo::SharedDtor() {
+inline void Position::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  delete _impl_.settings_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void VideoStreamInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.VideoStreamInfo)
+PROTOBUF_NOINLINE void Position::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Position)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.settings_ != nullptr);
-    _impl_.settings_->Clear();
-  }
-  ::memset(&_impl_.stream_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.spectrum_) -
-      reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.spectrum_));
-  _impl_._has_bits_.Clear();
+  ::memset(&_impl_.latitude_deg_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.relative_altitude_m_) -
+      reinterpret_cast<char*>(&_impl_.latitude_deg_)) + sizeof(_impl_.relative_altitude_m_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* VideoStreamInfo::_InternalParse(
+const char* Position::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -11237,87 +10936,106 @@ const char* VideoStreamInfo::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 0, 2> VideoStreamInfo::_table_ = {
+const ::_pbi::TcParseTable<2, 4, 0, 0, 2> Position::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
     4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
     4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_VideoStreamInfo_default_instance_._instance,
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_Position_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamInfo, _impl_.spectrum_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.spectrum_)}},
-    // int32 stream_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamInfo, _impl_.stream_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.stream_id_)}},
-    // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 0, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.settings_)}},
-    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamInfo, _impl_.status_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.status_)}},
+    // float relative_altitude_m = 4;
+    {::_pbi::TcParser::FastF32S1,
+     {37, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.relative_altitude_m_)}},
+    // double latitude_deg = 1;
+    {::_pbi::TcParser::FastF64S1,
+     {9, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.latitude_deg_)}},
+    // double longitude_deg = 2;
+    {::_pbi::TcParser::FastF64S1,
+     {17, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.longitude_deg_)}},
+    // float absolute_altitude_m = 3;
+    {::_pbi::TcParser::FastF32S1,
+     {29, 63, 0, PROTOBUF_FIELD_OFFSET(Position, _impl_.absolute_altitude_m_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // int32 stream_id = 1;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.stream_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.settings_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.status_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
-    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.spectrum_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::VideoStreamSettings>()},
-  }}, {{
+    // double latitude_deg = 1;
+    {PROTOBUF_FIELD_OFFSET(Position, _impl_.latitude_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
+    // double longitude_deg = 2;
+    {PROTOBUF_FIELD_OFFSET(Position, _impl_.longitude_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kDouble)},
+    // float absolute_altitude_m = 3;
+    {PROTOBUF_FIELD_OFFSET(Position, _impl_.absolute_altitude_m_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // float relative_altitude_m = 4;
+    {PROTOBUF_FIELD_OFFSET(Position, _impl_.relative_altitude_m_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+  }},
+  // no aux_entries
+  {{
   }},
 };
 
-::uint8_t* VideoStreamInfo::_InternalSerialize(
+::uint8_t* Position::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.VideoStreamInfo)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Position)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // int32 stream_id = 1;
-  if (this->_internal_stream_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::
-        WriteInt32ToArrayWithField<1>(
-            stream, this->_internal_stream_id(), target);
-  }
-
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        2, _Internal::settings(this),
-        _Internal::settings(this).GetCachedSize(), target, stream);
+  // double latitude_deg = 1;
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_latitude_deg = this->_internal_latitude_deg();
+  ::uint64_t raw_latitude_deg;
+  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
+  if (raw_latitude_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
+        1, this->_internal_latitude_deg(), target);
   }
 
-  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
-  if (this->_internal_status() != 0) {
+  // double longitude_deg = 2;
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_longitude_deg = this->_internal_longitude_deg();
+  ::uint64_t raw_longitude_deg;
+  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
+  if (raw_longitude_deg != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        3, this->_internal_status(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(
+        2, this->_internal_longitude_deg(), target);
   }
 
-  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
-  if (this->_internal_spectrum() != 0) {
+  // float absolute_altitude_m = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_absolute_altitude_m = this->_internal_absolute_altitude_m();
+  ::uint32_t raw_absolute_altitude_m;
+  memcpy(&raw_absolute_altitude_m, &tmp_absolute_altitude_m, sizeof(tmp_absolute_altitude_m));
+  if (raw_absolute_altitude_m != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        4, this->_internal_spectrum(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        3, this->_internal_absolute_altitude_m(), target);
+  }
+
+  // float relative_altitude_m = 4;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_relative_altitude_m = this->_internal_relative_altitude_m();
+  ::uint32_t raw_relative_altitude_m;
+  memcpy(&raw_relative_altitude_m, &tmp_relative_altitude_m, sizeof(tmp_relative_altitude_m));
+  if (raw_relative_altitude_m != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        4, this->_internal_relative_altitude_m(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -11325,186 +11043,196 @@ const ::_pbi::TcParseTable<2, 4, 1, 0, 2> VideoStreamInfo::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.VideoStreamInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Position)
   return target;
 }
 
-::size_t VideoStreamInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.VideoStreamInfo)
+::size_t Position::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Position)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.settings_);
+  // double latitude_deg = 1;
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_latitude_deg = this->_internal_latitude_deg();
+  ::uint64_t raw_latitude_deg;
+  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
+  if (raw_latitude_deg != 0) {
+    total_size += 9;
   }
 
-  // int32 stream_id = 1;
-  if (this->_internal_stream_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-        this->_internal_stream_id());
+  // double longitude_deg = 2;
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_longitude_deg = this->_internal_longitude_deg();
+  ::uint64_t raw_longitude_deg;
+  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
+  if (raw_longitude_deg != 0) {
+    total_size += 9;
   }
 
-  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
-  if (this->_internal_status() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  // float absolute_altitude_m = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_absolute_altitude_m = this->_internal_absolute_altitude_m();
+  ::uint32_t raw_absolute_altitude_m;
+  memcpy(&raw_absolute_altitude_m, &tmp_absolute_altitude_m, sizeof(tmp_absolute_altitude_m));
+  if (raw_absolute_altitude_m != 0) {
+    total_size += 5;
   }
 
-  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
-  if (this->_internal_spectrum() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_spectrum());
+  // float relative_altitude_m = 4;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_relative_altitude_m = this->_internal_relative_altitude_m();
+  ::uint32_t raw_relative_altitude_m;
+  memcpy(&raw_relative_altitude_m, &tmp_relative_altitude_m, sizeof(tmp_relative_altitude_m));
+  if (raw_relative_altitude_m != 0) {
+    total_size += 5;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData VideoStreamInfo::_class_data_ = {
-    VideoStreamInfo::MergeImpl,
+const ::google::protobuf::Message::ClassData Position::_class_data_ = {
+    Position::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* VideoStreamInfo::GetClassData() const {
+const ::google::protobuf::Message::ClassData* Position::GetClassData() const {
   return &_class_data_;
 }
 
-void VideoStreamInfo::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<VideoStreamInfo*>(&to_msg);
-  auto& from = static_cast<const VideoStreamInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.VideoStreamInfo)
+void Position::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Position*>(&to_msg);
+  auto& from = static_cast<const Position&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Position)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_settings()->::mavcam::rpc::camera::VideoStreamSettings::MergeFrom(
-        from._internal_settings());
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_latitude_deg = from._internal_latitude_deg();
+  ::uint64_t raw_latitude_deg;
+  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
+  if (raw_latitude_deg != 0) {
+    _this->_internal_set_latitude_deg(from._internal_latitude_deg());
   }
-  if (from._internal_stream_id() != 0) {
-    _this->_internal_set_stream_id(from._internal_stream_id());
+  static_assert(sizeof(::uint64_t) == sizeof(double),
+                "Code assumes ::uint64_t and double are the same size.");
+  double tmp_longitude_deg = from._internal_longitude_deg();
+  ::uint64_t raw_longitude_deg;
+  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
+  if (raw_longitude_deg != 0) {
+    _this->_internal_set_longitude_deg(from._internal_longitude_deg());
   }
-  if (from._internal_status() != 0) {
-    _this->_internal_set_status(from._internal_status());
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_absolute_altitude_m = from._internal_absolute_altitude_m();
+  ::uint32_t raw_absolute_altitude_m;
+  memcpy(&raw_absolute_altitude_m, &tmp_absolute_altitude_m, sizeof(tmp_absolute_altitude_m));
+  if (raw_absolute_altitude_m != 0) {
+    _this->_internal_set_absolute_altitude_m(from._internal_absolute_altitude_m());
   }
-  if (from._internal_spectrum() != 0) {
-    _this->_internal_set_spectrum(from._internal_spectrum());
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_relative_altitude_m = from._internal_relative_altitude_m();
+  ::uint32_t raw_relative_altitude_m;
+  memcpy(&raw_relative_altitude_m, &tmp_relative_altitude_m, sizeof(tmp_relative_altitude_m));
+  if (raw_relative_altitude_m != 0) {
+    _this->_internal_set_relative_altitude_m(from._internal_relative_altitude_m());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void VideoStreamInfo::CopyFrom(const VideoStreamInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.VideoStreamInfo)
+void Position::CopyFrom(const Position& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Position)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool VideoStreamInfo::IsInitialized() const {
+PROTOBUF_NOINLINE bool Position::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* VideoStreamInfo::AccessCachedSize() const {
+::_pbi::CachedSize* Position::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void VideoStreamInfo::InternalSwap(VideoStreamInfo* PROTOBUF_RESTRICT other) {
+void Position::InternalSwap(Position* PROTOBUF_RESTRICT other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.spectrum_)
-      + sizeof(VideoStreamInfo::_impl_.spectrum_)
-      - PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.settings_)>(
-          reinterpret_cast<char*>(&_impl_.settings_),
-          reinterpret_cast<char*>(&other->_impl_.settings_));
+      PROTOBUF_FIELD_OFFSET(Position, _impl_.relative_altitude_m_)
+      + sizeof(Position::_impl_.relative_altitude_m_)
+      - PROTOBUF_FIELD_OFFSET(Position, _impl_.latitude_deg_)>(
+          reinterpret_cast<char*>(&_impl_.latitude_deg_),
+          reinterpret_cast<char*>(&other->_impl_.latitude_deg_));
 }
 
-::google::protobuf::Metadata VideoStreamInfo::GetMetadata() const {
+::google::protobuf::Metadata Position::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[52]);
+      file_level_metadata_camera_2fcamera_2eproto[53]);
 }
 // ===================================================================
 
-class Status::_Internal {
+class Quaternion::_Internal {
  public:
 };
 
-Status::Status(::google::protobuf::Arena* arena)
+Quaternion::Quaternion(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Status)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Quaternion)
 }
-inline PROTOBUF_NDEBUG_INLINE Status::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from)
-      : media_folder_name_(arena, from.media_folder_name_),
-        _cached_size_{0} {}
-
-Status::Status(
-    ::google::protobuf::Arena* arena,
-    const Status& from)
-    : ::google::protobuf::Message(arena) {
-  Status* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, video_on_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, video_on_),
-           offsetof(Impl_, storage_type_) -
-               offsetof(Impl_, video_on_) +
-               sizeof(Impl_::storage_type_));
-
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.Status)
+Quaternion::Quaternion(
+    ::google::protobuf::Arena* arena, const Quaternion& from)
+    : Quaternion(arena) {
+  MergeFrom(from);
 }
-inline PROTOBUF_NDEBUG_INLINE Status::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE Quaternion::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : media_folder_name_(arena),
-        _cached_size_{0} {}
+      : _cached_size_{0} {}
 
-inline void Status::SharedCtor(::_pb::Arena* arena) {
+inline void Quaternion::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
   ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, video_on_),
+               offsetof(Impl_, w_),
            0,
-           offsetof(Impl_, storage_type_) -
-               offsetof(Impl_, video_on_) +
-               sizeof(Impl_::storage_type_));
+           offsetof(Impl_, z_) -
+               offsetof(Impl_, w_) +
+               sizeof(Impl_::z_));
 }
-Status::~Status() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Status)
+Quaternion::~Quaternion() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Quaternion)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void Status::SharedDtor() {
+inline void Quaternion::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.media_folder_name_.Destroy();
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void Status::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Status)
+PROTOBUF_NOINLINE void Quaternion::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Quaternion)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.media_folder_name_.ClearToEmpty();
-  ::memset(&_impl_.video_on_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.storage_type_) -
-      reinterpret_cast<char*>(&_impl_.video_on_)) + sizeof(_impl_.storage_type_));
+  ::memset(&_impl_.w_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.z_) -
+      reinterpret_cast<char*>(&_impl_.w_)) + sizeof(_impl_.z_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* Status::_InternalParse(
+const char* Quaternion::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -11512,194 +11240,106 @@ const char* Status::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 10, 0, 58, 2> Status::_table_ = {
+const ::_pbi::TcParseTable<2, 4, 0, 0, 2> Quaternion::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    10, 120,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294966272,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    10,  // num_field_entries
+    4,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_Status_default_instance_._instance,
+    &_Quaternion_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // bool video_on = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Status, _impl_.video_on_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.video_on_)}},
-    // bool photo_interval_on = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Status, _impl_.photo_interval_on_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.photo_interval_on_)}},
-    // float used_storage_mib = 3;
+    // float z = 4;
     {::_pbi::TcParser::FastF32S1,
-     {29, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.used_storage_mib_)}},
-    // float available_storage_mib = 4;
+     {37, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.z_)}},
+    // float w = 1;
     {::_pbi::TcParser::FastF32S1,
-     {37, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.available_storage_mib_)}},
-    // float total_storage_mib = 5;
+     {13, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.w_)}},
+    // float x = 2;
     {::_pbi::TcParser::FastF32S1,
-     {45, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.total_storage_mib_)}},
-    // float recording_time_s = 6;
+     {21, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.x_)}},
+    // float y = 3;
     {::_pbi::TcParser::FastF32S1,
-     {53, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.recording_time_s_)}},
-    // string media_folder_name = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.media_folder_name_)}},
-    // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.storage_status_), 63>(),
-     {64, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_status_)}},
-    // uint32 storage_id = 9;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.storage_id_), 63>(),
-     {72, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_id_)}},
-    // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.storage_type_), 63>(),
-     {80, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_type_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
+     {29, 63, 0, PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.y_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // bool video_on = 1;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.video_on_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // bool photo_interval_on = 2;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.photo_interval_on_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // float used_storage_mib = 3;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.used_storage_mib_), 0, 0,
+    // float w = 1;
+    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.w_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float available_storage_mib = 4;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.available_storage_mib_), 0, 0,
+    // float x = 2;
+    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.x_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float total_storage_mib = 5;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.total_storage_mib_), 0, 0,
+    // float y = 3;
+    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.y_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // float recording_time_s = 6;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.recording_time_s_), 0, 0,
+    // float z = 4;
+    {PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.z_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
-    // string media_folder_name = 7;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.media_folder_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_status_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // uint32 storage_id = 9;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-    // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
-    {PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
   }},
   // no aux_entries
   {{
-    "\30\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0"
-    "mavcam.rpc.camera.Status"
-    "media_folder_name"
   }},
 };
 
-::uint8_t* Status::_InternalSerialize(
+::uint8_t* Quaternion::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Status)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Quaternion)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // bool video_on = 1;
-  if (this->_internal_video_on() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        1, this->_internal_video_on(), target);
-  }
-
-  // bool photo_interval_on = 2;
-  if (this->_internal_photo_interval_on() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        2, this->_internal_photo_interval_on(), target);
-  }
-
-  // float used_storage_mib = 3;
+  // float w = 1;
   static_assert(sizeof(::uint32_t) == sizeof(float),
                 "Code assumes ::uint32_t and float are the same size.");
-  float tmp_used_storage_mib = this->_internal_used_storage_mib();
-  ::uint32_t raw_used_storage_mib;
-  memcpy(&raw_used_storage_mib, &tmp_used_storage_mib, sizeof(tmp_used_storage_mib));
-  if (raw_used_storage_mib != 0) {
+  float tmp_w = this->_internal_w();
+  ::uint32_t raw_w;
+  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
+  if (raw_w != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        3, this->_internal_used_storage_mib(), target);
+        1, this->_internal_w(), target);
   }
 
-  // float available_storage_mib = 4;
+  // float x = 2;
   static_assert(sizeof(::uint32_t) == sizeof(float),
                 "Code assumes ::uint32_t and float are the same size.");
-  float tmp_available_storage_mib = this->_internal_available_storage_mib();
-  ::uint32_t raw_available_storage_mib;
-  memcpy(&raw_available_storage_mib, &tmp_available_storage_mib, sizeof(tmp_available_storage_mib));
-  if (raw_available_storage_mib != 0) {
+  float tmp_x = this->_internal_x();
+  ::uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        4, this->_internal_available_storage_mib(), target);
+        2, this->_internal_x(), target);
   }
 
-  // float total_storage_mib = 5;
+  // float y = 3;
   static_assert(sizeof(::uint32_t) == sizeof(float),
                 "Code assumes ::uint32_t and float are the same size.");
-  float tmp_total_storage_mib = this->_internal_total_storage_mib();
-  ::uint32_t raw_total_storage_mib;
-  memcpy(&raw_total_storage_mib, &tmp_total_storage_mib, sizeof(tmp_total_storage_mib));
-  if (raw_total_storage_mib != 0) {
+  float tmp_y = this->_internal_y();
+  ::uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        5, this->_internal_total_storage_mib(), target);
+        3, this->_internal_y(), target);
   }
 
-  // float recording_time_s = 6;
+  // float z = 4;
   static_assert(sizeof(::uint32_t) == sizeof(float),
                 "Code assumes ::uint32_t and float are the same size.");
-  float tmp_recording_time_s = this->_internal_recording_time_s();
-  ::uint32_t raw_recording_time_s;
-  memcpy(&raw_recording_time_s, &tmp_recording_time_s, sizeof(tmp_recording_time_s));
-  if (raw_recording_time_s != 0) {
+  float tmp_z = this->_internal_z();
+  ::uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteFloatToArray(
-        6, this->_internal_recording_time_s(), target);
-  }
-
-  // string media_folder_name = 7;
-  if (!this->_internal_media_folder_name().empty()) {
-    const std::string& _s = this->_internal_media_folder_name();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Status.media_folder_name");
-    target = stream->WriteStringMaybeAliased(7, _s, target);
-  }
-
-  // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
-  if (this->_internal_storage_status() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        8, this->_internal_storage_status(), target);
-  }
-
-  // uint32 storage_id = 9;
-  if (this->_internal_storage_id() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-        9, this->_internal_storage_id(), target);
-  }
-
-  // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
-  if (this->_internal_storage_type() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-        10, this->_internal_storage_type(), target);
+        4, this->_internal_z(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -11707,262 +11347,2550 @@ const ::_pbi::TcParseTable<4, 10, 0, 58, 2> Status::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Status)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Quaternion)
   return target;
 }
 
-::size_t Status::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Status)
+::size_t Quaternion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Quaternion)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string media_folder_name = 7;
-  if (!this->_internal_media_folder_name().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_media_folder_name());
+  // float w = 1;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_w = this->_internal_w();
+  ::uint32_t raw_w;
+  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
+  if (raw_w != 0) {
+    total_size += 5;
   }
 
-  // bool video_on = 1;
-  if (this->_internal_video_on() != 0) {
-    total_size += 2;
+  // float x = 2;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  ::uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    total_size += 5;
   }
 
-  // bool photo_interval_on = 2;
-  if (this->_internal_photo_interval_on() != 0) {
-    total_size += 2;
+  // float y = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  ::uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    total_size += 5;
   }
 
-  // float used_storage_mib = 3;
+  // float z = 4;
   static_assert(sizeof(::uint32_t) == sizeof(float),
                 "Code assumes ::uint32_t and float are the same size.");
-  float tmp_used_storage_mib = this->_internal_used_storage_mib();
-  ::uint32_t raw_used_storage_mib;
-  memcpy(&raw_used_storage_mib, &tmp_used_storage_mib, sizeof(tmp_used_storage_mib));
-  if (raw_used_storage_mib != 0) {
+  float tmp_z = this->_internal_z();
+  ::uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
     total_size += 5;
   }
 
-  // float available_storage_mib = 4;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Quaternion::_class_data_ = {
+    Quaternion::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Quaternion::GetClassData() const {
+  return &_class_data_;
+}
+
+void Quaternion::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Quaternion*>(&to_msg);
+  auto& from = static_cast<const Quaternion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Quaternion)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   static_assert(sizeof(::uint32_t) == sizeof(float),
                 "Code assumes ::uint32_t and float are the same size.");
-  float tmp_available_storage_mib = this->_internal_available_storage_mib();
-  ::uint32_t raw_available_storage_mib;
-  memcpy(&raw_available_storage_mib, &tmp_available_storage_mib, sizeof(tmp_available_storage_mib));
-  if (raw_available_storage_mib != 0) {
-    total_size += 5;
+  float tmp_w = from._internal_w();
+  ::uint32_t raw_w;
+  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
+  if (raw_w != 0) {
+    _this->_internal_set_w(from._internal_w());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  ::uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  ::uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  ::uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Quaternion::CopyFrom(const Quaternion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Quaternion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Quaternion::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* Quaternion::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Quaternion::InternalSwap(Quaternion* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.z_)
+      + sizeof(Quaternion::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(Quaternion, _impl_.w_)>(
+          reinterpret_cast<char*>(&_impl_.w_),
+          reinterpret_cast<char*>(&other->_impl_.w_));
+}
+
+::google::protobuf::Metadata Quaternion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[54]);
+}
+// ===================================================================
+
+class EulerAngle::_Internal {
+ public:
+};
+
+EulerAngle::EulerAngle(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.EulerAngle)
+}
+EulerAngle::EulerAngle(
+    ::google::protobuf::Arena* arena, const EulerAngle& from)
+    : EulerAngle(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE EulerAngle::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void EulerAngle::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, roll_deg_),
+           0,
+           offsetof(Impl_, yaw_deg_) -
+               offsetof(Impl_, roll_deg_) +
+               sizeof(Impl_::yaw_deg_));
+}
+EulerAngle::~EulerAngle() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.EulerAngle)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void EulerAngle::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void EulerAngle::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.EulerAngle)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.roll_deg_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.yaw_deg_) -
+      reinterpret_cast<char*>(&_impl_.roll_deg_)) + sizeof(_impl_.yaw_deg_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* EulerAngle::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2> EulerAngle::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_EulerAngle_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // float roll_deg = 1;
+    {::_pbi::TcParser::FastF32S1,
+     {13, 63, 0, PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.roll_deg_)}},
+    // float pitch_deg = 2;
+    {::_pbi::TcParser::FastF32S1,
+     {21, 63, 0, PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.pitch_deg_)}},
+    // float yaw_deg = 3;
+    {::_pbi::TcParser::FastF32S1,
+     {29, 63, 0, PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.yaw_deg_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // float roll_deg = 1;
+    {PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.roll_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // float pitch_deg = 2;
+    {PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.pitch_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // float yaw_deg = 3;
+    {PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.yaw_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+::uint8_t* EulerAngle::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.EulerAngle)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // float roll_deg = 1;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_roll_deg = this->_internal_roll_deg();
+  ::uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        1, this->_internal_roll_deg(), target);
+  }
+
+  // float pitch_deg = 2;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  ::uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        2, this->_internal_pitch_deg(), target);
+  }
+
+  // float yaw_deg = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  ::uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        3, this->_internal_yaw_deg(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.EulerAngle)
+  return target;
+}
+
+::size_t EulerAngle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.EulerAngle)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float roll_deg = 1;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_roll_deg = this->_internal_roll_deg();
+  ::uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    total_size += 5;
+  }
+
+  // float pitch_deg = 2;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  ::uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    total_size += 5;
+  }
+
+  // float yaw_deg = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  ::uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    total_size += 5;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData EulerAngle::_class_data_ = {
+    EulerAngle::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* EulerAngle::GetClassData() const {
+  return &_class_data_;
+}
+
+void EulerAngle::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<EulerAngle*>(&to_msg);
+  auto& from = static_cast<const EulerAngle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.EulerAngle)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_roll_deg = from._internal_roll_deg();
+  ::uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    _this->_internal_set_roll_deg(from._internal_roll_deg());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_pitch_deg = from._internal_pitch_deg();
+  ::uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_yaw_deg = from._internal_yaw_deg();
+  ::uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EulerAngle::CopyFrom(const EulerAngle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.EulerAngle)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool EulerAngle::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* EulerAngle::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void EulerAngle::InternalSwap(EulerAngle* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.yaw_deg_)
+      + sizeof(EulerAngle::_impl_.yaw_deg_)
+      - PROTOBUF_FIELD_OFFSET(EulerAngle, _impl_.roll_deg_)>(
+          reinterpret_cast<char*>(&_impl_.roll_deg_),
+          reinterpret_cast<char*>(&other->_impl_.roll_deg_));
+}
+
+::google::protobuf::Metadata EulerAngle::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[55]);
+}
+// ===================================================================
+
+class CaptureInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CaptureInfo>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::Position& position(const CaptureInfo* msg);
+  static void set_has_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::mavcam::rpc::camera::Quaternion& attitude_quaternion(const CaptureInfo* msg);
+  static void set_has_attitude_quaternion(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::mavcam::rpc::camera::EulerAngle& attitude_euler_angle(const CaptureInfo* msg);
+  static void set_has_attitude_euler_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::mavcam::rpc::camera::Position& CaptureInfo::_Internal::position(const CaptureInfo* msg) {
+  return *msg->_impl_.position_;
+}
+const ::mavcam::rpc::camera::Quaternion& CaptureInfo::_Internal::attitude_quaternion(const CaptureInfo* msg) {
+  return *msg->_impl_.attitude_quaternion_;
+}
+const ::mavcam::rpc::camera::EulerAngle& CaptureInfo::_Internal::attitude_euler_angle(const CaptureInfo* msg) {
+  return *msg->_impl_.attitude_euler_angle_;
+}
+CaptureInfo::CaptureInfo(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CaptureInfo)
+}
+inline PROTOBUF_NDEBUG_INLINE CaptureInfo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        file_url_(arena, from.file_url_) {}
+
+CaptureInfo::CaptureInfo(
+    ::google::protobuf::Arena* arena,
+    const CaptureInfo& from)
+    : ::google::protobuf::Message(arena) {
+  CaptureInfo* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.position_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Position>(arena, *from._impl_.position_)
+                : nullptr;
+  _impl_.attitude_quaternion_ = (cached_has_bits & 0x00000002u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Quaternion>(arena, *from._impl_.attitude_quaternion_)
+                : nullptr;
+  _impl_.attitude_euler_angle_ = (cached_has_bits & 0x00000004u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::EulerAngle>(arena, *from._impl_.attitude_euler_angle_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, time_utc_us_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, time_utc_us_),
+           offsetof(Impl_, index_) -
+               offsetof(Impl_, time_utc_us_) +
+               sizeof(Impl_::index_));
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CaptureInfo)
+}
+inline PROTOBUF_NDEBUG_INLINE CaptureInfo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        file_url_(arena) {}
+
+inline void CaptureInfo::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, position_),
+           0,
+           offsetof(Impl_, index_) -
+               offsetof(Impl_, position_) +
+               sizeof(Impl_::index_));
+}
+CaptureInfo::~CaptureInfo() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CaptureInfo)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void CaptureInfo::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.file_url_.Destroy();
+  delete _impl_.position_;
+  delete _impl_.attitude_quaternion_;
+  delete _impl_.attitude_euler_angle_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void CaptureInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CaptureInfo)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_url_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      ABSL_DCHECK(_impl_.position_ != nullptr);
+      _impl_.position_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      ABSL_DCHECK(_impl_.attitude_quaternion_ != nullptr);
+      _impl_.attitude_quaternion_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      ABSL_DCHECK(_impl_.attitude_euler_angle_ != nullptr);
+      _impl_.attitude_euler_angle_->Clear();
+    }
+  }
+  ::memset(&_impl_.time_utc_us_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.index_) -
+      reinterpret_cast<char*>(&_impl_.time_utc_us_)) + sizeof(_impl_.index_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* CaptureInfo::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 3, 46, 2> CaptureInfo::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_._has_bits_),
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    3,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_CaptureInfo_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .mavcam.rpc.camera.Position position = 1;
+    {::_pbi::TcParser::FastMtS1,
+     {10, 0, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.position_)}},
+    // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 1, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_quaternion_)}},
+    // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 2, 2, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_euler_angle_)}},
+    // uint64 time_utc_us = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CaptureInfo, _impl_.time_utc_us_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.time_utc_us_)}},
+    // bool is_success = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(CaptureInfo, _impl_.is_success_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.is_success_)}},
+    // int32 index = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CaptureInfo, _impl_.index_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.index_)}},
+    // string file_url = 7;
+    {::_pbi::TcParser::FastUS1,
+     {58, 63, 0, PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.file_url_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .mavcam.rpc.camera.Position position = 1;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.position_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_quaternion_), _Internal::kHasBitsOffset + 1, 1,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.attitude_euler_angle_), _Internal::kHasBitsOffset + 2, 2,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // uint64 time_utc_us = 4;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.time_utc_us_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // bool is_success = 5;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.is_success_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 index = 6;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.index_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string file_url = 7;
+    {PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.file_url_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Position>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Quaternion>()},
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::EulerAngle>()},
+  }}, {{
+    "\35\0\0\0\0\0\0\10"
+    "mavcam.rpc.camera.CaptureInfo"
+    "file_url"
+  }},
+};
+
+::uint8_t* CaptureInfo::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CaptureInfo)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.Position position = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::attitude_quaternion(this),
+        _Internal::attitude_quaternion(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::attitude_euler_angle(this),
+        _Internal::attitude_euler_angle(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 time_utc_us = 4;
+  if (this->_internal_time_utc_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        4, this->_internal_time_utc_us(), target);
+  }
+
+  // bool is_success = 5;
+  if (this->_internal_is_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        5, this->_internal_is_success(), target);
+  }
+
+  // int32 index = 6;
+  if (this->_internal_index() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<6>(
+            stream, this->_internal_index(), target);
+  }
+
+  // string file_url = 7;
+  if (!this->_internal_file_url().empty()) {
+    const std::string& _s = this->_internal_file_url();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.CaptureInfo.file_url");
+    target = stream->WriteStringMaybeAliased(7, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CaptureInfo)
+  return target;
+}
+
+::size_t CaptureInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CaptureInfo)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_url = 7;
+  if (!this->_internal_file_url().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_file_url());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // .mavcam.rpc.camera.Position position = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.position_);
+    }
+
+    // .mavcam.rpc.camera.Quaternion attitude_quaternion = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.attitude_quaternion_);
+    }
+
+    // .mavcam.rpc.camera.EulerAngle attitude_euler_angle = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size +=
+          1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.attitude_euler_angle_);
+    }
+
+  }
+  // uint64 time_utc_us = 4;
+  if (this->_internal_time_utc_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_time_utc_us());
+  }
+
+  // bool is_success = 5;
+  if (this->_internal_is_success() != 0) {
+    total_size += 2;
+  }
+
+  // int32 index = 6;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData CaptureInfo::_class_data_ = {
+    CaptureInfo::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* CaptureInfo::GetClassData() const {
+  return &_class_data_;
+}
+
+void CaptureInfo::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<CaptureInfo*>(&to_msg);
+  auto& from = static_cast<const CaptureInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CaptureInfo)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_url().empty()) {
+    _this->_internal_set_file_url(from._internal_file_url());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_position()->::mavcam::rpc::camera::Position::MergeFrom(
+          from._internal_position());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_attitude_quaternion()->::mavcam::rpc::camera::Quaternion::MergeFrom(
+          from._internal_attitude_quaternion());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_attitude_euler_angle()->::mavcam::rpc::camera::EulerAngle::MergeFrom(
+          from._internal_attitude_euler_angle());
+    }
+  }
+  if (from._internal_time_utc_us() != 0) {
+    _this->_internal_set_time_utc_us(from._internal_time_utc_us());
+  }
+  if (from._internal_is_success() != 0) {
+    _this->_internal_set_is_success(from._internal_is_success());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CaptureInfo::CopyFrom(const CaptureInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CaptureInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool CaptureInfo::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* CaptureInfo::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void CaptureInfo::InternalSwap(CaptureInfo* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.file_url_, &other->_impl_.file_url_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.index_)
+      + sizeof(CaptureInfo::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(CaptureInfo, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
+}
+
+::google::protobuf::Metadata CaptureInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[56]);
+}
+// ===================================================================
+
+class VideoStreamSettings::_Internal {
+ public:
+};
+
+VideoStreamSettings::VideoStreamSettings(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.VideoStreamSettings)
+}
+inline PROTOBUF_NDEBUG_INLINE VideoStreamSettings::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : uri_(arena, from.uri_),
+        _cached_size_{0} {}
+
+VideoStreamSettings::VideoStreamSettings(
+    ::google::protobuf::Arena* arena,
+    const VideoStreamSettings& from)
+    : ::google::protobuf::Message(arena) {
+  VideoStreamSettings* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, frame_rate_hz_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, frame_rate_hz_),
+           offsetof(Impl_, horizontal_fov_deg_) -
+               offsetof(Impl_, frame_rate_hz_) +
+               sizeof(Impl_::horizontal_fov_deg_));
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.VideoStreamSettings)
+}
+inline PROTOBUF_NDEBUG_INLINE VideoStreamSettings::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uri_(arena),
+        _cached_size_{0} {}
+
+inline void VideoStreamSettings::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, frame_rate_hz_),
+           0,
+           offsetof(Impl_, horizontal_fov_deg_) -
+               offsetof(Impl_, frame_rate_hz_) +
+               sizeof(Impl_::horizontal_fov_deg_));
+}
+VideoStreamSettings::~VideoStreamSettings() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.VideoStreamSettings)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void VideoStreamSettings::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.uri_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void VideoStreamSettings::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.VideoStreamSettings)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uri_.ClearToEmpty();
+  ::memset(&_impl_.frame_rate_hz_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.horizontal_fov_deg_) -
+      reinterpret_cast<char*>(&_impl_.frame_rate_hz_)) + sizeof(_impl_.horizontal_fov_deg_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* VideoStreamSettings::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 49, 2> VideoStreamSettings::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_VideoStreamSettings_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // float frame_rate_hz = 1;
+    {::_pbi::TcParser::FastF32S1,
+     {13, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.frame_rate_hz_)}},
+    // uint32 horizontal_resolution_pix = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.horizontal_resolution_pix_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_resolution_pix_)}},
+    // uint32 vertical_resolution_pix = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.vertical_resolution_pix_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.vertical_resolution_pix_)}},
+    // uint32 bit_rate_b_s = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.bit_rate_b_s_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.bit_rate_b_s_)}},
+    // uint32 rotation_deg = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamSettings, _impl_.rotation_deg_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.rotation_deg_)}},
+    // string uri = 6;
+    {::_pbi::TcParser::FastUS1,
+     {50, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.uri_)}},
+    // float horizontal_fov_deg = 7;
+    {::_pbi::TcParser::FastF32S1,
+     {61, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_fov_deg_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // float frame_rate_hz = 1;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.frame_rate_hz_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // uint32 horizontal_resolution_pix = 2;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_resolution_pix_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
+    // uint32 vertical_resolution_pix = 3;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.vertical_resolution_pix_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
+    // uint32 bit_rate_b_s = 4;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.bit_rate_b_s_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
+    // uint32 rotation_deg = 5;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.rotation_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
+    // string uri = 6;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.uri_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // float horizontal_fov_deg = 7;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_fov_deg_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+  }},
+  // no aux_entries
+  {{
+    "\45\0\0\0\0\0\3\0"
+    "mavcam.rpc.camera.VideoStreamSettings"
+    "uri"
+  }},
+};
+
+::uint8_t* VideoStreamSettings::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.VideoStreamSettings)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // float frame_rate_hz = 1;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_frame_rate_hz = this->_internal_frame_rate_hz();
+  ::uint32_t raw_frame_rate_hz;
+  memcpy(&raw_frame_rate_hz, &tmp_frame_rate_hz, sizeof(tmp_frame_rate_hz));
+  if (raw_frame_rate_hz != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        1, this->_internal_frame_rate_hz(), target);
+  }
+
+  // uint32 horizontal_resolution_pix = 2;
+  if (this->_internal_horizontal_resolution_pix() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        2, this->_internal_horizontal_resolution_pix(), target);
+  }
+
+  // uint32 vertical_resolution_pix = 3;
+  if (this->_internal_vertical_resolution_pix() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        3, this->_internal_vertical_resolution_pix(), target);
+  }
+
+  // uint32 bit_rate_b_s = 4;
+  if (this->_internal_bit_rate_b_s() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        4, this->_internal_bit_rate_b_s(), target);
+  }
+
+  // uint32 rotation_deg = 5;
+  if (this->_internal_rotation_deg() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        5, this->_internal_rotation_deg(), target);
+  }
+
+  // string uri = 6;
+  if (!this->_internal_uri().empty()) {
+    const std::string& _s = this->_internal_uri();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.VideoStreamSettings.uri");
+    target = stream->WriteStringMaybeAliased(6, _s, target);
+  }
+
+  // float horizontal_fov_deg = 7;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_horizontal_fov_deg = this->_internal_horizontal_fov_deg();
+  ::uint32_t raw_horizontal_fov_deg;
+  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
+  if (raw_horizontal_fov_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        7, this->_internal_horizontal_fov_deg(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.VideoStreamSettings)
+  return target;
+}
+
+::size_t VideoStreamSettings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.VideoStreamSettings)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string uri = 6;
+  if (!this->_internal_uri().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_uri());
+  }
+
+  // float frame_rate_hz = 1;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_frame_rate_hz = this->_internal_frame_rate_hz();
+  ::uint32_t raw_frame_rate_hz;
+  memcpy(&raw_frame_rate_hz, &tmp_frame_rate_hz, sizeof(tmp_frame_rate_hz));
+  if (raw_frame_rate_hz != 0) {
+    total_size += 5;
+  }
+
+  // uint32 horizontal_resolution_pix = 2;
+  if (this->_internal_horizontal_resolution_pix() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+        this->_internal_horizontal_resolution_pix());
+  }
+
+  // uint32 vertical_resolution_pix = 3;
+  if (this->_internal_vertical_resolution_pix() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+        this->_internal_vertical_resolution_pix());
+  }
+
+  // uint32 bit_rate_b_s = 4;
+  if (this->_internal_bit_rate_b_s() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+        this->_internal_bit_rate_b_s());
+  }
+
+  // uint32 rotation_deg = 5;
+  if (this->_internal_rotation_deg() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+        this->_internal_rotation_deg());
+  }
+
+  // float horizontal_fov_deg = 7;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_horizontal_fov_deg = this->_internal_horizontal_fov_deg();
+  ::uint32_t raw_horizontal_fov_deg;
+  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
+  if (raw_horizontal_fov_deg != 0) {
+    total_size += 5;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData VideoStreamSettings::_class_data_ = {
+    VideoStreamSettings::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* VideoStreamSettings::GetClassData() const {
+  return &_class_data_;
+}
+
+void VideoStreamSettings::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<VideoStreamSettings*>(&to_msg);
+  auto& from = static_cast<const VideoStreamSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.VideoStreamSettings)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uri().empty()) {
+    _this->_internal_set_uri(from._internal_uri());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_frame_rate_hz = from._internal_frame_rate_hz();
+  ::uint32_t raw_frame_rate_hz;
+  memcpy(&raw_frame_rate_hz, &tmp_frame_rate_hz, sizeof(tmp_frame_rate_hz));
+  if (raw_frame_rate_hz != 0) {
+    _this->_internal_set_frame_rate_hz(from._internal_frame_rate_hz());
+  }
+  if (from._internal_horizontal_resolution_pix() != 0) {
+    _this->_internal_set_horizontal_resolution_pix(from._internal_horizontal_resolution_pix());
+  }
+  if (from._internal_vertical_resolution_pix() != 0) {
+    _this->_internal_set_vertical_resolution_pix(from._internal_vertical_resolution_pix());
+  }
+  if (from._internal_bit_rate_b_s() != 0) {
+    _this->_internal_set_bit_rate_b_s(from._internal_bit_rate_b_s());
+  }
+  if (from._internal_rotation_deg() != 0) {
+    _this->_internal_set_rotation_deg(from._internal_rotation_deg());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_horizontal_fov_deg = from._internal_horizontal_fov_deg();
+  ::uint32_t raw_horizontal_fov_deg;
+  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
+  if (raw_horizontal_fov_deg != 0) {
+    _this->_internal_set_horizontal_fov_deg(from._internal_horizontal_fov_deg());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VideoStreamSettings::CopyFrom(const VideoStreamSettings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.VideoStreamSettings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool VideoStreamSettings::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* VideoStreamSettings::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void VideoStreamSettings::InternalSwap(VideoStreamSettings* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uri_, &other->_impl_.uri_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.horizontal_fov_deg_)
+      + sizeof(VideoStreamSettings::_impl_.horizontal_fov_deg_)
+      - PROTOBUF_FIELD_OFFSET(VideoStreamSettings, _impl_.frame_rate_hz_)>(
+          reinterpret_cast<char*>(&_impl_.frame_rate_hz_),
+          reinterpret_cast<char*>(&other->_impl_.frame_rate_hz_));
+}
+
+::google::protobuf::Metadata VideoStreamSettings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[57]);
+}
+// ===================================================================
+
+class VideoStreamInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<VideoStreamInfo>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::VideoStreamSettings& settings(const VideoStreamInfo* msg);
+  static void set_has_settings(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::mavcam::rpc::camera::VideoStreamSettings& VideoStreamInfo::_Internal::settings(const VideoStreamInfo* msg) {
+  return *msg->_impl_.settings_;
+}
+VideoStreamInfo::VideoStreamInfo(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.VideoStreamInfo)
+}
+inline PROTOBUF_NDEBUG_INLINE VideoStreamInfo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+VideoStreamInfo::VideoStreamInfo(
+    ::google::protobuf::Arena* arena,
+    const VideoStreamInfo& from)
+    : ::google::protobuf::Message(arena) {
+  VideoStreamInfo* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.settings_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::VideoStreamSettings>(arena, *from._impl_.settings_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, stream_id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, stream_id_),
+           offsetof(Impl_, spectrum_) -
+               offsetof(Impl_, stream_id_) +
+               sizeof(Impl_::spectrum_));
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.VideoStreamInfo)
+}
+inline PROTOBUF_NDEBUG_INLINE VideoStreamInfo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void VideoStreamInfo::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, settings_),
+           0,
+           offsetof(Impl_, spectrum_) -
+               offsetof(Impl_, settings_) +
+               sizeof(Impl_::spectrum_));
+}
+VideoStreamInfo::~VideoStreamInfo() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.VideoStreamInfo)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void VideoStreamInfo::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  delete _impl_.settings_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void VideoStreamInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.VideoStreamInfo)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.settings_ != nullptr);
+    _impl_.settings_->Clear();
+  }
+  ::memset(&_impl_.stream_id_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.spectrum_) -
+      reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.spectrum_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* VideoStreamInfo::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 1, 0, 2> VideoStreamInfo::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_VideoStreamInfo_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamInfo, _impl_.spectrum_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.spectrum_)}},
+    // int32 stream_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamInfo, _impl_.stream_id_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.stream_id_)}},
+    // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.settings_)}},
+    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VideoStreamInfo, _impl_.status_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.status_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 stream_id = 1;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.stream_id_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.settings_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.status_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
+    {PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.spectrum_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::VideoStreamSettings>()},
+  }}, {{
+  }},
+};
+
+::uint8_t* VideoStreamInfo::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.VideoStreamInfo)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // int32 stream_id = 1;
+  if (this->_internal_stream_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::
+        WriteInt32ToArrayWithField<1>(
+            stream, this->_internal_stream_id(), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        2, _Internal::settings(this),
+        _Internal::settings(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        3, this->_internal_status(), target);
+  }
+
+  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
+  if (this->_internal_spectrum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        4, this->_internal_spectrum(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.VideoStreamInfo)
+  return target;
+}
+
+::size_t VideoStreamInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.VideoStreamInfo)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.settings_);
+  }
+
+  // int32 stream_id = 1;
+  if (this->_internal_stream_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_stream_id());
+  }
+
+  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamSpectrum spectrum = 4;
+  if (this->_internal_spectrum() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_spectrum());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData VideoStreamInfo::_class_data_ = {
+    VideoStreamInfo::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* VideoStreamInfo::GetClassData() const {
+  return &_class_data_;
+}
+
+void VideoStreamInfo::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<VideoStreamInfo*>(&to_msg);
+  auto& from = static_cast<const VideoStreamInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.VideoStreamInfo)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_settings()->::mavcam::rpc::camera::VideoStreamSettings::MergeFrom(
+        from._internal_settings());
+  }
+  if (from._internal_stream_id() != 0) {
+    _this->_internal_set_stream_id(from._internal_stream_id());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_spectrum() != 0) {
+    _this->_internal_set_spectrum(from._internal_spectrum());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VideoStreamInfo::CopyFrom(const VideoStreamInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.VideoStreamInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool VideoStreamInfo::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* VideoStreamInfo::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void VideoStreamInfo::InternalSwap(VideoStreamInfo* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.spectrum_)
+      + sizeof(VideoStreamInfo::_impl_.spectrum_)
+      - PROTOBUF_FIELD_OFFSET(VideoStreamInfo, _impl_.settings_)>(
+          reinterpret_cast<char*>(&_impl_.settings_),
+          reinterpret_cast<char*>(&other->_impl_.settings_));
+}
+
+::google::protobuf::Metadata VideoStreamInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[58]);
+}
+// ===================================================================
+
+class Status::_Internal {
+ public:
+};
+
+Status::Status(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Status)
+}
+inline PROTOBUF_NDEBUG_INLINE Status::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : media_folder_name_(arena, from.media_folder_name_),
+        _cached_size_{0} {}
+
+Status::Status(
+    ::google::protobuf::Arena* arena,
+    const Status& from)
+    : ::google::protobuf::Message(arena) {
+  Status* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, video_on_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, video_on_),
+           offsetof(Impl_, storage_type_) -
+               offsetof(Impl_, video_on_) +
+               sizeof(Impl_::storage_type_));
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.Status)
+}
+inline PROTOBUF_NDEBUG_INLINE Status::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : media_folder_name_(arena),
+        _cached_size_{0} {}
+
+inline void Status::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, video_on_),
+           0,
+           offsetof(Impl_, storage_type_) -
+               offsetof(Impl_, video_on_) +
+               sizeof(Impl_::storage_type_));
+}
+Status::~Status() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Status)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Status::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.media_folder_name_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Status::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Status)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.media_folder_name_.ClearToEmpty();
+  ::memset(&_impl_.video_on_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.storage_type_) -
+      reinterpret_cast<char*>(&_impl_.video_on_)) + sizeof(_impl_.storage_type_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Status::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<4, 10, 0, 58, 2> Status::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    10, 120,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294966272,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    10,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_Status_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // bool video_on = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Status, _impl_.video_on_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.video_on_)}},
+    // bool photo_interval_on = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Status, _impl_.photo_interval_on_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.photo_interval_on_)}},
+    // float used_storage_mib = 3;
+    {::_pbi::TcParser::FastF32S1,
+     {29, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.used_storage_mib_)}},
+    // float available_storage_mib = 4;
+    {::_pbi::TcParser::FastF32S1,
+     {37, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.available_storage_mib_)}},
+    // float total_storage_mib = 5;
+    {::_pbi::TcParser::FastF32S1,
+     {45, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.total_storage_mib_)}},
+    // float recording_time_s = 6;
+    {::_pbi::TcParser::FastF32S1,
+     {53, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.recording_time_s_)}},
+    // string media_folder_name = 7;
+    {::_pbi::TcParser::FastUS1,
+     {58, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.media_folder_name_)}},
+    // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.storage_status_), 63>(),
+     {64, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_status_)}},
+    // uint32 storage_id = 9;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.storage_id_), 63>(),
+     {72, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_id_)}},
+    // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.storage_type_), 63>(),
+     {80, 63, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_type_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool video_on = 1;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.video_on_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // bool photo_interval_on = 2;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.photo_interval_on_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // float used_storage_mib = 3;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.used_storage_mib_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // float available_storage_mib = 4;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.available_storage_mib_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // float total_storage_mib = 5;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.total_storage_mib_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // float recording_time_s = 6;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.recording_time_s_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kFloat)},
+    // string media_folder_name = 7;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.media_folder_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_status_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // uint32 storage_id = 9;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
+    // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_type_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+    "\30\0\0\0\0\0\0\21\0\0\0\0\0\0\0\0"
+    "mavcam.rpc.camera.Status"
+    "media_folder_name"
+  }},
+};
+
+::uint8_t* Status::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Status)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // bool video_on = 1;
+  if (this->_internal_video_on() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        1, this->_internal_video_on(), target);
+  }
+
+  // bool photo_interval_on = 2;
+  if (this->_internal_photo_interval_on() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        2, this->_internal_photo_interval_on(), target);
+  }
+
+  // float used_storage_mib = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_used_storage_mib = this->_internal_used_storage_mib();
+  ::uint32_t raw_used_storage_mib;
+  memcpy(&raw_used_storage_mib, &tmp_used_storage_mib, sizeof(tmp_used_storage_mib));
+  if (raw_used_storage_mib != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        3, this->_internal_used_storage_mib(), target);
+  }
+
+  // float available_storage_mib = 4;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_available_storage_mib = this->_internal_available_storage_mib();
+  ::uint32_t raw_available_storage_mib;
+  memcpy(&raw_available_storage_mib, &tmp_available_storage_mib, sizeof(tmp_available_storage_mib));
+  if (raw_available_storage_mib != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        4, this->_internal_available_storage_mib(), target);
+  }
+
+  // float total_storage_mib = 5;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_total_storage_mib = this->_internal_total_storage_mib();
+  ::uint32_t raw_total_storage_mib;
+  memcpy(&raw_total_storage_mib, &tmp_total_storage_mib, sizeof(tmp_total_storage_mib));
+  if (raw_total_storage_mib != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        5, this->_internal_total_storage_mib(), target);
+  }
+
+  // float recording_time_s = 6;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_recording_time_s = this->_internal_recording_time_s();
+  ::uint32_t raw_recording_time_s;
+  memcpy(&raw_recording_time_s, &tmp_recording_time_s, sizeof(tmp_recording_time_s));
+  if (raw_recording_time_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        6, this->_internal_recording_time_s(), target);
+  }
+
+  // string media_folder_name = 7;
+  if (!this->_internal_media_folder_name().empty()) {
+    const std::string& _s = this->_internal_media_folder_name();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Status.media_folder_name");
+    target = stream->WriteStringMaybeAliased(7, _s, target);
+  }
+
+  // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
+  if (this->_internal_storage_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        8, this->_internal_storage_status(), target);
+  }
+
+  // uint32 storage_id = 9;
+  if (this->_internal_storage_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+        9, this->_internal_storage_id(), target);
+  }
+
+  // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
+  if (this->_internal_storage_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        10, this->_internal_storage_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Status)
+  return target;
+}
+
+::size_t Status::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Status)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string media_folder_name = 7;
+  if (!this->_internal_media_folder_name().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_media_folder_name());
+  }
+
+  // bool video_on = 1;
+  if (this->_internal_video_on() != 0) {
+    total_size += 2;
+  }
+
+  // bool photo_interval_on = 2;
+  if (this->_internal_photo_interval_on() != 0) {
+    total_size += 2;
+  }
+
+  // float used_storage_mib = 3;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_used_storage_mib = this->_internal_used_storage_mib();
+  ::uint32_t raw_used_storage_mib;
+  memcpy(&raw_used_storage_mib, &tmp_used_storage_mib, sizeof(tmp_used_storage_mib));
+  if (raw_used_storage_mib != 0) {
+    total_size += 5;
+  }
+
+  // float available_storage_mib = 4;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_available_storage_mib = this->_internal_available_storage_mib();
+  ::uint32_t raw_available_storage_mib;
+  memcpy(&raw_available_storage_mib, &tmp_available_storage_mib, sizeof(tmp_available_storage_mib));
+  if (raw_available_storage_mib != 0) {
+    total_size += 5;
+  }
+
+  // float total_storage_mib = 5;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_total_storage_mib = this->_internal_total_storage_mib();
+  ::uint32_t raw_total_storage_mib;
+  memcpy(&raw_total_storage_mib, &tmp_total_storage_mib, sizeof(tmp_total_storage_mib));
+  if (raw_total_storage_mib != 0) {
+    total_size += 5;
+  }
+
+  // float recording_time_s = 6;
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_recording_time_s = this->_internal_recording_time_s();
+  ::uint32_t raw_recording_time_s;
+  memcpy(&raw_recording_time_s, &tmp_recording_time_s, sizeof(tmp_recording_time_s));
+  if (raw_recording_time_s != 0) {
+    total_size += 5;
+  }
+
+  // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
+  if (this->_internal_storage_status() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_storage_status());
+  }
+
+  // uint32 storage_id = 9;
+  if (this->_internal_storage_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+        this->_internal_storage_id());
+  }
+
+  // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
+  if (this->_internal_storage_type() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_storage_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Status::_class_data_ = {
+    Status::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Status::GetClassData() const {
+  return &_class_data_;
+}
+
+void Status::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Status*>(&to_msg);
+  auto& from = static_cast<const Status&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Status)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_media_folder_name().empty()) {
+    _this->_internal_set_media_folder_name(from._internal_media_folder_name());
+  }
+  if (from._internal_video_on() != 0) {
+    _this->_internal_set_video_on(from._internal_video_on());
+  }
+  if (from._internal_photo_interval_on() != 0) {
+    _this->_internal_set_photo_interval_on(from._internal_photo_interval_on());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_used_storage_mib = from._internal_used_storage_mib();
+  ::uint32_t raw_used_storage_mib;
+  memcpy(&raw_used_storage_mib, &tmp_used_storage_mib, sizeof(tmp_used_storage_mib));
+  if (raw_used_storage_mib != 0) {
+    _this->_internal_set_used_storage_mib(from._internal_used_storage_mib());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_available_storage_mib = from._internal_available_storage_mib();
+  ::uint32_t raw_available_storage_mib;
+  memcpy(&raw_available_storage_mib, &tmp_available_storage_mib, sizeof(tmp_available_storage_mib));
+  if (raw_available_storage_mib != 0) {
+    _this->_internal_set_available_storage_mib(from._internal_available_storage_mib());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_total_storage_mib = from._internal_total_storage_mib();
+  ::uint32_t raw_total_storage_mib;
+  memcpy(&raw_total_storage_mib, &tmp_total_storage_mib, sizeof(tmp_total_storage_mib));
+  if (raw_total_storage_mib != 0) {
+    _this->_internal_set_total_storage_mib(from._internal_total_storage_mib());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float),
+                "Code assumes ::uint32_t and float are the same size.");
+  float tmp_recording_time_s = from._internal_recording_time_s();
+  ::uint32_t raw_recording_time_s;
+  memcpy(&raw_recording_time_s, &tmp_recording_time_s, sizeof(tmp_recording_time_s));
+  if (raw_recording_time_s != 0) {
+    _this->_internal_set_recording_time_s(from._internal_recording_time_s());
+  }
+  if (from._internal_storage_status() != 0) {
+    _this->_internal_set_storage_status(from._internal_storage_status());
+  }
+  if (from._internal_storage_id() != 0) {
+    _this->_internal_set_storage_id(from._internal_storage_id());
+  }
+  if (from._internal_storage_type() != 0) {
+    _this->_internal_set_storage_type(from._internal_storage_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Status::CopyFrom(const Status& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Status)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Status::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* Status::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Status::InternalSwap(Status* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.media_folder_name_, &other->_impl_.media_folder_name_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_type_)
+      + sizeof(Status::_impl_.storage_type_)
+      - PROTOBUF_FIELD_OFFSET(Status, _impl_.video_on_)>(
+          reinterpret_cast<char*>(&_impl_.video_on_),
+          reinterpret_cast<char*>(&other->_impl_.video_on_));
+}
+
+::google::protobuf::Metadata Status::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[59]);
+}
+// ===================================================================
+
+class Option::_Internal {
+ public:
+};
+
+Option::Option(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Option)
+}
+inline PROTOBUF_NDEBUG_INLINE Option::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : option_id_(arena, from.option_id_),
+        option_description_(arena, from.option_description_),
+        _cached_size_{0} {}
+
+Option::Option(
+    ::google::protobuf::Arena* arena,
+    const Option& from)
+    : ::google::protobuf::Message(arena) {
+  Option* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.Option)
+}
+inline PROTOBUF_NDEBUG_INLINE Option::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : option_id_(arena),
+        option_description_(arena),
+        _cached_size_{0} {}
+
+inline void Option::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+Option::~Option() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Option)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Option::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.option_id_.Destroy();
+  _impl_.option_description_.Destroy();
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Option::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Option)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.option_id_.ClearToEmpty();
+  _impl_.option_description_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Option::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 60, 2> Option::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_Option_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // string option_description = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Option, _impl_.option_description_)}},
+    // string option_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Option, _impl_.option_id_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string option_id = 1;
+    {PROTOBUF_FIELD_OFFSET(Option, _impl_.option_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string option_description = 2;
+    {PROTOBUF_FIELD_OFFSET(Option, _impl_.option_description_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\30\11\22\0\0\0\0\0"
+    "mavcam.rpc.camera.Option"
+    "option_id"
+    "option_description"
+  }},
+};
+
+::uint8_t* Option::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Option)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string option_id = 1;
+  if (!this->_internal_option_id().empty()) {
+    const std::string& _s = this->_internal_option_id();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Option.option_id");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // string option_description = 2;
+  if (!this->_internal_option_description().empty()) {
+    const std::string& _s = this->_internal_option_description();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Option.option_description");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Option)
+  return target;
+}
+
+::size_t Option::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Option)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string option_id = 1;
+  if (!this->_internal_option_id().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_option_id());
+  }
+
+  // string option_description = 2;
+  if (!this->_internal_option_description().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_option_description());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::google::protobuf::Message::ClassData Option::_class_data_ = {
+    Option::MergeImpl,
+    nullptr,  // OnDemandRegisterArenaDtor
+};
+const ::google::protobuf::Message::ClassData* Option::GetClassData() const {
+  return &_class_data_;
+}
+
+void Option::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Option*>(&to_msg);
+  auto& from = static_cast<const Option&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Option)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_option_id().empty()) {
+    _this->_internal_set_option_id(from._internal_option_id());
+  }
+  if (!from._internal_option_description().empty()) {
+    _this->_internal_set_option_description(from._internal_option_description());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Option::CopyFrom(const Option& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Option)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+PROTOBUF_NOINLINE bool Option::IsInitialized() const {
+  return true;
+}
+
+::_pbi::CachedSize* Option::AccessCachedSize() const {
+  return &_impl_._cached_size_;
+}
+void Option::InternalSwap(Option* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.option_id_, &other->_impl_.option_id_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.option_description_, &other->_impl_.option_description_, arena);
+}
+
+::google::protobuf::Metadata Option::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
+      file_level_metadata_camera_2fcamera_2eproto[60]);
+}
+// ===================================================================
+
+class Setting::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Setting>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+    8 * PROTOBUF_FIELD_OFFSET(Setting, _impl_._has_bits_);
+  static const ::mavcam::rpc::camera::Option& option(const Setting* msg);
+  static void set_has_option(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::mavcam::rpc::camera::Option& Setting::_Internal::option(const Setting* msg) {
+  return *msg->_impl_.option_;
+}
+Setting::Setting(::google::protobuf::Arena* arena)
+    : ::google::protobuf::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Setting)
+}
+inline PROTOBUF_NDEBUG_INLINE Setting::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        setting_id_(arena, from.setting_id_),
+        setting_description_(arena, from.setting_description_) {}
+
+Setting::Setting(
+    ::google::protobuf::Arena* arena,
+    const Setting& from)
+    : ::google::protobuf::Message(arena) {
+  Setting* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.option_ = (cached_has_bits & 0x00000001u)
+                ? CreateMaybeMessage<::mavcam::rpc::camera::Option>(arena, *from._impl_.option_)
+                : nullptr;
+  _impl_.is_range_ = from._impl_.is_range_;
+
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.Setting)
+}
+inline PROTOBUF_NDEBUG_INLINE Setting::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0},
+        setting_id_(arena),
+        setting_description_(arena) {}
+
+inline void Setting::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, option_),
+           0,
+           offsetof(Impl_, is_range_) -
+               offsetof(Impl_, option_) +
+               sizeof(Impl_::is_range_));
+}
+Setting::~Setting() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Setting)
+  _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  SharedDtor();
+}
+inline void Setting::SharedDtor() {
+  ABSL_DCHECK(GetArena() == nullptr);
+  _impl_.setting_id_.Destroy();
+  _impl_.setting_description_.Destroy();
+  delete _impl_.option_;
+  _impl_.~Impl_();
+}
+
+PROTOBUF_NOINLINE void Setting::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Setting)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.setting_id_.ClearToEmpty();
+  _impl_.setting_description_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    ABSL_DCHECK(_impl_.option_ != nullptr);
+    _impl_.option_->Clear();
+  }
+  _impl_.is_range_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+const char* Setting::_InternalParse(
+    const char* ptr, ::_pbi::ParseContext* ctx) {
+  ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
+  return ptr;
+}
+
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 1, 63, 2> Setting::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(Setting, _impl_._has_bits_),
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_Setting_default_instance_._instance,
+    ::_pbi::TcParser::GenericFallback,  // fallback
+  }, {{
+    // bool is_range = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Setting, _impl_.is_range_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.is_range_)}},
+    // string setting_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_id_)}},
+    // string setting_description = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_description_)}},
+    // .mavcam.rpc.camera.Option option = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 0, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.option_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string setting_id = 1;
+    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_id_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string setting_description = 2;
+    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_description_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // .mavcam.rpc.camera.Option option = 3;
+    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.option_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool is_range = 4;
+    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.is_range_), -1, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Option>()},
+  }}, {{
+    "\31\12\23\0\0\0\0\0"
+    "mavcam.rpc.camera.Setting"
+    "setting_id"
+    "setting_description"
+  }},
+};
+
+::uint8_t* Setting::_InternalSerialize(
+    ::uint8_t* target,
+    ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Setting)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // string setting_id = 1;
+  if (!this->_internal_setting_id().empty()) {
+    const std::string& _s = this->_internal_setting_id();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Setting.setting_id");
+    target = stream->WriteStringMaybeAliased(1, _s, target);
+  }
+
+  // string setting_description = 2;
+  if (!this->_internal_setting_description().empty()) {
+    const std::string& _s = this->_internal_setting_description();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Setting.setting_description");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // .mavcam.rpc.camera.Option option = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, _Internal::option(this),
+        _Internal::option(this).GetCachedSize(), target, stream);
+  }
+
+  // bool is_range = 4;
+  if (this->_internal_is_range() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        4, this->_internal_is_range(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Setting)
+  return target;
+}
 
-  // float total_storage_mib = 5;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_total_storage_mib = this->_internal_total_storage_mib();
-  ::uint32_t raw_total_storage_mib;
-  memcpy(&raw_total_storage_mib, &tmp_total_storage_mib, sizeof(tmp_total_storage_mib));
-  if (raw_total_storage_mib != 0) {
-    total_size += 5;
-  }
+::size_t Setting::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Setting)
+  ::size_t total_size = 0;
 
-  // float recording_time_s = 6;
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_recording_time_s = this->_internal_recording_time_s();
-  ::uint32_t raw_recording_time_s;
-  memcpy(&raw_recording_time_s, &tmp_recording_time_s, sizeof(tmp_recording_time_s));
-  if (raw_recording_time_s != 0) {
-    total_size += 5;
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string setting_id = 1;
+  if (!this->_internal_setting_id().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_setting_id());
   }
 
-  // .mavcam.rpc.camera.Status.StorageStatus storage_status = 8;
-  if (this->_internal_storage_status() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_storage_status());
+  // string setting_description = 2;
+  if (!this->_internal_setting_description().empty()) {
+    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                    this->_internal_setting_description());
   }
 
-  // uint32 storage_id = 9;
-  if (this->_internal_storage_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-        this->_internal_storage_id());
+  // .mavcam.rpc.camera.Option option = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size +=
+        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.option_);
   }
 
-  // .mavcam.rpc.camera.Status.StorageType storage_type = 10;
-  if (this->_internal_storage_type() != 0) {
-    total_size += 1 +
-                  ::_pbi::WireFormatLite::EnumSize(this->_internal_storage_type());
+  // bool is_range = 4;
+  if (this->_internal_is_range() != 0) {
+    total_size += 2;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData Status::_class_data_ = {
-    Status::MergeImpl,
+const ::google::protobuf::Message::ClassData Setting::_class_data_ = {
+    Setting::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* Status::GetClassData() const {
+const ::google::protobuf::Message::ClassData* Setting::GetClassData() const {
   return &_class_data_;
 }
 
-void Status::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<Status*>(&to_msg);
-  auto& from = static_cast<const Status&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Status)
+void Setting::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<Setting*>(&to_msg);
+  auto& from = static_cast<const Setting&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Setting)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_media_folder_name().empty()) {
-    _this->_internal_set_media_folder_name(from._internal_media_folder_name());
-  }
-  if (from._internal_video_on() != 0) {
-    _this->_internal_set_video_on(from._internal_video_on());
-  }
-  if (from._internal_photo_interval_on() != 0) {
-    _this->_internal_set_photo_interval_on(from._internal_photo_interval_on());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_used_storage_mib = from._internal_used_storage_mib();
-  ::uint32_t raw_used_storage_mib;
-  memcpy(&raw_used_storage_mib, &tmp_used_storage_mib, sizeof(tmp_used_storage_mib));
-  if (raw_used_storage_mib != 0) {
-    _this->_internal_set_used_storage_mib(from._internal_used_storage_mib());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_available_storage_mib = from._internal_available_storage_mib();
-  ::uint32_t raw_available_storage_mib;
-  memcpy(&raw_available_storage_mib, &tmp_available_storage_mib, sizeof(tmp_available_storage_mib));
-  if (raw_available_storage_mib != 0) {
-    _this->_internal_set_available_storage_mib(from._internal_available_storage_mib());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_total_storage_mib = from._internal_total_storage_mib();
-  ::uint32_t raw_total_storage_mib;
-  memcpy(&raw_total_storage_mib, &tmp_total_storage_mib, sizeof(tmp_total_storage_mib));
-  if (raw_total_storage_mib != 0) {
-    _this->_internal_set_total_storage_mib(from._internal_total_storage_mib());
-  }
-  static_assert(sizeof(::uint32_t) == sizeof(float),
-                "Code assumes ::uint32_t and float are the same size.");
-  float tmp_recording_time_s = from._internal_recording_time_s();
-  ::uint32_t raw_recording_time_s;
-  memcpy(&raw_recording_time_s, &tmp_recording_time_s, sizeof(tmp_recording_time_s));
-  if (raw_recording_time_s != 0) {
-    _this->_internal_set_recording_time_s(from._internal_recording_time_s());
+  if (!from._internal_setting_id().empty()) {
+    _this->_internal_set_setting_id(from._internal_setting_id());
   }
-  if (from._internal_storage_status() != 0) {
-    _this->_internal_set_storage_status(from._internal_storage_status());
+  if (!from._internal_setting_description().empty()) {
+    _this->_internal_set_setting_description(from._internal_setting_description());
   }
-  if (from._internal_storage_id() != 0) {
-    _this->_internal_set_storage_id(from._internal_storage_id());
+  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    _this->_internal_mutable_option()->::mavcam::rpc::camera::Option::MergeFrom(
+        from._internal_option());
   }
-  if (from._internal_storage_type() != 0) {
-    _this->_internal_set_storage_type(from._internal_storage_type());
+  if (from._internal_is_range() != 0) {
+    _this->_internal_set_is_range(from._internal_is_range());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Status::CopyFrom(const Status& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Status)
+void Setting::CopyFrom(const Setting& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Setting)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool Status::IsInitialized() const {
+PROTOBUF_NOINLINE bool Setting::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* Status::AccessCachedSize() const {
+::_pbi::CachedSize* Setting::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void Status::InternalSwap(Status* PROTOBUF_RESTRICT other) {
+void Setting::InternalSwap(Setting* PROTOBUF_RESTRICT other) {
   using std::swap;
   auto* arena = GetArena();
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.media_folder_name_, &other->_impl_.media_folder_name_, arena);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_id_, &other->_impl_.setting_id_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_description_, &other->_impl_.setting_description_, arena);
   ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Status, _impl_.storage_type_)
-      + sizeof(Status::_impl_.storage_type_)
-      - PROTOBUF_FIELD_OFFSET(Status, _impl_.video_on_)>(
-          reinterpret_cast<char*>(&_impl_.video_on_),
-          reinterpret_cast<char*>(&other->_impl_.video_on_));
+      PROTOBUF_FIELD_OFFSET(Setting, _impl_.is_range_)
+      + sizeof(Setting::_impl_.is_range_)
+      - PROTOBUF_FIELD_OFFSET(Setting, _impl_.option_)>(
+          reinterpret_cast<char*>(&_impl_.option_),
+          reinterpret_cast<char*>(&other->_impl_.option_));
 }
 
-::google::protobuf::Metadata Status::GetMetadata() const {
+::google::protobuf::Metadata Setting::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[53]);
+      file_level_metadata_camera_2fcamera_2eproto[61]);
 }
 // ===================================================================
 
-class Option::_Internal {
+class SettingOptions::_Internal {
  public:
 };
 
-Option::Option(::google::protobuf::Arena* arena)
+SettingOptions::SettingOptions(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Option)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SettingOptions)
 }
-inline PROTOBUF_NDEBUG_INLINE Option::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SettingOptions::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : option_id_(arena, from.option_id_),
-        option_description_(arena, from.option_description_),
+      : options_{visibility, arena, from.options_},
+        setting_id_(arena, from.setting_id_),
+        setting_description_(arena, from.setting_description_),
         _cached_size_{0} {}
 
-Option::Option(
+SettingOptions::SettingOptions(
     ::google::protobuf::Arena* arena,
-    const Option& from)
+    const SettingOptions& from)
     : ::google::protobuf::Message(arena) {
-  Option* const _this = this;
+  SettingOptions* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
+  _impl_.is_range_ = from._impl_.is_range_;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.Option)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SettingOptions)
 }
-inline PROTOBUF_NDEBUG_INLINE Option::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE SettingOptions::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : option_id_(arena),
-        option_description_(arena),
+      : options_{visibility, arena},
+        setting_id_(arena),
+        setting_description_(arena),
         _cached_size_{0} {}
 
-inline void Option::SharedCtor(::_pb::Arena* arena) {
+inline void SettingOptions::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.is_range_ = {};
 }
-Option::~Option() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Option)
+SettingOptions::~SettingOptions() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SettingOptions)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void Option::SharedDtor() {
+inline void SettingOptions::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.option_id_.Destroy();
-  _impl_.option_description_.Destroy();
+  _impl_.setting_id_.Destroy();
+  _impl_.setting_description_.Destroy();
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void Option::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Option)
+PROTOBUF_NOINLINE void SettingOptions::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SettingOptions)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.option_id_.ClearToEmpty();
-  _impl_.option_description_.ClearToEmpty();
+  _impl_.options_.Clear();
+  _impl_.setting_id_.ClearToEmpty();
+  _impl_.setting_description_.ClearToEmpty();
+  _impl_.is_range_ = false;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* Option::_InternalParse(
+const char* SettingOptions::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -11970,248 +13898,262 @@ const char* Option::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 60, 2> Option::_table_ = {
+const ::_pbi::TcParseTable<2, 4, 1, 70, 2> SettingOptions::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    &_Option_default_instance_._instance,
+    4,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    &_SettingOptions_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // string option_description = 2;
+    // bool is_range = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(SettingOptions, _impl_.is_range_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.is_range_)}},
+    // string setting_id = 1;
     {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Option, _impl_.option_description_)}},
-    // string option_id = 1;
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_id_)}},
+    // string setting_description = 2;
     {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Option, _impl_.option_id_)}},
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_description_)}},
+    // repeated .mavcam.rpc.camera.Option options = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.options_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string option_id = 1;
-    {PROTOBUF_FIELD_OFFSET(Option, _impl_.option_id_), 0, 0,
+    // string setting_id = 1;
+    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_id_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string option_description = 2;
-    {PROTOBUF_FIELD_OFFSET(Option, _impl_.option_description_), 0, 0,
+    // string setting_description = 2;
+    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_description_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\30\11\22\0\0\0\0\0"
-    "mavcam.rpc.camera.Option"
-    "option_id"
-    "option_description"
+    // repeated .mavcam.rpc.camera.Option options = 3;
+    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.options_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool is_range = 4;
+    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.is_range_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Option>()},
+  }}, {{
+    "\40\12\23\0\0\0\0\0"
+    "mavcam.rpc.camera.SettingOptions"
+    "setting_id"
+    "setting_description"
   }},
 };
 
-::uint8_t* Option::_InternalSerialize(
+::uint8_t* SettingOptions::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Option)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SettingOptions)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // string option_id = 1;
-  if (!this->_internal_option_id().empty()) {
-    const std::string& _s = this->_internal_option_id();
+  // string setting_id = 1;
+  if (!this->_internal_setting_id().empty()) {
+    const std::string& _s = this->_internal_setting_id();
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Option.option_id");
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.SettingOptions.setting_id");
     target = stream->WriteStringMaybeAliased(1, _s, target);
   }
 
-  // string option_description = 2;
-  if (!this->_internal_option_description().empty()) {
-    const std::string& _s = this->_internal_option_description();
+  // string setting_description = 2;
+  if (!this->_internal_setting_description().empty()) {
+    const std::string& _s = this->_internal_setting_description();
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Option.option_description");
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.SettingOptions.setting_description");
     target = stream->WriteStringMaybeAliased(2, _s, target);
   }
 
+  // repeated .mavcam.rpc.camera.Option options = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_options_size()); i < n; i++) {
+    const auto& repfield = this->_internal_options().Get(i);
+    target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool is_range = 4;
+  if (this->_internal_is_range() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        4, this->_internal_is_range(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Option)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SettingOptions)
   return target;
 }
 
-::size_t Option::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Option)
+::size_t SettingOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SettingOptions)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string option_id = 1;
-  if (!this->_internal_option_id().empty()) {
+  // repeated .mavcam.rpc.camera.Option options = 3;
+  total_size += 1UL * this->_internal_options_size();
+  for (const auto& msg : this->_internal_options()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+  }
+  // string setting_id = 1;
+  if (!this->_internal_setting_id().empty()) {
     total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_option_id());
+                                    this->_internal_setting_id());
   }
 
-  // string option_description = 2;
-  if (!this->_internal_option_description().empty()) {
+  // string setting_description = 2;
+  if (!this->_internal_setting_description().empty()) {
     total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_option_description());
+                                    this->_internal_setting_description());
+  }
+
+  // bool is_range = 4;
+  if (this->_internal_is_range() != 0) {
+    total_size += 2;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData Option::_class_data_ = {
-    Option::MergeImpl,
+const ::google::protobuf::Message::ClassData SettingOptions::_class_data_ = {
+    SettingOptions::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* Option::GetClassData() const {
+const ::google::protobuf::Message::ClassData* SettingOptions::GetClassData() const {
   return &_class_data_;
 }
 
-void Option::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<Option*>(&to_msg);
-  auto& from = static_cast<const Option&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Option)
+void SettingOptions::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<SettingOptions*>(&to_msg);
+  auto& from = static_cast<const SettingOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SettingOptions)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_option_id().empty()) {
-    _this->_internal_set_option_id(from._internal_option_id());
+  _this->_internal_mutable_options()->MergeFrom(
+      from._internal_options());
+  if (!from._internal_setting_id().empty()) {
+    _this->_internal_set_setting_id(from._internal_setting_id());
   }
-  if (!from._internal_option_description().empty()) {
-    _this->_internal_set_option_description(from._internal_option_description());
+  if (!from._internal_setting_description().empty()) {
+    _this->_internal_set_setting_description(from._internal_setting_description());
+  }
+  if (from._internal_is_range() != 0) {
+    _this->_internal_set_is_range(from._internal_is_range());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Option::CopyFrom(const Option& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Option)
+void SettingOptions::CopyFrom(const SettingOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SettingOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool Option::IsInitialized() const {
+PROTOBUF_NOINLINE bool SettingOptions::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* Option::AccessCachedSize() const {
+::_pbi::CachedSize* SettingOptions::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void Option::InternalSwap(Option* PROTOBUF_RESTRICT other) {
+void SettingOptions::InternalSwap(SettingOptions* PROTOBUF_RESTRICT other) {
   using std::swap;
   auto* arena = GetArena();
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.option_id_, &other->_impl_.option_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.option_description_, &other->_impl_.option_description_, arena);
+  _impl_.options_.InternalSwap(&other->_impl_.options_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_id_, &other->_impl_.setting_id_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_description_, &other->_impl_.setting_description_, arena);
+        swap(_impl_.is_range_, other->_impl_.is_range_);
 }
 
-::google::protobuf::Metadata Option::GetMetadata() const {
+::google::protobuf::Metadata SettingOptions::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[54]);
+      file_level_metadata_camera_2fcamera_2eproto[62]);
 }
 // ===================================================================
 
-class Setting::_Internal {
+class AppliedSetting::_Internal {
  public:
-  using HasBits = decltype(std::declval<Setting>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-    8 * PROTOBUF_FIELD_OFFSET(Setting, _impl_._has_bits_);
-  static const ::mavcam::rpc::camera::Option& option(const Setting* msg);
-  static void set_has_option(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::mavcam::rpc::camera::Option& Setting::_Internal::option(const Setting* msg) {
-  return *msg->_impl_.option_;
-}
-Setting::Setting(::google::protobuf::Arena* arena)
+AppliedSetting::AppliedSetting(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.Setting)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.AppliedSetting)
 }
-inline PROTOBUF_NDEBUG_INLINE Setting::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE AppliedSetting::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        setting_id_(arena, from.setting_id_),
-        setting_description_(arena, from.setting_description_) {}
+      : setting_id_(arena, from.setting_id_),
+        _cached_size_{0} {}
 
-Setting::Setting(
+AppliedSetting::AppliedSetting(
     ::google::protobuf::Arena* arena,
-    const Setting& from)
+    const AppliedSetting& from)
     : ::google::protobuf::Message(arena) {
-  Setting* const _this = this;
+  AppliedSetting* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.option_ = (cached_has_bits & 0x00000001u)
-                ? CreateMaybeMessage<::mavcam::rpc::camera::Option>(arena, *from._impl_.option_)
-                : nullptr;
-  _impl_.is_range_ = from._impl_.is_range_;
+  _impl_.result_ = from._impl_.result_;
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.Setting)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.AppliedSetting)
 }
-inline PROTOBUF_NDEBUG_INLINE Setting::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE AppliedSetting::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        setting_id_(arena),
-        setting_description_(arena) {}
+      : setting_id_(arena),
+        _cached_size_{0} {}
 
-inline void Setting::SharedCtor(::_pb::Arena* arena) {
+inline void AppliedSetting::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, option_),
-           0,
-           offsetof(Impl_, is_range_) -
-               offsetof(Impl_, option_) +
-               sizeof(Impl_::is_range_));
+  _impl_.result_ = {};
 }
-Setting::~Setting() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.Setting)
+AppliedSetting::~AppliedSetting() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.AppliedSetting)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void Setting::SharedDtor() {
+inline void AppliedSetting::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
   _impl_.setting_id_.Destroy();
-  _impl_.setting_description_.Destroy();
-  delete _impl_.option_;
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void Setting::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.Setting)
+PROTOBUF_NOINLINE void AppliedSetting::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.AppliedSetting)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.setting_id_.ClearToEmpty();
-  _impl_.setting_description_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.option_ != nullptr);
-    _impl_.option_->Clear();
-  }
-  _impl_.is_range_ = false;
-  _impl_._has_bits_.Clear();
+  _impl_.result_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* Setting::_InternalParse(
+const char* AppliedSetting::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -12219,93 +14161,64 @@ const char* Setting::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 63, 2> Setting::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 51, 2> AppliedSetting::_table_ = {
   {
-    PROTOBUF_FIELD_OFFSET(Setting, _impl_._has_bits_),
+    0,  // no _has_bits_
     0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_Setting_default_instance_._instance,
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_AppliedSetting_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // bool is_range = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Setting, _impl_.is_range_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.is_range_)}},
-    // string setting_id = 1;
+    // string setting_id = 2;
     {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_id_)}},
-    // string setting_description = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_description_)}},
-    // .mavcam.rpc.camera.Option option = 3;
-    {::_pbi::TcParser::FastMtS1,
-     {26, 0, 0, PROTOBUF_FIELD_OFFSET(Setting, _impl_.option_)}},
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(AppliedSetting, _impl_.setting_id_)}},
+    // .mavcam.rpc.camera.CameraResult.Result result = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AppliedSetting, _impl_.result_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AppliedSetting, _impl_.result_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string setting_id = 1;
-    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string setting_description = 2;
-    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.setting_description_), -1, 0,
+    // .mavcam.rpc.camera.CameraResult.Result result = 1;
+    {PROTOBUF_FIELD_OFFSET(AppliedSetting, _impl_.result_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // string setting_id = 2;
+    {PROTOBUF_FIELD_OFFSET(AppliedSetting, _impl_.setting_id_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .mavcam.rpc.camera.Option option = 3;
-    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.option_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // bool is_range = 4;
-    {PROTOBUF_FIELD_OFFSET(Setting, _impl_.is_range_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Option>()},
-  }}, {{
-    "\31\12\23\0\0\0\0\0"
-    "mavcam.rpc.camera.Setting"
+  }},
+  // no aux_entries
+  {{
+    "\40\0\12\0\0\0\0\0"
+    "mavcam.rpc.camera.AppliedSetting"
     "setting_id"
-    "setting_description"
   }},
 };
 
-::uint8_t* Setting::_InternalSerialize(
+::uint8_t* AppliedSetting::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.Setting)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.AppliedSetting)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // string setting_id = 1;
-  if (!this->_internal_setting_id().empty()) {
-    const std::string& _s = this->_internal_setting_id();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Setting.setting_id");
-    target = stream->WriteStringMaybeAliased(1, _s, target);
-  }
-
-  // string setting_description = 2;
-  if (!this->_internal_setting_description().empty()) {
-    const std::string& _s = this->_internal_setting_description();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.Setting.setting_description");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
-  }
-
-  cached_has_bits = _impl_._has_bits_[0];
-  // .mavcam.rpc.camera.Option option = 3;
-  if (cached_has_bits & 0x00000001u) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        3, _Internal::option(this),
-        _Internal::option(this).GetCachedSize(), target, stream);
+  // .mavcam.rpc.camera.CameraResult.Result result = 1;
+  if (this->_internal_result() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1, this->_internal_result(), target);
   }
 
-  // bool is_range = 4;
-  if (this->_internal_is_range() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        4, this->_internal_is_range(), target);
+  // string setting_id = 2;
+  if (!this->_internal_setting_id().empty()) {
+    const std::string& _s = this->_internal_setting_id();
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.AppliedSetting.setting_id");
+    target = stream->WriteStringMaybeAliased(2, _s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -12313,57 +14226,45 @@ const ::_pbi::TcParseTable<2, 4, 1, 63, 2> Setting::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.Setting)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.AppliedSetting)
   return target;
 }
 
-::size_t Setting::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.Setting)
+::size_t AppliedSetting::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.AppliedSetting)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string setting_id = 1;
+  // string setting_id = 2;
   if (!this->_internal_setting_id().empty()) {
     total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                     this->_internal_setting_id());
   }
 
-  // string setting_description = 2;
-  if (!this->_internal_setting_description().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_setting_description());
-  }
-
-  // .mavcam.rpc.camera.Option option = 3;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size +=
-        1 + ::google::protobuf::internal::WireFormatLite::MessageSize(*_impl_.option_);
-  }
-
-  // bool is_range = 4;
-  if (this->_internal_is_range() != 0) {
-    total_size += 2;
+  // .mavcam.rpc.camera.CameraResult.Result result = 1;
+  if (this->_internal_result() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_result());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData Setting::_class_data_ = {
-    Setting::MergeImpl,
+const ::google::protobuf::Message::ClassData AppliedSetting::_class_data_ = {
+    AppliedSetting::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* Setting::GetClassData() const {
+const ::google::protobuf::Message::ClassData* AppliedSetting::GetClassData() const {
   return &_class_data_;
 }
 
-void Setting::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<Setting*>(&to_msg);
-  auto& from = static_cast<const Setting&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.Setting)
+void AppliedSetting::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<AppliedSetting*>(&to_msg);
+  auto& from = static_cast<const AppliedSetting&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.AppliedSetting)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -12371,125 +14272,117 @@ void Setting::MergeImpl(::google::protobuf::Message& to_msg, const ::google::pro
   if (!from._internal_setting_id().empty()) {
     _this->_internal_set_setting_id(from._internal_setting_id());
   }
-  if (!from._internal_setting_description().empty()) {
-    _this->_internal_set_setting_description(from._internal_setting_description());
-  }
-  if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
-    _this->_internal_mutable_option()->::mavcam::rpc::camera::Option::MergeFrom(
-        from._internal_option());
-  }
-  if (from._internal_is_range() != 0) {
-    _this->_internal_set_is_range(from._internal_is_range());
+  if (from._internal_result() != 0) {
+    _this->_internal_set_result(from._internal_result());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Setting::CopyFrom(const Setting& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.Setting)
+void AppliedSetting::CopyFrom(const AppliedSetting& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.AppliedSetting)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool Setting::IsInitialized() const {
+PROTOBUF_NOINLINE bool AppliedSetting::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* Setting::AccessCachedSize() const {
+::_pbi::CachedSize* AppliedSetting::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void Setting::InternalSwap(Setting* PROTOBUF_RESTRICT other) {
+void AppliedSetting::InternalSwap(AppliedSetting* PROTOBUF_RESTRICT other) {
   using std::swap;
   auto* arena = GetArena();
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_id_, &other->_impl_.setting_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_description_, &other->_impl_.setting_description_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Setting, _impl_.is_range_)
-      + sizeof(Setting::_impl_.is_range_)
-      - PROTOBUF_FIELD_OFFSET(Setting, _impl_.option_)>(
-          reinterpret_cast<char*>(&_impl_.option_),
-          reinterpret_cast<char*>(&other->_impl_.option_));
+  swap(_impl_.result_, other->_impl_.result_);
 }
 
-::google::protobuf::Metadata Setting::GetMetadata() const {
+::google::protobuf::Metadata AppliedSetting::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[55]);
+      file_level_metadata_camera_2fcamera_2eproto[63]);
 }
 // ===================================================================
 
-class SettingOptions::_Internal {
+class CallMetric::_Internal {
  public:
 };
 
-SettingOptions::SettingOptions(::google::protobuf::Arena* arena)
+CallMetric::CallMetric(::google::protobuf::Arena* arena)
     : ::google::protobuf::Message(arena) {
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.SettingOptions)
+  // @@protoc_insertion_point(arena_constructor:mavcam.rpc.camera.CallMetric)
 }
-inline PROTOBUF_NDEBUG_INLINE SettingOptions::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CallMetric::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from)
-      : options_{visibility, arena, from.options_},
-        setting_id_(arena, from.setting_id_),
-        setting_description_(arena, from.setting_description_),
+      : name_(arena, from.name_),
         _cached_size_{0} {}
 
-SettingOptions::SettingOptions(
+CallMetric::CallMetric(
     ::google::protobuf::Arena* arena,
-    const SettingOptions& from)
+    const CallMetric& from)
     : ::google::protobuf::Message(arena) {
-  SettingOptions* const _this = this;
+  CallMetric* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_);
-  _impl_.is_range_ = from._impl_.is_range_;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, count_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, count_),
+           offsetof(Impl_, p99_latency_us_) -
+               offsetof(Impl_, count_) +
+               sizeof(Impl_::p99_latency_us_));
 
-  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.SettingOptions)
+  // @@protoc_insertion_point(copy_constructor:mavcam.rpc.camera.CallMetric)
 }
-inline PROTOBUF_NDEBUG_INLINE SettingOptions::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE CallMetric::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : options_{visibility, arena},
-        setting_id_(arena),
-        setting_description_(arena),
+      : name_(arena),
         _cached_size_{0} {}
 
-inline void SettingOptions::SharedCtor(::_pb::Arena* arena) {
+inline void CallMetric::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.is_range_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, count_),
+           0,
+           offsetof(Impl_, p99_latency_us_) -
+               offsetof(Impl_, count_) +
+               sizeof(Impl_::p99_latency_us_));
 }
-SettingOptions::~SettingOptions() {
-  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.SettingOptions)
+CallMetric::~CallMetric() {
+  // @@protoc_insertion_point(destructor:mavcam.rpc.camera.CallMetric)
   _internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   SharedDtor();
 }
-inline void SettingOptions::SharedDtor() {
+inline void CallMetric::SharedDtor() {
   ABSL_DCHECK(GetArena() == nullptr);
-  _impl_.setting_id_.Destroy();
-  _impl_.setting_description_.Destroy();
+  _impl_.name_.Destroy();
   _impl_.~Impl_();
 }
 
-PROTOBUF_NOINLINE void SettingOptions::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.SettingOptions)
+PROTOBUF_NOINLINE void CallMetric::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavcam.rpc.camera.CallMetric)
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.options_.Clear();
-  _impl_.setting_id_.ClearToEmpty();
-  _impl_.setting_description_.ClearToEmpty();
-  _impl_.is_range_ = false;
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.p99_latency_us_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.p99_latency_us_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
-const char* SettingOptions::_InternalParse(
+const char* CallMetric::_InternalParse(
     const char* ptr, ::_pbi::ParseContext* ctx) {
   ptr = ::_pbi::TcParser::ParseLoop(this, ptr, ctx, &_table_.header);
   return ptr;
@@ -12497,93 +14390,142 @@ const char* SettingOptions::_InternalParse(
 
 
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 70, 2> SettingOptions::_table_ = {
+const ::_pbi::TcParseTable<3, 8, 0, 49, 2> CallMetric::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
+    8, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
+    4294967040,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    &_SettingOptions_default_instance_._instance,
+    8,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    &_CallMetric_default_instance_._instance,
     ::_pbi::TcParser::GenericFallback,  // fallback
   }, {{
-    // bool is_range = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(SettingOptions, _impl_.is_range_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.is_range_)}},
-    // string setting_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_id_)}},
-    // string setting_description = 2;
+    // uint64 p99_latency_us = 8;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.p99_latency_us_), 63>(),
+     {64, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p99_latency_us_)}},
+    // string name = 1;
     {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_description_)}},
-    // repeated .mavcam.rpc.camera.Option options = 3;
-    {::_pbi::TcParser::FastMtR1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.options_)}},
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.name_)}},
+    // uint64 count = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.count_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.count_)}},
+    // uint64 error_count = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.error_count_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.error_count_)}},
+    // uint64 total_latency_us = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.total_latency_us_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.total_latency_us_)}},
+    // uint64 max_latency_us = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.max_latency_us_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.max_latency_us_)}},
+    // uint64 p50_latency_us = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.p50_latency_us_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p50_latency_us_)}},
+    // uint64 p90_latency_us = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CallMetric, _impl_.p90_latency_us_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p90_latency_us_)}},
   }}, {{
     65535, 65535
   }}, {{
-    // string setting_id = 1;
-    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string setting_description = 2;
-    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.setting_description_), 0, 0,
+    // string name = 1;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.name_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated .mavcam.rpc.camera.Option options = 3;
-    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.options_), 0, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // bool is_range = 4;
-    {PROTOBUF_FIELD_OFFSET(SettingOptions, _impl_.is_range_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::mavcam::rpc::camera::Option>()},
-  }}, {{
-    "\40\12\23\0\0\0\0\0"
-    "mavcam.rpc.camera.SettingOptions"
-    "setting_id"
-    "setting_description"
+    // uint64 count = 2;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.count_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // uint64 error_count = 3;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.error_count_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // uint64 total_latency_us = 4;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.total_latency_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // uint64 max_latency_us = 5;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.max_latency_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // uint64 p50_latency_us = 6;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p50_latency_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // uint64 p90_latency_us = 7;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p90_latency_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+    // uint64 p99_latency_us = 8;
+    {PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p99_latency_us_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\34\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "mavcam.rpc.camera.CallMetric"
+    "name"
   }},
 };
 
-::uint8_t* SettingOptions::_InternalSerialize(
+::uint8_t* CallMetric::_InternalSerialize(
     ::uint8_t* target,
     ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.SettingOptions)
+  // @@protoc_insertion_point(serialize_to_array_start:mavcam.rpc.camera.CallMetric)
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // string setting_id = 1;
-  if (!this->_internal_setting_id().empty()) {
-    const std::string& _s = this->_internal_setting_id();
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    const std::string& _s = this->_internal_name();
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.SettingOptions.setting_id");
+        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.CallMetric.name");
     target = stream->WriteStringMaybeAliased(1, _s, target);
   }
 
-  // string setting_description = 2;
-  if (!this->_internal_setting_description().empty()) {
-    const std::string& _s = this->_internal_setting_description();
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-        _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "mavcam.rpc.camera.SettingOptions.setting_description");
-    target = stream->WriteStringMaybeAliased(2, _s, target);
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        2, this->_internal_count(), target);
   }
 
-  // repeated .mavcam.rpc.camera.Option options = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_options_size()); i < n; i++) {
-    const auto& repfield = this->_internal_options().Get(i);
-    target = ::google::protobuf::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // uint64 error_count = 3;
+  if (this->_internal_error_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        3, this->_internal_error_count(), target);
   }
 
-  // bool is_range = 4;
-  if (this->_internal_is_range() != 0) {
+  // uint64 total_latency_us = 4;
+  if (this->_internal_total_latency_us() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(
-        4, this->_internal_is_range(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        4, this->_internal_total_latency_us(), target);
+  }
+
+  // uint64 max_latency_us = 5;
+  if (this->_internal_max_latency_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        5, this->_internal_max_latency_us(), target);
+  }
+
+  // uint64 p50_latency_us = 6;
+  if (this->_internal_p50_latency_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        6, this->_internal_p50_latency_us(), target);
+  }
+
+  // uint64 p90_latency_us = 7;
+  if (this->_internal_p90_latency_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        7, this->_internal_p90_latency_us(), target);
+  }
+
+  // uint64 p99_latency_us = 8;
+  if (this->_internal_p99_latency_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+        8, this->_internal_p99_latency_us(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -12591,103 +14533,144 @@ const ::_pbi::TcParseTable<2, 4, 1, 70, 2> SettingOptions::_table_ = {
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
             _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.SettingOptions)
+  // @@protoc_insertion_point(serialize_to_array_end:mavcam.rpc.camera.CallMetric)
   return target;
 }
 
-::size_t SettingOptions::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.SettingOptions)
+::size_t CallMetric::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavcam.rpc.camera.CallMetric)
   ::size_t total_size = 0;
 
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .mavcam.rpc.camera.Option options = 3;
-  total_size += 1UL * this->_internal_options_size();
-  for (const auto& msg : this->_internal_options()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-  }
-  // string setting_id = 1;
-  if (!this->_internal_setting_id().empty()) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_setting_id());
+                                    this->_internal_name());
   }
 
-  // string setting_description = 2;
-  if (!this->_internal_setting_description().empty()) {
-    total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                    this->_internal_setting_description());
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_count());
   }
 
-  // bool is_range = 4;
-  if (this->_internal_is_range() != 0) {
-    total_size += 2;
+  // uint64 error_count = 3;
+  if (this->_internal_error_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_error_count());
+  }
+
+  // uint64 total_latency_us = 4;
+  if (this->_internal_total_latency_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_total_latency_us());
+  }
+
+  // uint64 max_latency_us = 5;
+  if (this->_internal_max_latency_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_max_latency_us());
+  }
+
+  // uint64 p50_latency_us = 6;
+  if (this->_internal_p50_latency_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_p50_latency_us());
+  }
+
+  // uint64 p90_latency_us = 7;
+  if (this->_internal_p90_latency_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_p90_latency_us());
+  }
+
+  // uint64 p99_latency_us = 8;
+  if (this->_internal_p99_latency_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+        this->_internal_p99_latency_us());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::google::protobuf::Message::ClassData SettingOptions::_class_data_ = {
-    SettingOptions::MergeImpl,
+const ::google::protobuf::Message::ClassData CallMetric::_class_data_ = {
+    CallMetric::MergeImpl,
     nullptr,  // OnDemandRegisterArenaDtor
 };
-const ::google::protobuf::Message::ClassData* SettingOptions::GetClassData() const {
+const ::google::protobuf::Message::ClassData* CallMetric::GetClassData() const {
   return &_class_data_;
 }
 
-void SettingOptions::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
-  auto* const _this = static_cast<SettingOptions*>(&to_msg);
-  auto& from = static_cast<const SettingOptions&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.SettingOptions)
+void CallMetric::MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg) {
+  auto* const _this = static_cast<CallMetric*>(&to_msg);
+  auto& from = static_cast<const CallMetric&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavcam.rpc.camera.CallMetric)
   ABSL_DCHECK_NE(&from, _this);
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_internal_mutable_options()->MergeFrom(
-      from._internal_options());
-  if (!from._internal_setting_id().empty()) {
-    _this->_internal_set_setting_id(from._internal_setting_id());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (!from._internal_setting_description().empty()) {
-    _this->_internal_set_setting_description(from._internal_setting_description());
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
   }
-  if (from._internal_is_range() != 0) {
-    _this->_internal_set_is_range(from._internal_is_range());
+  if (from._internal_error_count() != 0) {
+    _this->_internal_set_error_count(from._internal_error_count());
+  }
+  if (from._internal_total_latency_us() != 0) {
+    _this->_internal_set_total_latency_us(from._internal_total_latency_us());
+  }
+  if (from._internal_max_latency_us() != 0) {
+    _this->_internal_set_max_latency_us(from._internal_max_latency_us());
+  }
+  if (from._internal_p50_latency_us() != 0) {
+    _this->_internal_set_p50_latency_us(from._internal_p50_latency_us());
+  }
+  if (from._internal_p90_latency_us() != 0) {
+    _this->_internal_set_p90_latency_us(from._internal_p90_latency_us());
+  }
+  if (from._internal_p99_latency_us() != 0) {
+    _this->_internal_set_p99_latency_us(from._internal_p99_latency_us());
   }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SettingOptions::CopyFrom(const SettingOptions& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.SettingOptions)
+void CallMetric::CopyFrom(const CallMetric& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavcam.rpc.camera.CallMetric)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-PROTOBUF_NOINLINE bool SettingOptions::IsInitialized() const {
+PROTOBUF_NOINLINE bool CallMetric::IsInitialized() const {
   return true;
 }
 
-::_pbi::CachedSize* SettingOptions::AccessCachedSize() const {
+::_pbi::CachedSize* CallMetric::AccessCachedSize() const {
   return &_impl_._cached_size_;
 }
-void SettingOptions::InternalSwap(SettingOptions* PROTOBUF_RESTRICT other) {
+void CallMetric::InternalSwap(CallMetric* PROTOBUF_RESTRICT other) {
   using std::swap;
   auto* arena = GetArena();
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.options_.InternalSwap(&other->_impl_.options_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_id_, &other->_impl_.setting_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.setting_description_, &other->_impl_.setting_description_, arena);
-        swap(_impl_.is_range_, other->_impl_.is_range_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.p99_latency_us_)
+      + sizeof(CallMetric::_impl_.p99_latency_us_)
+      - PROTOBUF_FIELD_OFFSET(CallMetric, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
 }
 
-::google::protobuf::Metadata SettingOptions::GetMetadata() const {
+::google::protobuf::Metadata CallMetric::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[56]);
+      file_level_metadata_camera_2fcamera_2eproto[64]);
 }
 // ===================================================================
 
@@ -13225,7 +15208,7 @@ void Information::InternalSwap(Information* PROTOBUF_RESTRICT other) {
 ::google::protobuf::Metadata Information::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_camera_2fcamera_2eproto_getter, &descriptor_table_camera_2fcamera_2eproto_once,
-      file_level_metadata_camera_2fcamera_2eproto[57]);
+      file_level_metadata_camera_2fcamera_2eproto[65]);
 }
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace camera
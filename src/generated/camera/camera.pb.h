@@ -61,6 +61,12 @@ extern const ::google::protobuf::internal::DescriptorTable
 namespace mavcam {
 namespace rpc {
 namespace camera {
+class AppliedSetting;
+struct AppliedSettingDefaultTypeInternal;
+extern AppliedSettingDefaultTypeInternal _AppliedSetting_default_instance_;
+class CallMetric;
+struct CallMetricDefaultTypeInternal;
+extern CallMetricDefaultTypeInternal _CallMetric_default_instance_;
 class CameraResult;
 struct CameraResultDefaultTypeInternal;
 extern CameraResultDefaultTypeInternal _CameraResult_default_instance_;
@@ -82,6 +88,12 @@ extern FormatStorageRequestDefaultTypeInternal _FormatStorageRequest_default_ins
 class FormatStorageResponse;
 struct FormatStorageResponseDefaultTypeInternal;
 extern FormatStorageResponseDefaultTypeInternal _FormatStorageResponse_default_instance_;
+class GetMetricsRequest;
+struct GetMetricsRequestDefaultTypeInternal;
+extern GetMetricsRequestDefaultTypeInternal _GetMetricsRequest_default_instance_;
+class GetMetricsResponse;
+struct GetMetricsResponseDefaultTypeInternal;
+extern GetMetricsResponseDefaultTypeInternal _GetMetricsResponse_default_instance_;
 class GetSettingRequest;
 struct GetSettingRequestDefaultTypeInternal;
 extern GetSettingRequestDefaultTypeInternal _GetSettingRequest_default_instance_;
@@ -145,6 +157,12 @@ extern SetSettingRequestDefaultTypeInternal _SetSettingRequest_default_instance_
 class SetSettingResponse;
 struct SetSettingResponseDefaultTypeInternal;
 extern SetSettingResponseDefaultTypeInternal _SetSettingResponse_default_instance_;
+class SetSettingsRequest;
+struct SetSettingsRequestDefaultTypeInternal;
+extern SetSettingsRequestDefaultTypeInternal _SetSettingsRequest_default_instance_;
+class SetSettingsResponse;
+struct SetSettingsResponseDefaultTypeInternal;
+extern SetSettingsResponseDefaultTypeInternal _SetSettingsResponse_default_instance_;
 class SetTimestampRequest;
 struct SetTimestampRequestDefaultTypeInternal;
 extern SetTimestampRequestDefaultTypeInternal _SetTimestampRequest_default_instance_;
@@ -157,6 +175,12 @@ extern SettingDefaultTypeInternal _Setting_default_instance_;
 class SettingOptions;
 struct SettingOptionsDefaultTypeInternal;
 extern SettingOptionsDefaultTypeInternal _SettingOptions_default_instance_;
+class StartBurstRequest;
+struct StartBurstRequestDefaultTypeInternal;
+extern StartBurstRequestDefaultTypeInternal _StartBurstRequest_default_instance_;
+class StartBurstResponse;
+struct StartBurstResponseDefaultTypeInternal;
+extern StartBurstResponseDefaultTypeInternal _StartBurstResponse_default_instance_;
 class StartPhotoIntervalRequest;
 struct StartPhotoIntervalRequestDefaultTypeInternal;
 extern StartPhotoIntervalRequestDefaultTypeInternal _StartPhotoIntervalRequest_default_instance_;
@@ -595,7 +619,7 @@ class VideoStreamSettings final :
                &_VideoStreamSettings_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    51;
+    57;
 
   friend void swap(VideoStreamSettings& a, VideoStreamSettings& b) {
     a.Swap(&b);
@@ -983,7 +1007,7 @@ class SubscribeVideoStreamInfoRequest final :
                &_SubscribeVideoStreamInfoRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    24;
+    26;
 
   friend void swap(SubscribeVideoStreamInfoRequest& a, SubscribeVideoStreamInfoRequest& b) {
     a.Swap(&b);
@@ -1119,7 +1143,7 @@ class SubscribeStatusRequest final :
                &_SubscribeStatusRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    28;
+    30;
 
   friend void swap(SubscribeStatusRequest& a, SubscribeStatusRequest& b) {
     a.Swap(&b);
@@ -1255,7 +1279,7 @@ class SubscribePossibleSettingOptionsRequest final :
                &_SubscribePossibleSettingOptionsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    32;
+    34;
 
   friend void swap(SubscribePossibleSettingOptionsRequest& a, SubscribePossibleSettingOptionsRequest& b) {
     a.Swap(&b);
@@ -1391,7 +1415,7 @@ class SubscribeModeRequest final :
                &_SubscribeModeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    22;
+    24;
 
   friend void swap(SubscribeModeRequest& a, SubscribeModeRequest& b) {
     a.Swap(&b);
@@ -1527,7 +1551,7 @@ class SubscribeInformationRequest final :
                &_SubscribeInformationRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    20;
+    22;
 
   friend void swap(SubscribeInformationRequest& a, SubscribeInformationRequest& b) {
     a.Swap(&b);
@@ -1663,7 +1687,7 @@ class SubscribeCurrentSettingsRequest final :
                &_SubscribeCurrentSettingsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    30;
+    32;
 
   friend void swap(SubscribeCurrentSettingsRequest& a, SubscribeCurrentSettingsRequest& b) {
     a.Swap(&b);
@@ -1799,7 +1823,7 @@ class SubscribeCaptureInfoRequest final :
                &_SubscribeCaptureInfoRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    26;
+    28;
 
   friend void swap(SubscribeCaptureInfoRequest& a, SubscribeCaptureInfoRequest& b) {
     a.Swap(&b);
@@ -1936,7 +1960,7 @@ class StopVideoStreamingRequest final :
                &_StopVideoStreamingRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    16;
 
   friend void swap(StopVideoStreamingRequest& a, StopVideoStreamingRequest& b) {
     a.Swap(&b);
@@ -2110,7 +2134,7 @@ class StopVideoRequest final :
                &_StopVideoRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    12;
 
   friend void swap(StopVideoRequest& a, StopVideoRequest& b) {
     a.Swap(&b);
@@ -2383,7 +2407,7 @@ class Status final :
                &_Status_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    53;
+    59;
 
   friend void swap(Status& a, Status& b) {
     a.Swap(&b);
@@ -2718,7 +2742,7 @@ class StartVideoStreamingRequest final :
                &_StartVideoStreamingRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    14;
 
   friend void swap(StartVideoStreamingRequest& a, StartVideoStreamingRequest& b) {
     a.Swap(&b);
@@ -2892,7 +2916,7 @@ class StartVideoRequest final :
                &_StartVideoRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    10;
 
   friend void swap(StartVideoRequest& a, StartVideoRequest& b) {
     a.Swap(&b);
@@ -3145,6 +3169,193 @@ class StartPhotoIntervalRequest final :
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
+class StartBurstRequest final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.StartBurstRequest) */ {
+ public:
+  inline StartBurstRequest() : StartBurstRequest(nullptr) {}
+  ~StartBurstRequest() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR StartBurstRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline StartBurstRequest(const StartBurstRequest& from)
+      : StartBurstRequest(nullptr, from) {}
+  StartBurstRequest(StartBurstRequest&& from) noexcept
+    : StartBurstRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StartBurstRequest& operator=(const StartBurstRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartBurstRequest& operator=(StartBurstRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartBurstRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartBurstRequest* internal_default_instance() {
+    return reinterpret_cast<const StartBurstRequest*>(
+               &_StartBurstRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(StartBurstRequest& a, StartBurstRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartBurstRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartBurstRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartBurstRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartBurstRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StartBurstRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const StartBurstRequest& from) {
+    StartBurstRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(StartBurstRequest* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.StartBurstRequest";
+  }
+  protected:
+  explicit StartBurstRequest(::google::protobuf::Arena* arena);
+  StartBurstRequest(::google::protobuf::Arena* arena, const StartBurstRequest& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountFieldNumber = 1,
+    kIntervalSFieldNumber = 2,
+  };
+  // int32 count = 1;
+  void clear_count() ;
+  ::int32_t count() const;
+  void set_count(::int32_t value);
+
+  private:
+  ::int32_t _internal_count() const;
+  void _internal_set_count(::int32_t value);
+
+  public:
+  // float interval_s = 2;
+  void clear_interval_s() ;
+  float interval_s() const;
+  void set_interval_s(float value);
+
+  private:
+  float _internal_interval_s() const;
+  void _internal_set_interval_s(float value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.StartBurstRequest)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::int32_t count_;
+    float interval_s_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
 class SetTimestampRequest final :
     public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.SetTimestampRequest) */ {
  public:
@@ -3204,7 +3415,7 @@ class SetTimestampRequest final :
                &_SetTimestampRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    44;
+    50;
 
   friend void swap(SetTimestampRequest& a, SetTimestampRequest& b) {
     a.Swap(&b);
@@ -3379,7 +3590,7 @@ class SetModeRequest final :
                &_SetModeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    18;
 
   friend void swap(SetModeRequest& a, SetModeRequest& b) {
     a.Swap(&b);
@@ -3554,7 +3765,7 @@ class SelectCameraRequest final :
                &_SelectCameraRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    41;
+    47;
 
   friend void swap(SelectCameraRequest& a, SelectCameraRequest& b) {
     a.Swap(&b);
@@ -3728,7 +3939,7 @@ class ResetSettingsRequest final :
                &_ResetSettingsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    42;
+    48;
 
   friend void swap(ResetSettingsRequest& a, ResetSettingsRequest& b) {
     a.Swap(&b);
@@ -3865,7 +4076,7 @@ class Quaternion final :
                &_Quaternion_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    48;
+    54;
 
   friend void swap(Quaternion& a, Quaternion& b) {
     a.Swap(&b);
@@ -4212,7 +4423,7 @@ class Position final :
                &_Position_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    47;
+    53;
 
   friend void swap(Position& a, Position& b) {
     a.Swap(&b);
@@ -4423,7 +4634,7 @@ class Option final :
                &_Option_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    54;
+    60;
 
   friend void swap(Option& a, Option& b) {
     a.Swap(&b);
@@ -4622,7 +4833,7 @@ class ModeResponse final :
                &_ModeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    23;
+    25;
 
   friend void swap(ModeResponse& a, ModeResponse& b) {
     a.Swap(&b);
@@ -4797,7 +5008,7 @@ class ListPhotosRequest final :
                &_ListPhotosRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    18;
+    20;
 
   friend void swap(ListPhotosRequest& a, ListPhotosRequest& b) {
     a.Swap(&b);
@@ -4972,7 +5183,7 @@ class Information final :
                &_Information_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    57;
+    65;
 
   friend void swap(Information& a, Information& b) {
     a.Swap(&b);
@@ -5284,26 +5495,25 @@ class Information final :
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
-class FormatStorageRequest final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.FormatStorageRequest) */ {
+class GetMetricsRequest final :
+    public ::google::protobuf::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.GetMetricsRequest) */ {
  public:
-  inline FormatStorageRequest() : FormatStorageRequest(nullptr) {}
-  ~FormatStorageRequest() override;
+  inline GetMetricsRequest() : GetMetricsRequest(nullptr) {}
   template<typename = void>
-  explicit PROTOBUF_CONSTEXPR FormatStorageRequest(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR GetMetricsRequest(::google::protobuf::internal::ConstantInitialized);
 
-  inline FormatStorageRequest(const FormatStorageRequest& from)
-      : FormatStorageRequest(nullptr, from) {}
-  FormatStorageRequest(FormatStorageRequest&& from) noexcept
-    : FormatStorageRequest() {
+  inline GetMetricsRequest(const GetMetricsRequest& from)
+      : GetMetricsRequest(nullptr, from) {}
+  GetMetricsRequest(GetMetricsRequest&& from) noexcept
+    : GetMetricsRequest() {
     *this = ::std::move(from);
   }
 
-  inline FormatStorageRequest& operator=(const FormatStorageRequest& from) {
+  inline GetMetricsRequest& operator=(const GetMetricsRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FormatStorageRequest& operator=(FormatStorageRequest&& from) noexcept {
+  inline GetMetricsRequest& operator=(GetMetricsRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5335,20 +5545,20 @@ class FormatStorageRequest final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const FormatStorageRequest& default_instance() {
+  static const GetMetricsRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const FormatStorageRequest* internal_default_instance() {
-    return reinterpret_cast<const FormatStorageRequest*>(
-               &_FormatStorageRequest_default_instance_);
+  static inline const GetMetricsRequest* internal_default_instance() {
+    return reinterpret_cast<const GetMetricsRequest*>(
+               &_GetMetricsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    38;
+    40;
 
-  friend void swap(FormatStorageRequest& a, FormatStorageRequest& b) {
+  friend void swap(GetMetricsRequest& a, GetMetricsRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(FormatStorageRequest* other) {
+  inline void Swap(GetMetricsRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -5361,7 +5571,7 @@ class FormatStorageRequest final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(FormatStorageRequest* other) {
+  void UnsafeArenaSwap(GetMetricsRequest* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -5369,61 +5579,198 @@ class FormatStorageRequest final :
 
   // implements Message ----------------------------------------------
 
-  FormatStorageRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<FormatStorageRequest>(arena);
+  GetMetricsRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetMetricsRequest>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const FormatStorageRequest& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const FormatStorageRequest& from) {
-    FormatStorageRequest::MergeImpl(*this, from);
+  using ::google::protobuf::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const GetMetricsRequest& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::google::protobuf::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const GetMetricsRequest& from) {
+    ::google::protobuf::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  private:
-  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  ::size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
-  ::uint8_t* _InternalSerialize(
-      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
-
-  private:
-  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
-  void SharedCtor(::google::protobuf::Arena* arena);
-  void SharedDtor();
-  void InternalSwap(FormatStorageRequest* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.FormatStorageRequest";
+    return "mavcam.rpc.camera.GetMetricsRequest";
   }
   protected:
-  explicit FormatStorageRequest(::google::protobuf::Arena* arena);
-  FormatStorageRequest(::google::protobuf::Arena* arena, const FormatStorageRequest& from);
+  explicit GetMetricsRequest(::google::protobuf::Arena* arena);
+  GetMetricsRequest(::google::protobuf::Arena* arena, const GetMetricsRequest& from);
   public:
 
-  static const ClassData _class_data_;
-  const ::google::protobuf::Message::ClassData*GetClassData() const final;
-
   ::google::protobuf::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kStorageIdFieldNumber = 1,
-  };
-  // int32 storage_id = 1;
-  void clear_storage_id() ;
-  ::int32_t storage_id() const;
-  void set_storage_id(::int32_t value);
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.GetMetricsRequest)
+ private:
+  class _Internal;
 
-  private:
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class FormatStorageRequest final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.FormatStorageRequest) */ {
+ public:
+  inline FormatStorageRequest() : FormatStorageRequest(nullptr) {}
+  ~FormatStorageRequest() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR FormatStorageRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline FormatStorageRequest(const FormatStorageRequest& from)
+      : FormatStorageRequest(nullptr, from) {}
+  FormatStorageRequest(FormatStorageRequest&& from) noexcept
+    : FormatStorageRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FormatStorageRequest& operator=(const FormatStorageRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FormatStorageRequest& operator=(FormatStorageRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FormatStorageRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FormatStorageRequest* internal_default_instance() {
+    return reinterpret_cast<const FormatStorageRequest*>(
+               &_FormatStorageRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(FormatStorageRequest& a, FormatStorageRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FormatStorageRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FormatStorageRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FormatStorageRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FormatStorageRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const FormatStorageRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const FormatStorageRequest& from) {
+    FormatStorageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(FormatStorageRequest* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.FormatStorageRequest";
+  }
+  protected:
+  explicit FormatStorageRequest(::google::protobuf::Arena* arena);
+  FormatStorageRequest(::google::protobuf::Arena* arena, const FormatStorageRequest& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStorageIdFieldNumber = 1,
+  };
+  // int32 storage_id = 1;
+  void clear_storage_id() ;
+  ::int32_t storage_id() const;
+  void set_storage_id(::int32_t value);
+
+  private:
   ::int32_t _internal_storage_id() const;
   void _internal_set_storage_id(::int32_t value);
 
@@ -5518,7 +5865,7 @@ class EulerAngle final :
                &_EulerAngle_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    49;
+    55;
 
   friend void swap(EulerAngle& a, EulerAngle& b) {
     a.Swap(&b);
@@ -5717,7 +6064,7 @@ class CameraResult final :
                &_CameraResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    46;
+    52;
 
   friend void swap(CameraResult& a, CameraResult& b) {
     a.Swap(&b);
@@ -5879,26 +6226,26 @@ class CameraResult final :
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
-class VideoStreamInfo final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.VideoStreamInfo) */ {
+class CallMetric final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.CallMetric) */ {
  public:
-  inline VideoStreamInfo() : VideoStreamInfo(nullptr) {}
-  ~VideoStreamInfo() override;
+  inline CallMetric() : CallMetric(nullptr) {}
+  ~CallMetric() override;
   template<typename = void>
-  explicit PROTOBUF_CONSTEXPR VideoStreamInfo(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR CallMetric(::google::protobuf::internal::ConstantInitialized);
 
-  inline VideoStreamInfo(const VideoStreamInfo& from)
-      : VideoStreamInfo(nullptr, from) {}
-  VideoStreamInfo(VideoStreamInfo&& from) noexcept
-    : VideoStreamInfo() {
+  inline CallMetric(const CallMetric& from)
+      : CallMetric(nullptr, from) {}
+  CallMetric(CallMetric&& from) noexcept
+    : CallMetric() {
     *this = ::std::move(from);
   }
 
-  inline VideoStreamInfo& operator=(const VideoStreamInfo& from) {
+  inline CallMetric& operator=(const CallMetric& from) {
     CopyFrom(from);
     return *this;
   }
-  inline VideoStreamInfo& operator=(VideoStreamInfo&& from) noexcept {
+  inline CallMetric& operator=(CallMetric&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5930,20 +6277,20 @@ class VideoStreamInfo final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const VideoStreamInfo& default_instance() {
+  static const CallMetric& default_instance() {
     return *internal_default_instance();
   }
-  static inline const VideoStreamInfo* internal_default_instance() {
-    return reinterpret_cast<const VideoStreamInfo*>(
-               &_VideoStreamInfo_default_instance_);
+  static inline const CallMetric* internal_default_instance() {
+    return reinterpret_cast<const CallMetric*>(
+               &_CallMetric_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    52;
+    64;
 
-  friend void swap(VideoStreamInfo& a, VideoStreamInfo& b) {
+  friend void swap(CallMetric& a, CallMetric& b) {
     a.Swap(&b);
   }
-  inline void Swap(VideoStreamInfo* other) {
+  inline void Swap(CallMetric* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -5956,7 +6303,7 @@ class VideoStreamInfo final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(VideoStreamInfo* other) {
+  void UnsafeArenaSwap(CallMetric* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -5964,14 +6311,14 @@ class VideoStreamInfo final :
 
   // implements Message ----------------------------------------------
 
-  VideoStreamInfo* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<VideoStreamInfo>(arena);
+  CallMetric* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallMetric>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const VideoStreamInfo& from);
+  void CopyFrom(const CallMetric& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const VideoStreamInfo& from) {
-    VideoStreamInfo::MergeImpl(*this, from);
+  void MergeFrom( const CallMetric& from) {
+    CallMetric::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
@@ -5989,16 +6336,16 @@ class VideoStreamInfo final :
   ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
   void SharedCtor(::google::protobuf::Arena* arena);
   void SharedDtor();
-  void InternalSwap(VideoStreamInfo* other);
+  void InternalSwap(CallMetric* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.VideoStreamInfo";
+    return "mavcam.rpc.camera.CallMetric";
   }
   protected:
-  explicit VideoStreamInfo(::google::protobuf::Arena* arena);
-  VideoStreamInfo(::google::protobuf::Arena* arena, const VideoStreamInfo& from);
+  explicit CallMetric(::google::protobuf::Arena* arena);
+  CallMetric(::google::protobuf::Arena* arena, const CallMetric& from);
   public:
 
   static const ClassData _class_data_;
@@ -6008,81 +6355,539 @@ class VideoStreamInfo final :
 
   // nested types ----------------------------------------------------
 
-  using VideoStreamStatus = VideoStreamInfo_VideoStreamStatus;
-  static constexpr VideoStreamStatus VIDEO_STREAM_STATUS_NOT_RUNNING = VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING;
-  static constexpr VideoStreamStatus VIDEO_STREAM_STATUS_IN_PROGRESS = VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS;
-  static inline bool VideoStreamStatus_IsValid(int value) {
-    return VideoStreamInfo_VideoStreamStatus_IsValid(value);
-  }
-  static constexpr VideoStreamStatus VideoStreamStatus_MIN = VideoStreamInfo_VideoStreamStatus_VideoStreamStatus_MIN;
-  static constexpr VideoStreamStatus VideoStreamStatus_MAX = VideoStreamInfo_VideoStreamStatus_VideoStreamStatus_MAX;
-  static constexpr int VideoStreamStatus_ARRAYSIZE = VideoStreamInfo_VideoStreamStatus_VideoStreamStatus_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor* VideoStreamStatus_descriptor() {
-    return VideoStreamInfo_VideoStreamStatus_descriptor();
-  }
-  template <typename T>
-  static inline const std::string& VideoStreamStatus_Name(T value) {
-    return VideoStreamInfo_VideoStreamStatus_Name(value);
-  }
-  static inline bool VideoStreamStatus_Parse(absl::string_view name, VideoStreamStatus* value) {
-    return VideoStreamInfo_VideoStreamStatus_Parse(name, value);
-  }
-
-  using VideoStreamSpectrum = VideoStreamInfo_VideoStreamSpectrum;
-  static constexpr VideoStreamSpectrum VIDEO_STREAM_SPECTRUM_UNKNOWN = VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN;
-  static constexpr VideoStreamSpectrum VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT = VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT;
-  static constexpr VideoStreamSpectrum VIDEO_STREAM_SPECTRUM_INFRARED = VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED;
-  static inline bool VideoStreamSpectrum_IsValid(int value) {
-    return VideoStreamInfo_VideoStreamSpectrum_IsValid(value);
-  }
-  static constexpr VideoStreamSpectrum VideoStreamSpectrum_MIN = VideoStreamInfo_VideoStreamSpectrum_VideoStreamSpectrum_MIN;
-  static constexpr VideoStreamSpectrum VideoStreamSpectrum_MAX = VideoStreamInfo_VideoStreamSpectrum_VideoStreamSpectrum_MAX;
-  static constexpr int VideoStreamSpectrum_ARRAYSIZE = VideoStreamInfo_VideoStreamSpectrum_VideoStreamSpectrum_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor* VideoStreamSpectrum_descriptor() {
-    return VideoStreamInfo_VideoStreamSpectrum_descriptor();
-  }
-  template <typename T>
-  static inline const std::string& VideoStreamSpectrum_Name(T value) {
-    return VideoStreamInfo_VideoStreamSpectrum_Name(value);
-  }
-  static inline bool VideoStreamSpectrum_Parse(absl::string_view name, VideoStreamSpectrum* value) {
-    return VideoStreamInfo_VideoStreamSpectrum_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSettingsFieldNumber = 2,
-    kStreamIdFieldNumber = 1,
-    kStatusFieldNumber = 3,
-    kSpectrumFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kErrorCountFieldNumber = 3,
+    kTotalLatencyUsFieldNumber = 4,
+    kMaxLatencyUsFieldNumber = 5,
+    kP50LatencyUsFieldNumber = 6,
+    kP90LatencyUsFieldNumber = 7,
+    kP99LatencyUsFieldNumber = 8,
   };
-  // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
-  bool has_settings() const;
-  void clear_settings() ;
-  const ::mavcam::rpc::camera::VideoStreamSettings& settings() const;
-  PROTOBUF_NODISCARD ::mavcam::rpc::camera::VideoStreamSettings* release_settings();
-  ::mavcam::rpc::camera::VideoStreamSettings* mutable_settings();
-  void set_allocated_settings(::mavcam::rpc::camera::VideoStreamSettings* value);
-  void unsafe_arena_set_allocated_settings(::mavcam::rpc::camera::VideoStreamSettings* value);
-  ::mavcam::rpc::camera::VideoStreamSettings* unsafe_arena_release_settings();
+  // string name = 1;
+  void clear_name() ;
+  const std::string& name() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_name(Arg_&& arg, Args_... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* value);
 
   private:
-  const ::mavcam::rpc::camera::VideoStreamSettings& _internal_settings() const;
-  ::mavcam::rpc::camera::VideoStreamSettings* _internal_mutable_settings();
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(
+      const std::string& value);
+  std::string* _internal_mutable_name();
 
   public:
-  // int32 stream_id = 1;
-  void clear_stream_id() ;
-  ::int32_t stream_id() const;
-  void set_stream_id(::int32_t value);
+  // uint64 count = 2;
+  void clear_count() ;
+  ::uint64_t count() const;
+  void set_count(::uint64_t value);
 
   private:
-  ::int32_t _internal_stream_id() const;
-  void _internal_set_stream_id(::int32_t value);
+  ::uint64_t _internal_count() const;
+  void _internal_set_count(::uint64_t value);
 
   public:
-  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
+  // uint64 error_count = 3;
+  void clear_error_count() ;
+  ::uint64_t error_count() const;
+  void set_error_count(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_error_count() const;
+  void _internal_set_error_count(::uint64_t value);
+
+  public:
+  // uint64 total_latency_us = 4;
+  void clear_total_latency_us() ;
+  ::uint64_t total_latency_us() const;
+  void set_total_latency_us(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_total_latency_us() const;
+  void _internal_set_total_latency_us(::uint64_t value);
+
+  public:
+  // uint64 max_latency_us = 5;
+  void clear_max_latency_us() ;
+  ::uint64_t max_latency_us() const;
+  void set_max_latency_us(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_max_latency_us() const;
+  void _internal_set_max_latency_us(::uint64_t value);
+
+  public:
+  // uint64 p50_latency_us = 6;
+  void clear_p50_latency_us() ;
+  ::uint64_t p50_latency_us() const;
+  void set_p50_latency_us(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_p50_latency_us() const;
+  void _internal_set_p50_latency_us(::uint64_t value);
+
+  public:
+  // uint64 p90_latency_us = 7;
+  void clear_p90_latency_us() ;
+  ::uint64_t p90_latency_us() const;
+  void set_p90_latency_us(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_p90_latency_us() const;
+  void _internal_set_p90_latency_us(::uint64_t value);
+
+  public:
+  // uint64 p99_latency_us = 8;
+  void clear_p99_latency_us() ;
+  ::uint64_t p99_latency_us() const;
+  void set_p99_latency_us(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_p99_latency_us() const;
+  void _internal_set_p99_latency_us(::uint64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.CallMetric)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 8, 0,
+      49, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ArenaStringPtr name_;
+    ::uint64_t count_;
+    ::uint64_t error_count_;
+    ::uint64_t total_latency_us_;
+    ::uint64_t max_latency_us_;
+    ::uint64_t p50_latency_us_;
+    ::uint64_t p90_latency_us_;
+    ::uint64_t p99_latency_us_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class AppliedSetting final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.AppliedSetting) */ {
+ public:
+  inline AppliedSetting() : AppliedSetting(nullptr) {}
+  ~AppliedSetting() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR AppliedSetting(::google::protobuf::internal::ConstantInitialized);
+
+  inline AppliedSetting(const AppliedSetting& from)
+      : AppliedSetting(nullptr, from) {}
+  AppliedSetting(AppliedSetting&& from) noexcept
+    : AppliedSetting() {
+    *this = ::std::move(from);
+  }
+
+  inline AppliedSetting& operator=(const AppliedSetting& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppliedSetting& operator=(AppliedSetting&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppliedSetting& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppliedSetting* internal_default_instance() {
+    return reinterpret_cast<const AppliedSetting*>(
+               &_AppliedSetting_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    63;
+
+  friend void swap(AppliedSetting& a, AppliedSetting& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppliedSetting* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppliedSetting* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AppliedSetting* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppliedSetting>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const AppliedSetting& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const AppliedSetting& from) {
+    AppliedSetting::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(AppliedSetting* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.AppliedSetting";
+  }
+  protected:
+  explicit AppliedSetting(::google::protobuf::Arena* arena);
+  AppliedSetting(::google::protobuf::Arena* arena, const AppliedSetting& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSettingIdFieldNumber = 2,
+    kResultFieldNumber = 1,
+  };
+  // string setting_id = 2;
+  void clear_setting_id() ;
+  const std::string& setting_id() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_setting_id(Arg_&& arg, Args_... args);
+  std::string* mutable_setting_id();
+  PROTOBUF_NODISCARD std::string* release_setting_id();
+  void set_allocated_setting_id(std::string* value);
+
+  private:
+  const std::string& _internal_setting_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_setting_id(
+      const std::string& value);
+  std::string* _internal_mutable_setting_id();
+
+  public:
+  // .mavcam.rpc.camera.CameraResult.Result result = 1;
+  void clear_result() ;
+  ::mavcam::rpc::camera::CameraResult_Result result() const;
+  void set_result(::mavcam::rpc::camera::CameraResult_Result value);
+
+  private:
+  ::mavcam::rpc::camera::CameraResult_Result _internal_result() const;
+  void _internal_set_result(::mavcam::rpc::camera::CameraResult_Result value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.AppliedSetting)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      51, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::ArenaStringPtr setting_id_;
+    int result_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class VideoStreamInfo final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.VideoStreamInfo) */ {
+ public:
+  inline VideoStreamInfo() : VideoStreamInfo(nullptr) {}
+  ~VideoStreamInfo() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR VideoStreamInfo(::google::protobuf::internal::ConstantInitialized);
+
+  inline VideoStreamInfo(const VideoStreamInfo& from)
+      : VideoStreamInfo(nullptr, from) {}
+  VideoStreamInfo(VideoStreamInfo&& from) noexcept
+    : VideoStreamInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline VideoStreamInfo& operator=(const VideoStreamInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VideoStreamInfo& operator=(VideoStreamInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VideoStreamInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VideoStreamInfo* internal_default_instance() {
+    return reinterpret_cast<const VideoStreamInfo*>(
+               &_VideoStreamInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    58;
+
+  friend void swap(VideoStreamInfo& a, VideoStreamInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VideoStreamInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VideoStreamInfo* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VideoStreamInfo* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VideoStreamInfo>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const VideoStreamInfo& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const VideoStreamInfo& from) {
+    VideoStreamInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(VideoStreamInfo* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.VideoStreamInfo";
+  }
+  protected:
+  explicit VideoStreamInfo(::google::protobuf::Arena* arena);
+  VideoStreamInfo(::google::protobuf::Arena* arena, const VideoStreamInfo& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  using VideoStreamStatus = VideoStreamInfo_VideoStreamStatus;
+  static constexpr VideoStreamStatus VIDEO_STREAM_STATUS_NOT_RUNNING = VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING;
+  static constexpr VideoStreamStatus VIDEO_STREAM_STATUS_IN_PROGRESS = VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS;
+  static inline bool VideoStreamStatus_IsValid(int value) {
+    return VideoStreamInfo_VideoStreamStatus_IsValid(value);
+  }
+  static constexpr VideoStreamStatus VideoStreamStatus_MIN = VideoStreamInfo_VideoStreamStatus_VideoStreamStatus_MIN;
+  static constexpr VideoStreamStatus VideoStreamStatus_MAX = VideoStreamInfo_VideoStreamStatus_VideoStreamStatus_MAX;
+  static constexpr int VideoStreamStatus_ARRAYSIZE = VideoStreamInfo_VideoStreamStatus_VideoStreamStatus_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* VideoStreamStatus_descriptor() {
+    return VideoStreamInfo_VideoStreamStatus_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& VideoStreamStatus_Name(T value) {
+    return VideoStreamInfo_VideoStreamStatus_Name(value);
+  }
+  static inline bool VideoStreamStatus_Parse(absl::string_view name, VideoStreamStatus* value) {
+    return VideoStreamInfo_VideoStreamStatus_Parse(name, value);
+  }
+
+  using VideoStreamSpectrum = VideoStreamInfo_VideoStreamSpectrum;
+  static constexpr VideoStreamSpectrum VIDEO_STREAM_SPECTRUM_UNKNOWN = VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN;
+  static constexpr VideoStreamSpectrum VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT = VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT;
+  static constexpr VideoStreamSpectrum VIDEO_STREAM_SPECTRUM_INFRARED = VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED;
+  static inline bool VideoStreamSpectrum_IsValid(int value) {
+    return VideoStreamInfo_VideoStreamSpectrum_IsValid(value);
+  }
+  static constexpr VideoStreamSpectrum VideoStreamSpectrum_MIN = VideoStreamInfo_VideoStreamSpectrum_VideoStreamSpectrum_MIN;
+  static constexpr VideoStreamSpectrum VideoStreamSpectrum_MAX = VideoStreamInfo_VideoStreamSpectrum_VideoStreamSpectrum_MAX;
+  static constexpr int VideoStreamSpectrum_ARRAYSIZE = VideoStreamInfo_VideoStreamSpectrum_VideoStreamSpectrum_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor* VideoStreamSpectrum_descriptor() {
+    return VideoStreamInfo_VideoStreamSpectrum_descriptor();
+  }
+  template <typename T>
+  static inline const std::string& VideoStreamSpectrum_Name(T value) {
+    return VideoStreamInfo_VideoStreamSpectrum_Name(value);
+  }
+  static inline bool VideoStreamSpectrum_Parse(absl::string_view name, VideoStreamSpectrum* value) {
+    return VideoStreamInfo_VideoStreamSpectrum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSettingsFieldNumber = 2,
+    kStreamIdFieldNumber = 1,
+    kStatusFieldNumber = 3,
+    kSpectrumFieldNumber = 4,
+  };
+  // .mavcam.rpc.camera.VideoStreamSettings settings = 2;
+  bool has_settings() const;
+  void clear_settings() ;
+  const ::mavcam::rpc::camera::VideoStreamSettings& settings() const;
+  PROTOBUF_NODISCARD ::mavcam::rpc::camera::VideoStreamSettings* release_settings();
+  ::mavcam::rpc::camera::VideoStreamSettings* mutable_settings();
+  void set_allocated_settings(::mavcam::rpc::camera::VideoStreamSettings* value);
+  void unsafe_arena_set_allocated_settings(::mavcam::rpc::camera::VideoStreamSettings* value);
+  ::mavcam::rpc::camera::VideoStreamSettings* unsafe_arena_release_settings();
+
+  private:
+  const ::mavcam::rpc::camera::VideoStreamSettings& _internal_settings() const;
+  ::mavcam::rpc::camera::VideoStreamSettings* _internal_mutable_settings();
+
+  public:
+  // int32 stream_id = 1;
+  void clear_stream_id() ;
+  ::int32_t stream_id() const;
+  void set_stream_id(::int32_t value);
+
+  private:
+  ::int32_t _internal_stream_id() const;
+  void _internal_set_stream_id(::int32_t value);
+
+  public:
+  // .mavcam.rpc.camera.VideoStreamInfo.VideoStreamStatus status = 3;
   void clear_status() ;
   ::mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus status() const;
   void set_status(::mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus value);
@@ -6377,7 +7182,7 @@ class StopVideoStreamingResponse final :
                &_StopVideoStreamingResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    17;
 
   friend void swap(StopVideoStreamingResponse& a, StopVideoStreamingResponse& b) {
     a.Swap(&b);
@@ -6558,7 +7363,7 @@ class StopVideoResponse final :
                &_StopVideoResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    13;
 
   friend void swap(StopVideoResponse& a, StopVideoResponse& b) {
     a.Swap(&b);
@@ -6920,7 +7725,7 @@ class StatusResponse final :
                &_StatusResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    29;
+    31;
 
   friend void swap(StatusResponse& a, StatusResponse& b) {
     a.Swap(&b);
@@ -7101,7 +7906,7 @@ class StartVideoStreamingResponse final :
                &_StartVideoStreamingResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    15;
 
   friend void swap(StartVideoStreamingResponse& a, StartVideoStreamingResponse& b) {
     a.Swap(&b);
@@ -7238,11 +8043,192 @@ class StartVideoResponse final :
     *this = ::std::move(from);
   }
 
-  inline StartVideoResponse& operator=(const StartVideoResponse& from) {
+  inline StartVideoResponse& operator=(const StartVideoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartVideoResponse& operator=(StartVideoResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartVideoResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartVideoResponse* internal_default_instance() {
+    return reinterpret_cast<const StartVideoResponse*>(
+               &_StartVideoResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(StartVideoResponse& a, StartVideoResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartVideoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartVideoResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartVideoResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartVideoResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const StartVideoResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const StartVideoResponse& from) {
+    StartVideoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(StartVideoResponse* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.StartVideoResponse";
+  }
+  protected:
+  explicit StartVideoResponse(::google::protobuf::Arena* arena);
+  StartVideoResponse(::google::protobuf::Arena* arena, const StartVideoResponse& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCameraResultFieldNumber = 1,
+  };
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  bool has_camera_result() const;
+  void clear_camera_result() ;
+  const ::mavcam::rpc::camera::CameraResult& camera_result() const;
+  PROTOBUF_NODISCARD ::mavcam::rpc::camera::CameraResult* release_camera_result();
+  ::mavcam::rpc::camera::CameraResult* mutable_camera_result();
+  void set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value);
+  void unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value);
+  ::mavcam::rpc::camera::CameraResult* unsafe_arena_release_camera_result();
+
+  private:
+  const ::mavcam::rpc::camera::CameraResult& _internal_camera_result() const;
+  ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.StartVideoResponse)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::mavcam::rpc::camera::CameraResult* camera_result_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class StartPhotoIntervalResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.StartPhotoIntervalResponse) */ {
+ public:
+  inline StartPhotoIntervalResponse() : StartPhotoIntervalResponse(nullptr) {}
+  ~StartPhotoIntervalResponse() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR StartPhotoIntervalResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline StartPhotoIntervalResponse(const StartPhotoIntervalResponse& from)
+      : StartPhotoIntervalResponse(nullptr, from) {}
+  StartPhotoIntervalResponse(StartPhotoIntervalResponse&& from) noexcept
+    : StartPhotoIntervalResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StartPhotoIntervalResponse& operator=(const StartPhotoIntervalResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StartVideoResponse& operator=(StartVideoResponse&& from) noexcept {
+  inline StartPhotoIntervalResponse& operator=(StartPhotoIntervalResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7274,20 +8260,20 @@ class StartVideoResponse final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StartVideoResponse& default_instance() {
+  static const StartPhotoIntervalResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const StartVideoResponse* internal_default_instance() {
-    return reinterpret_cast<const StartVideoResponse*>(
-               &_StartVideoResponse_default_instance_);
+  static inline const StartPhotoIntervalResponse* internal_default_instance() {
+    return reinterpret_cast<const StartPhotoIntervalResponse*>(
+               &_StartPhotoIntervalResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    5;
 
-  friend void swap(StartVideoResponse& a, StartVideoResponse& b) {
+  friend void swap(StartPhotoIntervalResponse& a, StartPhotoIntervalResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(StartVideoResponse* other) {
+  inline void Swap(StartPhotoIntervalResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -7300,7 +8286,7 @@ class StartVideoResponse final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StartVideoResponse* other) {
+  void UnsafeArenaSwap(StartPhotoIntervalResponse* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -7308,14 +8294,14 @@ class StartVideoResponse final :
 
   // implements Message ----------------------------------------------
 
-  StartVideoResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<StartVideoResponse>(arena);
+  StartPhotoIntervalResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartPhotoIntervalResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const StartVideoResponse& from);
+  void CopyFrom(const StartPhotoIntervalResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const StartVideoResponse& from) {
-    StartVideoResponse::MergeImpl(*this, from);
+  void MergeFrom( const StartPhotoIntervalResponse& from) {
+    StartPhotoIntervalResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
@@ -7333,16 +8319,16 @@ class StartVideoResponse final :
   ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
   void SharedCtor(::google::protobuf::Arena* arena);
   void SharedDtor();
-  void InternalSwap(StartVideoResponse* other);
+  void InternalSwap(StartPhotoIntervalResponse* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.StartVideoResponse";
+    return "mavcam.rpc.camera.StartPhotoIntervalResponse";
   }
   protected:
-  explicit StartVideoResponse(::google::protobuf::Arena* arena);
-  StartVideoResponse(::google::protobuf::Arena* arena, const StartVideoResponse& from);
+  explicit StartPhotoIntervalResponse(::google::protobuf::Arena* arena);
+  StartPhotoIntervalResponse(::google::protobuf::Arena* arena, const StartPhotoIntervalResponse& from);
   public:
 
   static const ClassData _class_data_;
@@ -7372,7 +8358,7 @@ class StartVideoResponse final :
   ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.StartVideoResponse)
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.StartPhotoIntervalResponse)
  private:
   class _Internal;
 
@@ -7404,26 +8390,26 @@ class StartVideoResponse final :
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
-class StartPhotoIntervalResponse final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.StartPhotoIntervalResponse) */ {
+class StartBurstResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.StartBurstResponse) */ {
  public:
-  inline StartPhotoIntervalResponse() : StartPhotoIntervalResponse(nullptr) {}
-  ~StartPhotoIntervalResponse() override;
+  inline StartBurstResponse() : StartBurstResponse(nullptr) {}
+  ~StartBurstResponse() override;
   template<typename = void>
-  explicit PROTOBUF_CONSTEXPR StartPhotoIntervalResponse(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR StartBurstResponse(::google::protobuf::internal::ConstantInitialized);
 
-  inline StartPhotoIntervalResponse(const StartPhotoIntervalResponse& from)
-      : StartPhotoIntervalResponse(nullptr, from) {}
-  StartPhotoIntervalResponse(StartPhotoIntervalResponse&& from) noexcept
-    : StartPhotoIntervalResponse() {
+  inline StartBurstResponse(const StartBurstResponse& from)
+      : StartBurstResponse(nullptr, from) {}
+  StartBurstResponse(StartBurstResponse&& from) noexcept
+    : StartBurstResponse() {
     *this = ::std::move(from);
   }
 
-  inline StartPhotoIntervalResponse& operator=(const StartPhotoIntervalResponse& from) {
+  inline StartBurstResponse& operator=(const StartBurstResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StartPhotoIntervalResponse& operator=(StartPhotoIntervalResponse&& from) noexcept {
+  inline StartBurstResponse& operator=(StartBurstResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7455,20 +8441,20 @@ class StartPhotoIntervalResponse final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StartPhotoIntervalResponse& default_instance() {
+  static const StartBurstResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const StartPhotoIntervalResponse* internal_default_instance() {
-    return reinterpret_cast<const StartPhotoIntervalResponse*>(
-               &_StartPhotoIntervalResponse_default_instance_);
+  static inline const StartBurstResponse* internal_default_instance() {
+    return reinterpret_cast<const StartBurstResponse*>(
+               &_StartBurstResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    9;
 
-  friend void swap(StartPhotoIntervalResponse& a, StartPhotoIntervalResponse& b) {
+  friend void swap(StartBurstResponse& a, StartBurstResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(StartPhotoIntervalResponse* other) {
+  inline void Swap(StartBurstResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -7481,7 +8467,7 @@ class StartPhotoIntervalResponse final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StartPhotoIntervalResponse* other) {
+  void UnsafeArenaSwap(StartBurstResponse* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -7489,14 +8475,14 @@ class StartPhotoIntervalResponse final :
 
   // implements Message ----------------------------------------------
 
-  StartPhotoIntervalResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<StartPhotoIntervalResponse>(arena);
+  StartBurstResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartBurstResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const StartPhotoIntervalResponse& from);
+  void CopyFrom(const StartBurstResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const StartPhotoIntervalResponse& from) {
-    StartPhotoIntervalResponse::MergeImpl(*this, from);
+  void MergeFrom( const StartBurstResponse& from) {
+    StartBurstResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
@@ -7514,16 +8500,16 @@ class StartPhotoIntervalResponse final :
   ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
   void SharedCtor(::google::protobuf::Arena* arena);
   void SharedDtor();
-  void InternalSwap(StartPhotoIntervalResponse* other);
+  void InternalSwap(StartBurstResponse* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.StartPhotoIntervalResponse";
+    return "mavcam.rpc.camera.StartBurstResponse";
   }
   protected:
-  explicit StartPhotoIntervalResponse(::google::protobuf::Arena* arena);
-  StartPhotoIntervalResponse(::google::protobuf::Arena* arena, const StartPhotoIntervalResponse& from);
+  explicit StartBurstResponse(::google::protobuf::Arena* arena);
+  StartBurstResponse(::google::protobuf::Arena* arena, const StartBurstResponse& from);
   public:
 
   static const ClassData _class_data_;
@@ -7553,7 +8539,7 @@ class StartPhotoIntervalResponse final :
   ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.StartPhotoIntervalResponse)
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.StartBurstResponse)
  private:
   class _Internal;
 
@@ -7644,7 +8630,7 @@ class SettingOptions final :
                &_SettingOptions_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    56;
+    62;
 
   friend void swap(SettingOptions& a, SettingOptions& b) {
     a.Swap(&b);
@@ -7875,7 +8861,7 @@ class Setting final :
                &_Setting_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    55;
+    61;
 
   friend void swap(Setting& a, Setting& b) {
     a.Swap(&b);
@@ -7995,29 +8981,213 @@ class Setting final :
   void unsafe_arena_set_allocated_option(::mavcam::rpc::camera::Option* value);
   ::mavcam::rpc::camera::Option* unsafe_arena_release_option();
 
-  private:
-  const ::mavcam::rpc::camera::Option& _internal_option() const;
-  ::mavcam::rpc::camera::Option* _internal_mutable_option();
+  private:
+  const ::mavcam::rpc::camera::Option& _internal_option() const;
+  ::mavcam::rpc::camera::Option* _internal_mutable_option();
+
+  public:
+  // bool is_range = 4;
+  void clear_is_range() ;
+  bool is_range() const;
+  void set_is_range(bool value);
+
+  private:
+  bool _internal_is_range() const;
+  void _internal_set_is_range(bool value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.Setting)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 1,
+      63, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr setting_id_;
+    ::google::protobuf::internal::ArenaStringPtr setting_description_;
+    ::mavcam::rpc::camera::Option* option_;
+    bool is_range_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class SetTimestampResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.SetTimestampResponse) */ {
+ public:
+  inline SetTimestampResponse() : SetTimestampResponse(nullptr) {}
+  ~SetTimestampResponse() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR SetTimestampResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline SetTimestampResponse(const SetTimestampResponse& from)
+      : SetTimestampResponse(nullptr, from) {}
+  SetTimestampResponse(SetTimestampResponse&& from) noexcept
+    : SetTimestampResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetTimestampResponse& operator=(const SetTimestampResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetTimestampResponse& operator=(SetTimestampResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetTimestampResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetTimestampResponse* internal_default_instance() {
+    return reinterpret_cast<const SetTimestampResponse*>(
+               &_SetTimestampResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(SetTimestampResponse& a, SetTimestampResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetTimestampResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetTimestampResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetTimestampResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetTimestampResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const SetTimestampResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const SetTimestampResponse& from) {
+    SetTimestampResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(SetTimestampResponse* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.SetTimestampResponse";
+  }
+  protected:
+  explicit SetTimestampResponse(::google::protobuf::Arena* arena);
+  SetTimestampResponse(::google::protobuf::Arena* arena, const SetTimestampResponse& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
 
-  public:
-  // bool is_range = 4;
-  void clear_is_range() ;
-  bool is_range() const;
-  void set_is_range(bool value);
+  enum : int {
+    kCameraResultFieldNumber = 1,
+  };
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  bool has_camera_result() const;
+  void clear_camera_result() ;
+  const ::mavcam::rpc::camera::CameraResult& camera_result() const;
+  PROTOBUF_NODISCARD ::mavcam::rpc::camera::CameraResult* release_camera_result();
+  ::mavcam::rpc::camera::CameraResult* mutable_camera_result();
+  void set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value);
+  void unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value);
+  ::mavcam::rpc::camera::CameraResult* unsafe_arena_release_camera_result();
 
   private:
-  bool _internal_is_range() const;
-  void _internal_set_is_range(bool value);
+  const ::mavcam::rpc::camera::CameraResult& _internal_camera_result() const;
+  ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.Setting)
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.SetTimestampResponse)
  private:
   class _Internal;
 
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 1,
-      63, 2>
+      0, 1, 1,
+      0, 2>
       _table_;
   friend class ::google::protobuf::MessageLite;
   friend class ::google::protobuf::Arena;
@@ -8035,36 +9205,33 @@ class Setting final :
                               ::google::protobuf::Arena* arena, const Impl_& from);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr setting_id_;
-    ::google::protobuf::internal::ArenaStringPtr setting_description_;
-    ::mavcam::rpc::camera::Option* option_;
-    bool is_range_;
+    ::mavcam::rpc::camera::CameraResult* camera_result_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
-class SetTimestampResponse final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.SetTimestampResponse) */ {
+class SetSettingsResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.SetSettingsResponse) */ {
  public:
-  inline SetTimestampResponse() : SetTimestampResponse(nullptr) {}
-  ~SetTimestampResponse() override;
+  inline SetSettingsResponse() : SetSettingsResponse(nullptr) {}
+  ~SetSettingsResponse() override;
   template<typename = void>
-  explicit PROTOBUF_CONSTEXPR SetTimestampResponse(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR SetSettingsResponse(::google::protobuf::internal::ConstantInitialized);
 
-  inline SetTimestampResponse(const SetTimestampResponse& from)
-      : SetTimestampResponse(nullptr, from) {}
-  SetTimestampResponse(SetTimestampResponse&& from) noexcept
-    : SetTimestampResponse() {
+  inline SetSettingsResponse(const SetSettingsResponse& from)
+      : SetSettingsResponse(nullptr, from) {}
+  SetSettingsResponse(SetSettingsResponse&& from) noexcept
+    : SetSettingsResponse() {
     *this = ::std::move(from);
   }
 
-  inline SetTimestampResponse& operator=(const SetTimestampResponse& from) {
+  inline SetSettingsResponse& operator=(const SetSettingsResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetTimestampResponse& operator=(SetTimestampResponse&& from) noexcept {
+  inline SetSettingsResponse& operator=(SetSettingsResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8096,20 +9263,20 @@ class SetTimestampResponse final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetTimestampResponse& default_instance() {
+  static const SetSettingsResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetTimestampResponse* internal_default_instance() {
-    return reinterpret_cast<const SetTimestampResponse*>(
-               &_SetTimestampResponse_default_instance_);
+  static inline const SetSettingsResponse* internal_default_instance() {
+    return reinterpret_cast<const SetSettingsResponse*>(
+               &_SetSettingsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    45;
+    39;
 
-  friend void swap(SetTimestampResponse& a, SetTimestampResponse& b) {
+  friend void swap(SetSettingsResponse& a, SetSettingsResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetTimestampResponse* other) {
+  inline void Swap(SetSettingsResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -8122,7 +9289,7 @@ class SetTimestampResponse final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetTimestampResponse* other) {
+  void UnsafeArenaSwap(SetSettingsResponse* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -8130,14 +9297,14 @@ class SetTimestampResponse final :
 
   // implements Message ----------------------------------------------
 
-  SetTimestampResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetTimestampResponse>(arena);
+  SetSettingsResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetSettingsResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const SetTimestampResponse& from);
+  void CopyFrom(const SetSettingsResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const SetTimestampResponse& from) {
-    SetTimestampResponse::MergeImpl(*this, from);
+  void MergeFrom( const SetSettingsResponse& from) {
+    SetSettingsResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
@@ -8155,16 +9322,16 @@ class SetTimestampResponse final :
   ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
   void SharedCtor(::google::protobuf::Arena* arena);
   void SharedDtor();
-  void InternalSwap(SetTimestampResponse* other);
+  void InternalSwap(SetSettingsResponse* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.SetTimestampResponse";
+    return "mavcam.rpc.camera.SetSettingsResponse";
   }
   protected:
-  explicit SetTimestampResponse(::google::protobuf::Arena* arena);
-  SetTimestampResponse(::google::protobuf::Arena* arena, const SetTimestampResponse& from);
+  explicit SetSettingsResponse(::google::protobuf::Arena* arena);
+  SetSettingsResponse(::google::protobuf::Arena* arena, const SetSettingsResponse& from);
   public:
 
   static const ClassData _class_data_;
@@ -8177,8 +9344,27 @@ class SetTimestampResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kAppliedSettingsFieldNumber = 2,
     kCameraResultFieldNumber = 1,
   };
+  // repeated .mavcam.rpc.camera.AppliedSetting applied_settings = 2;
+  int applied_settings_size() const;
+  private:
+  int _internal_applied_settings_size() const;
+
+  public:
+  void clear_applied_settings() ;
+  ::mavcam::rpc::camera::AppliedSetting* mutable_applied_settings(int index);
+  ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::AppliedSetting >*
+      mutable_applied_settings();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::AppliedSetting>& _internal_applied_settings() const;
+  ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::AppliedSetting>* _internal_mutable_applied_settings();
+  public:
+  const ::mavcam::rpc::camera::AppliedSetting& applied_settings(int index) const;
+  ::mavcam::rpc::camera::AppliedSetting* add_applied_settings();
+  const ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::AppliedSetting >&
+      applied_settings() const;
   // .mavcam.rpc.camera.CameraResult camera_result = 1;
   bool has_camera_result() const;
   void clear_camera_result() ;
@@ -8194,13 +9380,13 @@ class SetTimestampResponse final :
   ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.SetTimestampResponse)
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.SetSettingsResponse)
  private:
   class _Internal;
 
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 1,
+      1, 2, 2,
       0, 2>
       _table_;
   friend class ::google::protobuf::MessageLite;
@@ -8219,6 +9405,7 @@ class SetTimestampResponse final :
                               ::google::protobuf::Arena* arena, const Impl_& from);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::AppliedSetting > applied_settings_;
     ::mavcam::rpc::camera::CameraResult* camera_result_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -8285,7 +9472,7 @@ class SetSettingResponse final :
                &_SetSettingResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    37;
 
   friend void swap(SetSettingResponse& a, SetSettingResponse& b) {
     a.Swap(&b);
@@ -8466,7 +9653,7 @@ class SetModeResponse final :
                &_SetModeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    17;
+    19;
 
   friend void swap(SetModeResponse& a, SetModeResponse& b) {
     a.Swap(&b);
@@ -8647,7 +9834,7 @@ class SelectCameraResponse final :
                &_SelectCameraResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    40;
+    46;
 
   friend void swap(SelectCameraResponse& a, SelectCameraResponse& b) {
     a.Swap(&b);
@@ -8828,7 +10015,7 @@ class ResetSettingsResponse final :
                &_ResetSettingsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    43;
+    49;
 
   friend void swap(ResetSettingsResponse& a, ResetSettingsResponse& b) {
     a.Swap(&b);
@@ -9095,11 +10282,192 @@ class PrepareResponse final :
   ::mavcam::rpc::camera::CameraResult* unsafe_arena_release_camera_result();
 
   private:
-  const ::mavcam::rpc::camera::CameraResult& _internal_camera_result() const;
-  ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
+  const ::mavcam::rpc::camera::CameraResult& _internal_camera_result() const;
+  ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.PrepareResponse)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::mavcam::rpc::camera::CameraResult* camera_result_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class InformationResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.InformationResponse) */ {
+ public:
+  inline InformationResponse() : InformationResponse(nullptr) {}
+  ~InformationResponse() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR InformationResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline InformationResponse(const InformationResponse& from)
+      : InformationResponse(nullptr, from) {}
+  InformationResponse(InformationResponse&& from) noexcept
+    : InformationResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InformationResponse& operator=(const InformationResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InformationResponse& operator=(InformationResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InformationResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InformationResponse* internal_default_instance() {
+    return reinterpret_cast<const InformationResponse*>(
+               &_InformationResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(InformationResponse& a, InformationResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InformationResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InformationResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InformationResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InformationResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const InformationResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const InformationResponse& from) {
+    InformationResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(InformationResponse* other);
+
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.InformationResponse";
+  }
+  protected:
+  explicit InformationResponse(::google::protobuf::Arena* arena);
+  InformationResponse(::google::protobuf::Arena* arena, const InformationResponse& from);
+  public:
+
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
+
+  ::google::protobuf::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInformationFieldNumber = 1,
+  };
+  // .mavcam.rpc.camera.Information information = 1;
+  bool has_information() const;
+  void clear_information() ;
+  const ::mavcam::rpc::camera::Information& information() const;
+  PROTOBUF_NODISCARD ::mavcam::rpc::camera::Information* release_information();
+  ::mavcam::rpc::camera::Information* mutable_information();
+  void set_allocated_information(::mavcam::rpc::camera::Information* value);
+  void unsafe_arena_set_allocated_information(::mavcam::rpc::camera::Information* value);
+  ::mavcam::rpc::camera::Information* unsafe_arena_release_information();
+
+  private:
+  const ::mavcam::rpc::camera::Information& _internal_information() const;
+  ::mavcam::rpc::camera::Information* _internal_mutable_information();
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.PrepareResponse)
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.InformationResponse)
  private:
   class _Internal;
 
@@ -9124,33 +10492,33 @@ class PrepareResponse final :
                               ::google::protobuf::Arena* arena, const Impl_& from);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    ::mavcam::rpc::camera::CameraResult* camera_result_;
+    ::mavcam::rpc::camera::Information* information_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
-class InformationResponse final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.InformationResponse) */ {
+class GetMetricsResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.GetMetricsResponse) */ {
  public:
-  inline InformationResponse() : InformationResponse(nullptr) {}
-  ~InformationResponse() override;
+  inline GetMetricsResponse() : GetMetricsResponse(nullptr) {}
+  ~GetMetricsResponse() override;
   template<typename = void>
-  explicit PROTOBUF_CONSTEXPR InformationResponse(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR GetMetricsResponse(::google::protobuf::internal::ConstantInitialized);
 
-  inline InformationResponse(const InformationResponse& from)
-      : InformationResponse(nullptr, from) {}
-  InformationResponse(InformationResponse&& from) noexcept
-    : InformationResponse() {
+  inline GetMetricsResponse(const GetMetricsResponse& from)
+      : GetMetricsResponse(nullptr, from) {}
+  GetMetricsResponse(GetMetricsResponse&& from) noexcept
+    : GetMetricsResponse() {
     *this = ::std::move(from);
   }
 
-  inline InformationResponse& operator=(const InformationResponse& from) {
+  inline GetMetricsResponse& operator=(const GetMetricsResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InformationResponse& operator=(InformationResponse&& from) noexcept {
+  inline GetMetricsResponse& operator=(GetMetricsResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9182,20 +10550,20 @@ class InformationResponse final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InformationResponse& default_instance() {
+  static const GetMetricsResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InformationResponse* internal_default_instance() {
-    return reinterpret_cast<const InformationResponse*>(
-               &_InformationResponse_default_instance_);
+  static inline const GetMetricsResponse* internal_default_instance() {
+    return reinterpret_cast<const GetMetricsResponse*>(
+               &_GetMetricsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    41;
 
-  friend void swap(InformationResponse& a, InformationResponse& b) {
+  friend void swap(GetMetricsResponse& a, GetMetricsResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(InformationResponse* other) {
+  inline void Swap(GetMetricsResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -9208,7 +10576,7 @@ class InformationResponse final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InformationResponse* other) {
+  void UnsafeArenaSwap(GetMetricsResponse* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -9216,14 +10584,14 @@ class InformationResponse final :
 
   // implements Message ----------------------------------------------
 
-  InformationResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InformationResponse>(arena);
+  GetMetricsResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetMetricsResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const InformationResponse& from);
+  void CopyFrom(const GetMetricsResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const InformationResponse& from) {
-    InformationResponse::MergeImpl(*this, from);
+  void MergeFrom( const GetMetricsResponse& from) {
+    GetMetricsResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
@@ -9241,16 +10609,16 @@ class InformationResponse final :
   ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
   void SharedCtor(::google::protobuf::Arena* arena);
   void SharedDtor();
-  void InternalSwap(InformationResponse* other);
+  void InternalSwap(GetMetricsResponse* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.InformationResponse";
+    return "mavcam.rpc.camera.GetMetricsResponse";
   }
   protected:
-  explicit InformationResponse(::google::protobuf::Arena* arena);
-  InformationResponse(::google::protobuf::Arena* arena, const InformationResponse& from);
+  explicit GetMetricsResponse(::google::protobuf::Arena* arena);
+  GetMetricsResponse(::google::protobuf::Arena* arena, const GetMetricsResponse& from);
   public:
 
   static const ClassData _class_data_;
@@ -9263,30 +10631,49 @@ class InformationResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kInformationFieldNumber = 1,
+    kCallMetricsFieldNumber = 2,
+    kCameraResultFieldNumber = 1,
   };
-  // .mavcam.rpc.camera.Information information = 1;
-  bool has_information() const;
-  void clear_information() ;
-  const ::mavcam::rpc::camera::Information& information() const;
-  PROTOBUF_NODISCARD ::mavcam::rpc::camera::Information* release_information();
-  ::mavcam::rpc::camera::Information* mutable_information();
-  void set_allocated_information(::mavcam::rpc::camera::Information* value);
-  void unsafe_arena_set_allocated_information(::mavcam::rpc::camera::Information* value);
-  ::mavcam::rpc::camera::Information* unsafe_arena_release_information();
+  // repeated .mavcam.rpc.camera.CallMetric call_metrics = 2;
+  int call_metrics_size() const;
+  private:
+  int _internal_call_metrics_size() const;
 
+  public:
+  void clear_call_metrics() ;
+  ::mavcam::rpc::camera::CallMetric* mutable_call_metrics(int index);
+  ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::CallMetric >*
+      mutable_call_metrics();
   private:
-  const ::mavcam::rpc::camera::Information& _internal_information() const;
-  ::mavcam::rpc::camera::Information* _internal_mutable_information();
+  const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::CallMetric>& _internal_call_metrics() const;
+  ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::CallMetric>* _internal_mutable_call_metrics();
+  public:
+  const ::mavcam::rpc::camera::CallMetric& call_metrics(int index) const;
+  ::mavcam::rpc::camera::CallMetric* add_call_metrics();
+  const ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::CallMetric >&
+      call_metrics() const;
+  // .mavcam.rpc.camera.CameraResult camera_result = 1;
+  bool has_camera_result() const;
+  void clear_camera_result() ;
+  const ::mavcam::rpc::camera::CameraResult& camera_result() const;
+  PROTOBUF_NODISCARD ::mavcam::rpc::camera::CameraResult* release_camera_result();
+  ::mavcam::rpc::camera::CameraResult* mutable_camera_result();
+  void set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value);
+  void unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value);
+  ::mavcam::rpc::camera::CameraResult* unsafe_arena_release_camera_result();
+
+  private:
+  const ::mavcam::rpc::camera::CameraResult& _internal_camera_result() const;
+  ::mavcam::rpc::camera::CameraResult* _internal_mutable_camera_result();
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.InformationResponse)
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.GetMetricsResponse)
  private:
   class _Internal;
 
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 1,
+      1, 2, 2,
       0, 2>
       _table_;
   friend class ::google::protobuf::MessageLite;
@@ -9305,7 +10692,8 @@ class InformationResponse final :
                               ::google::protobuf::Arena* arena, const Impl_& from);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    ::mavcam::rpc::camera::Information* information_;
+    ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::CallMetric > call_metrics_;
+    ::mavcam::rpc::camera::CameraResult* camera_result_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -9371,7 +10759,7 @@ class FormatStorageResponse final :
                &_FormatStorageResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    39;
+    45;
 
   friend void swap(FormatStorageResponse& a, FormatStorageResponse& b) {
     a.Swap(&b);
@@ -9552,7 +10940,7 @@ class CaptureInfo final :
                &_CaptureInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    50;
+    56;
 
   friend void swap(CaptureInfo& a, CaptureInfo& b) {
     a.Swap(&b);
@@ -9690,48 +11078,238 @@ class CaptureInfo final :
   ::mavcam::rpc::camera::EulerAngle* unsafe_arena_release_attitude_euler_angle();
 
   private:
-  const ::mavcam::rpc::camera::EulerAngle& _internal_attitude_euler_angle() const;
-  ::mavcam::rpc::camera::EulerAngle* _internal_mutable_attitude_euler_angle();
+  const ::mavcam::rpc::camera::EulerAngle& _internal_attitude_euler_angle() const;
+  ::mavcam::rpc::camera::EulerAngle* _internal_mutable_attitude_euler_angle();
+
+  public:
+  // uint64 time_utc_us = 4;
+  void clear_time_utc_us() ;
+  ::uint64_t time_utc_us() const;
+  void set_time_utc_us(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_time_utc_us() const;
+  void _internal_set_time_utc_us(::uint64_t value);
+
+  public:
+  // bool is_success = 5;
+  void clear_is_success() ;
+  bool is_success() const;
+  void set_is_success(bool value);
+
+  private:
+  bool _internal_is_success() const;
+  void _internal_set_is_success(bool value);
+
+  public:
+  // int32 index = 6;
+  void clear_index() ;
+  ::int32_t index() const;
+  void set_index(::int32_t value);
+
+  private:
+  ::int32_t _internal_index() const;
+  void _internal_set_index(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.CaptureInfo)
+ private:
+  class _Internal;
+
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 7, 3,
+      46, 2>
+      _table_;
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+
+        inline explicit constexpr Impl_(
+            ::google::protobuf::internal::ConstantInitialized) noexcept;
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena);
+        inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                              ::google::protobuf::Arena* arena, const Impl_& from);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    mutable ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr file_url_;
+    ::mavcam::rpc::camera::Position* position_;
+    ::mavcam::rpc::camera::Quaternion* attitude_quaternion_;
+    ::mavcam::rpc::camera::EulerAngle* attitude_euler_angle_;
+    ::uint64_t time_utc_us_;
+    bool is_success_;
+    ::int32_t index_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_camera_2fcamera_2eproto;
+};// -------------------------------------------------------------------
+
+class VideoStreamInfoResponse final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.VideoStreamInfoResponse) */ {
+ public:
+  inline VideoStreamInfoResponse() : VideoStreamInfoResponse(nullptr) {}
+  ~VideoStreamInfoResponse() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR VideoStreamInfoResponse(::google::protobuf::internal::ConstantInitialized);
+
+  inline VideoStreamInfoResponse(const VideoStreamInfoResponse& from)
+      : VideoStreamInfoResponse(nullptr, from) {}
+  VideoStreamInfoResponse(VideoStreamInfoResponse&& from) noexcept
+    : VideoStreamInfoResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline VideoStreamInfoResponse& operator=(const VideoStreamInfoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VideoStreamInfoResponse& operator=(VideoStreamInfoResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetArena() == from.GetArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VideoStreamInfoResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VideoStreamInfoResponse* internal_default_instance() {
+    return reinterpret_cast<const VideoStreamInfoResponse*>(
+               &_VideoStreamInfoResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(VideoStreamInfoResponse& a, VideoStreamInfoResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VideoStreamInfoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() != nullptr &&
+        GetArena() == other->GetArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetArena() == other->GetArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VideoStreamInfoResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VideoStreamInfoResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VideoStreamInfoResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const VideoStreamInfoResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom( const VideoStreamInfoResponse& from) {
+    VideoStreamInfoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::google::protobuf::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
+  void SharedCtor(::google::protobuf::Arena* arena);
+  void SharedDtor();
+  void InternalSwap(VideoStreamInfoResponse* other);
 
+  private:
+  friend class ::google::protobuf::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "mavcam.rpc.camera.VideoStreamInfoResponse";
+  }
+  protected:
+  explicit VideoStreamInfoResponse(::google::protobuf::Arena* arena);
+  VideoStreamInfoResponse(::google::protobuf::Arena* arena, const VideoStreamInfoResponse& from);
   public:
-  // uint64 time_utc_us = 4;
-  void clear_time_utc_us() ;
-  ::uint64_t time_utc_us() const;
-  void set_time_utc_us(::uint64_t value);
 
-  private:
-  ::uint64_t _internal_time_utc_us() const;
-  void _internal_set_time_utc_us(::uint64_t value);
+  static const ClassData _class_data_;
+  const ::google::protobuf::Message::ClassData*GetClassData() const final;
 
-  public:
-  // bool is_success = 5;
-  void clear_is_success() ;
-  bool is_success() const;
-  void set_is_success(bool value);
+  ::google::protobuf::Metadata GetMetadata() const final;
 
-  private:
-  bool _internal_is_success() const;
-  void _internal_set_is_success(bool value);
+  // nested types ----------------------------------------------------
 
-  public:
-  // int32 index = 6;
-  void clear_index() ;
-  ::int32_t index() const;
-  void set_index(::int32_t value);
+  // accessors -------------------------------------------------------
 
+  enum : int {
+    kVideoStreamInfosFieldNumber = 1,
+  };
+  // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
+  int video_stream_infos_size() const;
   private:
-  ::int32_t _internal_index() const;
-  void _internal_set_index(::int32_t value);
+  int _internal_video_stream_infos_size() const;
 
   public:
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.CaptureInfo)
+  void clear_video_stream_infos() ;
+  ::mavcam::rpc::camera::VideoStreamInfo* mutable_video_stream_infos(int index);
+  ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::VideoStreamInfo >*
+      mutable_video_stream_infos();
+  private:
+  const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::VideoStreamInfo>& _internal_video_stream_infos() const;
+  ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::VideoStreamInfo>* _internal_mutable_video_stream_infos();
+  public:
+  const ::mavcam::rpc::camera::VideoStreamInfo& video_stream_infos(int index) const;
+  ::mavcam::rpc::camera::VideoStreamInfo* add_video_stream_infos();
+  const ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::VideoStreamInfo >&
+      video_stream_infos() const;
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.VideoStreamInfoResponse)
  private:
   class _Internal;
 
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      3, 7, 3,
-      46, 2>
+      0, 1, 1,
+      0, 2>
       _table_;
   friend class ::google::protobuf::MessageLite;
   friend class ::google::protobuf::Arena;
@@ -9747,41 +11325,34 @@ class CaptureInfo final :
                               ::google::protobuf::Arena* arena);
         inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                               ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::VideoStreamInfo > video_stream_infos_;
     mutable ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr file_url_;
-    ::mavcam::rpc::camera::Position* position_;
-    ::mavcam::rpc::camera::Quaternion* attitude_quaternion_;
-    ::mavcam::rpc::camera::EulerAngle* attitude_euler_angle_;
-    ::uint64_t time_utc_us_;
-    bool is_success_;
-    ::int32_t index_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_camera_2fcamera_2eproto;
 };// -------------------------------------------------------------------
 
-class VideoStreamInfoResponse final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.VideoStreamInfoResponse) */ {
+class SetSettingsRequest final :
+    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mavcam.rpc.camera.SetSettingsRequest) */ {
  public:
-  inline VideoStreamInfoResponse() : VideoStreamInfoResponse(nullptr) {}
-  ~VideoStreamInfoResponse() override;
+  inline SetSettingsRequest() : SetSettingsRequest(nullptr) {}
+  ~SetSettingsRequest() override;
   template<typename = void>
-  explicit PROTOBUF_CONSTEXPR VideoStreamInfoResponse(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR SetSettingsRequest(::google::protobuf::internal::ConstantInitialized);
 
-  inline VideoStreamInfoResponse(const VideoStreamInfoResponse& from)
-      : VideoStreamInfoResponse(nullptr, from) {}
-  VideoStreamInfoResponse(VideoStreamInfoResponse&& from) noexcept
-    : VideoStreamInfoResponse() {
+  inline SetSettingsRequest(const SetSettingsRequest& from)
+      : SetSettingsRequest(nullptr, from) {}
+  SetSettingsRequest(SetSettingsRequest&& from) noexcept
+    : SetSettingsRequest() {
     *this = ::std::move(from);
   }
 
-  inline VideoStreamInfoResponse& operator=(const VideoStreamInfoResponse& from) {
+  inline SetSettingsRequest& operator=(const SetSettingsRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline VideoStreamInfoResponse& operator=(VideoStreamInfoResponse&& from) noexcept {
+  inline SetSettingsRequest& operator=(SetSettingsRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetArena() == from.GetArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -9813,20 +11384,20 @@ class VideoStreamInfoResponse final :
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const VideoStreamInfoResponse& default_instance() {
+  static const SetSettingsRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const VideoStreamInfoResponse* internal_default_instance() {
-    return reinterpret_cast<const VideoStreamInfoResponse*>(
-               &_VideoStreamInfoResponse_default_instance_);
+  static inline const SetSettingsRequest* internal_default_instance() {
+    return reinterpret_cast<const SetSettingsRequest*>(
+               &_SetSettingsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    25;
+    38;
 
-  friend void swap(VideoStreamInfoResponse& a, VideoStreamInfoResponse& b) {
+  friend void swap(SetSettingsRequest& a, SetSettingsRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(VideoStreamInfoResponse* other) {
+  inline void Swap(SetSettingsRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetArena() != nullptr &&
@@ -9839,7 +11410,7 @@ class VideoStreamInfoResponse final :
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(VideoStreamInfoResponse* other) {
+  void UnsafeArenaSwap(SetSettingsRequest* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -9847,14 +11418,14 @@ class VideoStreamInfoResponse final :
 
   // implements Message ----------------------------------------------
 
-  VideoStreamInfoResponse* New(::google::protobuf::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<VideoStreamInfoResponse>(arena);
+  SetSettingsRequest* New(::google::protobuf::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetSettingsRequest>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const VideoStreamInfoResponse& from);
+  void CopyFrom(const SetSettingsRequest& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom( const VideoStreamInfoResponse& from) {
-    VideoStreamInfoResponse::MergeImpl(*this, from);
+  void MergeFrom( const SetSettingsRequest& from) {
+    SetSettingsRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::google::protobuf::Message& to_msg, const ::google::protobuf::Message& from_msg);
@@ -9872,16 +11443,16 @@ class VideoStreamInfoResponse final :
   ::google::protobuf::internal::CachedSize* AccessCachedSize() const final;
   void SharedCtor(::google::protobuf::Arena* arena);
   void SharedDtor();
-  void InternalSwap(VideoStreamInfoResponse* other);
+  void InternalSwap(SetSettingsRequest* other);
 
   private:
   friend class ::google::protobuf::internal::AnyMetadata;
   static ::absl::string_view FullMessageName() {
-    return "mavcam.rpc.camera.VideoStreamInfoResponse";
+    return "mavcam.rpc.camera.SetSettingsRequest";
   }
   protected:
-  explicit VideoStreamInfoResponse(::google::protobuf::Arena* arena);
-  VideoStreamInfoResponse(::google::protobuf::Arena* arena, const VideoStreamInfoResponse& from);
+  explicit SetSettingsRequest(::google::protobuf::Arena* arena);
+  SetSettingsRequest(::google::protobuf::Arena* arena, const SetSettingsRequest& from);
   public:
 
   static const ClassData _class_data_;
@@ -9894,27 +11465,27 @@ class VideoStreamInfoResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVideoStreamInfosFieldNumber = 1,
+    kSettingsFieldNumber = 1,
   };
-  // repeated .mavcam.rpc.camera.VideoStreamInfo video_stream_infos = 1;
-  int video_stream_infos_size() const;
+  // repeated .mavcam.rpc.camera.Setting settings = 1;
+  int settings_size() const;
   private:
-  int _internal_video_stream_infos_size() const;
+  int _internal_settings_size() const;
 
   public:
-  void clear_video_stream_infos() ;
-  ::mavcam::rpc::camera::VideoStreamInfo* mutable_video_stream_infos(int index);
-  ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::VideoStreamInfo >*
-      mutable_video_stream_infos();
+  void clear_settings() ;
+  ::mavcam::rpc::camera::Setting* mutable_settings(int index);
+  ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::Setting >*
+      mutable_settings();
   private:
-  const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::VideoStreamInfo>& _internal_video_stream_infos() const;
-  ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::VideoStreamInfo>* _internal_mutable_video_stream_infos();
+  const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::Setting>& _internal_settings() const;
+  ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::Setting>* _internal_mutable_settings();
   public:
-  const ::mavcam::rpc::camera::VideoStreamInfo& video_stream_infos(int index) const;
-  ::mavcam::rpc::camera::VideoStreamInfo* add_video_stream_infos();
-  const ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::VideoStreamInfo >&
-      video_stream_infos() const;
-  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.VideoStreamInfoResponse)
+  const ::mavcam::rpc::camera::Setting& settings(int index) const;
+  ::mavcam::rpc::camera::Setting* add_settings();
+  const ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::Setting >&
+      settings() const;
+  // @@protoc_insertion_point(class_scope:mavcam.rpc.camera.SetSettingsRequest)
  private:
   class _Internal;
 
@@ -9937,7 +11508,7 @@ class VideoStreamInfoResponse final :
                               ::google::protobuf::Arena* arena);
         inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                               ::google::protobuf::Arena* arena, const Impl_& from);
-    ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::VideoStreamInfo > video_stream_infos_;
+    ::google::protobuf::RepeatedPtrField< ::mavcam::rpc::camera::Setting > settings_;
     mutable ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -10004,7 +11575,7 @@ class SetSettingRequest final :
                &_SetSettingRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    34;
+    36;
 
   friend void swap(SetSettingRequest& a, SetSettingRequest& b) {
     a.Swap(&b);
@@ -10185,7 +11756,7 @@ class PossibleSettingOptionsResponse final :
                &_PossibleSettingOptionsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    35;
 
   friend void swap(PossibleSettingOptionsResponse& a, PossibleSettingOptionsResponse& b) {
     a.Swap(&b);
@@ -10368,7 +11939,7 @@ class ListPhotosResponse final :
                &_ListPhotosResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    19;
+    21;
 
   friend void swap(ListPhotosResponse& a, ListPhotosResponse& b) {
     a.Swap(&b);
@@ -10569,7 +12140,7 @@ class GetSettingResponse final :
                &_GetSettingResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    37;
+    43;
 
   friend void swap(GetSettingResponse& a, GetSettingResponse& b) {
     a.Swap(&b);
@@ -10767,7 +12338,7 @@ class GetSettingRequest final :
                &_GetSettingRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    36;
+    42;
 
   friend void swap(GetSettingRequest& a, GetSettingRequest& b) {
     a.Swap(&b);
@@ -10948,7 +12519,7 @@ class CurrentSettingsResponse final :
                &_CurrentSettingsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    31;
+    33;
 
   friend void swap(CurrentSettingsResponse& a, CurrentSettingsResponse& b) {
     a.Swap(&b);
@@ -11131,7 +12702,7 @@ class CaptureInfoResponse final :
                &_CaptureInfoResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    27;
+    29;
 
   friend void swap(CaptureInfoResponse& a, CaptureInfoResponse& b) {
     a.Swap(&b);
@@ -11600,35 +13171,185 @@ inline void StartPhotoIntervalResponse::set_allocated_camera_result(::mavcam::rp
   // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.StartPhotoIntervalResponse.camera_result)
 }
 
-// -------------------------------------------------------------------
-
-// StopPhotoIntervalRequest
+// -------------------------------------------------------------------
+
+// StopPhotoIntervalRequest
+
+// -------------------------------------------------------------------
+
+// StopPhotoIntervalResponse
+
+// .mavcam.rpc.camera.CameraResult camera_result = 1;
+inline bool StopPhotoIntervalResponse::has_camera_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.camera_result_ != nullptr);
+  return value;
+}
+inline void StopPhotoIntervalResponse::clear_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.camera_result_ != nullptr) _impl_.camera_result_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::mavcam::rpc::camera::CameraResult& StopPhotoIntervalResponse::_internal_camera_result() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::mavcam::rpc::camera::CameraResult* p = _impl_.camera_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavcam::rpc::camera::CameraResult&>(::mavcam::rpc::camera::_CameraResult_default_instance_);
+}
+inline const ::mavcam::rpc::camera::CameraResult& StopPhotoIntervalResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+  return _internal_camera_result();
+}
+inline void StopPhotoIntervalResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.camera_result_);
+  }
+  _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+}
+inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::release_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::mavcam::rpc::camera::CameraResult* released = _impl_.camera_result_;
+  _impl_.camera_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::unsafe_arena_release_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::mavcam::rpc::camera::CameraResult* temp = _impl_.camera_result_;
+  _impl_.camera_result_ = nullptr;
+  return temp;
+}
+inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::_internal_mutable_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.camera_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(GetArena());
+    _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(p);
+  }
+  return _impl_.camera_result_;
+}
+inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::mavcam::rpc::camera::CameraResult* _msg = _internal_mutable_camera_result();
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+  return _msg;
+}
+inline void StopPhotoIntervalResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(_impl_.camera_result_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+}
+
+// -------------------------------------------------------------------
+
+// StartBurstRequest
+
+// int32 count = 1;
+inline void StartBurstRequest::clear_count() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.count_ = 0;
+}
+inline ::int32_t StartBurstRequest::count() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.StartBurstRequest.count)
+  return _internal_count();
+}
+inline void StartBurstRequest::set_count(::int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.StartBurstRequest.count)
+}
+inline ::int32_t StartBurstRequest::_internal_count() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.count_;
+}
+inline void StartBurstRequest::_internal_set_count(::int32_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.count_ = value;
+}
+
+// float interval_s = 2;
+inline void StartBurstRequest::clear_interval_s() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.interval_s_ = 0;
+}
+inline float StartBurstRequest::interval_s() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.StartBurstRequest.interval_s)
+  return _internal_interval_s();
+}
+inline void StartBurstRequest::set_interval_s(float value) {
+  _internal_set_interval_s(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.StartBurstRequest.interval_s)
+}
+inline float StartBurstRequest::_internal_interval_s() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.interval_s_;
+}
+inline void StartBurstRequest::_internal_set_interval_s(float value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.interval_s_ = value;
+}
 
 // -------------------------------------------------------------------
 
-// StopPhotoIntervalResponse
+// StartBurstResponse
 
 // .mavcam.rpc.camera.CameraResult camera_result = 1;
-inline bool StopPhotoIntervalResponse::has_camera_result() const {
+inline bool StartBurstResponse::has_camera_result() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.camera_result_ != nullptr);
   return value;
 }
-inline void StopPhotoIntervalResponse::clear_camera_result() {
+inline void StartBurstResponse::clear_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (_impl_.camera_result_ != nullptr) _impl_.camera_result_->Clear();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::mavcam::rpc::camera::CameraResult& StopPhotoIntervalResponse::_internal_camera_result() const {
+inline const ::mavcam::rpc::camera::CameraResult& StartBurstResponse::_internal_camera_result() const {
   PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   const ::mavcam::rpc::camera::CameraResult* p = _impl_.camera_result_;
   return p != nullptr ? *p : reinterpret_cast<const ::mavcam::rpc::camera::CameraResult&>(::mavcam::rpc::camera::_CameraResult_default_instance_);
 }
-inline const ::mavcam::rpc::camera::CameraResult& StopPhotoIntervalResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+inline const ::mavcam::rpc::camera::CameraResult& StartBurstResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.StartBurstResponse.camera_result)
   return _internal_camera_result();
 }
-inline void StopPhotoIntervalResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+inline void StartBurstResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.camera_result_);
@@ -11639,9 +13360,9 @@ inline void StopPhotoIntervalResponse::unsafe_arena_set_allocated_camera_result(
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.StartBurstResponse.camera_result)
 }
-inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::release_camera_result() {
+inline ::mavcam::rpc::camera::CameraResult* StartBurstResponse::release_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
 
   _impl_._has_bits_[0] &= ~0x00000001u;
@@ -11660,16 +13381,16 @@ inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::release_c
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return released;
 }
-inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::unsafe_arena_release_camera_result() {
+inline ::mavcam::rpc::camera::CameraResult* StartBurstResponse::unsafe_arena_release_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.StartBurstResponse.camera_result)
 
   _impl_._has_bits_[0] &= ~0x00000001u;
   ::mavcam::rpc::camera::CameraResult* temp = _impl_.camera_result_;
   _impl_.camera_result_ = nullptr;
   return temp;
 }
-inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::_internal_mutable_camera_result() {
+inline ::mavcam::rpc::camera::CameraResult* StartBurstResponse::_internal_mutable_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_._has_bits_[0] |= 0x00000001u;
   if (_impl_.camera_result_ == nullptr) {
@@ -11678,12 +13399,12 @@ inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::_internal
   }
   return _impl_.camera_result_;
 }
-inline ::mavcam::rpc::camera::CameraResult* StopPhotoIntervalResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline ::mavcam::rpc::camera::CameraResult* StartBurstResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
   ::mavcam::rpc::camera::CameraResult* _msg = _internal_mutable_camera_result();
-  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.StartBurstResponse.camera_result)
   return _msg;
 }
-inline void StopPhotoIntervalResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+inline void StartBurstResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
   ::google::protobuf::Arena* message_arena = GetArena();
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (message_arena == nullptr) {
@@ -11701,7 +13422,7 @@ inline void StopPhotoIntervalResponse::set_allocated_camera_result(::mavcam::rpc
   }
 
   _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
-  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.StopPhotoIntervalResponse.camera_result)
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.StartBurstResponse.camera_result)
 }
 
 // -------------------------------------------------------------------
@@ -13007,25 +14728,278 @@ inline const ::mavcam::rpc::camera::Setting& SetSettingRequest::setting() const
   // @@protoc_insertion_point(field_get:mavcam.rpc.camera.SetSettingRequest.setting)
   return _internal_setting();
 }
-inline void SetSettingRequest::unsafe_arena_set_allocated_setting(::mavcam::rpc::camera::Setting* value) {
+inline void SetSettingRequest::unsafe_arena_set_allocated_setting(::mavcam::rpc::camera::Setting* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.setting_);
+  }
+  _impl_.setting_ = reinterpret_cast<::mavcam::rpc::camera::Setting*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.SetSettingRequest.setting)
+}
+inline ::mavcam::rpc::camera::Setting* SetSettingRequest::release_setting() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::mavcam::rpc::camera::Setting* released = _impl_.setting_;
+  _impl_.setting_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::mavcam::rpc::camera::Setting* SetSettingRequest::unsafe_arena_release_setting() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.SetSettingRequest.setting)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::mavcam::rpc::camera::Setting* temp = _impl_.setting_;
+  _impl_.setting_ = nullptr;
+  return temp;
+}
+inline ::mavcam::rpc::camera::Setting* SetSettingRequest::_internal_mutable_setting() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.setting_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavcam::rpc::camera::Setting>(GetArena());
+    _impl_.setting_ = reinterpret_cast<::mavcam::rpc::camera::Setting*>(p);
+  }
+  return _impl_.setting_;
+}
+inline ::mavcam::rpc::camera::Setting* SetSettingRequest::mutable_setting() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::mavcam::rpc::camera::Setting* _msg = _internal_mutable_setting();
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingRequest.setting)
+  return _msg;
+}
+inline void SetSettingRequest::set_allocated_setting(::mavcam::rpc::camera::Setting* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::mavcam::rpc::camera::Setting*>(_impl_.setting_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::mavcam::rpc::camera::Setting*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.setting_ = reinterpret_cast<::mavcam::rpc::camera::Setting*>(value);
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.SetSettingRequest.setting)
+}
+
+// -------------------------------------------------------------------
+
+// SetSettingResponse
+
+// .mavcam.rpc.camera.CameraResult camera_result = 1;
+inline bool SetSettingResponse::has_camera_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.camera_result_ != nullptr);
+  return value;
+}
+inline void SetSettingResponse::clear_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.camera_result_ != nullptr) _impl_.camera_result_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::mavcam::rpc::camera::CameraResult& SetSettingResponse::_internal_camera_result() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::mavcam::rpc::camera::CameraResult* p = _impl_.camera_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavcam::rpc::camera::CameraResult&>(::mavcam::rpc::camera::_CameraResult_default_instance_);
+}
+inline const ::mavcam::rpc::camera::CameraResult& SetSettingResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.SetSettingResponse.camera_result)
+  return _internal_camera_result();
+}
+inline void SetSettingResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.camera_result_);
+  }
+  _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.SetSettingResponse.camera_result)
+}
+inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::release_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::mavcam::rpc::camera::CameraResult* released = _impl_.camera_result_;
+  _impl_.camera_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+  released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  if (GetArena() == nullptr) {
+    delete old;
+  }
+#else   // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArena() != nullptr) {
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return released;
+}
+inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::unsafe_arena_release_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.SetSettingResponse.camera_result)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::mavcam::rpc::camera::CameraResult* temp = _impl_.camera_result_;
+  _impl_.camera_result_ = nullptr;
+  return temp;
+}
+inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::_internal_mutable_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.camera_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(GetArena());
+    _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(p);
+  }
+  return _impl_.camera_result_;
+}
+inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::mavcam::rpc::camera::CameraResult* _msg = _internal_mutable_camera_result();
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingResponse.camera_result)
+  return _msg;
+}
+inline void SetSettingResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(_impl_.camera_result_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.SetSettingResponse.camera_result)
+}
+
+// -------------------------------------------------------------------
+
+// SetSettingsRequest
+
+// repeated .mavcam.rpc.camera.Setting settings = 1;
+inline int SetSettingsRequest::_internal_settings_size() const {
+  return _internal_settings().size();
+}
+inline int SetSettingsRequest::settings_size() const {
+  return _internal_settings_size();
+}
+inline void SetSettingsRequest::clear_settings() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.settings_.Clear();
+}
+inline ::mavcam::rpc::camera::Setting* SetSettingsRequest::mutable_settings(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingsRequest.settings)
+  return _internal_mutable_settings()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::Setting>* SetSettingsRequest::mutable_settings()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:mavcam.rpc.camera.SetSettingsRequest.settings)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_settings();
+}
+inline const ::mavcam::rpc::camera::Setting& SetSettingsRequest::settings(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.SetSettingsRequest.settings)
+  return _internal_settings().Get(index);
+}
+inline ::mavcam::rpc::camera::Setting* SetSettingsRequest::add_settings() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::mavcam::rpc::camera::Setting* _add = _internal_mutable_settings()->Add();
+  // @@protoc_insertion_point(field_add:mavcam.rpc.camera.SetSettingsRequest.settings)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::Setting>& SetSettingsRequest::settings() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:mavcam.rpc.camera.SetSettingsRequest.settings)
+  return _internal_settings();
+}
+inline const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::Setting>&
+SetSettingsRequest::_internal_settings() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.settings_;
+}
+inline ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::Setting>*
+SetSettingsRequest::_internal_mutable_settings() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.settings_;
+}
+
+// -------------------------------------------------------------------
+
+// SetSettingsResponse
+
+// .mavcam.rpc.camera.CameraResult camera_result = 1;
+inline bool SetSettingsResponse::has_camera_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.camera_result_ != nullptr);
+  return value;
+}
+inline void SetSettingsResponse::clear_camera_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  if (_impl_.camera_result_ != nullptr) _impl_.camera_result_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::mavcam::rpc::camera::CameraResult& SetSettingsResponse::_internal_camera_result() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  const ::mavcam::rpc::camera::CameraResult* p = _impl_.camera_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavcam::rpc::camera::CameraResult&>(::mavcam::rpc::camera::_CameraResult_default_instance_);
+}
+inline const ::mavcam::rpc::camera::CameraResult& SetSettingsResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.SetSettingsResponse.camera_result)
+  return _internal_camera_result();
+}
+inline void SetSettingsResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.setting_);
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.camera_result_);
   }
-  _impl_.setting_ = reinterpret_cast<::mavcam::rpc::camera::Setting*>(value);
+  _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
   if (value != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.SetSettingRequest.setting)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.SetSettingsResponse.camera_result)
 }
-inline ::mavcam::rpc::camera::Setting* SetSettingRequest::release_setting() {
+inline ::mavcam::rpc::camera::CameraResult* SetSettingsResponse::release_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
 
   _impl_._has_bits_[0] &= ~0x00000001u;
-  ::mavcam::rpc::camera::Setting* released = _impl_.setting_;
-  _impl_.setting_ = nullptr;
+  ::mavcam::rpc::camera::CameraResult* released = _impl_.camera_result_;
+  _impl_.camera_result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
   released = ::google::protobuf::internal::DuplicateIfNonNull(released);
@@ -13039,38 +15013,38 @@ inline ::mavcam::rpc::camera::Setting* SetSettingRequest::release_setting() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return released;
 }
-inline ::mavcam::rpc::camera::Setting* SetSettingRequest::unsafe_arena_release_setting() {
+inline ::mavcam::rpc::camera::CameraResult* SetSettingsResponse::unsafe_arena_release_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.SetSettingRequest.setting)
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.SetSettingsResponse.camera_result)
 
   _impl_._has_bits_[0] &= ~0x00000001u;
-  ::mavcam::rpc::camera::Setting* temp = _impl_.setting_;
-  _impl_.setting_ = nullptr;
+  ::mavcam::rpc::camera::CameraResult* temp = _impl_.camera_result_;
+  _impl_.camera_result_ = nullptr;
   return temp;
 }
-inline ::mavcam::rpc::camera::Setting* SetSettingRequest::_internal_mutable_setting() {
+inline ::mavcam::rpc::camera::CameraResult* SetSettingsResponse::_internal_mutable_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_._has_bits_[0] |= 0x00000001u;
-  if (_impl_.setting_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavcam::rpc::camera::Setting>(GetArena());
-    _impl_.setting_ = reinterpret_cast<::mavcam::rpc::camera::Setting*>(p);
+  if (_impl_.camera_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavcam::rpc::camera::CameraResult>(GetArena());
+    _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(p);
   }
-  return _impl_.setting_;
+  return _impl_.camera_result_;
 }
-inline ::mavcam::rpc::camera::Setting* SetSettingRequest::mutable_setting() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::mavcam::rpc::camera::Setting* _msg = _internal_mutable_setting();
-  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingRequest.setting)
+inline ::mavcam::rpc::camera::CameraResult* SetSettingsResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::mavcam::rpc::camera::CameraResult* _msg = _internal_mutable_camera_result();
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingsResponse.camera_result)
   return _msg;
 }
-inline void SetSettingRequest::set_allocated_setting(::mavcam::rpc::camera::Setting* value) {
+inline void SetSettingsResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
   ::google::protobuf::Arena* message_arena = GetArena();
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (message_arena == nullptr) {
-    delete reinterpret_cast<::mavcam::rpc::camera::Setting*>(_impl_.setting_);
+    delete reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(_impl_.camera_result_);
   }
 
   if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::mavcam::rpc::camera::Setting*>(value)->GetArena();
+    ::google::protobuf::Arena* submessage_arena = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value)->GetArena();
     if (message_arena != submessage_arena) {
       value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
     }
@@ -13079,35 +15053,88 @@ inline void SetSettingRequest::set_allocated_setting(::mavcam::rpc::camera::Sett
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
 
-  _impl_.setting_ = reinterpret_cast<::mavcam::rpc::camera::Setting*>(value);
-  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.SetSettingRequest.setting)
+  _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.SetSettingsResponse.camera_result)
+}
+
+// repeated .mavcam.rpc.camera.AppliedSetting applied_settings = 2;
+inline int SetSettingsResponse::_internal_applied_settings_size() const {
+  return _internal_applied_settings().size();
+}
+inline int SetSettingsResponse::applied_settings_size() const {
+  return _internal_applied_settings_size();
+}
+inline void SetSettingsResponse::clear_applied_settings() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.applied_settings_.Clear();
+}
+inline ::mavcam::rpc::camera::AppliedSetting* SetSettingsResponse::mutable_applied_settings(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingsResponse.applied_settings)
+  return _internal_mutable_applied_settings()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::AppliedSetting>* SetSettingsResponse::mutable_applied_settings()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:mavcam.rpc.camera.SetSettingsResponse.applied_settings)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_applied_settings();
+}
+inline const ::mavcam::rpc::camera::AppliedSetting& SetSettingsResponse::applied_settings(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.SetSettingsResponse.applied_settings)
+  return _internal_applied_settings().Get(index);
+}
+inline ::mavcam::rpc::camera::AppliedSetting* SetSettingsResponse::add_applied_settings() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::mavcam::rpc::camera::AppliedSetting* _add = _internal_mutable_applied_settings()->Add();
+  // @@protoc_insertion_point(field_add:mavcam.rpc.camera.SetSettingsResponse.applied_settings)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::AppliedSetting>& SetSettingsResponse::applied_settings() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:mavcam.rpc.camera.SetSettingsResponse.applied_settings)
+  return _internal_applied_settings();
+}
+inline const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::AppliedSetting>&
+SetSettingsResponse::_internal_applied_settings() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.applied_settings_;
+}
+inline ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::AppliedSetting>*
+SetSettingsResponse::_internal_mutable_applied_settings() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.applied_settings_;
 }
 
 // -------------------------------------------------------------------
 
-// SetSettingResponse
+// GetMetricsRequest
+
+// -------------------------------------------------------------------
+
+// GetMetricsResponse
 
 // .mavcam.rpc.camera.CameraResult camera_result = 1;
-inline bool SetSettingResponse::has_camera_result() const {
+inline bool GetMetricsResponse::has_camera_result() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.camera_result_ != nullptr);
   return value;
 }
-inline void SetSettingResponse::clear_camera_result() {
+inline void GetMetricsResponse::clear_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (_impl_.camera_result_ != nullptr) _impl_.camera_result_->Clear();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::mavcam::rpc::camera::CameraResult& SetSettingResponse::_internal_camera_result() const {
+inline const ::mavcam::rpc::camera::CameraResult& GetMetricsResponse::_internal_camera_result() const {
   PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
   const ::mavcam::rpc::camera::CameraResult* p = _impl_.camera_result_;
   return p != nullptr ? *p : reinterpret_cast<const ::mavcam::rpc::camera::CameraResult&>(::mavcam::rpc::camera::_CameraResult_default_instance_);
 }
-inline const ::mavcam::rpc::camera::CameraResult& SetSettingResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.SetSettingResponse.camera_result)
+inline const ::mavcam::rpc::camera::CameraResult& GetMetricsResponse::camera_result() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.GetMetricsResponse.camera_result)
   return _internal_camera_result();
 }
-inline void SetSettingResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+inline void GetMetricsResponse::unsafe_arena_set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.camera_result_);
@@ -13118,9 +15145,9 @@ inline void SetSettingResponse::unsafe_arena_set_allocated_camera_result(::mavca
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.SetSettingResponse.camera_result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavcam.rpc.camera.GetMetricsResponse.camera_result)
 }
-inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::release_camera_result() {
+inline ::mavcam::rpc::camera::CameraResult* GetMetricsResponse::release_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
 
   _impl_._has_bits_[0] &= ~0x00000001u;
@@ -13139,16 +15166,16 @@ inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::release_camera_r
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return released;
 }
-inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::unsafe_arena_release_camera_result() {
+inline ::mavcam::rpc::camera::CameraResult* GetMetricsResponse::unsafe_arena_release_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
-  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.SetSettingResponse.camera_result)
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.GetMetricsResponse.camera_result)
 
   _impl_._has_bits_[0] &= ~0x00000001u;
   ::mavcam::rpc::camera::CameraResult* temp = _impl_.camera_result_;
   _impl_.camera_result_ = nullptr;
   return temp;
 }
-inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::_internal_mutable_camera_result() {
+inline ::mavcam::rpc::camera::CameraResult* GetMetricsResponse::_internal_mutable_camera_result() {
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   _impl_._has_bits_[0] |= 0x00000001u;
   if (_impl_.camera_result_ == nullptr) {
@@ -13157,12 +15184,12 @@ inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::_internal_mutabl
   }
   return _impl_.camera_result_;
 }
-inline ::mavcam::rpc::camera::CameraResult* SetSettingResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline ::mavcam::rpc::camera::CameraResult* GetMetricsResponse::mutable_camera_result() ABSL_ATTRIBUTE_LIFETIME_BOUND {
   ::mavcam::rpc::camera::CameraResult* _msg = _internal_mutable_camera_result();
-  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.SetSettingResponse.camera_result)
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.GetMetricsResponse.camera_result)
   return _msg;
 }
-inline void SetSettingResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
+inline void GetMetricsResponse::set_allocated_camera_result(::mavcam::rpc::camera::CameraResult* value) {
   ::google::protobuf::Arena* message_arena = GetArena();
   PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
   if (message_arena == nullptr) {
@@ -13180,7 +15207,56 @@ inline void SetSettingResponse::set_allocated_camera_result(::mavcam::rpc::camer
   }
 
   _impl_.camera_result_ = reinterpret_cast<::mavcam::rpc::camera::CameraResult*>(value);
-  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.SetSettingResponse.camera_result)
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.GetMetricsResponse.camera_result)
+}
+
+// repeated .mavcam.rpc.camera.CallMetric call_metrics = 2;
+inline int GetMetricsResponse::_internal_call_metrics_size() const {
+  return _internal_call_metrics().size();
+}
+inline int GetMetricsResponse::call_metrics_size() const {
+  return _internal_call_metrics_size();
+}
+inline void GetMetricsResponse::clear_call_metrics() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.call_metrics_.Clear();
+}
+inline ::mavcam::rpc::camera::CallMetric* GetMetricsResponse::mutable_call_metrics(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.GetMetricsResponse.call_metrics)
+  return _internal_mutable_call_metrics()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::CallMetric>* GetMetricsResponse::mutable_call_metrics()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:mavcam.rpc.camera.GetMetricsResponse.call_metrics)
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  return _internal_mutable_call_metrics();
+}
+inline const ::mavcam::rpc::camera::CallMetric& GetMetricsResponse::call_metrics(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.GetMetricsResponse.call_metrics)
+  return _internal_call_metrics().Get(index);
+}
+inline ::mavcam::rpc::camera::CallMetric* GetMetricsResponse::add_call_metrics() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ::mavcam::rpc::camera::CallMetric* _add = _internal_mutable_call_metrics()->Add();
+  // @@protoc_insertion_point(field_add:mavcam.rpc.camera.GetMetricsResponse.call_metrics)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::CallMetric>& GetMetricsResponse::call_metrics() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:mavcam.rpc.camera.GetMetricsResponse.call_metrics)
+  return _internal_call_metrics();
+}
+inline const ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::CallMetric>&
+GetMetricsResponse::_internal_call_metrics() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.call_metrics_;
+}
+inline ::google::protobuf::RepeatedPtrField<::mavcam::rpc::camera::CallMetric>*
+GetMetricsResponse::_internal_mutable_call_metrics() {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return &_impl_.call_metrics_;
 }
 
 // -------------------------------------------------------------------
@@ -15874,6 +17950,304 @@ inline void SettingOptions::_internal_set_is_range(bool value) {
 
 // -------------------------------------------------------------------
 
+// AppliedSetting
+
+// .mavcam.rpc.camera.CameraResult.Result result = 1;
+inline void AppliedSetting::clear_result() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.result_ = 0;
+}
+inline ::mavcam::rpc::camera::CameraResult_Result AppliedSetting::result() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.AppliedSetting.result)
+  return _internal_result();
+}
+inline void AppliedSetting::set_result(::mavcam::rpc::camera::CameraResult_Result value) {
+  _internal_set_result(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.AppliedSetting.result)
+}
+inline ::mavcam::rpc::camera::CameraResult_Result AppliedSetting::_internal_result() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return static_cast<::mavcam::rpc::camera::CameraResult_Result>(_impl_.result_);
+}
+inline void AppliedSetting::_internal_set_result(::mavcam::rpc::camera::CameraResult_Result value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.result_ = value;
+}
+
+// string setting_id = 2;
+inline void AppliedSetting::clear_setting_id() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.setting_id_.ClearToEmpty();
+}
+inline const std::string& AppliedSetting::setting_id() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.AppliedSetting.setting_id)
+  return _internal_setting_id();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void AppliedSetting::set_setting_id(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.setting_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.AppliedSetting.setting_id)
+}
+inline std::string* AppliedSetting::mutable_setting_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_setting_id();
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.AppliedSetting.setting_id)
+  return _s;
+}
+inline const std::string& AppliedSetting::_internal_setting_id() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.setting_id_.Get();
+}
+inline void AppliedSetting::_internal_set_setting_id(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.setting_id_.Set(value, GetArena());
+}
+inline std::string* AppliedSetting::_internal_mutable_setting_id() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.setting_id_.Mutable( GetArena());
+}
+inline std::string* AppliedSetting::release_setting_id() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.AppliedSetting.setting_id)
+  return _impl_.setting_id_.Release();
+}
+inline void AppliedSetting::set_allocated_setting_id(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.setting_id_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.setting_id_.IsDefault()) {
+          _impl_.setting_id_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.AppliedSetting.setting_id)
+}
+
+// -------------------------------------------------------------------
+
+// CallMetric
+
+// string name = 1;
+inline void CallMetric::clear_name() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& CallMetric::name() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.name)
+  return _internal_name();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void CallMetric::set_name(Arg_&& arg,
+                                                     Args_... args) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.name)
+}
+inline std::string* CallMetric::mutable_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:mavcam.rpc.camera.CallMetric.name)
+  return _s;
+}
+inline const std::string& CallMetric::_internal_name() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.name_.Get();
+}
+inline void CallMetric::_internal_set_name(const std::string& value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.name_.Set(value, GetArena());
+}
+inline std::string* CallMetric::_internal_mutable_name() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  return _impl_.name_.Mutable( GetArena());
+}
+inline std::string* CallMetric::release_name() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  // @@protoc_insertion_point(field_release:mavcam.rpc.camera.CallMetric.name)
+  return _impl_.name_.Release();
+}
+inline void CallMetric::set_allocated_name(std::string* value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.name_.SetAllocated(value, GetArena());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.name_.IsDefault()) {
+          _impl_.name_.Set("", GetArena());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mavcam.rpc.camera.CallMetric.name)
+}
+
+// uint64 count = 2;
+inline void CallMetric::clear_count() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.count_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::count() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.count)
+  return _internal_count();
+}
+inline void CallMetric::set_count(::uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.count)
+}
+inline ::uint64_t CallMetric::_internal_count() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.count_;
+}
+inline void CallMetric::_internal_set_count(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.count_ = value;
+}
+
+// uint64 error_count = 3;
+inline void CallMetric::clear_error_count() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.error_count_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::error_count() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.error_count)
+  return _internal_error_count();
+}
+inline void CallMetric::set_error_count(::uint64_t value) {
+  _internal_set_error_count(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.error_count)
+}
+inline ::uint64_t CallMetric::_internal_error_count() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.error_count_;
+}
+inline void CallMetric::_internal_set_error_count(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.error_count_ = value;
+}
+
+// uint64 total_latency_us = 4;
+inline void CallMetric::clear_total_latency_us() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.total_latency_us_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::total_latency_us() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.total_latency_us)
+  return _internal_total_latency_us();
+}
+inline void CallMetric::set_total_latency_us(::uint64_t value) {
+  _internal_set_total_latency_us(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.total_latency_us)
+}
+inline ::uint64_t CallMetric::_internal_total_latency_us() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.total_latency_us_;
+}
+inline void CallMetric::_internal_set_total_latency_us(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.total_latency_us_ = value;
+}
+
+// uint64 max_latency_us = 5;
+inline void CallMetric::clear_max_latency_us() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.max_latency_us_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::max_latency_us() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.max_latency_us)
+  return _internal_max_latency_us();
+}
+inline void CallMetric::set_max_latency_us(::uint64_t value) {
+  _internal_set_max_latency_us(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.max_latency_us)
+}
+inline ::uint64_t CallMetric::_internal_max_latency_us() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.max_latency_us_;
+}
+inline void CallMetric::_internal_set_max_latency_us(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.max_latency_us_ = value;
+}
+
+// uint64 p50_latency_us = 6;
+inline void CallMetric::clear_p50_latency_us() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.p50_latency_us_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::p50_latency_us() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.p50_latency_us)
+  return _internal_p50_latency_us();
+}
+inline void CallMetric::set_p50_latency_us(::uint64_t value) {
+  _internal_set_p50_latency_us(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.p50_latency_us)
+}
+inline ::uint64_t CallMetric::_internal_p50_latency_us() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.p50_latency_us_;
+}
+inline void CallMetric::_internal_set_p50_latency_us(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.p50_latency_us_ = value;
+}
+
+// uint64 p90_latency_us = 7;
+inline void CallMetric::clear_p90_latency_us() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.p90_latency_us_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::p90_latency_us() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.p90_latency_us)
+  return _internal_p90_latency_us();
+}
+inline void CallMetric::set_p90_latency_us(::uint64_t value) {
+  _internal_set_p90_latency_us(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.p90_latency_us)
+}
+inline ::uint64_t CallMetric::_internal_p90_latency_us() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.p90_latency_us_;
+}
+inline void CallMetric::_internal_set_p90_latency_us(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.p90_latency_us_ = value;
+}
+
+// uint64 p99_latency_us = 8;
+inline void CallMetric::clear_p99_latency_us() {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  _impl_.p99_latency_us_ = ::uint64_t{0u};
+}
+inline ::uint64_t CallMetric::p99_latency_us() const {
+  // @@protoc_insertion_point(field_get:mavcam.rpc.camera.CallMetric.p99_latency_us)
+  return _internal_p99_latency_us();
+}
+inline void CallMetric::set_p99_latency_us(::uint64_t value) {
+  _internal_set_p99_latency_us(value);
+  // @@protoc_insertion_point(field_set:mavcam.rpc.camera.CallMetric.p99_latency_us)
+}
+inline ::uint64_t CallMetric::_internal_p99_latency_us() const {
+  PROTOBUF_TSAN_READ(&_impl_._tsan_detect_race);
+  return _impl_.p99_latency_us_;
+}
+inline void CallMetric::_internal_set_p99_latency_us(::uint64_t value) {
+  PROTOBUF_TSAN_WRITE(&_impl_._tsan_detect_race);
+  ;
+  _impl_.p99_latency_us_ = value;
+}
+
+// -------------------------------------------------------------------
+
 // Information
 
 // string vendor_name = 1;
@@ -5,6 +5,7 @@
 #include "camera_local_client.h"
 #ifdef ENABLE_SERVER
 #include "camera_rpc_client.h"
+#include "mav_server/mav_server.h"
 #endif
 
 namespace mavcam {
@@ -13,10 +14,10 @@ CameraClient *CreateLocalCameraClient() {
     return new CameraLocalClient();
 }
 
-CameraClient *CreateRpcCameraClient(int rpc_port) {
+CameraClient *CreateRpcCameraClient(int rpc_port, const std::string &rpc_socket) {
 #ifdef ENABLE_SERVER
     CameraRpcClient *client = new CameraRpcClient();
-    bool ret = client->init(rpc_port);
+    bool ret = client->init(rpc_port, rpc_socket);
     if (!ret) {
         delete client;
         return nullptr;
@@ -28,4 +29,20 @@ CameraClient *CreateRpcCameraClient(int rpc_port) {
 #endif
 }
 
+CameraClient *CreateEmbeddedCameraClient(MavServer *server) {
+#ifdef ENABLE_SERVER
+    // same rpc contract as the remote server, without the socket round trips
+    CameraRpcClient *client = new CameraRpcClient();
+    bool ret = client->init(server->in_process_channel());
+    if (!ret) {
+        delete client;
+        return nullptr;
+    }
+    return client;
+#else
+    base::LogError() << "Cannot embed rpc server when disable server build";
+    return nullptr;
+#endif
+}
+
 }  // namespace mavcam
@@ -3,10 +3,13 @@
 #include <mavsdk/plugins/camera/camera.h>
 #include <mavsdk/plugins/camera_server/camera_server.h>
 
+#include <string>
 #include <vector>
 
 namespace mavcam {
 
+class MavServer;
+
 class CameraClient {
 public:
     virtual ~CameraClient() {}
@@ -39,9 +42,15 @@ public:  // settings
     virtual mavsdk::CameraServer::Result set_setting(mavsdk::Camera::Setting setting) = 0;
     virtual std::pair<mavsdk::CameraServer::Result, mavsdk::Camera::Setting> get_setting(
         mavsdk::Camera::Setting setting) const = 0;
+    /**
+     * @brief apply all settings in one call, the second value holds one result per setting
+     */
+    virtual std::pair<mavsdk::CameraServer::Result, std::vector<mavsdk::CameraServer::Result>>
+    set_settings(std::vector<mavsdk::Camera::Setting> settings) = 0;
 };
 
 CameraClient *CreateLocalCameraClient();
-CameraClient *CreateRpcCameraClient(int rpc_port);
+CameraClient *CreateRpcCameraClient(int rpc_port, const std::string &rpc_socket);
+CameraClient *CreateEmbeddedCameraClient(MavServer *server);
 
 }  // namespace mavcam
@@ -21,6 +21,7 @@ CameraLocalClient::CameraLocalClient() {
     _settings[kCameraModeName] = "0";
     _settings["CAM_DISPLAY_MODE"] = "0";
     _settings["CAM_PHOTO_RES"] = "1";
+    _settings["CAM_BURST"] = "1";
     _settings["CAM_WBMODE"] = "4";
     _settings["CAM_EXPMODE"] = "0";
     _settings["CAM_EV"] = "1";
@@ -37,14 +38,19 @@ CameraLocalClient::CameraLocalClient() {
 CameraLocalClient::~CameraLocalClient() {}
 
 mavsdk::CameraServer::Result CameraLocalClient::take_photo(int index) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    base::LogDebug() << "locally call take photo " << index;
-    _is_capture_in_progress = true;
-    auto result = mavsdk::CameraServer::Result::Success;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        base::LogDebug() << "locally call take photo " << index;
+        if (_is_capture_in_progress) {
+            return mavsdk::CameraServer::Result::Busy;
+        }
+        _is_capture_in_progress = true;
+    }
+    // the simulated exposure does not hold the other calls
     std::this_thread::sleep_for(std::chrono::seconds(1));
-    _is_capture_in_progress = false;
     _image_count++;
-    return result;
+    _is_capture_in_progress = false;
+    return mavsdk::CameraServer::Result::Success;
 }
 
 mavsdk::CameraServer::Result CameraLocalClient::start_video() {
@@ -101,6 +107,7 @@ mavsdk::CameraServer::Result CameraLocalClient::reset_settings() {
     _settings[kCameraModeName] = "0";
     _settings["CAM_DISPLAY_MODE"] = "0";
     _settings["CAM_PHOTO_RES"] = "1";
+    _settings["CAM_BURST"] = "1";
     _settings["CAM_WBMODE"] = "0";
     _settings["CAM_EXPMODE"] = "0";
     _settings["CAM_EV"] = "0";
@@ -236,6 +243,25 @@ mavsdk::CameraServer::Result CameraLocalClient::set_setting(mavsdk::Camera::Sett
     return mavsdk::CameraServer::Result::Success;
 }
 
+std::pair<mavsdk::CameraServer::Result, std::vector<mavsdk::CameraServer::Result>>
+CameraLocalClient::set_settings(std::vector<mavsdk::Camera::Setting> settings) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto result = mavsdk::CameraServer::Result::Success;
+    std::vector<mavsdk::CameraServer::Result> results;
+    for (const auto &setting : settings) {
+        base::LogDebug() << "change " << setting.setting_id << " to " << setting.option.option_id;
+        if (_settings.count(setting.setting_id) == 0) {
+            base::LogError() << "Unsupport setting " << setting.setting_id;
+            results.push_back(mavsdk::CameraServer::Result::WrongArgument);
+            result = mavsdk::CameraServer::Result::Error;
+            continue;
+        }
+        _settings[setting.setting_id] = setting.option.option_id;
+        results.push_back(mavsdk::CameraServer::Result::Success);
+    }
+    return {result, results};
+}
+
 std::pair<mavsdk::CameraServer::Result, mavsdk::Camera::Setting> CameraLocalClient::get_setting(
     mavsdk::Camera::Setting setting) const {
     if (_settings.count(setting.setting_id) == 0) {
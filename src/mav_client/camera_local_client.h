@@ -41,6 +41,8 @@ public:  // settings
     mavsdk::CameraServer::Result set_setting(mavsdk::Camera::Setting setting) override;
     std::pair<mavsdk::CameraServer::Result, mavsdk::Camera::Setting> get_setting(
         mavsdk::Camera::Setting setting) const override;
+    std::pair<mavsdk::CameraServer::Result, std::vector<mavsdk::CameraServer::Result>>
+    set_settings(std::vector<mavsdk::Camera::Setting> settings) override;
 private:
     mavsdk::Camera::Setting build_setting(std::string name, std::string value);
 private:
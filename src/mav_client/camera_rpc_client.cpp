@@ -1,8 +1,14 @@
 #include "camera_rpc_client.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <grpcpp/impl/client_unary_call.h>
+
 #include <chrono>
 #include <string>
+#include <vector>
 
+#include "base/enum_table.h"
 #include "base/log.h"
 #include "camera/camera.pb.h"
 
@@ -10,6 +16,20 @@ namespace mavcam {
 
 static std::string kCameraModeName = "CAM_MODE";
 
+// on a cold boot the server may come up long after the client
+const auto kServerStartupTimeout = std::chrono::seconds(60);
+const auto kConnectPollInterval = std::chrono::milliseconds(100);
+const auto kHealthCheckTimeout = std::chrono::seconds(1);
+// the default reconnect backoff grows to two minutes while the server is still booting
+const int kMinReconnectBackoffMs = 100;
+const int kMaxReconnectBackoffMs = 1000;
+const char kHealthCheckMethod[] = "/grpc.health.v1.Health/Check";
+// HealthCheckResponse.status is field 1 as varint, SERVING is 1
+const uint32_t kServingStatusTag = 8;
+const uint32_t kServingStatusServing = 1;
+
+static bool is_server_serving(const std::shared_ptr<grpc::Channel> &channel);
+
 static mavsdk::CameraServer::Result translateFromRpcResult(
     const mavcam::rpc::camera::CameraResult_Result result);
 static mavcam::rpc::camera::Mode translateFromCameraServerMode(
@@ -46,33 +66,27 @@ CameraRpcClient::~CameraRpcClient() {
     stop();
 }
 
-bool CameraRpcClient::init(int rpc_port) {
-    std::string target = "0.0.0.0:" + std::to_string(rpc_port);
-    // the channel isn't authenticated
-    _channel = grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
-    _stub = mavcam::rpc::camera::CameraService::NewStub(_channel);
-
-    // call prepare to init mav camera
-    mavcam::rpc::camera::PrepareRequest request;
-    grpc::ClientContext context;
-    mavcam::rpc::camera::PrepareResponse response;
-    grpc::Status status = _stub->Prepare(&context, request, &response);
-    if (!status.ok()) {
-        base::LogError() << "Call rpc prepare failed with errorcode: " << status.error_code();
-        return false;
+bool CameraRpcClient::init(int rpc_port, const std::string &rpc_socket) {
+    // both transports are watched at once, the socket wins when both are ready
+    std::vector<std::string> targets;
+    if (!rpc_socket.empty()) {
+        targets.push_back("unix:" + rpc_socket);
     }
-    auto result = response.camera_result().result();
-    if (result == mavcam::rpc::camera::CameraResult::RESULT_SUCCESS) {
-        base::LogInfo() << "Camera is ready";
-    } else {
-        base::LogError() << "Camera is not ready, just return";
+    targets.push_back("0.0.0.0:" + std::to_string(rpc_port));
+    std::string target;
+    auto channel = wait_for_server(targets, target);
+    if (channel == nullptr || !prepare(channel, target)) {
         return false;
     }
+    start_work_thread();
+    return true;
+}
 
-    _init_information = false;
-    _image_count = 0;
-    _should_exit = false;
-    _work_thread = new std::thread(work_thread, this);
+bool CameraRpcClient::init(std::shared_ptr<grpc::Channel> channel) {
+    if (channel == nullptr || !prepare(channel, "in process channel")) {
+        return false;
+    }
+    start_work_thread();
     return true;
 }
 
@@ -254,6 +268,8 @@ mavsdk::CameraServer::Result CameraRpcClient::fill_information(
         if (information_reader->Read(&response)) {
             fillInformation(response.information(), _information);
         }
+        // the stream stays open for updates, only the current value is needed
+        context.TryCancel();
         information_reader->Finish();
         _init_information = true;
     }
@@ -273,6 +289,7 @@ mavsdk::CameraServer::Result CameraRpcClient::fill_video_stream_info(
         if (video_stream_info_reader->Read(&response)) {
             fillVideoStreamInfos(response.video_stream_infos(), _video_stream_infos);
         }
+        context.TryCancel();
         video_stream_info_reader->Finish();
 
         _init_video_stream_info = true;
@@ -330,6 +347,7 @@ mavsdk::CameraServer::Result CameraRpcClient::retrieve_current_settings(
                 buildSettings(setting.setting_id(), setting.option().option_id()));
         }
     }
+    context.TryCancel();
     _current_settings_reader->Finish();
     return mavsdk::CameraServer::Result::Success;
 }
@@ -390,8 +408,126 @@ std::pair<mavsdk::CameraServer::Result, mavsdk::Camera::Setting> CameraRpcClient
     return {mavsdk::CameraServer::Result::Success, setting};
 }
 
+std::pair<mavsdk::CameraServer::Result, std::vector<mavsdk::CameraServer::Result>>
+CameraRpcClient::set_settings(std::vector<mavsdk::Camera::Setting> settings) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    base::LogDebug() << "rpc call set " << settings.size() << " settings";
+
+    mavcam::rpc::camera::SetSettingsRequest request;
+    for (const auto &setting : settings) {
+        auto *rpc_setting = request.add_settings();
+        rpc_setting->set_setting_id(setting.setting_id);
+        rpc_setting->mutable_option()->set_option_id(setting.option.option_id);
+    }
+
+    grpc::ClientContext context;
+    mavcam::rpc::camera::SetSettingsResponse response;
+    grpc::Status status = _stub->SetSettings(&context, request, &response);
+    if (!status.ok()) {
+        base::LogError() << "call rpc set_settings failed with errorcode: " << status.error_code();
+        return {mavsdk::CameraServer::Result::NoSystem, {}};
+    }
+
+    // applied settings come back in request order
+    std::vector<mavsdk::CameraServer::Result> results;
+    for (int i = 0; i < response.applied_settings_size(); i++) {
+        auto result = translateFromRpcResult(response.applied_settings(i).result());
+        results.push_back(result);
+        // sync current camera mode
+        if (result == mavsdk::CameraServer::Result::Success &&
+            i < static_cast<int>(settings.size()) && settings[i].setting_id == kCameraModeName) {
+            if (settings[i].option.option_id == "0") {
+                _current_mode = mavsdk::CameraServer::Mode::Photo;
+            } else {
+                _current_mode = mavsdk::CameraServer::Mode::Video;
+            }
+        }
+    }
+
+    base::LogDebug() << "Set settings result : " << response.camera_result().result_str();
+    return {translateFromRpcResult(response.camera_result().result()), results};
+}
+
+std::shared_ptr<grpc::Channel> CameraRpcClient::wait_for_server(
+    const std::vector<std::string> &targets, std::string &ready_target) {
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, kMinReconnectBackoffMs);
+    args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, kMinReconnectBackoffMs);
+    args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, kMaxReconnectBackoffMs);
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (const auto &target : targets) {
+        // the channel isn't authenticated
+        channels.push_back(
+            grpc::CreateCustomChannel(target, grpc::InsecureChannelCredentials(), args));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + kServerStartupTimeout;
+    bool waiting_logged = false;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (size_t i = 0; i < channels.size(); i++) {
+            // returns as soon as the channel state turns ready
+            if (!channels[i]->WaitForConnected(std::chrono::system_clock::now() +
+                                               kConnectPollInterval)) {
+                continue;
+            }
+            if (is_server_serving(channels[i])) {
+                ready_target = targets[i];
+                return channels[i];
+            }
+            // connected but not serving yet, don't spin on it
+            std::this_thread::sleep_for(kConnectPollInterval);
+        }
+        if (!waiting_logged) {
+            base::LogInfo() << "Waiting for rpc server to be ready";
+            waiting_logged = true;
+        }
+    }
+    base::LogError() << "Rpc server is not ready after "
+                     << std::chrono::duration_cast<std::chrono::seconds>(kServerStartupTimeout)
+                            .count()
+                     << "s";
+    return nullptr;
+}
+
+bool CameraRpcClient::prepare(std::shared_ptr<grpc::Channel> channel, const std::string &target) {
+    _channel = channel;
+    _stub = mavcam::rpc::camera::CameraService::NewStub(_channel);
+
+    // call prepare to init mav camera
+    mavcam::rpc::camera::PrepareRequest request;
+    grpc::ClientContext context;
+    mavcam::rpc::camera::PrepareResponse response;
+    grpc::Status status = _stub->Prepare(&context, request, &response);
+    if (!status.ok()) {
+        base::LogError() << "Call rpc prepare on " << target
+                         << " failed with errorcode: " << status.error_code();
+        return false;
+    }
+    auto result = response.camera_result().result();
+    if (result != mavcam::rpc::camera::CameraResult::RESULT_SUCCESS) {
+        // the server answered, another transport will not help
+        base::LogError() << "Camera is not ready, just return";
+        return false;
+    }
+    base::LogInfo() << "Camera is ready on " << target;
+    return true;
+}
+
+void CameraRpcClient::start_work_thread() {
+    _init_information = false;
+    _image_count = 0;
+    _should_exit = false;
+    _work_thread = new std::thread(work_thread, this);
+}
+
 void CameraRpcClient::stop() {
-    _should_exit = true;
+    {
+        std::lock_guard<std::mutex> lock(_status_context_mutex);
+        _should_exit = true;
+        if (_status_context != nullptr) {
+            _status_context->TryCancel();
+        }
+    }
     if (_work_thread != nullptr) {
         _work_thread->join();
         delete _work_thread;
@@ -403,98 +539,174 @@ void CameraRpcClient::work_thread(CameraRpcClient *self) {
     while (!self->_should_exit) {
         mavcam::rpc::camera::SubscribeStatusRequest request;
         grpc::ClientContext context;
+        {
+            std::lock_guard<std::mutex> lock(self->_status_context_mutex);
+            if (self->_should_exit) {
+                break;
+            }
+            self->_status_context = &context;
+        }
         auto status_reader = self->_stub->SubscribeStatus(&context, request);
 
+        // the server pushes a new status every time it changes
         mavcam::rpc::camera::StatusResponse response;
-        if (status_reader->Read(&response)) {
+        while (status_reader->Read(&response)) {
             fillStorageInformation(response.camera_status(), self->_storage_information);
             fillCaptureStatus(response.camera_status(), self->_capture_status);
             // TODO need change
             self->_capture_status.image_count = self->_image_count;
         }
-        status_reader->Finish();
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        auto status = status_reader->Finish();
+        {
+            std::lock_guard<std::mutex> lock(self->_status_context_mutex);
+            self->_status_context = nullptr;
+        }
+        if (!self->_should_exit) {
+            base::LogWarn() << "Status stream closed with errorcode: " << status.error_code()
+                            << ", subscribe again";
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        }
     }
 }
 
+static bool is_server_serving(const std::shared_ptr<grpc::Channel> &channel) {
+    // an empty HealthCheckRequest asks for the server as a whole, the health stubs aren't
+    // generated here so the call goes out as raw bytes
+    grpc::Slice request_slice(std::string{});
+    grpc::ByteBuffer request(&request_slice, 1);
+    grpc::ByteBuffer response;
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + kHealthCheckTimeout);
+    auto status = grpc::internal::BlockingUnaryCall<grpc::ByteBuffer, grpc::ByteBuffer,
+                                                    grpc::ByteBuffer, grpc::ByteBuffer>(
+        channel.get(),
+        grpc::internal::RpcMethod(kHealthCheckMethod, grpc::internal::RpcMethod::NORMAL_RPC),
+        &context, request, &response);
+    if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+        // a server without health service is ready once it is connected
+        return true;
+    }
+    if (!status.ok()) {
+        base::LogDebug() << "Health check failed with errorcode: " << status.error_code();
+        return false;
+    }
+
+    std::vector<grpc::Slice> slices;
+    if (!response.Dump(&slices).ok()) {
+        return false;
+    }
+    std::string data;
+    for (const auto &slice : slices) {
+        data.append(reinterpret_cast<const char *>(slice.begin()), slice.size());
+    }
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t *>(data.data()),
+                                                 static_cast<int>(data.size()));
+    uint32_t serving_status = 0;
+    for (auto tag = input.ReadTag(); tag != 0; tag = input.ReadTag()) {
+        if (tag == kServingStatusTag) {
+            if (!input.ReadVarint32(&serving_status)) {
+                return false;
+            }
+        } else if (!google::protobuf::internal::WireFormatLite::SkipField(&input, tag)) {
+            return false;
+        }
+    }
+    return serving_status == kServingStatusServing;
+}
+
+static constexpr base::EnumEntry<mavsdk::CameraServer::Result,
+                                 mavcam::rpc::camera::CameraResult_Result>
+    kResultTable[] = {
+    {mavsdk::CameraServer::Result::Unknown,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_UNKNOWN,
+     "Unknown"},
+    {mavsdk::CameraServer::Result::Success,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_SUCCESS,
+     "Success"},
+    {mavsdk::CameraServer::Result::InProgress,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_IN_PROGRESS,
+     "In Progress"},
+    {mavsdk::CameraServer::Result::Busy,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_BUSY,
+     "Busy"},
+    {mavsdk::CameraServer::Result::Denied,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_DENIED,
+     "Denied"},
+    {mavsdk::CameraServer::Result::Error,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_ERROR,
+     "Error"},
+    {mavsdk::CameraServer::Result::Timeout,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_TIMEOUT,
+     "Timeout"},
+    {mavsdk::CameraServer::Result::WrongArgument,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_WRONG_ARGUMENT,
+     "Wrong Argument"},
+    {mavsdk::CameraServer::Result::NoSystem,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_NO_SYSTEM,
+     "No System"},
+};
+
 static mavsdk::CameraServer::Result translateFromRpcResult(
     const mavcam::rpc::camera::CameraResult_Result result) {
-    switch (result) {
-        default:
-            base::LogError() << "Unknown result enum value: " << static_cast<int>(result);
-        // FALLTHROUGH
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_UNKNOWN:
-            return mavsdk::CameraServer::Result::Unknown;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_SUCCESS:
-            return mavsdk::CameraServer::Result::Success;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_IN_PROGRESS:
-            return mavsdk::CameraServer::Result::InProgress;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_BUSY:
-            return mavsdk::CameraServer::Result::Busy;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_DENIED:
-            return mavsdk::CameraServer::Result::Denied;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_ERROR:
-            return mavsdk::CameraServer::Result::Error;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_TIMEOUT:
-            return mavsdk::CameraServer::Result::Timeout;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_WRONG_ARGUMENT:
-            return mavsdk::CameraServer::Result::WrongArgument;
-        case mavcam::rpc::camera::CameraResult_Result_RESULT_NO_SYSTEM:
-            return mavsdk::CameraServer::Result::NoSystem;
-    }
+    return base::enum_from_rpc(kResultTable, result);
 }
 
+static constexpr base::EnumEntry<mavsdk::CameraServer::Mode, mavcam::rpc::camera::Mode>
+    kModeTable[] = {
+    {mavsdk::CameraServer::Mode::Unknown, mavcam::rpc::camera::Mode::MODE_UNKNOWN, "Unknown"},
+    {mavsdk::CameraServer::Mode::Photo, mavcam::rpc::camera::Mode::MODE_PHOTO, "Photo"},
+    {mavsdk::CameraServer::Mode::Video, mavcam::rpc::camera::Mode::MODE_VIDEO, "Video"},
+};
+
 static mavcam::rpc::camera::Mode translateFromCameraServerMode(
     const mavsdk::CameraServer::Mode server_mode) {
-    switch (server_mode) {
-        default:
-            base::LogError() << "Unknown enum value: " << static_cast<int>(server_mode);
-        // FALLTHROUGH
-        case mavsdk::CameraServer::Mode::Photo:
-            return mavcam::rpc::camera::Mode::MODE_PHOTO;
-        case mavsdk::CameraServer::Mode::Video:
-            return mavcam::rpc::camera::Mode::MODE_VIDEO;
-        case mavsdk::CameraServer::Mode::Unknown:
-            return mavcam::rpc::camera::Mode::MODE_UNKNOWN;
-    }
-}
+    return base::enum_to_rpc(kModeTable, server_mode);
+}
+
+static constexpr base::EnumEntry<mavsdk::CameraServer::Information::CameraCapFlags,
+                                 mavcam::rpc::camera::Information::CameraCapFlags>
+    kCameraCapFlagsTable[] = {
+    {mavsdk::CameraServer::Information::CameraCapFlags::CaptureVideo,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_VIDEO,
+     "Capture Video"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::CaptureImage,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_IMAGE,
+     "Capture Image"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasModes,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_MODES,
+     "Has Modes"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::CanCaptureImageInVideoMode,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_IMAGE_IN_VIDEO_MODE,
+     "Can Capture Image In Video Mode"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::CanCaptureVideoInImageMode,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_VIDEO_IN_IMAGE_MODE,
+     "Can Capture Video In Image Mode"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasImageSurveyMode,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_IMAGE_SURVEY_MODE,
+     "Has Image Survey Mode"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasBasicZoom,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_ZOOM,
+     "Has Basic Zoom"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasBasicFocus,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_FOCUS,
+     "Has Basic Focus"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasVideoStream,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_VIDEO_STREAM,
+     "Has Video Stream"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasTrackingPoint,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_POINT,
+     "Has Tracking Point"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasTrackingRectangle,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_RECTANGLE,
+     "Has Tracking Rectangle"},
+    {mavsdk::CameraServer::Information::CameraCapFlags::HasTrackingGeoStatus,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_GEO_STATUS,
+     "Has Tracking Geo Status"},
+};
 
 static mavsdk::CameraServer::Information::CameraCapFlags translateFromRpcCameraCapFlags(
     const mavcam::rpc::camera::Information::CameraCapFlags camera_cap_flags) {
-    switch (camera_cap_flags) {
-        default:
-            base::LogError() << "Unknown camera_cap_flags enum value: "
-                             << static_cast<int>(camera_cap_flags);
-        // FALLTHROUGH
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_VIDEO:
-            return mavsdk::CameraServer::Information::CameraCapFlags::CaptureVideo;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_IMAGE:
-            return mavsdk::CameraServer::Information::CameraCapFlags::CaptureImage;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_MODES:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasModes;
-        case mavcam::rpc::camera::
-            Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_IMAGE_IN_VIDEO_MODE:
-            return mavsdk::CameraServer::Information::CameraCapFlags::CanCaptureImageInVideoMode;
-        case mavcam::rpc::camera::
-            Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_VIDEO_IN_IMAGE_MODE:
-            return mavsdk::CameraServer::Information::CameraCapFlags::CanCaptureVideoInImageMode;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_IMAGE_SURVEY_MODE:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasImageSurveyMode;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_ZOOM:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasBasicZoom;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_FOCUS:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasBasicFocus;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_VIDEO_STREAM:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasVideoStream;
-        case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_POINT:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasTrackingPoint;
-        case mavcam::rpc::camera::
-            Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_RECTANGLE:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasTrackingRectangle;
-        case mavcam::rpc::camera::
-            Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_GEO_STATUS:
-            return mavsdk::CameraServer::Information::CameraCapFlags::HasTrackingGeoStatus;
-    }
+    return base::enum_from_rpc(kCameraCapFlagsTable, camera_cap_flags);
 }
 
 static void fillInformation(const mavcam::rpc::camera::Information &input,
@@ -557,6 +769,9 @@ static void fillCaptureStatus(const mavcam::rpc::camera::Status &input,
                               mavsdk::CameraServer::CaptureStatus &output) {
     output.recording_time_s = input.recording_time_s();
     output.available_capacity_mib = input.available_storage_mib();
+    output.image_status = input.photo_interval_on()
+                            ? mavsdk::CameraServer::CaptureStatus::ImageStatus::IntervalInProgress
+                            : mavsdk::CameraServer::CaptureStatus::ImageStatus::Idle;
     output.video_status = input.video_on()
                             ? mavsdk::CameraServer::CaptureStatus::VideoStatus::CaptureInProgress
                             : mavsdk::CameraServer::CaptureStatus::VideoStatus::Idle;
@@ -584,77 +799,90 @@ std::unique_ptr<mavcam::rpc::camera::Setting> createRPCSetting(
     return setting;
 }
 
+static constexpr base::EnumEntry<mavsdk::CameraServer::VideoStreamInfo::VideoStreamStatus,
+                                 mavcam::rpc::camera::VideoStreamInfo::VideoStreamStatus>
+    kVideoStreamStatusTable[] = {
+    {mavsdk::CameraServer::VideoStreamInfo::VideoStreamStatus::NotRunning,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING,
+     "Not Running"},
+    {mavsdk::CameraServer::VideoStreamInfo::VideoStreamStatus::InProgress,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS,
+     "In Progress"},
+};
+
 static mavsdk::CameraServer::VideoStreamInfo::VideoStreamStatus translateFromRpcVideoStreamStatus(
     const mavcam::rpc::camera::VideoStreamInfo::VideoStreamStatus video_stream_status) {
-    switch (video_stream_status) {
-        default:
-            base::LogError() << "Unknown video_stream_status enum value: "
-                             << static_cast<int>(video_stream_status);
-        // FALLTHROUGH
-        case mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING:
-            return mavsdk::CameraServer::VideoStreamInfo::VideoStreamStatus::NotRunning;
-        case mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS:
-            return mavsdk::CameraServer::VideoStreamInfo::VideoStreamStatus::InProgress;
-    }
-}
+    return base::enum_from_rpc(kVideoStreamStatusTable, video_stream_status);
+}
+
+static constexpr base::EnumEntry<mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum,
+                                 mavcam::rpc::camera::VideoStreamInfo::VideoStreamSpectrum>
+    kVideoStreamSpectrumTable[] = {
+    {mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum::Unknown,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN,
+     "Unknown"},
+    {mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum::VisibleLight,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT,
+     "Visible Light"},
+    {mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum::Infrared,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED,
+     "Infrared"},
+};
 
 static mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum
 translateFromRpcVideoStreamSpectrum(
     const mavcam::rpc::camera::VideoStreamInfo::VideoStreamSpectrum video_stream_spectrum) {
-    switch (video_stream_spectrum) {
-        default:
-            base::LogError() << "Unknown video_stream_spectrum enum value: "
-                             << static_cast<int>(video_stream_spectrum);
-        // FALLTHROUGH
-        case mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN:
-            return mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum::Unknown;
-        case mavcam::rpc::camera::
-            VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT:
-            return mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum::VisibleLight;
-        case mavcam::rpc::camera::
-            VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED:
-            return mavsdk::CameraServer::VideoStreamInfo::VideoStreamSpectrum::Infrared;
-    }
-}
+    return base::enum_from_rpc(kVideoStreamSpectrumTable, video_stream_spectrum);
+}
+
+static constexpr base::EnumEntry<mavsdk::CameraServer::StorageInformation::StorageStatus,
+                                 mavcam::rpc::camera::Status::StorageStatus>
+    kStorageStatusTable[] = {
+    {mavsdk::CameraServer::StorageInformation::StorageStatus::NotAvailable,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_AVAILABLE,
+     "Not Available"},
+    {mavsdk::CameraServer::StorageInformation::StorageStatus::Unformatted,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_UNFORMATTED,
+     "Unformatted"},
+    {mavsdk::CameraServer::StorageInformation::StorageStatus::Formatted,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_FORMATTED,
+     "Formatted"},
+    {mavsdk::CameraServer::StorageInformation::StorageStatus::NotSupported,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_SUPPORTED,
+     "Not Supported"},
+};
 
 static mavsdk::CameraServer::StorageInformation::StorageStatus translateFromRpcStorageStatus(
     const mavcam::rpc::camera::Status::StorageStatus storage_status) {
-    switch (storage_status) {
-        default:
-            base::LogError() << "Unknown storage_status enum value: "
-                             << static_cast<int>(storage_status);
-        // FALLTHROUGH
-        case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_AVAILABLE:
-            return mavsdk::CameraServer::StorageInformation::StorageStatus::NotAvailable;
-        case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_UNFORMATTED:
-            return mavsdk::CameraServer::StorageInformation::StorageStatus::Unformatted;
-        case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_FORMATTED:
-            return mavsdk::CameraServer::StorageInformation::StorageStatus::Formatted;
-        case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_SUPPORTED:
-            return mavsdk::CameraServer::StorageInformation::StorageStatus::NotSupported;
-    }
-}
+    return base::enum_from_rpc(kStorageStatusTable, storage_status);
+}
+
+static constexpr base::EnumEntry<mavsdk::CameraServer::StorageInformation::StorageType,
+                                 mavcam::rpc::camera::Status::StorageType>
+    kStorageTypeTable[] = {
+    {mavsdk::CameraServer::StorageInformation::StorageType::Unknown,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_UNKNOWN,
+     "Unknown"},
+    {mavsdk::CameraServer::StorageInformation::StorageType::UsbStick,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_USB_STICK,
+     "Usb Stick"},
+    {mavsdk::CameraServer::StorageInformation::StorageType::Sd,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_SD,
+     "Sd"},
+    {mavsdk::CameraServer::StorageInformation::StorageType::Microsd,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_MICROSD,
+     "Microsd"},
+    {mavsdk::CameraServer::StorageInformation::StorageType::Hd,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_HD,
+     "Hd"},
+    {mavsdk::CameraServer::StorageInformation::StorageType::Other,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_OTHER,
+     "Other"},
+};
 
 static mavsdk::CameraServer::StorageInformation::StorageType translateFromRpcStorageType(
     const mavcam::rpc::camera::Status::StorageType storage_type) {
-    switch (storage_type) {
-        default:
-            base::LogError() << "Unknown storage_type enum value: "
-                             << static_cast<int>(storage_type);
-        // FALLTHROUGH
-        case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_UNKNOWN:
-            return mavsdk::CameraServer::StorageInformation::StorageType::Unknown;
-        case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_USB_STICK:
-            return mavsdk::CameraServer::StorageInformation::StorageType::UsbStick;
-        case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_SD:
-            return mavsdk::CameraServer::StorageInformation::StorageType::Sd;
-        case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_MICROSD:
-            return mavsdk::CameraServer::StorageInformation::StorageType::Microsd;
-        case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_HD:
-            return mavsdk::CameraServer::StorageInformation::StorageType::Hd;
-        case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_OTHER:
-            return mavsdk::CameraServer::StorageInformation::StorageType::Other;
-    }
+    return base::enum_from_rpc(kStorageTypeTable, storage_type);
 }
 
 }  // namespace mavcam
\ No newline at end of file
@@ -6,7 +6,9 @@
 #include <chrono>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "camera/camera.grpc.pb.h"
 #include "camera/camera.pb.h"
@@ -45,9 +47,27 @@ public:  // settings
     virtual mavsdk::CameraServer::Result set_setting(mavsdk::Camera::Setting setting) override;
     virtual std::pair<mavsdk::CameraServer::Result, mavsdk::Camera::Setting> get_setting(
         mavsdk::Camera::Setting setting) const override;
+    virtual std::pair<mavsdk::CameraServer::Result, std::vector<mavsdk::CameraServer::Result>>
+    set_settings(std::vector<mavsdk::Camera::Setting> settings) override;
 public:
-    bool init(int rpc_port);
+    /**
+     * @brief connect to the rpc server, a non empty rpc_socket is tried before tcp
+     */
+    bool init(int rpc_port, const std::string &rpc_socket = "");
+    /**
+     * @brief use an already connected channel, e.g. the in process channel of an embedded server
+     */
+    bool init(std::shared_ptr<grpc::Channel> channel);
 private:
+    /**
+     * @brief watch the channels until one is connected and its server reports serving
+     *
+     * Returns the first ready channel and its target, nullptr once kServerStartupTimeout passed.
+     */
+    static std::shared_ptr<grpc::Channel> wait_for_server(const std::vector<std::string> &targets,
+                                                          std::string &ready_target);
+    bool prepare(std::shared_ptr<grpc::Channel> channel, const std::string &target);
+    void start_work_thread();
     void stop();
     static void work_thread(CameraRpcClient *self);
 private:
@@ -74,6 +94,8 @@ private:
 private:  // backend work thread
     std::thread *_work_thread{nullptr};
     std::atomic<bool> _should_exit{false};
+    std::mutex _status_context_mutex{};
+    grpc::ClientContext *_status_context{nullptr};
     mutable std::mutex _mutex{};
 };
 
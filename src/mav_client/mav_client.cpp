@@ -11,21 +11,40 @@
 
 #include "base/log.h"
 #include "camera_client.h"
+#ifdef ENABLE_SERVER
+#include "mav_server/mav_server.h"
+#endif
 
 namespace mavcam {
 
 bool MavClient::init(std::string &connection_url, bool use_local, int32_t rpc_port,
-                     std::string &ftp_root_path, bool compatible_qgc) {
+                     std::string &ftp_root_path, bool compatible_qgc,
+                     const std::string &rpc_socket, bool embedded_server,
+                     const CameraConfig &camera_config) {
     // TODO need check connection url first
     _connection_url = connection_url;
     _rpc_port = rpc_port;
+    _rpc_socket = rpc_socket;
     _ftp_root_path = ftp_root_path;
     _compatible_qgc = compatible_qgc;
 
     if (use_local) {
         _camera_client = CreateLocalCameraClient();  // use local client
+    } else if (embedded_server) {
+#ifdef ENABLE_SERVER
+        _embedded_server = new MavServer();
+        _embedded_server->init(0, 0, "", 0, camera_config);
+        if (!_embedded_server->start()) {
+            delete _embedded_server;
+            _embedded_server = nullptr;
+            return false;
+        }
+        _camera_client = CreateEmbeddedCameraClient(_embedded_server);  // use in process rpc
+#else
+        base::LogError() << "Cannot embed rpc server when disable server build";
+#endif
     } else {
-        _camera_client = CreateRpcCameraClient(_rpc_port);  // use rpc client
+        _camera_client = CreateRpcCameraClient(_rpc_port, _rpc_socket);  // use rpc client
     }
     if (_camera_client == nullptr) {
         return false;
@@ -33,6 +52,20 @@ bool MavClient::init(std::string &connection_url, bool use_local, int32_t rpc_po
     return true;
 }
 
+MavClient::~MavClient() {
+    // the camera client closes its streams before the embedded server goes away
+    delete _camera_client;
+    _camera_client = nullptr;
+#ifdef ENABLE_SERVER
+    if (_embedded_server != nullptr) {
+        _embedded_server->stop_runloop();
+        _embedded_server->wait();
+        delete _embedded_server;
+        _embedded_server = nullptr;
+    }
+#endif
+}
+
 bool MavClient::start_runloop() {
     auto component_type = mavsdk::Mavsdk::ComponentType::Camera;
     if (_compatible_qgc) {
@@ -78,7 +111,14 @@ void MavClient::subscribe_camera_operation(mavsdk::CameraServer &camera_server,
         [this](int64_t time_unix_msec) { _camera_client->set_timestamp(time_unix_msec); });
 
     camera_server.subscribe_take_photo([this, &camera_server](int32_t index) {
-        _camera_client->take_photo(index);
+        // the server queues the photo, Busy while its capture queue is full
+        auto result = _camera_client->take_photo(index);
+        auto feedback = mavsdk::CameraServer::CameraFeedback::Ok;
+        if (result == mavsdk::CameraServer::Result::Busy) {
+            feedback = mavsdk::CameraServer::CameraFeedback::Busy;
+        } else if (result != mavsdk::CameraServer::Result::Success) {
+            feedback = mavsdk::CameraServer::CameraFeedback::Failed;
+        }
 
         // TODO no position info for now
         auto position = mavsdk::CameraServer::Position{};
@@ -87,8 +127,8 @@ void MavClient::subscribe_camera_operation(mavsdk::CameraServer &camera_server,
         auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
                              std::chrono::system_clock::now().time_since_epoch())
                              .count();
-        auto success = true;
-        camera_server.respond_take_photo(mavsdk::CameraServer::CameraFeedback::Ok,
+        auto success = result == mavsdk::CameraServer::Result::Success;
+        camera_server.respond_take_photo(feedback,
                                          mavsdk::CameraServer::CaptureInfo{
                                              .position = position,
                                              .attitude_quaternion = attitude,
@@ -3,6 +3,8 @@
 #include <atomic>
 #include <string>
 
+#include "mav_server/plugins/camera/camera_config.h"
+
 namespace mavsdk {
 class CameraServer;
 class ParamServer;
@@ -11,14 +13,20 @@ class ParamServer;
 namespace mavcam {
 
 class CameraClient;
+class MavServer;
 
 class MavClient {
 public:
     MavClient() {}
-    ~MavClient() {}
+    ~MavClient();
 public:
+    /**
+     * @brief embedded_server hosts the camera service in this process instead of mav_server,
+     * its camera starts with camera_config
+     */
     bool init(std::string &connection_url, bool use_local, int32_t rpc_port,
-              std::string &ftp_root_path, bool compatible_qgc);
+              std::string &ftp_root_path, bool compatible_qgc, const std::string &rpc_socket = "",
+              bool embedded_server = false, const CameraConfig &camera_config = CameraConfig());
     bool start_runloop();
     void stop_runloop();
 private:
@@ -30,7 +38,9 @@ private:
     std::atomic<bool> _running;
     std::string _connection_url;
     int32_t _rpc_port;
-    CameraClient *_camera_client;
+    std::string _rpc_socket;
+    CameraClient *_camera_client{nullptr};
+    MavServer *_embedded_server{nullptr};
     std::string _ftp_root_path;
     bool _compatible_qgc;
 };
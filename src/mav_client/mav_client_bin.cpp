@@ -1,3 +1,4 @@
+#include <chrono>
 #include <csignal>
 #include <filesystem>
 #include <fstream>
@@ -10,10 +11,18 @@
 
 static auto constexpr default_connection = "udp://192.168.251.2:14550";
 static auto constexpr default_rpc_port = 50051;
+static auto constexpr default_capture_depth = 4;
+static auto constexpr default_vendor_call_log_ms = 1500;
+static std::string default_rpc_socket = "";
 static std::string default_ftp_path = "/usr/share/mav-cam/";
 static std::string default_log_path = "/data/camera/";
 static std::fstream *default_log_stream = nullptr;
 static bool compatible_qgc = false;
+static bool embedded_server = false;
+static std::string default_store_prefix = "NDAA";
+static std::string default_capture_index = "/data/camera/capture_index";
+static std::string default_media_path = "/data/camera/";
+static std::string default_settings_file = "/data/camera/settings_snapshot";
 
 static void usage(const char *bin_name);
 static void init_log();
@@ -33,6 +42,10 @@ int main(int argc, const char *argv[]) {
     std::string connection_url = default_connection;
     int rpc_port = default_rpc_port;
     bool use_local = false;
+    // only used by the embedded server
+    mavcam::CameraConfig camera_config;
+    camera_config.capture_depth = default_capture_depth;
+    camera_config.vendor_call_log_threshold = std::chrono::milliseconds(default_vendor_call_log_ms);
 
     for (int i = 1; i < argc; i++) {
         const std::string current_arg = argv[i];
@@ -65,6 +78,13 @@ int main(int argc, const char *argv[]) {
                 return 1;
             }
             rpc_port = std::stoi(rpc_port_string);
+        } else if (current_arg == "--rpc_socket") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_rpc_socket = std::string(argv[i + 1]);
+            i++;
         } else if (current_arg == "-f" || current_arg == "--ftp_path") {
             if (argc <= i + 1) {
                 usage(argv[0]);
@@ -81,6 +101,73 @@ int main(int argc, const char *argv[]) {
             i++;
         } else if (current_arg == "--qgc") {
             compatible_qgc = true;
+        } else if (current_arg == "--embedded_server") {
+            embedded_server = true;
+        } else if (current_arg == "--capture_depth") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            const std::string capture_depth_string(argv[i + 1]);
+            if (!is_integer(capture_depth_string) || std::stoi(capture_depth_string) <= 0) {
+                usage(argv[0]);
+                return 1;
+            }
+            camera_config.capture_depth = std::stoi(capture_depth_string);
+            i++;
+        } else if (current_arg == "--vendor_call_log_ms") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            const std::string log_ms_string(argv[i + 1]);
+            if (!is_integer(log_ms_string) || std::stoi(log_ms_string) <= 0) {
+                usage(argv[0]);
+                return 1;
+            }
+            camera_config.vendor_call_log_threshold =
+                std::chrono::milliseconds(std::stoi(log_ms_string));
+            i++;
+        } else if (current_arg == "--store_prefix") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_store_prefix = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--capture_index") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_capture_index = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--media_path") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_media_path = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--settings_file") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_settings_file = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--camera_mode") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            auto camera_mode = std::string(argv[i + 1]);
+            i++;
+            if (camera_mode != "0" && camera_mode != "1") {
+                usage(argv[0]);
+                return 1;
+            }
+            camera_config.init_camera_mode = std::stoi(camera_mode);
         } else {
             std::cout << "Invalid option : " << current_arg << std::endl;
             usage(argv[0]);
@@ -88,7 +175,12 @@ int main(int argc, const char *argv[]) {
         }
     }
 
-    if (!client.init(connection_url, use_local, rpc_port, default_ftp_path, compatible_qgc)) {
+    camera_config.store_prefix = default_store_prefix;
+    camera_config.capture_index_path = default_capture_index;
+    camera_config.media_path = default_media_path;
+    camera_config.settings_snapshot_path = default_settings_file;
+    if (!client.init(connection_url, use_local, rpc_port, default_ftp_path, compatible_qgc,
+                     default_rpc_socket, embedded_server, camera_config)) {
         std::cout << "Cannot init mav client " << connection_url << std::endl;
         return 1;
     }
@@ -120,12 +212,31 @@ void usage(const char *bin_name) {
               << "\t-l             : use local client" << '\n'
               << "\t-r             : set the remote port,"
               << " (default is " << default_rpc_port << ")\n"
+              << "\t--rpc_socket   : connect over a unix domain socket, tcp port is the fallback"
+              << '\n'
               << "\t-f | --ftp_path: set the ftp root path,"
               << " (default is " << default_ftp_path << ")" << '\n'
               << "\t--log_path     : store output log to file path, default is " << default_log_path
               << '\n'
               << "\t--qgc          : work compatible with QGC(make mav_client work as Autopilot)"
-              << '\n';
+              << '\n'
+              << "\t--embedded_server : run the camera service in this process,"
+              << " no mav_server needed" << '\n'
+              << '\n'
+              << "Embedded server options, as for mav_server:" << '\n'
+              << "\t--capture_depth : photos queued before take photo answers busy,"
+              << " (default is " << default_capture_depth << ")\n"
+              << "\t--vendor_call_log_ms : log camera library calls taking this long,"
+              << " (default is " << default_vendor_call_log_ms << ")\n"
+              << "\t--store_prefix  : store folder and file prefix, default is "
+              << default_store_prefix << '\n'
+              << "\t--capture_index : file listing the photos taken, default is "
+              << default_capture_index << '\n'
+              << "\t--media_path    : folder the photos and videos are stored in, default is "
+              << default_media_path << '\n'
+              << "\t--settings_file : camera settings restored at start, default is "
+              << default_settings_file << '\n'
+              << "\t--camera_mode   : init camera mode, 0 for photo mode 1 for video mode" << '\n';
 }
 
 static void init_log() {
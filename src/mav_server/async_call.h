@@ -0,0 +1,321 @@
+#pragma once
+
+#include <google/protobuf/arena.h>
+#include <grpc++/grpc++.h>
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace mavcam {
+
+/**
+ * @brief Base of every per-RPC call object of the async server.
+ *
+ * The address of the call object is used as completion queue tag, the thread draining the
+ * queue calls proceed() with the tag it got back.
+ */
+class AsyncCall {
+public:
+    virtual ~AsyncCall() {}
+    /**
+     * @brief Advance the call after the completion queue returned its tag.
+     */
+    virtual void proceed(bool ok) = 0;
+};
+
+/**
+ * @brief Hands the handler of a received call to the thread that should run it.
+ *
+ * Returns false when it does not take the call, the handler then runs on the completion queue
+ * thread.
+ */
+using AsyncDispatcher = std::function<bool(grpc::ServerContext *, std::function<void()>)>;
+
+/**
+ * @brief Unary call object, the handler runs where the dispatcher puts it.
+ *
+ * Without a dispatcher it runs on the completion queue thread. Request and response live on a
+ * per-call arena, freed in one go with the call.
+ */
+template <typename RequestType, typename ResponseType>
+class AsyncUnaryCall final : public AsyncCall {
+public:
+    using Request = RequestType;
+    using Response = ResponseType;
+    using Responder = grpc::ServerAsyncResponseWriter<Response>;
+    using RequestMethod = std::function<void(grpc::ServerContext *, Request *, Responder *,
+                                             grpc::ServerCompletionQueue *, void *)>;
+    using Handler = std::function<grpc::Status(grpc::ServerContext *, const Request *, Response *)>;
+
+    /**
+     * @brief Create a call object waiting for the next request on the given queue.
+     */
+    static void spawn(const RequestMethod &request_method, const Handler &handler,
+                      const AsyncDispatcher &dispatcher, grpc::ServerCompletionQueue *cq) {
+        new AsyncUnaryCall(request_method, handler, dispatcher, cq);
+    }
+
+    void proceed(bool ok) override {
+        if (!ok || _finishing) {
+            // server is shutting down or the response has been sent
+            delete this;
+            return;
+        }
+        // keep one call object waiting for this method on this queue
+        spawn(_request_method, _handler, _dispatcher, _cq);
+
+        if (!_dispatcher || !_dispatcher(&_context, [this]() { run(); })) {
+            run();
+        }
+    }
+private:
+    AsyncUnaryCall(const RequestMethod &request_method, const Handler &handler,
+                   const AsyncDispatcher &dispatcher, grpc::ServerCompletionQueue *cq)
+        : _request_method(request_method),
+          _handler(handler),
+          _dispatcher(dispatcher),
+          _cq(cq),
+          _request(google::protobuf::Arena::CreateMessage<RequestType>(&_arena)),
+          _response(google::protobuf::Arena::CreateMessage<ResponseType>(&_arena)),
+          _responder(&_context) {
+        _request_method(&_context, _request, &_responder, _cq, this);
+    }
+
+    void run() {
+        auto status = _handler(&_context, _request, _response);
+        // the next proceed comes from the queue once the response is sent
+        _finishing = true;
+        _responder.Finish(*_response, status, this);
+    }
+private:
+    RequestMethod _request_method;
+    Handler _handler;
+    AsyncDispatcher _dispatcher;
+    grpc::ServerCompletionQueue *_cq;
+    grpc::ServerContext _context;
+    google::protobuf::Arena _arena;
+    RequestType *_request;
+    ResponseType *_response;
+    Responder _responder;
+    bool _finishing{false};
+};
+
+/**
+ * @brief Thread-safe writer handed to subscription callbacks of a server stream.
+ */
+template <typename ResponseType>
+class AsyncStreamWriter {
+public:
+    virtual ~AsyncStreamWriter() {}
+    /**
+     * @brief Queue one message, returns false once the stream is closed.
+     */
+    virtual bool write(const ResponseType &response) = 0;
+    /**
+     * @brief Finish the stream with this status after all queued messages are sent.
+     */
+    virtual void finish(const grpc::Status &status = grpc::Status::OK) = 0;
+    /**
+     * @brief Register the function run once the stream is done, typically to unsubscribe.
+     *
+     * Runs immediately if the stream is already done.
+     */
+    virtual void on_close(const std::function<void()> &close_handler) = 0;
+};
+
+/**
+ * @brief Server streaming call object.
+ *
+ * The handler subscribes and returns immediately, messages are written from whichever thread
+ * the subscription callback runs on. Only one write is in flight at a time, the others are
+ * queued in order. The stream stays open until the handler finishes it, the client cancels or
+ * the server shuts down.
+ */
+template <typename RequestType, typename ResponseType>
+class AsyncServerStreamCall final
+    : public AsyncCall,
+      public AsyncStreamWriter<ResponseType>,
+      public std::enable_shared_from_this<AsyncServerStreamCall<RequestType, ResponseType>> {
+public:
+    using Request = RequestType;
+    using Response = ResponseType;
+    using Responder = grpc::ServerAsyncWriter<Response>;
+    using Writer = AsyncStreamWriter<Response>;
+    using RequestMethod = std::function<void(grpc::ServerContext *, Request *, Responder *,
+                                             grpc::ServerCompletionQueue *, void *)>;
+    using Handler =
+        std::function<void(grpc::ServerContext *, const Request *, std::shared_ptr<Writer>)>;
+
+    /**
+     * @brief Create a call object waiting for the next request on the given queue.
+     */
+    static void spawn(const RequestMethod &request_method, const Handler &handler,
+                      grpc::ServerCompletionQueue *cq) {
+        std::shared_ptr<AsyncServerStreamCall> call(
+            new AsyncServerStreamCall(request_method, handler, cq));
+        // the completion queue owns the call while one of its tags is pending
+        call->_self = call;
+        // the done tag is only returned for calls that started
+        call->_context.AsyncNotifyWhenDone(&call->_done_tag);
+        call->_request_method(&call->_context, &call->_request, &call->_responder, cq,
+                              call.get());
+    }
+
+    void proceed(bool ok) override {
+        std::shared_ptr<AsyncServerStreamCall> release;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            switch (_state) {
+                case State::Waiting:
+                    if (ok) {
+                        _state = State::Streaming;
+                        break;
+                    }
+                    // server is shutting down
+                    _state = State::Closed;
+                    release = std::move(_self);
+                    return;
+                case State::Streaming:
+                    if (!ok) {
+                        // client is gone, nothing else can be sent
+                        _state = State::Closed;
+                        _queue.clear();
+                        release = close_locked();
+                        return;
+                    }
+                    _queue.pop_front();
+                    write_next();
+                    if (_done && _state == State::Streaming && _queue.empty()) {
+                        _state = State::Closed;
+                        release = close_locked();
+                    }
+                    return;
+                case State::Finishing:
+                case State::Closed:
+                    _state = State::Closed;
+                    release = close_locked();
+                    return;
+            }
+        }
+
+        spawn(_request_method, _handler, _cq);
+        _handler(&_context, &_request, this->shared_from_this());
+    }
+
+    bool write(const ResponseType &response) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_state != State::Streaming || _finish_requested || _done) {
+            return false;
+        }
+        _queue.push_back(response);
+        if (_queue.size() == 1) {
+            _responder.Write(_queue.front(), this);
+        }
+        return true;
+    }
+
+    void finish(const grpc::Status &status) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_state != State::Streaming || _finish_requested || _done) {
+            return;
+        }
+        _finish_requested = true;
+        _finish_status = status;
+        if (_queue.empty()) {
+            _state = State::Finishing;
+            _responder.Finish(_finish_status, this);
+        }
+    }
+
+    void on_close(const std::function<void()> &close_handler) override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_done) {
+                _close_handler = close_handler;
+                return;
+            }
+        }
+        close_handler();
+    }
+private:
+    /**
+     * @brief Tag returned by the completion queue once the call is done or cancelled.
+     */
+    class DoneTag final : public AsyncCall {
+    public:
+        explicit DoneTag(AsyncServerStreamCall *call) : _call(call) {}
+
+        void proceed(bool /* ok */) override { _call->on_done(); }
+    private:
+        AsyncServerStreamCall *_call;
+    };
+
+    AsyncServerStreamCall(const RequestMethod &request_method, const Handler &handler,
+                          grpc::ServerCompletionQueue *cq)
+        : _request_method(request_method),
+          _handler(handler),
+          _cq(cq),
+          _responder(&_context),
+          _done_tag(this) {}
+
+    void on_done() {
+        std::shared_ptr<AsyncServerStreamCall> release;
+        std::function<void()> close_handler;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _done = true;
+            close_handler = std::move(_close_handler);
+            _close_handler = nullptr;
+            if (_state == State::Streaming && _queue.empty()) {
+                // cancelled while idle, no other tag will come back
+                _state = State::Closed;
+            }
+            release = close_locked();
+        }
+        if (close_handler) {
+            close_handler();
+        }
+    }
+
+    // called with _mutex held, the call is released once closed and the done tag is back
+    std::shared_ptr<AsyncServerStreamCall> close_locked() {
+        if (_state == State::Closed && _done) {
+            return std::move(_self);
+        }
+        return nullptr;
+    }
+
+    // called with _mutex held after a write completed
+    void write_next() {
+        if (!_queue.empty()) {
+            _responder.Write(_queue.front(), this);
+        } else if (_finish_requested) {
+            _state = State::Finishing;
+            _responder.Finish(_finish_status, this);
+        }
+    }
+private:
+    enum class State { Waiting, Streaming, Finishing, Closed };
+
+    RequestMethod _request_method;
+    Handler _handler;
+    grpc::ServerCompletionQueue *_cq;
+    grpc::ServerContext _context;
+    RequestType _request;
+    Responder _responder;
+    DoneTag _done_tag;
+
+    std::mutex _mutex;
+    State _state{State::Waiting};
+    bool _finish_requested{false};
+    grpc::Status _finish_status;
+    bool _done{false};
+    std::function<void()> _close_handler;
+    std::deque<ResponseType> _queue;
+    std::shared_ptr<AsyncServerStreamCall> _self;
+};
+
+}  // namespace mavcam
@@ -0,0 +1,81 @@
+#include "camera_registry.h"
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include "base/log.h"
+
+namespace mavcam {
+
+CameraRegistry::~CameraRegistry() {
+    stop_workers();
+}
+
+void CameraRegistry::add(int32_t camera_id, std::shared_ptr<Camera> camera) {
+    auto &entry = _cameras[camera_id];
+    entry.camera = std::move(camera);
+    if (!entry.worker) {
+        entry.worker = std::make_unique<base::SerialWorker>();
+    }
+    base::LogInfo() << "Hosting camera " << camera_id;
+}
+
+int32_t CameraRegistry::camera_id(const grpc::ServerContext *context) const {
+    if (context == nullptr) {
+        return _selected_camera_id;
+    }
+    const auto &metadata = context->client_metadata();
+    auto it = metadata.find(kCameraIdMetadataKey);
+    if (it == metadata.end()) {
+        return _selected_camera_id;
+    }
+    const std::string value(it->second.data(), it->second.size());
+    char *end = nullptr;
+    auto camera_id = std::strtol(value.c_str(), &end, 10);
+    if (value.empty() || *end != '\0' || camera_id < 0 || camera_id > INT32_MAX) {
+        return kUnknownCameraId;
+    }
+    return static_cast<int32_t>(camera_id);
+}
+
+std::shared_ptr<Camera> CameraRegistry::camera(int32_t camera_id) const {
+    auto it = _cameras.find(camera_id);
+    if (it == _cameras.end()) {
+        return nullptr;
+    }
+    return it->second.camera;
+}
+
+std::vector<int32_t> CameraRegistry::camera_ids() const {
+    std::vector<int32_t> camera_ids;
+    camera_ids.reserve(_cameras.size());
+    for (const auto &entry : _cameras) {
+        camera_ids.push_back(entry.first);
+    }
+    return camera_ids;
+}
+
+base::SerialWorker *CameraRegistry::worker(int32_t camera_id) const {
+    auto it = _cameras.find(camera_id);
+    if (it == _cameras.end()) {
+        return nullptr;
+    }
+    return it->second.worker.get();
+}
+
+bool CameraRegistry::select(int32_t camera_id) {
+    if (_cameras.find(camera_id) == _cameras.end()) {
+        return false;
+    }
+    _selected_camera_id = camera_id;
+    return true;
+}
+
+void CameraRegistry::stop_workers() {
+    for (auto &entry : _cameras) {
+        entry.second.worker->stop();
+    }
+}
+
+}  // namespace mavcam
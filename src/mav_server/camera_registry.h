@@ -0,0 +1,69 @@
+#pragma once
+
+#include <grpc++/grpc++.h>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "base/serial_worker.h"
+#include "plugins/camera/camera.h"
+
+namespace mavcam {
+
+/**
+ * @brief Cameras hosted by the server keyed by camera id, each with its own worker thread.
+ *
+ * A call names its camera in the kCameraIdMetadataKey metadata, a call without it goes to the
+ * selected camera. Cameras are added before the server starts and are never removed, lookups
+ * take no lock.
+ */
+class CameraRegistry final {
+public:
+    static constexpr const char *kCameraIdMetadataKey = "mavcam-camera-id";
+    static constexpr int32_t kDefaultCameraId = 0;
+    static constexpr int32_t kUnknownCameraId = -1;
+
+    CameraRegistry() {}
+    ~CameraRegistry();
+public:
+    void add(int32_t camera_id, std::shared_ptr<Camera> camera);
+    /**
+     * @brief camera id the call is addressed to, kUnknownCameraId if the metadata is malformed
+     */
+    int32_t camera_id(const grpc::ServerContext *context) const;
+    /**
+     * @brief nullptr if no camera has this id
+     */
+    std::shared_ptr<Camera> camera(int32_t camera_id) const;
+    std::shared_ptr<Camera> camera(const grpc::ServerContext *context) const {
+        return camera(camera_id(context));
+    }
+    /**
+     * @brief ids of all hosted cameras in ascending order
+     */
+    std::vector<int32_t> camera_ids() const;
+    /**
+     * @brief worker of the camera, nullptr if no camera has this id
+     */
+    base::SerialWorker *worker(int32_t camera_id) const;
+    /**
+     * @brief route calls without a camera id to this camera, false if it is not hosted
+     */
+    bool select(int32_t camera_id);
+    /**
+     * @brief run the calls still queued on the workers and stop them
+     */
+    void stop_workers();
+private:
+    struct Entry {
+        std::shared_ptr<Camera> camera;
+        std::unique_ptr<base::SerialWorker> worker;
+    };
+    std::map<int32_t, Entry> _cameras;
+    std::atomic<int32_t> _selected_camera_id{kDefaultCameraId};
+};
+
+}  // namespace mavcam
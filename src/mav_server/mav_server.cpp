@@ -1,44 +1,238 @@
 #include "mav_server.h"
 
+#include <sys/un.h>
+#include <unistd.h>
+
 #include <chrono>
 #include <string>
 #include <thread>
 
+#include "async_call.h"
 #include "base/log.h"
+#include "camera_registry.h"
+#include "metrics_http_server.h"
+#include "plugins/camera/camera_async_service_impl.h"
 #include "plugins/camera/camera_impl.h"
 #include "plugins/camera/camera_service_impl.h"
+#include "rpc_metrics_interceptor.h"
 
 namespace mavcam {
 
-bool MavServer::init(int rpc_port) {
+// subscription streams stay open, cancel whatever is left after this grace period
+const auto kShutdownGracePeriod = std::chrono::seconds(1);
+
+static bool can_listen_on_socket(const std::string &socket_path) {
+    if (socket_path.size() >= sizeof(sockaddr_un::sun_path)) {
+        base::LogError() << "Socket path is too long : " << socket_path;
+        return false;
+    }
+    auto pos = socket_path.rfind('/');
+    std::string folder = ".";
+    if (pos == 0) {
+        folder = "/";
+    } else if (pos != std::string::npos) {
+        folder = socket_path.substr(0, pos);
+    }
+    if (access(folder.c_str(), W_OK | X_OK) != 0) {
+        base::LogError() << "Cannot create socket in folder : " << folder;
+        return false;
+    }
+    return true;
+}
+
+MavServer::MavServer() {}
+
+MavServer::~MavServer() {}
+
+bool MavServer::init(int rpc_port, int async_threads, const std::string &rpc_socket,
+                     int metrics_port, const CameraConfig &camera_config) {
     _rpc_port = rpc_port;
+    _async_threads = async_threads;
+    _rpc_socket = rpc_socket;
+    _metrics_port = metrics_port;
+    _camera_config = camera_config;
     return true;
 }
 
 bool MavServer::start_runloop() {
-    std::string server_address{"127.0.0.1"};
-    server_address += ":" + std::to_string(_rpc_port);
-    CameraServiceImpl service(std::make_shared<Camera>());
+    if (!start()) {
+        return false;
+    }
+    wait();
+    return true;
+}
+
+bool MavServer::start() {
+    std::string server_address;
+    if (_rpc_port > 0) {
+        server_address = "127.0.0.1:" + std::to_string(_rpc_port);
+    }
+    _cameras = std::make_shared<CameraRegistry>();
+    _cameras->add(CameraRegistry::kDefaultCameraId, std::make_shared<Camera>(_camera_config));
+    _service = std::make_unique<CameraServiceImpl>(_cameras);
+    _service->set_prepared_callback([this](int32_t camera_id, Camera::Result result) {
+        if (camera_id == CameraRegistry::kDefaultCameraId) {
+            set_camera_serving(result == Camera::Result::Success);
+        }
+    });
+    _async_service = std::make_unique<CameraAsyncServiceImpl>(*_service);
+
+    // grpc.health.v1.Health, the server itself is serving once it listens
+    grpc::EnableDefaultHealthCheckService(true);
 
     // Build server
     grpc::ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-    builder.RegisterService(&service);
+    if (!server_address.empty()) {
+        builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    }
+    std::string socket_address;
+    if (!_rpc_socket.empty()) {
+        if (can_listen_on_socket(_rpc_socket)) {
+            socket_address = "unix:" + _rpc_socket;
+            builder.AddListeningPort(socket_address, grpc::InsecureServerCredentials());
+        } else {
+            base::LogWarn() << "Cannot serve on unix:" << _rpc_socket;
+        }
+    }
+    if (_async_threads > 0) {
+        builder.RegisterService(_async_service->service());
+        for (int i = 0; i < _async_threads; i++) {
+            _completion_queues.emplace_back(builder.AddCompletionQueue());
+        }
+    } else {
+        builder.RegisterService(_service.get());
+    }
+    // every method of both engines and of the in process channel is timed here
+    std::vector<std::unique_ptr<grpc::experimental::ServerInterceptorFactoryInterface>>
+        interceptor_creators;
+    interceptor_creators.push_back(std::make_unique<RpcMetricsInterceptorFactory>());
+    builder.experimental().SetInterceptorCreators(std::move(interceptor_creators));
 
     _server = builder.BuildAndStart();
     if (!_server) {
         base::LogError() << "Failed to start server on " << server_address;
+        _completion_queues.clear();
+        _async_service.reset();
+        _service.reset();
+        _cameras.reset();
         return false;
     }
+    {
+        // a Prepare may already be running on the fresh server
+        std::lock_guard<std::mutex> lock(_health_mutex);
+        _health_service = _server->GetHealthCheckService();
+        _health_service->SetServingStatus(mavcam::rpc::camera::CameraService::service_full_name(),
+                                          _camera_serving);
+    }
 
-    // Run server
-    base::LogInfo() << "Server listening on " << server_address;
-    _server->Wait();
+    for (auto &cq : _completion_queues) {
+        _async_service->arm(cq.get());
+        _cq_threads.emplace_back(handle_rpcs, cq.get());
+    }
+
+    if (!server_address.empty()) {
+        base::LogInfo() << "Server listening on " << server_address;
+    }
+    if (!socket_address.empty()) {
+        base::LogInfo() << "Server listening on " << socket_address;
+    }
+    if (_async_threads > 0) {
+        base::LogInfo() << "Serving with " << _async_threads << " completion queue threads";
+    }
+    if (_metrics_port > 0) {
+        _metrics_server = std::make_unique<MetricsHttpServer>();
+        if (!_metrics_server->start(_metrics_port)) {
+            base::LogWarn() << "Serving without metrics endpoint";
+            _metrics_server.reset();
+        }
+    }
     return true;
 }
 
+void MavServer::wait() {
+    if (!_server) {
+        return;
+    }
+    _server->Wait();
+
+    // calls still queued on a camera worker finish on a live completion queue
+    _cameras->stop_workers();
+    // completion queues can only be shut down once the server is
+    for (auto &cq : _completion_queues) {
+        cq->Shutdown();
+    }
+    for (auto &cq_thread : _cq_threads) {
+        cq_thread.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_health_mutex);
+        _health_service = nullptr;
+        _camera_serving = false;
+    }
+    std::lock_guard<std::mutex> lock(_stop_mutex);
+    _cq_threads.clear();
+    _metrics_server.reset();
+    _completion_queues.clear();
+    _server.reset();
+    _async_service.reset();
+    _service.reset();
+    _cameras.reset();
+}
+
+std::shared_ptr<grpc::Channel> MavServer::in_process_channel() {
+    if (!_server) {
+        return nullptr;
+    }
+    return _server->InProcessChannel(grpc::ChannelArguments());
+}
+
+void MavServer::reload_backends() {
+    std::shared_ptr<CameraRegistry> cameras;
+    {
+        std::lock_guard<std::mutex> lock(_stop_mutex);
+        if (!_server) {
+            return;
+        }
+        cameras = _cameras;
+    }
+    for (auto camera_id : cameras->camera_ids()) {
+        auto result = cameras->camera(camera_id)->reload_backend();
+        base::LogInfo() << "Reload camera " << camera_id << " backend : " << result;
+        if (camera_id == CameraRegistry::kDefaultCameraId && result != Camera::Result::InProgress) {
+            set_camera_serving(result == Camera::Result::Success);
+        }
+    }
+}
+
 void MavServer::stop_runloop() {
-    _server->Shutdown();
+    std::lock_guard<std::mutex> lock(_stop_mutex);
+    if (!_server) {
+        return;
+    }
+    // sync stream handlers would otherwise only notice the cancellation on their next poll
+    _service->stop();
+    _server->Shutdown(std::chrono::system_clock::now() + kShutdownGracePeriod);
+}
+
+void MavServer::set_camera_serving(bool serving) {
+    std::lock_guard<std::mutex> lock(_health_mutex);
+    if (serving == _camera_serving) {
+        return;
+    }
+    _camera_serving = serving;
+    if (_health_service != nullptr) {
+        _health_service->SetServingStatus(mavcam::rpc::camera::CameraService::service_full_name(),
+                                          serving);
+    }
+    base::LogInfo() << "Camera service is " << (serving ? "serving" : "not serving");
+}
+
+void MavServer::handle_rpcs(grpc::ServerCompletionQueue *cq) {
+    void *tag = nullptr;
+    bool ok = false;
+    while (cq->Next(&tag, &ok)) {
+        static_cast<AsyncCall *>(tag)->proceed(ok);
+    }
 }
 
 }  // namespace mavcam
@@ -2,19 +2,86 @@
 
 #include <grpc++/grpc++.h>
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "plugins/camera/camera_config.h"
+
 namespace mavcam {
 
+class CameraRegistry;
+class CameraServiceImpl;
+class CameraAsyncServiceImpl;
+class MetricsHttpServer;
+
 class MavServer final {
 public:
-    MavServer() {}
-    ~MavServer() {}
+    MavServer();
+    ~MavServer();
 public:
-    bool init(int rpc_port);
+    /**
+     * @brief init rpc server, async_threads > 0 selects the completion queue engine
+     *
+     * A non empty rpc_socket also serves on that unix domain socket, tcp stays available.
+     * rpc_port <= 0 opens no port at all, the server is then only reachable in process.
+     * metrics_port > 0 also serves the call metrics as Prometheus text on 127.0.0.1.
+     * The default camera starts with camera_config.
+     */
+    bool init(int rpc_port, int async_threads = 0, const std::string &rpc_socket = "",
+              int metrics_port = 0, const CameraConfig &camera_config = CameraConfig());
     bool start_runloop();
+    /**
+     * @brief wake all open streams and shut down, bounded by a short grace period
+     *
+     * Not async-signal-safe, call it from a normal thread rather than a signal handler.
+     */
     void stop_runloop();
+    /**
+     * @brief build and start the server without blocking, used when embedded in mav_client
+     */
+    bool start();
+    /**
+     * @brief block until the server is stopped and release it
+     */
+    void wait();
+    /**
+     * @brief channel to the running server that bypasses the network stack
+     */
+    std::shared_ptr<grpc::Channel> in_process_channel();
+    /**
+     * @brief reload the vendor libraries of every hosted camera, blocking
+     */
+    void reload_backends();
+private:
+    /**
+     * @brief drain one completion queue until it is shut down
+     */
+    static void handle_rpcs(grpc::ServerCompletionQueue *cq);
+    /**
+     * @brief record whether the default camera is prepared and publish it on the health service
+     */
+    void set_camera_serving(bool serving);
 private:
     int _rpc_port;
+    int _async_threads{0};
+    std::string _rpc_socket;
+    int _metrics_port{0};
+    CameraConfig _camera_config;
+    std::shared_ptr<CameraRegistry> _cameras;
+    std::unique_ptr<CameraServiceImpl> _service;
+    std::unique_ptr<CameraAsyncServiceImpl> _async_service;
     std::unique_ptr<grpc::Server> _server;
+    std::unique_ptr<MetricsHttpServer> _metrics_server;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> _completion_queues;
+    std::vector<std::thread> _cq_threads;
+    std::mutex _stop_mutex{};
+    // not _stop_mutex, Prepare may still run while stop_runloop holds it during the shutdown
+    std::mutex _health_mutex{};
+    grpc::HealthCheckServiceInterface *_health_service{nullptr};
+    bool _camera_serving{false};
 };
 
 }  // namespace mavcam
@@ -1,6 +1,11 @@
+#include <pthread.h>
+#include <unistd.h>
+
+#include <chrono>
 #include <csignal>
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 #include "base/file_operation.h"
 #include "base/log.h"
@@ -8,14 +13,22 @@
 #include "version.h"
 
 static auto constexpr default_rpc_port = 50051;
+static auto constexpr default_async_threads = 0;
+static auto constexpr default_metrics_port = 0;
+static auto constexpr default_capture_depth = 4;
+static auto constexpr default_vendor_call_log_ms = 1500;
+static std::string default_rpc_socket = "";
 static std::string default_log_path = "/data/camera/";
 static std::fstream *default_log_stream = nullptr;
 static std::string default_store_prefix = "NDAA";
+static std::string default_capture_index = "/data/camera/capture_index";
+static std::string default_media_path = "/data/camera/";
+static std::string default_settings_file = "/data/camera/settings_snapshot";
 
 static void usage(const char *bin_name);
 static void init_log();
 static bool is_integer(const std::string &tested_integer);
-void signal_handler(int signum);
+static void handle_signals(sigset_t signals);
 
 mavcam::MavServer server;
 
@@ -23,6 +36,11 @@ int main(int argc, const char *argv[]) {
     std::ios::sync_with_stdio(true);
 
     int rpc_port = default_rpc_port;
+    int async_threads = default_async_threads;
+    int metrics_port = default_metrics_port;
+    mavcam::CameraConfig camera_config;
+    camera_config.capture_depth = default_capture_depth;
+    camera_config.vendor_call_log_threshold = std::chrono::milliseconds(default_vendor_call_log_ms);
     for (int i = 1; i < argc; i++) {
         const std::string current_arg = argv[i];
 
@@ -45,6 +63,62 @@ int main(int argc, const char *argv[]) {
             }
             rpc_port = std::stoi(rpc_port_string);
             i++;
+        } else if (current_arg == "--rpc_socket") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_rpc_socket = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--async_threads") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            const std::string async_threads_string(argv[i + 1]);
+            if (!is_integer(async_threads_string)) {
+                usage(argv[0]);
+                return 1;
+            }
+            async_threads = std::stoi(async_threads_string);
+            i++;
+        } else if (current_arg == "--metrics_port") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            const std::string metrics_port_string(argv[i + 1]);
+            if (!is_integer(metrics_port_string)) {
+                usage(argv[0]);
+                return 1;
+            }
+            metrics_port = std::stoi(metrics_port_string);
+            i++;
+        } else if (current_arg == "--capture_depth") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            const std::string capture_depth_string(argv[i + 1]);
+            if (!is_integer(capture_depth_string) || std::stoi(capture_depth_string) <= 0) {
+                usage(argv[0]);
+                return 1;
+            }
+            camera_config.capture_depth = std::stoi(capture_depth_string);
+            i++;
+        } else if (current_arg == "--vendor_call_log_ms") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            const std::string log_ms_string(argv[i + 1]);
+            if (!is_integer(log_ms_string) || std::stoi(log_ms_string) <= 0) {
+                usage(argv[0]);
+                return 1;
+            }
+            camera_config.vendor_call_log_threshold =
+                std::chrono::milliseconds(std::stoi(log_ms_string));
+            i++;
         } else if (current_arg == "--log_path") {
             if (argc <= i + 1) {
                 usage(argv[0]);
@@ -59,6 +133,27 @@ int main(int argc, const char *argv[]) {
             }
             default_store_prefix = std::string(argv[i + 1]);
             i++;
+        } else if (current_arg == "--capture_index") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_capture_index = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--media_path") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_media_path = std::string(argv[i + 1]);
+            i++;
+        } else if (current_arg == "--settings_file") {
+            if (argc <= i + 1) {
+                usage(argv[0]);
+                return 1;
+            }
+            default_settings_file = std::string(argv[i + 1]);
+            i++;
         } else if (current_arg == "--camera_mode") {
             if (argc <= i + 1) {
                 usage(argv[0]);
@@ -70,27 +165,40 @@ int main(int argc, const char *argv[]) {
                 usage(argv[0]);
                 return 1;
             }
-            setenv("MAVCAM_INIT_CAMERA_MODE", camera_mode.c_str(), 1);
+            camera_config.init_camera_mode = std::stoi(camera_mode);
         }
     }
 
     base::create_folder_if_not_exit(default_log_path);
     init_log();
-    signal(SIGINT, signal_handler);
+    // block the handled signals in every thread, they are handled by a plain thread so the
+    // shutdown and the backend reload may lock and wait, which is not allowed in a signal handler
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
     base::LogDebug() << "Launch mav server";
-    setenv("MAVCAM_DEFAULT_STORE_PREFIX", default_store_prefix.c_str(), 1);
+    camera_config.store_prefix = default_store_prefix;
     base::LogInfo() << "Store prefix is " << default_store_prefix;
-    const char *init_camera_mode = getenv("MAVCAM_INIT_CAMERA_MODE");
-    if (init_camera_mode != NULL) {
-        base::LogInfo() << "Init camera mode is " << init_camera_mode;
+    camera_config.capture_index_path = default_capture_index;
+    camera_config.media_path = default_media_path;
+    camera_config.settings_snapshot_path = default_settings_file;
+    if (camera_config.init_camera_mode >= 0) {
+        base::LogInfo() << "Init camera mode is " << camera_config.init_camera_mode;
     }
 
-    if (!server.init(rpc_port)) {
+    if (!server.init(rpc_port, async_threads, default_rpc_socket, metrics_port, camera_config)) {
         std::cout << "Init rpc server failed";
         return 1;
     }
 
+    std::thread signal_thread(handle_signals, signals);
     server.start_runloop();
+    // release the signal thread if the server stopped by itself
+    kill(getpid(), SIGTERM);
+    signal_thread.join();
     base::LogDebug() << "Quit mav server";
     if (default_log_stream != nullptr) {
         default_log_stream->close();
@@ -108,11 +216,31 @@ void usage(const char *bin_name) {
               << "\t-v | --version  : show version information " << '\n'
               << "\t-r              : set the rpc port,"
               << "(default is " << default_rpc_port << ")\n"
+              << "\t--rpc_socket    : also serve rpc on a unix domain socket, e.g. /run/mavcam.sock"
+              << '\n'
+              << "\t--async_threads : serve rpc with N completion queue threads,"
+              << "(default is " << default_async_threads << ", synchronous server)\n"
+              << "\t--metrics_port  : serve call metrics as Prometheus text on 127.0.0.1,"
+              << "(default is " << default_metrics_port << ", disabled)\n"
+              << "\t--capture_depth : photos queued before take photo answers busy,"
+              << "(default is " << default_capture_depth << ")\n"
+              << "\t--vendor_call_log_ms : log camera library calls taking this long,"
+              << "(default is " << default_vendor_call_log_ms << ")\n"
               << "\t--log_path      : store output log to file path, default is "
               << default_log_path << '\n'
               << "\t--store_prefix  : store folder and file prefix, default is "
               << default_store_prefix << '\n'
-              << "\t--camera_mode   : init camera mode, 0 for photo mode 1 for video mode" << '\n';
+              << "\t--capture_index : file listing the photos taken, default is "
+              << default_capture_index << '\n'
+              << "\t--media_path    : folder the photos and videos are stored in, default is "
+              << default_media_path << '\n'
+              << "\t--settings_file : camera settings restored at start, default is "
+              << default_settings_file << '\n'
+              << "\t--camera_mode   : init camera mode, 0 for photo mode 1 for video mode" << '\n'
+              << '\n'
+              << "Signals:" << '\n'
+              << "\tSIGHUP          : reload the camera vendor libraries" << '\n'
+              << "\tSIGINT|SIGTERM  : stop the server" << '\n';
 }
 
 static void init_log() {
@@ -165,9 +293,16 @@ bool is_integer(const std::string &tested_integer) {
     return true;
 }
 
-void signal_handler(int signum) {
-    base::LogDebug() << "Interrupt signal (" << signum << ") received.";
-    server.stop_runloop();
-
-    exit(signum);  // Exit the process
+static void handle_signals(sigset_t signals) {
+    int signum = 0;
+    while (sigwait(&signals, &signum) == 0) {
+        if (signum == SIGHUP) {
+            base::LogInfo() << "Reload signal received.";
+            server.reload_backends();
+            continue;
+        }
+        base::LogDebug() << "Interrupt signal (" << signum << ") received.";
+        server.stop_runloop();
+        return;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "metrics_http_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <iomanip>
+#include <sstream>
+
+#include "base/log.h"
+
+namespace mavcam {
+
+// a scraper sends a few hundred bytes of headers, anything larger is not worth reading
+const size_t kMaxRequestSize = 4096;
+const auto kClientTimeout = timeval{1, 0};
+
+static void write_all(int fd, const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        auto result = send(fd, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return;
+        }
+        written += static_cast<size_t>(result);
+    }
+}
+
+static void write_seconds(std::ostream &str, uint64_t micro_seconds) {
+    str << micro_seconds / 1000000 << '.' << std::setw(6) << std::setfill('0')
+        << micro_seconds % 1000000 << '\n';
+}
+
+MetricsHttpServer::~MetricsHttpServer() {
+    stop();
+}
+
+bool MetricsHttpServer::start(int port) {
+    _listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (_listen_fd < 0) {
+        base::LogError() << "Failed to create metrics socket, errno " << errno;
+        return false;
+    }
+    int reuse = 1;
+    setsockopt(_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(_listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        listen(_listen_fd, 4) != 0) {
+        base::LogError() << "Failed to listen for metrics on port " << port << ", errno "
+                         << errno;
+        close(_listen_fd);
+        _listen_fd = -1;
+        return false;
+    }
+    _stopping = false;
+    _thread = std::thread(&MetricsHttpServer::serve, this);
+    base::LogInfo() << "Metrics available on http://127.0.0.1:" << port << "/metrics";
+    return true;
+}
+
+void MetricsHttpServer::stop() {
+    if (_listen_fd < 0) {
+        return;
+    }
+    _stopping = true;
+    // wakes the blocking accept
+    shutdown(_listen_fd, SHUT_RDWR);
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    close(_listen_fd);
+    _listen_fd = -1;
+}
+
+void MetricsHttpServer::serve() {
+    while (!_stopping) {
+        int client_fd = accept4(_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client_fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if (!_stopping) {
+                base::LogError() << "Metrics listener stopped, errno " << errno;
+            }
+            return;
+        }
+        handle_client(client_fd);
+        close(client_fd);
+    }
+}
+
+void MetricsHttpServer::handle_client(int client_fd) {
+    setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &kClientTimeout, sizeof(kClientTimeout));
+    std::string request;
+    char buffer[512];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < kMaxRequestSize) {
+        auto result = recv(client_fd, buffer, sizeof(buffer), 0);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            break;
+        }
+        request.append(buffer, static_cast<size_t>(result));
+    }
+
+    const auto request_line = request.substr(0, request.find("\r\n"));
+    std::string status = "200 OK";
+    std::string body;
+    if (request_line.rfind("GET /metrics ", 0) == 0 || request_line == "GET /metrics") {
+        body = format(base::call_metrics().snapshot());
+    } else {
+        status = "404 Not Found";
+        body = "not found\n";
+    }
+    std::ostringstream response;
+    response << "HTTP/1.0 " << status << "\r\n"
+             << "Content-Type: text/plain; version=0.0.4\r\n"
+             << "Content-Length: " << body.size() << "\r\n"
+             << "Connection: close\r\n\r\n"
+             << body;
+    write_all(client_fd, response.str());
+}
+
+std::string MetricsHttpServer::format(const std::vector<base::CallMetric> &metrics) {
+    std::ostringstream str;
+    str << "# HELP mavcam_call_latency_seconds Latency of rpc methods and camera backend calls.\n"
+        << "# TYPE mavcam_call_latency_seconds summary\n";
+    for (const auto &metric : metrics) {
+        const std::string label = "call=\"" + metric.name + "\"";
+        str << "mavcam_call_latency_seconds{" << label << ",quantile=\"0.5\"} ";
+        write_seconds(str, metric.p50_latency_us);
+        str << "mavcam_call_latency_seconds{" << label << ",quantile=\"0.9\"} ";
+        write_seconds(str, metric.p90_latency_us);
+        str << "mavcam_call_latency_seconds{" << label << ",quantile=\"0.99\"} ";
+        write_seconds(str, metric.p99_latency_us);
+        str << "mavcam_call_latency_seconds_sum{" << label << "} ";
+        write_seconds(str, metric.total_latency_us);
+        str << "mavcam_call_latency_seconds_count{" << label << "} " << metric.count << '\n';
+    }
+    str << "# HELP mavcam_call_latency_max_seconds Slowest call since start.\n"
+        << "# TYPE mavcam_call_latency_max_seconds gauge\n";
+    for (const auto &metric : metrics) {
+        str << "mavcam_call_latency_max_seconds{call=\"" << metric.name << "\"} ";
+        write_seconds(str, metric.max_latency_us);
+    }
+    str << "# HELP mavcam_call_errors_total Calls that failed or returned an error result.\n"
+        << "# TYPE mavcam_call_errors_total counter\n";
+    for (const auto &metric : metrics) {
+        str << "mavcam_call_errors_total{call=\"" << metric.name << "\"} " << metric.error_count
+            << '\n';
+    }
+    return str.str();
+}
+
+}  // namespace mavcam
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/call_metrics.h"
+
+namespace mavcam {
+
+/**
+ * @brief Minimal HTTP listener on 127.0.0.1 serving base::call_metrics() as Prometheus text.
+ *
+ * GET /metrics is answered, anything else gets a 404. Requests are handled one at a time on a
+ * single thread, this is meant for a local scraper and not for general traffic.
+ */
+class MetricsHttpServer final {
+public:
+    MetricsHttpServer() {}
+    ~MetricsHttpServer();
+public:
+    bool start(int port);
+    void stop();
+    /**
+     * @brief Prometheus text exposition of the given metrics.
+     */
+    static std::string format(const std::vector<base::CallMetric> &metrics);
+private:
+    void serve();
+    void handle_client(int client_fd);
+private:
+    int _listen_fd{-1};
+    std::atomic<bool> _stopping{false};
+    std::thread _thread;
+};
+
+}  // namespace mavcam
@@ -1,12 +1,13 @@
 // WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
 // Edits need to be made to the proto files
-// (see https://github.com/mavlink/MAVSDK-Proto/blob/master/protos/camera/camera.proto)
+// (see protos/camera/camera.proto)
 
 #include "plugins/camera/camera.h"
 
 #include <iomanip>
 
 #include "camera_impl.h"
+#include "plugins/camera/camera_enum_table.h"
 
 namespace mavcam {
 
@@ -20,9 +21,13 @@ using Status = Camera::Status;
 using Option = Camera::Option;
 using Setting = Camera::Setting;
 using SettingOptions = Camera::SettingOptions;
+using AppliedSetting = Camera::AppliedSetting;
+using CallMetric = Camera::CallMetric;
 using Information = Camera::Information;
 
-Camera::Camera() : _impl{std::make_unique<CameraImpl>()} {}
+Camera::Camera() : _impl{std::make_unique<CameraImpl>(CameraConfig())} {}
+
+Camera::Camera(const CameraConfig &config) : _impl{std::make_unique<CameraImpl>(config)} {}
 
 Camera::~Camera() {}
 
@@ -67,56 +72,79 @@ std::pair<Camera::Result, std::vector<Camera::CaptureInfo>> Camera::list_photos(
     return _impl->list_photos(photos_range);
 }
 
-void Camera::mode_async(const ModeCallback &callback) {
-    _impl->mode_async(callback);
+Camera::ModeHandle Camera::subscribe_mode(const ModeCallback &callback) {
+    return _impl->subscribe_mode(callback);
+}
+
+void Camera::unsubscribe_mode(ModeHandle handle) {
+    _impl->unsubscribe_mode(handle);
 }
 
 Camera::Mode Camera::mode() const {
     return _impl->mode();
 }
 
-void Camera::information_async(const InformationCallback &callback) {
-    _impl->information_async(callback);
+Camera::InformationHandle Camera::subscribe_information(const InformationCallback &callback) {
+    return _impl->subscribe_information(callback);
+}
+
+void Camera::unsubscribe_information(InformationHandle handle) {
+    _impl->unsubscribe_information(handle);
 }
 
 Camera::Information Camera::information() const {
     return _impl->information();
 }
 
-void Camera::video_stream_info_async(const VideoStreamInfoCallback &callback) {
-    _impl->video_stream_info_async(callback);
+Camera::VideoStreamInfoHandle Camera::subscribe_video_stream_info(
+    const VideoStreamInfoCallback &callback) {
+    return _impl->subscribe_video_stream_info(callback);
+}
+
+void Camera::unsubscribe_video_stream_info(VideoStreamInfoHandle handle) {
+    _impl->unsubscribe_video_stream_info(handle);
 }
 
 std::vector<Camera::VideoStreamInfo> Camera::video_stream_info() const {
     return _impl->video_stream_info();
 }
 
-void Camera::capture_info_async(const CaptureInfoCallback &callback) {
-    _impl->capture_info_async(callback);
+Camera::CaptureInfoHandle Camera::subscribe_capture_info(const CaptureInfoCallback &callback) {
+    return _impl->subscribe_capture_info(callback);
+}
+
+void Camera::unsubscribe_capture_info(CaptureInfoHandle handle) {
+    _impl->unsubscribe_capture_info(handle);
 }
 
-Camera::CaptureInfo Camera::capture_info() const {
-    return _impl->capture_info();
+Camera::StatusHandle Camera::subscribe_status(const StatusCallback &callback) {
+    return _impl->subscribe_status(callback);
 }
 
-void Camera::status_async(const StatusCallback &callback) {
-    _impl->status_async(callback);
+void Camera::unsubscribe_status(StatusHandle handle) {
+    _impl->unsubscribe_status(handle);
 }
 
 Camera::Status Camera::status() const {
     return _impl->status();
 }
 
-void Camera::current_settings_async(const CurrentSettingsCallback &callback) {
-    _impl->current_settings_async(callback);
+Camera::CurrentSettingsHandle Camera::subscribe_current_settings(
+    const CurrentSettingsCallback &callback) {
+    return _impl->subscribe_current_settings(callback);
+}
+
+void Camera::unsubscribe_current_settings(CurrentSettingsHandle handle) {
+    _impl->unsubscribe_current_settings(handle);
 }
 
-std::vector<Camera::Setting> Camera::current_settings() const {
-    return _impl->current_settings();
+Camera::PossibleSettingOptionsHandle Camera::subscribe_possible_setting_options(
+    const PossibleSettingOptionsCallback &callback) {
+    return _impl->subscribe_possible_setting_options(callback);
 }
 
-void Camera::possible_setting_options_async(const PossibleSettingOptionsCallback &callback) {
-    _impl->possible_setting_options_async(callback);
+void Camera::unsubscribe_possible_setting_options(PossibleSettingOptionsHandle handle) {
+    _impl->unsubscribe_possible_setting_options(handle);
 }
 
 std::vector<Camera::SettingOptions> Camera::possible_setting_options() const {
@@ -147,31 +175,25 @@ Camera::Result Camera::set_timestamp(int64_t timestamp) const {
     return _impl->set_timestamp(timestamp);
 }
 
+std::pair<Camera::Result, std::vector<Camera::AppliedSetting>> Camera::set_settings(
+    std::vector<Setting> settings) const {
+    return _impl->set_settings(settings);
+}
+
+std::pair<Camera::Result, std::vector<Camera::CallMetric>> Camera::get_metrics() const {
+    return _impl->get_metrics();
+}
+
+Camera::Result Camera::start_burst(int32_t count, float interval_s) const {
+    return _impl->start_burst(count, interval_s);
+}
+
+Camera::Result Camera::reload_backend() const {
+    return _impl->reload_backend();
+}
+
 std::ostream &operator<<(std::ostream &str, Camera::Result const &result) {
-    switch (result) {
-        case Camera::Result::Unknown:
-            return str << "Unknown";
-        case Camera::Result::Success:
-            return str << "Success";
-        case Camera::Result::InProgress:
-            return str << "In Progress";
-        case Camera::Result::Busy:
-            return str << "Busy";
-        case Camera::Result::Denied:
-            return str << "Denied";
-        case Camera::Result::Error:
-            return str << "Error";
-        case Camera::Result::Timeout:
-            return str << "Timeout";
-        case Camera::Result::WrongArgument:
-            return str << "Wrong Argument";
-        case Camera::Result::NoSystem:
-            return str << "No System";
-        case Camera::Result::ProtocolUnsupported:
-            return str << "Protocol Unsupported";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraResultTable, result);
 }
 
 bool operator==(const Camera::Position &lhs, const Camera::Position &rhs) {
@@ -282,28 +304,12 @@ std::ostream &operator<<(std::ostream &str,
 
 std::ostream &operator<<(std::ostream &str,
                          Camera::VideoStreamInfo::VideoStreamStatus const &video_stream_status) {
-    switch (video_stream_status) {
-        case Camera::VideoStreamInfo::VideoStreamStatus::NotRunning:
-            return str << "Not Running";
-        case Camera::VideoStreamInfo::VideoStreamStatus::InProgress:
-            return str << "In Progress";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraVideoStreamStatusTable, video_stream_status);
 }
 
 std::ostream &operator<<(
     std::ostream &str, Camera::VideoStreamInfo::VideoStreamSpectrum const &video_stream_spectrum) {
-    switch (video_stream_spectrum) {
-        case Camera::VideoStreamInfo::VideoStreamSpectrum::Unknown:
-            return str << "Unknown";
-        case Camera::VideoStreamInfo::VideoStreamSpectrum::VisibleLight:
-            return str << "Visible Light";
-        case Camera::VideoStreamInfo::VideoStreamSpectrum::Infrared:
-            return str << "Infrared";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraVideoStreamSpectrumTable, video_stream_spectrum);
 }
 bool operator==(const Camera::VideoStreamInfo &lhs, const Camera::VideoStreamInfo &rhs) {
     return (rhs.stream_id == lhs.stream_id) && (rhs.settings == lhs.settings) &&
@@ -322,37 +328,11 @@ std::ostream &operator<<(std::ostream &str, Camera::VideoStreamInfo const &video
 }
 
 std::ostream &operator<<(std::ostream &str, Camera::Status::StorageStatus const &storage_status) {
-    switch (storage_status) {
-        case Camera::Status::StorageStatus::NotAvailable:
-            return str << "Not Available";
-        case Camera::Status::StorageStatus::Unformatted:
-            return str << "Unformatted";
-        case Camera::Status::StorageStatus::Formatted:
-            return str << "Formatted";
-        case Camera::Status::StorageStatus::NotSupported:
-            return str << "Not Supported";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraStorageStatusTable, storage_status);
 }
 
 std::ostream &operator<<(std::ostream &str, Camera::Status::StorageType const &storage_type) {
-    switch (storage_type) {
-        case Camera::Status::StorageType::Unknown:
-            return str << "Unknown";
-        case Camera::Status::StorageType::UsbStick:
-            return str << "Usb Stick";
-        case Camera::Status::StorageType::Sd:
-            return str << "Sd";
-        case Camera::Status::StorageType::Microsd:
-            return str << "Microsd";
-        case Camera::Status::StorageType::Hd:
-            return str << "Hd";
-        case Camera::Status::StorageType::Other:
-            return str << "Other";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraStorageTypeTable, storage_type);
 }
 bool operator==(const Camera::Status &lhs, const Camera::Status &rhs) {
     return (rhs.video_on == lhs.video_on) && (rhs.photo_interval_on == lhs.photo_interval_on) &&
@@ -437,36 +417,45 @@ std::ostream &operator<<(std::ostream &str, Camera::SettingOptions const &settin
     return str;
 }
 
+bool operator==(const Camera::AppliedSetting &lhs, const Camera::AppliedSetting &rhs) {
+    return (rhs.result == lhs.result) && (rhs.setting_id == lhs.setting_id);
+}
+
+std::ostream &operator<<(std::ostream &str, Camera::AppliedSetting const &applied_setting) {
+    str << std::setprecision(15);
+    str << "applied_setting:" << '\n' << "{\n";
+    str << "    result: " << applied_setting.result << '\n';
+    str << "    setting_id: " << applied_setting.setting_id << '\n';
+    str << '}';
+    return str;
+}
+
+bool operator==(const Camera::CallMetric &lhs, const Camera::CallMetric &rhs) {
+    return (rhs.name == lhs.name) && (rhs.count == lhs.count) &&
+           (rhs.error_count == lhs.error_count) && (rhs.total_latency_us == lhs.total_latency_us) &&
+           (rhs.max_latency_us == lhs.max_latency_us) &&
+           (rhs.p50_latency_us == lhs.p50_latency_us) &&
+           (rhs.p90_latency_us == lhs.p90_latency_us) && (rhs.p99_latency_us == lhs.p99_latency_us);
+}
+
+std::ostream &operator<<(std::ostream &str, Camera::CallMetric const &call_metric) {
+    str << std::setprecision(15);
+    str << "call_metric:" << '\n' << "{\n";
+    str << "    name: " << call_metric.name << '\n';
+    str << "    count: " << call_metric.count << '\n';
+    str << "    error_count: " << call_metric.error_count << '\n';
+    str << "    total_latency_us: " << call_metric.total_latency_us << '\n';
+    str << "    max_latency_us: " << call_metric.max_latency_us << '\n';
+    str << "    p50_latency_us: " << call_metric.p50_latency_us << '\n';
+    str << "    p90_latency_us: " << call_metric.p90_latency_us << '\n';
+    str << "    p99_latency_us: " << call_metric.p99_latency_us << '\n';
+    str << '}';
+    return str;
+}
+
 std::ostream &operator<<(std::ostream &str,
                          Camera::Information::CameraCapFlags const &camera_cap_flags) {
-    switch (camera_cap_flags) {
-        case Camera::Information::CameraCapFlags::CaptureVideo:
-            return str << "Capture Video";
-        case Camera::Information::CameraCapFlags::CaptureImage:
-            return str << "Capture Image";
-        case Camera::Information::CameraCapFlags::HasModes:
-            return str << "Has Modes";
-        case Camera::Information::CameraCapFlags::CanCaptureImageInVideoMode:
-            return str << "Can Capture Image In Video Mode";
-        case Camera::Information::CameraCapFlags::CanCaptureVideoInImageMode:
-            return str << "Can Capture Video In Image Mode";
-        case Camera::Information::CameraCapFlags::HasImageSurveyMode:
-            return str << "Has Image Survey Mode";
-        case Camera::Information::CameraCapFlags::HasBasicZoom:
-            return str << "Has Basic Zoom";
-        case Camera::Information::CameraCapFlags::HasBasicFocus:
-            return str << "Has Basic Focus";
-        case Camera::Information::CameraCapFlags::HasVideoStream:
-            return str << "Has Video Stream";
-        case Camera::Information::CameraCapFlags::HasTrackingPoint:
-            return str << "Has Tracking Point";
-        case Camera::Information::CameraCapFlags::HasTrackingRectangle:
-            return str << "Has Tracking Rectangle";
-        case Camera::Information::CameraCapFlags::HasTrackingGeoStatus:
-            return str << "Has Tracking Geo Status";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraCameraCapFlagsTable, camera_cap_flags);
 }
 bool operator==(const Camera::Information &lhs, const Camera::Information &rhs) {
     return (rhs.vendor_name == lhs.vendor_name) && (rhs.model_name == lhs.model_name) &&
@@ -511,27 +500,11 @@ std::ostream &operator<<(std::ostream &str, Camera::Information const &informati
 }
 
 std::ostream &operator<<(std::ostream &str, Camera::Mode const &mode) {
-    switch (mode) {
-        case Camera::Mode::Unknown:
-            return str << "Unknown";
-        case Camera::Mode::Photo:
-            return str << "Photo";
-        case Camera::Mode::Video:
-            return str << "Video";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraModeTable, mode);
 }
 
 std::ostream &operator<<(std::ostream &str, Camera::PhotosRange const &photos_range) {
-    switch (photos_range) {
-        case Camera::PhotosRange::All:
-            return str << "All";
-        case Camera::PhotosRange::SinceConnection:
-            return str << "Since Connection";
-        default:
-            return str << "Unknown";
-    }
+    return str << base::enum_name(kCameraPhotosRangeTable, photos_range);
 }
 
 }  // namespace mavcam
\ No newline at end of file
@@ -1,6 +1,6 @@
 // WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
 // Edits need to be made to the proto files
-// (see https://github.com/GoerLabs/MAVSDK-Proto/blob/main/protos/camera/camera.proto)
+// (see protos/camera/camera.proto)
 
 #pragma once
 
@@ -13,6 +13,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/callback_list.h"
+#include "plugins/camera/camera_config.h"
+
 namespace mavcam {
 
 class CameraImpl;
@@ -39,6 +42,11 @@ public:
      */
     explicit Camera();
 
+    /**
+     * @brief Constructor. Creates the plugin with the given start up options.
+     */
+    explicit Camera(const CameraConfig &config);
+
     /**
      * @brief Destructor (internal use only).
      */
@@ -443,6 +451,57 @@ public:
     friend std::ostream &operator<<(std::ostream &str,
                                     Camera::SettingOptions const &setting_options);
 
+    /**
+     * @brief Type to represent the outcome of one setting of a batch.
+     */
+    struct AppliedSetting {
+        Result result{};          /**< @brief Result of applying this setting */
+        std::string setting_id{}; /**< @brief Name of the setting (machine readable) */
+    };
+
+    /**
+     * @brief Equal operator to compare two `Camera::AppliedSetting` objects.
+     *
+     * @return `true` if items are equal.
+     */
+    friend bool operator==(const Camera::AppliedSetting &lhs, const Camera::AppliedSetting &rhs);
+
+    /**
+     * @brief Stream operator to print information about a `Camera::AppliedSetting`.
+     *
+     * @return A reference to the stream.
+     */
+    friend std::ostream &operator<<(std::ostream &str,
+                                    Camera::AppliedSetting const &applied_setting);
+
+    /**
+     * @brief Type to represent the counters of one rpc method or backend call.
+     */
+    struct CallMetric {
+        std::string name{};          /**< @brief Rpc method path or backend call name */
+        uint64_t count{};            /**< @brief Number of completed calls */
+        uint64_t error_count{};      /**< @brief Calls that failed or returned an error result */
+        uint64_t total_latency_us{}; /**< @brief Sum of all latencies in microseconds */
+        uint64_t max_latency_us{};   /**< @brief Slowest call in microseconds */
+        uint64_t p50_latency_us{};   /**< @brief Median latency in microseconds */
+        uint64_t p90_latency_us{};   /**< @brief 90th percentile latency in microseconds */
+        uint64_t p99_latency_us{};   /**< @brief 99th percentile latency in microseconds */
+    };
+
+    /**
+     * @brief Equal operator to compare two `Camera::CallMetric` objects.
+     *
+     * @return `true` if items are equal.
+     */
+    friend bool operator==(const Camera::CallMetric &lhs, const Camera::CallMetric &rhs);
+
+    /**
+     * @brief Stream operator to print information about a `Camera::CallMetric`.
+     *
+     * @return A reference to the stream.
+     */
+    friend std::ostream &operator<<(std::ostream &str, Camera::CallMetric const &call_metric);
+
     /**
      * @brief Type to represent a camera information.
      */
@@ -517,6 +576,9 @@ public:
     /**
      * @brief Take one photo.
      *
+     * The photo is queued and taken in the background, subscribe_capture_info reports it with
+     * the capture id as index. Busy is returned while the capture queue is full.
+     *
      * This function is blocking.
      *
      * @return Result of request.
@@ -596,14 +658,24 @@ public:
     std::pair<Result, std::vector<Camera::CaptureInfo>> list_photos(PhotosRange photos_range) const;
 
     /**
-     * @brief Callback type for mode_async.
+     * @brief Callback type for subscribe_mode.
      */
     using ModeCallback = std::function<void(Mode)>;
 
+    /**
+     * @brief Handle type for subscribe_mode.
+     */
+    using ModeHandle = base::Handle<Mode>;
+
     /**
      * @brief Subscribe to camera mode updates.
      */
-    void mode_async(const ModeCallback &callback);
+    ModeHandle subscribe_mode(const ModeCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_mode
+     */
+    void unsubscribe_mode(ModeHandle handle);
 
     /**
      * @brief Poll for 'Mode' (blocking).
@@ -613,14 +685,24 @@ public:
     Mode mode() const;
 
     /**
-     * @brief Callback type for information_async.
+     * @brief Callback type for subscribe_information.
      */
     using InformationCallback = std::function<void(Information)>;
 
+    /**
+     * @brief Handle type for subscribe_information.
+     */
+    using InformationHandle = base::Handle<Information>;
+
     /**
      * @brief Subscribe to camera information updates.
      */
-    void information_async(const InformationCallback &callback);
+    InformationHandle subscribe_information(const InformationCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_information
+     */
+    void unsubscribe_information(InformationHandle handle);
 
     /**
      * @brief Poll for 'Information' (blocking).
@@ -630,14 +712,24 @@ public:
     Information information() const;
 
     /**
-     * @brief Callback type for video_stream_info_async.
+     * @brief Callback type for subscribe_video_stream_info.
      */
     using VideoStreamInfoCallback = std::function<void(std::vector<VideoStreamInfo>)>;
 
+    /**
+     * @brief Handle type for subscribe_video_stream_info.
+     */
+    using VideoStreamInfoHandle = base::Handle<std::vector<VideoStreamInfo>>;
+
     /**
      * @brief Subscribe to video stream info updates.
      */
-    void video_stream_info_async(const VideoStreamInfoCallback &callback);
+    VideoStreamInfoHandle subscribe_video_stream_info(const VideoStreamInfoCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_video_stream_info
+     */
+    void unsubscribe_video_stream_info(VideoStreamInfoHandle handle);
 
     /**
      * @brief Poll for 'std::vector<VideoStreamInfo>' (blocking).
@@ -647,31 +739,44 @@ public:
     std::vector<VideoStreamInfo> video_stream_info() const;
 
     /**
-     * @brief Callback type for capture_info_async.
+     * @brief Callback type for subscribe_capture_info.
      */
     using CaptureInfoCallback = std::function<void(CaptureInfo)>;
 
+    /**
+     * @brief Handle type for subscribe_capture_info.
+     */
+    using CaptureInfoHandle = base::Handle<CaptureInfo>;
+
     /**
      * @brief Subscribe to capture info updates.
      */
-    void capture_info_async(const CaptureInfoCallback &callback);
+    CaptureInfoHandle subscribe_capture_info(const CaptureInfoCallback &callback);
 
     /**
-     * @brief Poll for 'CaptureInfo' (blocking).
-     *
-     * @return One CaptureInfo update.
+     * @brief Unsubscribe from subscribe_capture_info
      */
-    CaptureInfo capture_info() const;
+    void unsubscribe_capture_info(CaptureInfoHandle handle);
 
     /**
-     * @brief Callback type for status_async.
+     * @brief Callback type for subscribe_status.
      */
     using StatusCallback = std::function<void(Status)>;
 
+    /**
+     * @brief Handle type for subscribe_status.
+     */
+    using StatusHandle = base::Handle<Status>;
+
     /**
      * @brief Subscribe to camera status updates.
      */
-    void status_async(const StatusCallback &callback);
+    StatusHandle subscribe_status(const StatusCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_status
+     */
+    void unsubscribe_status(StatusHandle handle);
 
     /**
      * @brief Poll for 'Status' (blocking).
@@ -681,31 +786,45 @@ public:
     Status status() const;
 
     /**
-     * @brief Callback type for current_settings_async.
+     * @brief Callback type for subscribe_current_settings.
      */
     using CurrentSettingsCallback = std::function<void(std::vector<Setting>)>;
 
+    /**
+     * @brief Handle type for subscribe_current_settings.
+     */
+    using CurrentSettingsHandle = base::Handle<std::vector<Setting>>;
+
     /**
      * @brief Get the list of current camera settings.
      */
-    void current_settings_async(const CurrentSettingsCallback &callback);
+    CurrentSettingsHandle subscribe_current_settings(const CurrentSettingsCallback &callback);
 
     /**
-     * @brief Poll for 'std::vector<Setting>' (blocking).
-     *
-     * @return One std::vector<Setting> update.
+     * @brief Unsubscribe from subscribe_current_settings
      */
-    std::vector<Setting> current_settings() const;
+    void unsubscribe_current_settings(CurrentSettingsHandle handle);
 
     /**
-     * @brief Callback type for possible_setting_options_async.
+     * @brief Callback type for subscribe_possible_setting_options.
      */
     using PossibleSettingOptionsCallback = std::function<void(std::vector<SettingOptions>)>;
 
+    /**
+     * @brief Handle type for subscribe_possible_setting_options.
+     */
+    using PossibleSettingOptionsHandle = base::Handle<std::vector<SettingOptions>>;
+
     /**
      * @brief Get the list of settings that can be changed.
      */
-    void possible_setting_options_async(const PossibleSettingOptionsCallback &callback);
+    PossibleSettingOptionsHandle subscribe_possible_setting_options(
+        const PossibleSettingOptionsCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_possible_setting_options
+     */
+    void unsubscribe_possible_setting_options(PossibleSettingOptionsHandle handle);
 
     /**
      * @brief Poll for 'std::vector<SettingOptions>' (blocking).
@@ -778,6 +897,50 @@ public:
      */
     Result set_timestamp(int64_t timestamp) const;
 
+    /**
+     * @brief Apply several settings at once, dependent settings are applied first.
+     *
+     * Only setting_id of setting and option_id of option needs to be set.
+     *
+     * This function is blocking.
+     *
+     * @return Result of request.
+     */
+    std::pair<Result, std::vector<Camera::AppliedSetting>> set_settings(
+        std::vector<Setting> settings) const;
+
+    /**
+     * @brief Per method call counts and latency percentiles recorded by the server.
+     *
+     * This function is blocking.
+     *
+     * @return Result of request.
+     */
+    std::pair<Result, std::vector<Camera::CallMetric>> get_metrics() const;
+
+    /**
+     * @brief Take count photos, interval_s apart or back to back with 0.
+     *
+     * The burst is queued like one photo, subscribe_capture_info reports each photo with
+     * consecutive capture ids as index. Busy is returned while the capture queue is full.
+     *
+     * This function is blocking.
+     *
+     * @return Result of request.
+     */
+    Result start_burst(int32_t count, float interval_s) const;
+
+    /**
+     * @brief Close the vendor libraries and load them again without restarting the server.
+     *
+     * Calls reaching the camera meanwhile are answered Busy.
+     *
+     * This function is blocking.
+     *
+     * @return Result of request, InProgress if a reload is already running.
+     */
+    Result reload_backend() const;
+
     /**
      * @brief Copy constructor.
      */
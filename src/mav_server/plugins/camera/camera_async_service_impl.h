@@ -0,0 +1,523 @@
+// WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
+// Edits need to be made to the proto files
+// (see protos/camera/camera.proto)
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "async_call.h"
+#include "camera/camera.grpc.pb.h"
+#include "plugins/camera/camera.h"
+#include "plugins/camera/camera_service_impl.h"
+
+namespace mavcam {
+
+class CameraAsyncServiceImpl final {
+public:
+    CameraAsyncServiceImpl(CameraServiceImpl &service_impl)
+        : _service_impl(service_impl),
+          _dispatcher([this](grpc::ServerContext *context, std::function<void()> run) {
+              // a slow camera only holds up its own calls, not the completion queue
+              auto &cameras = _service_impl.cameras();
+              auto *worker = cameras.worker(cameras.camera_id(context));
+              return worker != nullptr && worker->post(std::move(run));
+          }) {}
+
+    grpc::Service *service() { return &_service; }
+
+    /**
+     * @brief Put one call object per method on the completion queue.
+     *
+     * Unary calls run the CameraServiceImpl handler on the worker of the addressed camera,
+     * streams only hold a subscription and never block a thread.
+     */
+    void arm(grpc::ServerCompletionQueue *cq) {
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::PrepareRequest,
+                                        mavcam::rpc::camera::PrepareResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestPrepare(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.Prepare(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::TakePhotoRequest,
+                                        mavcam::rpc::camera::TakePhotoResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestTakePhoto(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.TakePhoto(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StartPhotoIntervalRequest,
+                                        mavcam::rpc::camera::StartPhotoIntervalResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStartPhotoInterval(context, request, responder, new_cq, new_cq,
+                                                       tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StartPhotoInterval(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StopPhotoIntervalRequest,
+                                        mavcam::rpc::camera::StopPhotoIntervalResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStopPhotoInterval(context, request, responder, new_cq, new_cq,
+                                                      tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StopPhotoInterval(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StartVideoRequest,
+                                        mavcam::rpc::camera::StartVideoResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStartVideo(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StartVideo(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StopVideoRequest,
+                                        mavcam::rpc::camera::StopVideoResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStopVideo(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StopVideo(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StartVideoStreamingRequest,
+                                        mavcam::rpc::camera::StartVideoStreamingResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStartVideoStreaming(context, request, responder, new_cq, new_cq,
+                                                        tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StartVideoStreaming(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StopVideoStreamingRequest,
+                                        mavcam::rpc::camera::StopVideoStreamingResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStopVideoStreaming(context, request, responder, new_cq, new_cq,
+                                                       tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StopVideoStreaming(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::SetModeRequest,
+                                        mavcam::rpc::camera::SetModeResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSetMode(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.SetMode(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::ListPhotosRequest,
+                                        mavcam::rpc::camera::ListPhotosResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestListPhotos(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.ListPhotos(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncServerStreamCall<mavcam::rpc::camera::SubscribeModeRequest,
+                                               mavcam::rpc::camera::ModeResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribeMode(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribeModeUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribeModeUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call = AsyncServerStreamCall<mavcam::rpc::camera::SubscribeInformationRequest,
+                                               mavcam::rpc::camera::InformationResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribeInformation(context, request, responder, new_cq,
+                                                         new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribeInformationUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribeInformationUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call = AsyncServerStreamCall<mavcam::rpc::camera::SubscribeVideoStreamInfoRequest,
+                                               mavcam::rpc::camera::VideoStreamInfoResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribeVideoStreamInfo(context, request, responder, new_cq,
+                                                             new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribeVideoStreamInfoUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribeVideoStreamInfoUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call = AsyncServerStreamCall<mavcam::rpc::camera::SubscribeCaptureInfoRequest,
+                                               mavcam::rpc::camera::CaptureInfoResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribeCaptureInfo(context, request, responder, new_cq,
+                                                         new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribeCaptureInfoUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribeCaptureInfoUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call = AsyncServerStreamCall<mavcam::rpc::camera::SubscribeStatusRequest,
+                                               mavcam::rpc::camera::StatusResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribeStatus(context, request, responder, new_cq, new_cq,
+                                                    tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribeStatusUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribeStatusUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call = AsyncServerStreamCall<mavcam::rpc::camera::SubscribeCurrentSettingsRequest,
+                                               mavcam::rpc::camera::CurrentSettingsResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribeCurrentSettings(context, request, responder, new_cq,
+                                                             new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribeCurrentSettingsUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribeCurrentSettingsUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call =
+                AsyncServerStreamCall<mavcam::rpc::camera::SubscribePossibleSettingOptionsRequest,
+                                      mavcam::rpc::camera::PossibleSettingOptionsResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSubscribePossibleSettingOptions(context, request, responder,
+                                                                    new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       std::shared_ptr<Call::Writer> writer) {
+                    auto plugin = _service_impl.cameras().camera(context);
+                    if (plugin == nullptr) {
+                        writer->finish(CameraServiceImpl::unknownCameraStatus());
+                        return;
+                    }
+                    auto handle = _service_impl.subscribePossibleSettingOptionsUpdates(
+                        plugin, request, [writer](const Call::Response &rpc_response) {
+                            writer->write(rpc_response);
+                        });
+                    writer->on_close([this, plugin, handle]() {
+                        _service_impl.unsubscribePossibleSettingOptionsUpdates(plugin, handle);
+                    });
+                },
+                cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::SetSettingRequest,
+                                        mavcam::rpc::camera::SetSettingResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSetSetting(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.SetSetting(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::GetSettingRequest,
+                                        mavcam::rpc::camera::GetSettingResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestGetSetting(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.GetSetting(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::FormatStorageRequest,
+                                        mavcam::rpc::camera::FormatStorageResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestFormatStorage(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.FormatStorage(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::SelectCameraRequest,
+                                        mavcam::rpc::camera::SelectCameraResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSelectCamera(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.SelectCamera(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::ResetSettingsRequest,
+                                        mavcam::rpc::camera::ResetSettingsResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestResetSettings(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.ResetSettings(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::SetTimestampRequest,
+                                        mavcam::rpc::camera::SetTimestampResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSetTimestamp(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.SetTimestamp(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::SetSettingsRequest,
+                                        mavcam::rpc::camera::SetSettingsResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestSetSettings(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.SetSettings(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::GetMetricsRequest,
+                                        mavcam::rpc::camera::GetMetricsResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestGetMetrics(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.GetMetrics(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+        {
+            using Call = AsyncUnaryCall<mavcam::rpc::camera::StartBurstRequest,
+                                        mavcam::rpc::camera::StartBurstResponse>;
+            Call::spawn(
+                [this](grpc::ServerContext *context, Call::Request *request,
+                       Call::Responder *responder, grpc::ServerCompletionQueue *new_cq,
+                       void *tag) {
+                    _service.RequestStartBurst(context, request, responder, new_cq, new_cq, tag);
+                },
+                [this](grpc::ServerContext *context, const Call::Request *request,
+                       Call::Response *response) {
+                    return _service_impl.StartBurst(context, request, response);
+                },
+                _dispatcher, cq);
+        }
+    }
+private:
+    CameraServiceImpl &_service_impl;
+    AsyncDispatcher _dispatcher;
+    mavcam::rpc::camera::CameraService::AsyncService _service{};
+};
+
+}  // namespace mavcam
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace mavcam {
+
+/**
+ * @brief Start up options of a hosted camera, filled from the command line of mav_server or of
+ * mav_client running the server embedded. An empty path leaves its feature off.
+ */
+struct CameraConfig {
+    // folder and file prefix the vendor library stores the media with
+    std::string store_prefix;
+    // file listing the photos taken, kept across restarts
+    std::string capture_index_path;
+    // folder the photos and videos are stored in, its storage is monitored
+    std::string media_path;
+    // settings saved on every change and restored when the camera opens
+    std::string settings_snapshot_path;
+    // captures accepted by take_photo and not reported yet
+    std::size_t capture_depth{4};
+    // calls into the vendor libraries taking at least this long are logged
+    std::chrono::milliseconds vendor_call_log_threshold{1500};
+    // 0 opens the camera in photo mode and 1 in video mode, else in the mode of the snapshot
+    int init_camera_mode{-1};
+};
+
+}  // namespace mavcam
@@ -0,0 +1,167 @@
+// WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
+// Edits need to be made to the proto files
+// (see protos/camera/camera.proto)
+
+#pragma once
+
+#include "base/enum_table.h"
+#include "camera/camera.pb.h"
+#include "plugins/camera/camera.h"
+
+namespace mavcam {
+
+inline constexpr base::EnumEntry<mavcam::Camera::Mode,
+                                 mavcam::rpc::camera::Mode>
+    kCameraModeTable[] = {
+    {mavcam::Camera::Mode::Unknown, mavcam::rpc::camera::MODE_UNKNOWN, "Unknown"},
+    {mavcam::Camera::Mode::Photo, mavcam::rpc::camera::MODE_PHOTO, "Photo"},
+    {mavcam::Camera::Mode::Video, mavcam::rpc::camera::MODE_VIDEO, "Video"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::PhotosRange,
+                                 mavcam::rpc::camera::PhotosRange>
+    kCameraPhotosRangeTable[] = {
+    {mavcam::Camera::PhotosRange::All, mavcam::rpc::camera::PHOTOS_RANGE_ALL, "All"},
+    {mavcam::Camera::PhotosRange::SinceConnection,
+     mavcam::rpc::camera::PHOTOS_RANGE_SINCE_CONNECTION,
+     "Since Connection"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::Result,
+                                 mavcam::rpc::camera::CameraResult::Result>
+    kCameraResultTable[] = {
+    {mavcam::Camera::Result::Unknown,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_UNKNOWN,
+     "Unknown"},
+    {mavcam::Camera::Result::Success,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_SUCCESS,
+     "Success"},
+    {mavcam::Camera::Result::InProgress,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_IN_PROGRESS,
+     "In Progress"},
+    {mavcam::Camera::Result::Busy, mavcam::rpc::camera::CameraResult_Result_RESULT_BUSY, "Busy"},
+    {mavcam::Camera::Result::Denied,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_DENIED,
+     "Denied"},
+    {mavcam::Camera::Result::Error, mavcam::rpc::camera::CameraResult_Result_RESULT_ERROR, "Error"},
+    {mavcam::Camera::Result::Timeout,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_TIMEOUT,
+     "Timeout"},
+    {mavcam::Camera::Result::WrongArgument,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_WRONG_ARGUMENT,
+     "Wrong Argument"},
+    {mavcam::Camera::Result::NoSystem,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_NO_SYSTEM,
+     "No System"},
+    {mavcam::Camera::Result::ProtocolUnsupported,
+     mavcam::rpc::camera::CameraResult_Result_RESULT_PROTOCOL_UNSUPPORTED,
+     "Protocol Unsupported"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::VideoStreamInfo::VideoStreamStatus,
+                                 mavcam::rpc::camera::VideoStreamInfo::VideoStreamStatus>
+    kCameraVideoStreamStatusTable[] = {
+    {mavcam::Camera::VideoStreamInfo::VideoStreamStatus::NotRunning,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING,
+     "Not Running"},
+    {mavcam::Camera::VideoStreamInfo::VideoStreamStatus::InProgress,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS,
+     "In Progress"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum,
+                                 mavcam::rpc::camera::VideoStreamInfo::VideoStreamSpectrum>
+    kCameraVideoStreamSpectrumTable[] = {
+    {mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::Unknown,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN,
+     "Unknown"},
+    {mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::VisibleLight,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT,
+     "Visible Light"},
+    {mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::Infrared,
+     mavcam::rpc::camera::VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED,
+     "Infrared"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::Status::StorageStatus,
+                                 mavcam::rpc::camera::Status::StorageStatus>
+    kCameraStorageStatusTable[] = {
+    {mavcam::Camera::Status::StorageStatus::NotAvailable,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_AVAILABLE,
+     "Not Available"},
+    {mavcam::Camera::Status::StorageStatus::Unformatted,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_UNFORMATTED,
+     "Unformatted"},
+    {mavcam::Camera::Status::StorageStatus::Formatted,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_FORMATTED,
+     "Formatted"},
+    {mavcam::Camera::Status::StorageStatus::NotSupported,
+     mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_SUPPORTED,
+     "Not Supported"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::Status::StorageType,
+                                 mavcam::rpc::camera::Status::StorageType>
+    kCameraStorageTypeTable[] = {
+    {mavcam::Camera::Status::StorageType::Unknown,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_UNKNOWN,
+     "Unknown"},
+    {mavcam::Camera::Status::StorageType::UsbStick,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_USB_STICK,
+     "Usb Stick"},
+    {mavcam::Camera::Status::StorageType::Sd,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_SD,
+     "Sd"},
+    {mavcam::Camera::Status::StorageType::Microsd,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_MICROSD,
+     "Microsd"},
+    {mavcam::Camera::Status::StorageType::Hd,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_HD,
+     "Hd"},
+    {mavcam::Camera::Status::StorageType::Other,
+     mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_OTHER,
+     "Other"},
+};
+
+inline constexpr base::EnumEntry<mavcam::Camera::Information::CameraCapFlags,
+                                 mavcam::rpc::camera::Information::CameraCapFlags>
+    kCameraCameraCapFlagsTable[] = {
+    {mavcam::Camera::Information::CameraCapFlags::CaptureVideo,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_VIDEO,
+     "Capture Video"},
+    {mavcam::Camera::Information::CameraCapFlags::CaptureImage,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_IMAGE,
+     "Capture Image"},
+    {mavcam::Camera::Information::CameraCapFlags::HasModes,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_MODES,
+     "Has Modes"},
+    {mavcam::Camera::Information::CameraCapFlags::CanCaptureImageInVideoMode,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_IMAGE_IN_VIDEO_MODE,
+     "Can Capture Image In Video Mode"},
+    {mavcam::Camera::Information::CameraCapFlags::CanCaptureVideoInImageMode,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_VIDEO_IN_IMAGE_MODE,
+     "Can Capture Video In Image Mode"},
+    {mavcam::Camera::Information::CameraCapFlags::HasImageSurveyMode,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_IMAGE_SURVEY_MODE,
+     "Has Image Survey Mode"},
+    {mavcam::Camera::Information::CameraCapFlags::HasBasicZoom,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_ZOOM,
+     "Has Basic Zoom"},
+    {mavcam::Camera::Information::CameraCapFlags::HasBasicFocus,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_FOCUS,
+     "Has Basic Focus"},
+    {mavcam::Camera::Information::CameraCapFlags::HasVideoStream,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_VIDEO_STREAM,
+     "Has Video Stream"},
+    {mavcam::Camera::Information::CameraCapFlags::HasTrackingPoint,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_POINT,
+     "Has Tracking Point"},
+    {mavcam::Camera::Information::CameraCapFlags::HasTrackingRectangle,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_RECTANGLE,
+     "Has Tracking Rectangle"},
+    {mavcam::Camera::Information::CameraCapFlags::HasTrackingGeoStatus,
+     mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_GEO_STATUS,
+     "Has Tracking Geo Status"},
+};
+
+}  // namespace mavcam
@@ -1,30 +1,21 @@
 #include "camera_impl.h"
 
 #include <dlfcn.h>
-#include <string.h>
 #include <unistd.h>
 
-#include <iomanip>  // for std::setprecision
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <numeric>
 #include <thread>
 
+#include "base/call_metrics.h"
 #include "base/log.h"
+#include "plugins/camera/vendor_call.h"
 
 namespace mavcam {
 
-const std::string kCameraDisplayModeName = "CAM_DISPLAY_MODE";
-const std::string kCameraModeName = "CAM_MODE";
-const std::string kPhotoResolution = "CAM_PHOTO_RES";
-const std::string kVideoResolution = "CAM_VIDRES";
-const std::string kVideoFormat = "CAM_VIDFMT";
-const std::string kWhitebalanceModeName = "CAM_WBMODE";
-const std::string kExposureMode = "CAM_EXPMODE";
-const std::string kEVName = "CAM_EV";
-const std::string kISOName = "CAM_ISO";
-const std::string kShutterSpeedName = "CAM_SHUTTERSPD";
-
-const std::string kIrCamPalette = "IRCAM_PALETTE";
-const std::string kIrCamFFC = "IRCAM_FFC";
-
 const int32_t kPreviewWidth = 1920;
 const int32_t kPreviewPhotoHeight = 1440;
 const int32_t kPreviewVideoHeight = 1080;
@@ -36,22 +27,360 @@ const int32_t kSnapshotHalfHeight = 3472;
 const int32_t kVideoWidth = 3840;
 const int32_t kVideoHeight = 2160;
 
+/**
+ * @brief Camera value behind one option of a setting.
+ */
+template <typename Hardware>
+struct HardwareOption {
+    int32_t option;
+    Hardware value;
+};
+
+struct SnapshotSize {
+    int32_t width;
+    int32_t height;
+};
+
+struct VideoFormat {
+    int32_t width;
+    int32_t height;
+    int32_t framerate;
+};
+
+constexpr HardwareOption<mav_camera::PreivewStreamOutputType> kDisplayModeOptions[] = {
+    {0, mav_camera::PreivewStreamOutputType::RGBStreamOnly},
+    {1, mav_camera::PreivewStreamOutputType::InfraredStreamOnly},
+    {2, mav_camera::PreivewStreamOutputType::MixSideBySide},
+    {3, mav_camera::PreivewStreamOutputType::MixPIP},
+};
+
+constexpr HardwareOption<SnapshotSize> kPhotoResolutionOptions[] = {
+    {0, {kSnapshotWidth, kSnapshotHeight}},
+    {1, {kSnapshotHalfWidth, kSnapshotHalfHeight}},
+};
+
+// white balance temperature in kelvin
+constexpr HardwareOption<int32_t> kWhitebalanceOptions[] = {
+    {0, mav_camera::kAutoWhitebalanceValue},  // Auto
+    {1, 5500},                                // Daylight
+    {2, 6500},                                // Cloudy
+    {3, 7500},                                // Shady
+    {4, 2700},                                // Incandescent
+    {5, 4000},                                // Fluorescent
+};
+
+constexpr HardwareOption<VideoFormat> kVideoResolutionOptions[] = {
+    {0, {3840, 2160, 60}},
+    {1, {3840, 2160, 30}},
+    {2, {1920, 1080, 60}},
+    {3, {1920, 1080, 30}},
+};
+
+/**
+ * @brief true if the table has exactly the options the camera definition lists for the setting
+ */
+template <typename Hardware, std::size_t N>
+constexpr bool matches_definition(SettingId id, const HardwareOption<Hardware> (&table)[N]) {
+    const auto &schema = kSettingSchema[static_cast<std::size_t>(id)];
+    if (schema.option_count != N) {
+        return false;
+    }
+    for (std::size_t index = 0; index < N; ++index) {
+        bool found = false;
+        for (const auto &entry : table) {
+            found = found || entry.option == schema.options[index].number;
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(matches_definition(SettingId::CamDisplayMode, kDisplayModeOptions),
+              "CAM_DISPLAY_MODE options differ from the camera definition");
+static_assert(matches_definition(SettingId::CamPhotoRes, kPhotoResolutionOptions),
+              "CAM_PHOTO_RES options differ from the camera definition");
+static_assert(matches_definition(SettingId::CamWbmode, kWhitebalanceOptions),
+              "CAM_WBMODE options differ from the camera definition");
+static_assert(matches_definition(SettingId::CamVidres, kVideoResolutionOptions),
+              "CAM_VIDRES options differ from the camera definition");
+
+/**
+ * @brief camera value of an option, nullptr if the table has no such option
+ */
+template <typename Hardware, std::size_t N>
+static const Hardware *hardware_value(const HardwareOption<Hardware> (&table)[N], int32_t option) {
+    for (const auto &entry : table) {
+        if (entry.option == option) {
+            return &entry.value;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief option of the first camera value accepted by match, false if there is none
+ */
+template <typename Hardware, std::size_t N, typename Match>
+static bool hardware_option(const HardwareOption<Hardware> (&table)[N], Match match,
+                            int32_t &option) {
+    for (const auto &entry : table) {
+        if (match(entry.value)) {
+            option = entry.option;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Setting dispatch table, one row per SettingId in definition order.
+ *
+ * A row names the value type its handler reads and the handler applying it to the camera,
+ * nullptr for settings the camera does not implement. A new setting in the definition needs a
+ * row here, the build fails otherwise.
+ */
+struct CameraSettingHandlers {
+    struct Entry {
+        SettingId id;
+        SettingType type;
+        bool (CameraImpl::*apply)(const SettingValue &value);
+    };
+
+    static constexpr Entry kEntries[] = {
+        {SettingId::CamMode, SettingType::Enum, &CameraImpl::set_camera_mode},
+        {SettingId::CamDisplayMode, SettingType::Enum, &CameraImpl::set_camera_display_mode},
+        {SettingId::CamPhotoRes, SettingType::Enum, &CameraImpl::set_photo_resolution},
+        {SettingId::CamBurst, SettingType::Int32, &CameraImpl::set_burst_count},
+        {SettingId::CamWbmode, SettingType::Enum, &CameraImpl::set_whitebalance_mode},
+        {SettingId::CamExpmode, SettingType::Enum, &CameraImpl::set_exposure_mode},
+        {SettingId::CamShutterspd, SettingType::Float, &CameraImpl::set_shutter_speed},
+        {SettingId::CamIso, SettingType::Int32, &CameraImpl::set_iso},
+        {SettingId::CamEv, SettingType::Float, &CameraImpl::set_exposure_value},
+        {SettingId::CamVidres, SettingType::Enum, &CameraImpl::set_video_resolution},
+        {SettingId::CamVidfmt, SettingType::Enum, nullptr},
+        {SettingId::IrcamPalette, SettingType::Enum, &CameraImpl::set_ir_palette},
+        {SettingId::IrcamFfc, SettingType::Enum, &CameraImpl::set_ir_FFC},
+    };
+
+    struct Reader {
+        SettingId id;
+        bool (CameraImpl::*read)(SettingValue &value);
+    };
+
+    // settings the camera reports back, read when it opens without a snapshot and to check a
+    // restored one
+    static constexpr Reader kReaders[] = {
+        {SettingId::CamDisplayMode, &CameraImpl::get_camera_display_mode},
+        {SettingId::CamWbmode, &CameraImpl::get_whitebalance_mode},
+        {SettingId::CamEv, &CameraImpl::get_ev_value},
+        {SettingId::CamIso, &CameraImpl::get_iso_value},
+        {SettingId::CamShutterspd, &CameraImpl::get_shutter_speed_value},
+        {SettingId::CamVidres, &CameraImpl::get_video_resolution},
+    };
+
+    static constexpr bool matches_definition() {
+        if (std::size(kEntries) != kSettingCount) {
+            return false;
+        }
+        for (std::size_t index = 0; index < kSettingCount; ++index) {
+            if (kEntries[index].id != static_cast<SettingId>(index) ||
+                kEntries[index].type != kSettingSchema[index].type) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static_assert(CameraSettingHandlers::matches_definition(),
+              "setting handlers differ from the camera definition, see camera_settings_schema.h");
+
+// batch apply order, a setting may change what the later ones mean: mode before resolution and
+// exposure mode before the manual exposure values
+const std::pair<SettingId, int> kSettingApplyOrder[] = {
+    {SettingId::CamMode, 0},       {SettingId::CamDisplayMode, 1}, {SettingId::CamPhotoRes, 2},
+    {SettingId::CamBurst, 2},      {SettingId::CamVidres, 2},      {SettingId::CamVidfmt, 2},
+    {SettingId::CamWbmode, 3},     {SettingId::CamExpmode, 4},     {SettingId::CamEv, 5},
+    {SettingId::CamIso, 5},        {SettingId::CamShutterspd, 5},  {SettingId::IrcamPalette, 6},
+    {SettingId::IrcamFfc, 6},
+};
+
+static int setting_apply_order(SettingId id) {
+    for (const auto &entry : kSettingApplyOrder) {
+        if (entry.first == id) {
+            return entry.second;
+        }
+    }
+    return 7;
+}
+
+// reset_settings restores these to the definition defaults, already in apply order
+const SettingId kResetSettings[] = {
+    SettingId::CamMode,  SettingId::CamDisplayMode, SettingId::CamBurst,
+    SettingId::CamVidres, SettingId::CamVidfmt,     SettingId::CamWbmode,
+    SettingId::CamExpmode, SettingId::CamEv,        SettingId::CamIso,
+    SettingId::CamShutterspd,
+};
+
+// consecutive Timeout or NoSystem results from the vendor library before it is reloaded
+const int kBackendFailuresBeforeReload = 3;
+
+// photos of one burst, from StartBurst or CAM_BURST
+const int32_t kMaxBurstCount = 100;
+// longer series belong to the photo interval
+const float kMaxBurstIntervalS = 60;
+
+// bounds of the photo interval, a shorter one would divide by zero when a capture overruns
+const auto kMinPhotoInterval = std::chrono::milliseconds(1);
+const float kMaxPhotoIntervalS = 24 * 3600;
+
+// capture reports waiting for a slow subscriber, holds a full burst
+const std::size_t kCaptureReportCapacity = 128;
+
 #define QCOM_CAMERA_LIBERAY "libqcom_camera.so"
 #define BOSON_CAMERA_LIBRARY "libboson-sdk-clientfiles_64.so"
 
 typedef mav_camera::MavCamera *(*create_qcom_camera_fun)();
 
-CameraImpl::CameraImpl() {
+CameraImpl::CameraImpl(const CameraConfig &config)
+    : _config(config), _capture_reports(kCaptureReportCapacity) {
     _plugin_handle = NULL;
     _mav_camera = nullptr;
     _current_mode = Camera::Mode::Unknown;
     _framerate = 30;
+
+    _capture_depth = _config.capture_depth;
+    if (_capture_depth == 0) {
+        _capture_depth = CameraConfig().capture_depth;
+        base::LogWarn() << "Ignore invalid capture depth 0";
+    }
+    base::LogInfo() << "Capture depth is " << _capture_depth;
+
+    if (_config.vendor_call_log_threshold.count() > 0) {
+        set_vendor_call_log_threshold(_config.vendor_call_log_threshold);
+        base::LogInfo() << "Log vendor calls from " << _config.vendor_call_log_threshold.count()
+                        << " ms";
+    } else {
+        base::LogWarn() << "Ignore invalid vendor call log threshold "
+                        << _config.vendor_call_log_threshold.count();
+    }
+
+    if (_config.capture_index_path.empty()) {
+        base::LogWarn() << "No capture index found";
+    } else if (_capture_records.open(_config.capture_index_path)) {
+        _capture_records_at_start = _capture_records.size();
+        // capture ids go on from the previous run so the index never repeats one
+        _capture_index = _capture_records.next_capture_id();
+        base::LogInfo() << "Capture index " << _config.capture_index_path << " holds "
+                        << _capture_records_at_start << " capture(s)";
+    }
+    _capture_report_thread = std::thread(&CameraImpl::run_capture_reports, this);
+    _capture_thread = std::thread(&CameraImpl::run_captures, this);
+
+    if (_config.settings_snapshot_path.empty()) {
+        base::LogWarn() << "No settings snapshot found";
+    } else {
+        _settings_snapshot_path = _config.settings_snapshot_path;
+    }
+    _settings_verify_thread = std::thread(&CameraImpl::run_settings_verification, this);
+    _ir_bring_up_thread = std::thread(&CameraImpl::run_ir_bring_up, this);
+
+    if (_config.media_path.empty()) {
+        base::LogWarn() << "No media path found";
+    } else {
+        _status.media_folder_name = _config.media_path;
+        if (_storage_monitor.start(_config.media_path, [this]() { publish_status(); })) {
+            base::LogInfo() << "Monitor storage of " << _config.media_path;
+        }
+    }
 }
 
-CameraImpl::~CameraImpl() {}
+CameraImpl::~CameraImpl() {
+    _storage_monitor.stop();
+    {
+        std::lock_guard<std::mutex> lock(_settings_verify_mutex);
+        _settings_verify_thread_stop = true;
+    }
+    _settings_verify_cv.notify_all();
+    _settings_verify_thread.join();
+    {
+        std::lock_guard<std::mutex> lock(_ir_bring_up_mutex);
+        _ir_bring_up_thread_stop = true;
+    }
+    _ir_bring_up_cv.notify_all();
+    _ir_bring_up_thread.join();
+    free_ir_camera();
+    {
+        std::lock_guard<std::mutex> lock(_photo_interval_control_mutex);
+        stop_photo_interval_thread();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        _capture_thread_stop = true;
+    }
+    _capture_cv.notify_all();
+    _capture_thread.join();
+    {
+        std::lock_guard<std::mutex> lock(_capture_report_mutex);
+        _capture_report_thread_stop = true;
+    }
+    _capture_report_cv.notify_all();
+    _capture_report_thread.join();
+    stop_recording_timer();
+    std::lock_guard<std::mutex> lock(_backend_reload_thread_mutex);
+    if (_backend_reload_thread.joinable()) {
+        _backend_reload_thread.join();
+    }
+    // the vendor library reports storage from its own thread until it is closed
+    close_camera();
+}
 
 Camera::Result CameraImpl::prepare() {
+    std::unique_lock<std::shared_mutex> lock(_backend_mutex);
+    return open_backend();
+}
+
+Camera::Result CameraImpl::reload_backend() {
+    bool reloading = false;
+    if (!_backend_reloading.compare_exchange_strong(reloading, true)) {
+        return Camera::Result::InProgress;
+    }
+    base::LogWarn() << "Reloading camera backend";
+    auto start_time = std::chrono::steady_clock::now();
+    Camera::Result result;
+    {
+        // waits for the calls already inside the backend, new ones are answered Busy
+        std::unique_lock<std::shared_mutex> lock(_backend_mutex);
+        stop_recording_timer();
+        {
+            std::lock_guard<std::mutex> status_lock(_storage_information_mutex);
+            _status.video_on = false;
+        }
+        free_ir_camera();
+        result = open_backend();
+    }
+    _backend_failures = 0;
+    _backend_reloading = false;
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start_time)
+                          .count();
+    base::LogWarn() << "Camera backend reloaded in " << elapsed_ms << " ms : " << result;
+    return result;
+}
+
+Camera::Result CameraImpl::open_backend() {
+    auto start_time = std::chrono::steady_clock::now();
     close_camera();
+    _settings.clear();
+    _restored_ir_palette.reset();
+    // the ir camera comes up next to the RGB camera, its settings follow once it answers
+    {
+        std::lock_guard<std::mutex> lock(_ir_bring_up_mutex);
+        _ir_bring_up_pending = true;
+    }
+    _ir_bring_up_cv.notify_one();
     _plugin_handle = dlopen(QCOM_CAMERA_LIBERAY, RTLD_NOW);
     if (_plugin_handle == NULL) {
         char const *err_str = dlerror();
@@ -77,23 +406,29 @@ Camera::Result CameraImpl::prepare() {
         return Camera::Result::Error;
     }
 
-    _mav_camera->set_log_path("/data/camera/qcom_cam.log");
+    vendor_call("qcom/set_log_path",
+                [&] { _mav_camera->set_log_path("/data/camera/qcom_cam.log"); });
 
     mav_camera::Options options;
     options.preview_drm_output = false;
     options.preview_v4l2_output = false;
     options.preview_weston_output = true;
 
+    // settings of the previous run, applied in one batch instead of reading the camera back
+    CameraSettings snapshot;
+    bool warm_start = !_settings_snapshot_path.empty() && snapshot.load(_settings_snapshot_path);
+
     auto camera_mode = mav_camera::Mode::Photo;
-    const char *init_camera_mode = getenv("MAVCAM_INIT_CAMERA_MODE");
-    if (init_camera_mode != NULL) {
-        if (strncmp(init_camera_mode, "0", 1) == 0) {
-            camera_mode = mav_camera::Mode::Photo;
-            base::LogInfo() << "Manually init camera to photo mode";
-        } else if (strncmp(init_camera_mode, "1", 1) == 0) {
-            camera_mode = mav_camera::Mode::Video;
-            base::LogInfo() << "Manually init camera to video mode";
-        }
+    if (warm_start && snapshot.has(SettingId::CamMode) &&
+        snapshot.get(SettingId::CamMode).int_value == 1) {
+        camera_mode = mav_camera::Mode::Video;
+    }
+    if (_config.init_camera_mode == 0) {
+        camera_mode = mav_camera::Mode::Photo;
+        base::LogInfo() << "Manually init camera to photo mode";
+    } else if (_config.init_camera_mode == 1) {
+        camera_mode = mav_camera::Mode::Video;
+        base::LogInfo() << "Manually init camera to video mode";
     }
     options.init_mode = camera_mode;
 
@@ -112,97 +447,330 @@ Camera::Result CameraImpl::prepare() {
     options.framerate = _framerate;
     options.debug_calc_fps = false;
 
-    const char *store_prefix = getenv("MAVCAM_DEFAULT_STORE_PREFIX");
-    if (store_prefix == NULL) {
+    if (_config.store_prefix.empty()) {
         base::LogWarn() << "No store prefix found";
     } else {
-        options.store_prefix = store_prefix;
+        options.store_prefix = _config.store_prefix;
         base::LogInfo() << "Set store prefix to " << options.store_prefix;
     }
 
-    mav_camera::Result result = _mav_camera->open(options);
+    mav_camera::Result result =
+        vendor_call("qcom/open", [&] { return _mav_camera->open(options); });
     if (result == mav_camera::Result::Success) {
         base::LogDebug() << "open qcom camera success";
     }
 
-    if (options.init_mode == mav_camera::Mode::Photo) {
-        _settings.emplace_back(build_setting(kCameraModeName, "0"));
-    } else {
-        _settings.emplace_back(build_setting(kCameraModeName, "1"));
+    auto current_mode =
+        options.init_mode == mav_camera::Mode::Photo ? Camera::Mode::Photo : Camera::Mode::Video;
+    {
+        std::lock_guard<std::mutex> lock(_mode_mutex);
+        _current_mode = current_mode;
+        _mode_target = current_mode;
+        _mode_state = ModeState::Ready;
     }
-
-    _mav_camera->subscribe_storage_information(
-        [&](mav_camera::Result result, mav_camera::StorageInformation storage_information) {
-            std::lock_guard<std::mutex> lock(_storage_information_mutex);
-            _current_storage_information = storage_information;
-        });
-
-    // get all settings
-    auto display_mode = get_camera_display_mode();
-    _settings.emplace_back(build_setting(kCameraDisplayModeName, display_mode));
-    _settings.emplace_back(build_setting(kPhotoResolution, "1"));  // 1 for 4624x3472
-    std::string wb_mode = get_whitebalance_mode();
-    _settings.emplace_back(build_setting(kWhitebalanceModeName, wb_mode));
+    _settings.set_int(SettingId::CamMode, current_mode == Camera::Mode::Photo ? 0 : 1);
+
+    auto on_storage_information =
+        [&](mav_camera::Result /* storage_result */,
+            mav_camera::StorageInformation storage_information) {
+            std::atomic_store(
+                &_current_storage_information,
+                std::make_shared<const mav_camera::StorageInformation>(storage_information));
+            publish_status();
+        };
+    vendor_call("qcom/subscribe_storage_information",
+                [&] { _mav_camera->subscribe_storage_information(on_storage_information); });
+
+    // settings the camera opens with
+    _settings.set_int(SettingId::CamPhotoRes, 1);  // 1 for 4624x3472
+    _settings.set_int(SettingId::CamBurst, 1);
+    _burst_count.store(1, std::memory_order_relaxed);
     // 0 for auto exposure mode
-    _settings.emplace_back(build_setting(kExposureMode, "0"));
-    std::string ev_value = get_ev_value();
-    _settings.emplace_back(build_setting(kEVName, ev_value));
-    std::string iso_value = get_iso_value();
-    _settings.emplace_back(build_setting(kISOName, iso_value));
-    std::string shutter_speed_value = get_shutter_speed_value();
-    _settings.emplace_back(build_setting(kShutterSpeedName, shutter_speed_value));
-    _settings.emplace_back(build_setting(kVideoFormat, "1"));
-    std::string video_resolution = get_video_resolution();
-    _settings.emplace_back(build_setting(kVideoResolution, video_resolution));
-
-    auto ir_result = init_ir_camera();
-    if (ir_result) {
-        ColorMode color_mode;
-        _ir_camera->get_boson_color_mode(&color_mode);
-        base::LogDebug() << "Current ir palette is " << int(color_mode);
-        _settings.emplace_back(build_setting(kIrCamPalette, std::to_string(color_mode)));
-        _settings.emplace_back(build_setting(kIrCamFFC, "0"));
+    _settings.set_int(SettingId::CamExpmode, 0);
+    _settings.set_int(SettingId::CamVidfmt, 1);
+    if (!warm_start) {
+        for (const auto &reader : CameraSettingHandlers::kReaders) {
+            // a setting the camera cannot report starts from the definition default
+            auto value = CameraSettings::default_value(reader.id);
+            (this->*reader.read)(value);
+            _settings.set(reader.id, value);
+        }
+    }
+
+    if (warm_start) {
+        restore_settings(snapshot);
+        {
+            std::lock_guard<std::mutex> lock(_settings_verify_mutex);
+            _settings_verify_pending = true;
+        }
+        // runs once the caller lets go of the backend
+        _settings_verify_cv.notify_one();
+    } else {
+        save_settings_snapshot();
     }
 
     base::LogDebug() << "Init settings :";
-    for (const auto &setting : _settings) {
+    for (const auto &setting : _settings.render_all()) {
         base::LogDebug() << "  - " << setting.setting_id << " : " << setting.option.option_id;
     }
+
+    // subscribers may have been registered before the camera was opened
+    _mode_subscriptions.notify(current_mode);
+    _information_subscriptions.notify(information());
+    _video_stream_info_subscriptions.notify(video_stream_info());
+    _current_settings_subscriptions.notify(render_settings());
+    publish_status();
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start_time)
+                          .count();
+    base::LogInfo() << "Camera ready in " << elapsed_ms << " ms";
     return Camera::Result::Success;
 }
 
+void CameraImpl::restore_settings(const CameraSettings &snapshot) {
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<SettingId> ids;
+    for (std::size_t index = 0; index < kSettingCount; ++index) {
+        auto id = static_cast<SettingId>(index);
+        // the camera was opened in the saved mode and a flat field correction is not kept
+        if (!snapshot.has(id) || id == SettingId::CamMode || id == SettingId::IrcamFfc) {
+            continue;
+        }
+        if (id == SettingId::IrcamPalette) {
+            // applied by the ir bring-up
+            _restored_ir_palette = snapshot.get(id);
+            continue;
+        }
+        ids.push_back(id);
+    }
+    std::stable_sort(ids.begin(), ids.end(), [](SettingId left, SettingId right) {
+        return setting_apply_order(left) < setting_apply_order(right);
+    });
+
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    std::size_t failed = 0;
+    for (auto id : ids) {
+        if (CameraSettingHandlers::kEntries[static_cast<std::size_t>(id)].apply == nullptr) {
+            // not a camera setting, only kept in the cache
+            _settings.set(id, snapshot.get(id));
+        } else if (apply_setting(id, snapshot.get(id)) != Camera::Result::Success) {
+            ++failed;
+        }
+    }
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start_time)
+                          .count();
+    base::LogInfo() << "Restored " << ids.size() - failed << "/" << ids.size()
+                    << " setting(s) from " << _settings_snapshot_path << " in " << elapsed_ms
+                    << " ms";
+}
+
+void CameraImpl::save_settings_snapshot() {
+    if (_settings_snapshot_path.empty()) {
+        return;
+    }
+    if (!_restored_ir_palette) {
+        _settings.save(_settings_snapshot_path);
+        return;
+    }
+    // keep the palette the ir camera has not taken yet
+    auto settings = _settings;
+    settings.set(SettingId::IrcamPalette, *_restored_ir_palette);
+    settings.save(_settings_snapshot_path);
+}
+
+void CameraImpl::verify_settings() {
+    std::shared_lock<std::shared_mutex> backend_lock(_backend_mutex);
+    if (_backend_reloading || _mav_camera == nullptr) {
+        // a reload restores the snapshot again and asks for another check
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    std::size_t corrected = 0;
+    for (const auto &reader : CameraSettingHandlers::kReaders) {
+        SettingValue value;
+        if (!(this->*reader.read)(value)) {
+            continue;
+        }
+        if (_settings.has(reader.id)) {
+            const auto &cached = _settings.get(reader.id);
+            bool same = CameraSettings::schema(reader.id).type == SettingType::Float
+                            ? std::fabs(cached.float_value - value.float_value) <=
+                                  1e-6f * std::fmax(1.0f, std::fabs(value.float_value))
+                            : cached.int_value == value.int_value;
+            if (same) {
+                continue;
+            }
+            base::LogWarn() << "Camera has " << CameraSettings::schema(reader.id).name << " "
+                            << CameraSettings::render(reader.id, value).option.option_id
+                            << " instead of "
+                            << CameraSettings::render(reader.id, cached).option.option_id;
+        }
+        _settings.set(reader.id, value);
+        ++corrected;
+    }
+    base::LogInfo() << "Verified restored settings, " << corrected << " corrected";
+    if (corrected > 0) {
+        save_settings_snapshot();
+        _current_settings_subscriptions.notify(render_settings());
+    }
+}
+
+void CameraImpl::run_settings_verification() {
+    std::unique_lock<std::mutex> lock(_settings_verify_mutex);
+    while (true) {
+        _settings_verify_cv.wait(lock, [this]() {
+            return _settings_verify_thread_stop || _settings_verify_pending;
+        });
+        if (_settings_verify_thread_stop) {
+            break;
+        }
+        _settings_verify_pending = false;
+        lock.unlock();
+        verify_settings();
+        lock.lock();
+    }
+}
+
 Camera::Result CameraImpl::take_photo() {
-    auto result = _mav_camera->take_photo();
-    return convert_camera_result_to_mav_result(result);
+    return queue_capture(_burst_count.load(std::memory_order_relaxed),
+                         std::chrono::steady_clock::duration::zero());
+}
+
+Camera::Result CameraImpl::start_burst(int32_t count, float interval_s) {
+    base::LogDebug() << "call start burst " << count << " " << interval_s;
+    // also rejects nan
+    if (count < 1 || count > kMaxBurstCount ||
+        !(interval_s >= 0 && interval_s <= kMaxBurstIntervalS)) {
+        return Camera::Result::WrongArgument;
+    }
+    return queue_capture(count, std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                    std::chrono::duration<float>(interval_s)));
 }
 
 Camera::Result CameraImpl::start_photo_interval(float interval_s) {
     base::LogDebug() << "call start photo interval " << interval_s;
-    return Camera::Result::ProtocolUnsupported;
+    // also rejects nan, the upper bound keeps the conversion from overflowing
+    if (!(interval_s > 0 && interval_s <= kMaxPhotoIntervalS)) {
+        return Camera::Result::WrongArgument;
+    }
+    auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<float>(interval_s));
+    if (interval < kMinPhotoInterval) {
+        return Camera::Result::WrongArgument;
+    }
+    {
+        Camera::Result unavailable;
+        auto backend_lock = lock_backend(unavailable);
+        if (!backend_lock) {
+            return unavailable;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(_photo_interval_control_mutex);
+        // a new interval replaces the running one
+        stop_photo_interval_thread();
+        _photo_interval_stop = false;
+        _photo_interval_thread = std::thread(&CameraImpl::run_photo_interval, this, interval);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_storage_information_mutex);
+        _status.photo_interval_on = true;
+    }
+    publish_status();
+    base::LogInfo() << "Photo interval started, one photo every " << interval_s << " s";
+    return Camera::Result::Success;
+}
+
+Camera::Result CameraImpl::queue_capture(int32_t count,
+                                         std::chrono::steady_clock::duration interval) {
+    {
+        Camera::Result unavailable;
+        auto backend_lock = lock_backend(unavailable);
+        if (!backend_lock) {
+            return unavailable;
+        }
+    }
+    auto storage = _storage_monitor.snapshot();
+    if (storage != nullptr && storage->remaining_photos < count) {
+        base::LogWarn() << "Storage is full, room for " << storage->remaining_photos
+                        << " photo(s) and " << storage->remaining_video_s << " s of video";
+        return Camera::Result::Denied;
+    }
+    int32_t first_id;
+    {
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        if (_captures_in_flight >= _capture_depth) {
+            base::LogDebug() << "Capture queue is full, " << _captures_in_flight << " in flight";
+            return Camera::Result::Busy;
+        }
+        ++_captures_in_flight;
+        first_id = _capture_index;
+        _capture_index += count;
+        _pending_captures.push_back(CaptureRequest{first_id, count, interval});
+    }
+    _capture_cv.notify_one();
+    base::LogDebug() << "Queued " << count << " capture(s) from " << first_id;
+    return Camera::Result::Success;
 }
 
 Camera::Result CameraImpl::stop_photo_interval() {
     base::LogDebug() << "call stop photo interval";
-    return Camera::Result::ProtocolUnsupported;
+    {
+        std::lock_guard<std::mutex> lock(_photo_interval_control_mutex);
+        stop_photo_interval_thread();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_storage_information_mutex);
+        _status.photo_interval_on = false;
+    }
+    publish_status();
+    return Camera::Result::Success;
 }
 
 Camera::Result CameraImpl::start_video() {
     base::LogDebug() << "call start video";
-    auto result = _mav_camera->start_video();
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
+    }
+    hold_mode();
+    auto result = vendor_call("qcom/start_video", [&] { return _mav_camera->start_video(); });
+    release_mode();
+    watch_backend_result(result);
     auto mav_result = convert_camera_result_to_mav_result(result);
     if (mav_result == Camera::Result::Success) {
-        _status.video_on = true;
-        _start_video_time = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(_storage_information_mutex);
+            _status.video_on = true;
+            _start_video_time = std::chrono::steady_clock::now();
+        }
+        publish_status();
+        start_recording_timer();
     }
     return mav_result;
 }
 
 Camera::Result CameraImpl::stop_video() {
     base::LogDebug() << "call stop video";
-    auto result = _mav_camera->stop_video();
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
+    }
+    hold_mode();
+    auto result = vendor_call("qcom/stop_video", [&] { return _mav_camera->stop_video(); });
+    release_mode();
+    watch_backend_result(result);
     auto mav_result = convert_camera_result_to_mav_result(result);
     if (mav_result == Camera::Result::Success) {
-        _status.video_on = false;
+        stop_recording_timer();
+        {
+            std::lock_guard<std::mutex> lock(_storage_information_mutex);
+            _status.video_on = false;
+        }
+        publish_status();
     }
     // std::thread stop_thread(&CameraImpl::stop_video_async, this);
     // stop_thread.detach();
@@ -220,51 +788,87 @@ Camera::Result CameraImpl::stop_video_streaming(int32_t stream_id) {
 }
 
 Camera::Result CameraImpl::set_mode(Camera::Mode mode) {
-    if (_current_mode == mode) {
-        // same mode do not change again
-        return Camera::Result::Success;
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
     }
-
-    base::LogDebug() << "call set camera to mode " << mode;
-    _current_mode = mode;
-    mav_camera::Result result = mav_camera::Result::Unknown;
-    // also need change mode in settings
-    if (_current_mode == Camera::Mode::Photo) {
-        auto setting = build_setting(kCameraModeName, "0");
-        set_setting(setting);
-
-        result = _mav_camera->set_mode(mav_camera::Mode::Photo);
-    } else {
-        auto setting = build_setting(kCameraModeName, "1");
-        set_setting(setting);
-
-        result = _mav_camera->set_mode(mav_camera::Mode::Video);
+    uint64_t switches;
+    {
+        std::unique_lock<std::mutex> lock(_mode_mutex);
+        if (_mode_state == ModeState::Idle) {
+            return Camera::Result::NoSystem;
+        }
+        if (_mode_state == ModeState::Ready && _current_mode == mode) {
+            return Camera::Result::Success;
+        }
+        _mode_target = mode;
+        switches = _mode_switches;
+        if (_mode_state == ModeState::Switching) {
+            // the pending switch moves on to this mode, the backend is reconfigured once for
+            // every request made meanwhile instead of once each
+            _mode_cv.wait(lock, [&]() { return _mode_switches != switches; });
+            return _current_mode == mode ? Camera::Result::Success : _mode_switch_result;
+        }
+        // claimed under the same lock, requests made while this waits for the settings join it
+        _mode_state = ModeState::Switching;
     }
-
-    return convert_camera_result_to_mav_result(result);
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    std::unique_lock<std::mutex> mode_lock(_mode_mutex);
+    if (_mode_switches != switches) {
+        // a CAM_MODE change ran the claimed switch while this waited
+        return _current_mode == mode ? Camera::Result::Success : _mode_switch_result;
+    }
+    auto previous_mode = _current_mode;
+    auto result = run_mode_switch(mode, mode_lock);
+    if (this->mode() != previous_mode) {
+        save_settings_snapshot();
+        _current_settings_subscriptions.notify(render_settings());
+    }
+    return result;
 }
 
 std::pair<Camera::Result, std::vector<Camera::CaptureInfo>> CameraImpl::list_photos(
     Camera::PhotosRange photos_range) {
     base::LogDebug() << "call list_photos " << photos_range;
+    if (!_capture_records.is_open()) {
+        return {Camera::Result::Error, {}};
+    }
+    auto first = photos_range == Camera::PhotosRange::SinceConnection ? _capture_records_at_start
+                                                                      : 0;
+    return {Camera::Result::Success, _capture_records.list(first)};
+}
 
-    return {Camera::Result::ProtocolUnsupported, {}};
+Camera::ModeHandle CameraImpl::subscribe_mode(const Camera::ModeCallback &callback) {
+    base::LogDebug() << "call subscribe_mode";
+    auto handle = _mode_subscriptions.subscribe(callback);
+    callback(mode());
+    return handle;
 }
 
-void CameraImpl::mode_async(const Camera::ModeCallback &callback) {
-    base::LogDebug() << "call mode_async";
-    callback(_current_mode);
+void CameraImpl::unsubscribe_mode(Camera::ModeHandle handle) {
+    _mode_subscriptions.unsubscribe(handle);
 }
 
 Camera::Mode CameraImpl::mode() const {
+    std::lock_guard<std::mutex> lock(_mode_mutex);
     return _current_mode;
 }
 
-void CameraImpl::information_async(const Camera::InformationCallback &callback) {
-    base::LogDebug() << "call information_async";
-    if (callback) {
+Camera::InformationHandle CameraImpl::subscribe_information(
+    const Camera::InformationCallback &callback) {
+    base::LogDebug() << "call subscribe_information";
+    auto handle = _information_subscriptions.subscribe(callback);
+    std::shared_lock<std::shared_mutex> lock(_backend_mutex, std::try_to_lock);
+    if (lock) {
+        // otherwise the backend is being opened and notifies every subscriber once it is
         callback(information());
     }
+    return handle;
+}
+
+void CameraImpl::unsubscribe_information(Camera::InformationHandle handle) {
+    _information_subscriptions.unsubscribe(handle);
 }
 
 Camera::Information CameraImpl::information() const {
@@ -273,7 +877,8 @@ Camera::Information CameraImpl::information() const {
     mav_camera::Information in_info;
     mav_camera::Result result = mav_camera::Result::NoSystem;
     if (_mav_camera != nullptr) {
-        result = _mav_camera->get_information(in_info);
+        result = vendor_call("qcom/get_information",
+                             [&] { return _mav_camera->get_information(in_info); });
     }
     if (result == mav_camera::Result::Success) {
         out_info.vendor_name = "Aeroratech";
@@ -286,7 +891,7 @@ Camera::Information CameraImpl::information() const {
         out_info.vertical_resolution_px = in_info.vertical_resolution_px;
         out_info.lens_id = in_info.lens_id;
         //TODO (Thomas) : hard code
-        out_info.definition_file_version = 5;
+        out_info.definition_file_version = 6;
         out_info.definition_file_uri = "mftp://definition/D64TR.xml";
 
     } else {
@@ -311,9 +916,20 @@ Camera::Information CameraImpl::information() const {
     return out_info;
 }
 
-void CameraImpl::video_stream_info_async(const Camera::VideoStreamInfoCallback &callback) {
-    base::LogDebug() << "call video_stream_info_async";
-    callback(video_stream_info());
+Camera::VideoStreamInfoHandle CameraImpl::subscribe_video_stream_info(
+    const Camera::VideoStreamInfoCallback &callback) {
+    base::LogDebug() << "call subscribe_video_stream_info";
+    auto handle = _video_stream_info_subscriptions.subscribe(callback);
+    std::shared_lock<std::shared_mutex> lock(_backend_mutex, std::try_to_lock);
+    if (lock) {
+        // otherwise the backend is being opened and notifies every subscriber once it is
+        callback(video_stream_info());
+    }
+    return handle;
+}
+
+void CameraImpl::unsubscribe_video_stream_info(Camera::VideoStreamInfoHandle handle) {
+    _video_stream_info_subscriptions.unsubscribe(handle);
 }
 
 std::vector<Camera::VideoStreamInfo> CameraImpl::video_stream_info() const {
@@ -325,7 +941,8 @@ std::vector<Camera::VideoStreamInfo> CameraImpl::video_stream_info() const {
         mav_camera::Result result;
         int32_t preview_width = 0;
         int32_t preview_height = 0;
-        std::tie(result, preview_width, preview_height) = _mav_camera->get_preview_resolution();
+        std::tie(result, preview_width, preview_height) = vendor_call(
+            "qcom/get_preview_resolution", [&] { return _mav_camera->get_preview_resolution(); });
         normal_video_stream.settings.horizontal_resolution_pix = preview_width;
         normal_video_stream.settings.vertical_resolution_pix = preview_height;
         // TODO(thomas) : not set video bitrate for now
@@ -342,83 +959,139 @@ std::vector<Camera::VideoStreamInfo> CameraImpl::video_stream_info() const {
     return {};
 }
 
-void CameraImpl::capture_info_async(const Camera::CaptureInfoCallback &callback) {
-    base::LogDebug() << "call capture_info_async";
-    _capture_info_callback = callback;
+Camera::CaptureInfoHandle CameraImpl::subscribe_capture_info(
+    const Camera::CaptureInfoCallback &callback) {
+    base::LogDebug() << "call subscribe_capture_info";
+    // capture info are events, nothing to send until the next capture
+    return _capture_info_subscriptions.subscribe(callback);
+}
+
+void CameraImpl::unsubscribe_capture_info(Camera::CaptureInfoHandle handle) {
+    _capture_info_subscriptions.unsubscribe(handle);
 }
 
 Camera::CaptureInfo CameraImpl::capture_info() const {
     return Camera::CaptureInfo();
 }
 
-void CameraImpl::status_async(const Camera::StatusCallback &callback) {
-    // base::LogDebug() << "call status_async";
+Camera::StatusHandle CameraImpl::subscribe_status(const Camera::StatusCallback &callback) {
+    base::LogDebug() << "call subscribe_status";
+    auto handle = _status_subscriptions.subscribe(callback);
     callback(status());
+    return handle;
+}
+
+void CameraImpl::unsubscribe_status(Camera::StatusHandle handle) {
+    _status_subscriptions.unsubscribe(handle);
 }
 
 Camera::Status CameraImpl::status() const {
-    std::lock_guard<std::mutex> lock(_storage_information_mutex);
-    _status.available_storage_mib = _current_storage_information.available_storage_mib;
-    _status.total_storage_mib = _current_storage_information.total_storage_mib;
-    _status.storage_id = _current_storage_information.storage_id;
-    switch (_current_storage_information.storage_status) {
+    Camera::Status status;
+    std::chrono::steady_clock::time_point start_video_time;
+    {
+        std::lock_guard<std::mutex> lock(_storage_information_mutex);
+        status = _status;
+        start_video_time = _start_video_time;
+    }
+    auto storage_information = std::atomic_load(&_current_storage_information);
+    if (storage_information != nullptr) {
+        fill_storage_status(*storage_information, status);
+    }
+    // the monitor follows the writes, its numbers are newer than the vendor report
+    auto storage = _storage_monitor.snapshot();
+    if (storage != nullptr) {
+        status.used_storage_mib = storage->used_mib;
+        status.available_storage_mib = storage->available_mib;
+        status.total_storage_mib = storage->total_mib;
+    }
+    if (status.video_on) {
+        auto current_time = std::chrono::steady_clock::now();
+        status.recording_time_s =
+            std::chrono::duration_cast<std::chrono::seconds>(current_time - start_video_time)
+                .count();
+    } else {
+        status.recording_time_s = 0;
+    }
+    return status;
+}
+
+void CameraImpl::fill_storage_status(const mav_camera::StorageInformation &storage_information,
+                                     Camera::Status &status) {
+    status.used_storage_mib = storage_information.used_storage_mib;
+    status.available_storage_mib = storage_information.available_storage_mib;
+    status.total_storage_mib = storage_information.total_storage_mib;
+    status.storage_id = storage_information.storage_id;
+    switch (storage_information.storage_status) {
         case mav_camera::StorageInformation::StorageStatus::Formatted:
-            _status.storage_status = Camera::Status::StorageStatus::Formatted;
+            status.storage_status = Camera::Status::StorageStatus::Formatted;
             break;
         case mav_camera::StorageInformation::StorageStatus::Unformatted:
-            _status.storage_status = Camera::Status::StorageStatus::Unformatted;
+            status.storage_status = Camera::Status::StorageStatus::Unformatted;
             break;
         case mav_camera::StorageInformation::StorageStatus::NotAvailable:
-            _status.storage_status = Camera::Status::StorageStatus::NotAvailable;
+            status.storage_status = Camera::Status::StorageStatus::NotAvailable;
             break;
         case mav_camera::StorageInformation::StorageStatus::NotSupported:
-            _status.storage_status = Camera::Status::StorageStatus::NotSupported;
+            status.storage_status = Camera::Status::StorageStatus::NotSupported;
             break;
     }
 
-    switch (_current_storage_information.storage_type) {
+    switch (storage_information.storage_type) {
         case mav_camera::StorageType::Hd:
-            _status.storage_type = Camera::Status::StorageType::Hd;
+            status.storage_type = Camera::Status::StorageType::Hd;
             break;
         case mav_camera::StorageType::Microsd:
-            _status.storage_type = Camera::Status::StorageType::Microsd;
+            status.storage_type = Camera::Status::StorageType::Microsd;
             break;
         case mav_camera::StorageType::Other:
-            _status.storage_type = Camera::Status::StorageType::Other;
+            status.storage_type = Camera::Status::StorageType::Other;
             break;
         case mav_camera::StorageType::Sd:
-            _status.storage_type = Camera::Status::StorageType::Sd;
+            status.storage_type = Camera::Status::StorageType::Sd;
             break;
         case mav_camera::StorageType::Unknown:
-            _status.storage_type = Camera::Status::StorageType::Unknown;
+            status.storage_type = Camera::Status::StorageType::Unknown;
             break;
         case mav_camera::StorageType::UsbStick:
-            _status.storage_type = Camera::Status::StorageType::UsbStick;
+            status.storage_type = Camera::Status::StorageType::UsbStick;
             break;
     }
-    if (_status.video_on) {
-        auto current_time = std::chrono::steady_clock::now();
-        _status.recording_time_s =
-            std::chrono::duration_cast<std::chrono::seconds>(current_time - _start_video_time)
-                .count();
-    } else {
-        _status.recording_time_s = 0;
+}
+
+Camera::CurrentSettingsHandle CameraImpl::subscribe_current_settings(
+    const Camera::CurrentSettingsCallback &callback) {
+    base::LogDebug() << "call subscribe_current_settings";
+    auto handle = _current_settings_subscriptions.subscribe(callback);
+    std::shared_lock<std::shared_mutex> lock(_backend_mutex, std::try_to_lock);
+    if (lock) {
+        // otherwise the backend is being opened and notifies every subscriber once it is
+        callback(current_settings());
     }
-    return _status;
+    return handle;
 }
 
-void CameraImpl::current_settings_async(const Camera::CurrentSettingsCallback &callback) {
-    base::LogDebug() << "call current_settings_async";
-    callback(_settings);
+void CameraImpl::unsubscribe_current_settings(Camera::CurrentSettingsHandle handle) {
+    _current_settings_subscriptions.unsubscribe(handle);
 }
 
 std::vector<Camera::Setting> CameraImpl::current_settings() const {
-    return _settings;
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    return render_settings();
+}
+
+std::vector<Camera::Setting> CameraImpl::render_settings() const {
+    return _settings.render_all();
 }
 
-void CameraImpl::possible_setting_options_async(
+Camera::PossibleSettingOptionsHandle CameraImpl::subscribe_possible_setting_options(
     const Camera::PossibleSettingOptionsCallback &callback) {
     // TODO :)
+    return _possible_setting_options_subscriptions.subscribe(callback);
+}
+
+void CameraImpl::unsubscribe_possible_setting_options(
+    Camera::PossibleSettingOptionsHandle handle) {
+    _possible_setting_options_subscriptions.unsubscribe(handle);
 }
 
 std::vector<Camera::SettingOptions> CameraImpl::possible_setting_options() const {
@@ -427,78 +1100,51 @@ std::vector<Camera::SettingOptions> CameraImpl::possible_setting_options() const
 }
 
 Camera::Result CameraImpl::set_setting(Camera::Setting setting) {
-    base::LogDebug() << "call set " << setting.setting_id << " to value "
-                     << setting.option.option_id;
-    bool set_success = false;
-    //camera mode settings
-    if (setting.setting_id == kCameraModeName) {
-        if (setting.option.option_id == "0") {
-            set_mode(Camera::Mode::Photo);
-        } else {
-            set_mode(Camera::Mode::Video);
-        }
-    } else if (setting.setting_id == kCameraDisplayModeName) {
-        set_success = set_camera_display_mode(setting.option.option_id);
-    } else if (setting.setting_id == kPhotoResolution) {
-        if (setting.option.option_id == "0") {
-            auto result = _mav_camera->set_snapshot_resolution(kSnapshotWidth, kSnapshotHeight);
-            set_success = result == mav_camera::Result::Success;
-        } else if (setting.option.option_id == "1") {
-            auto result =
-                _mav_camera->set_snapshot_resolution(kSnapshotHalfWidth, kSnapshotHalfHeight);
-            set_success = result == mav_camera::Result::Success;
-        }
-    } else if (setting.setting_id == kWhitebalanceModeName) {  // whitebalance mode
-        set_success = set_whitebalance_mode(setting.option.option_id);
-    } else if (setting.setting_id == kExposureMode) {
-        // exposure mode not set to camera implement
-        set_success = true;
-    } else if (setting.setting_id == kEVName) {  // exposure value
-        auto result = _mav_camera->set_exposure_value(std::stof(setting.option.option_id));
-        set_success = result == mav_camera::Result::Success;
-    } else if (setting.setting_id == kISOName) {
-        auto result = _mav_camera->set_iso(std::stoi(setting.option.option_id));
-        set_success = result == mav_camera::Result::Success;
-    } else if (setting.setting_id == kShutterSpeedName) {
-        auto result = _mav_camera->set_shutter_speed(setting.option.option_id);
-        set_success = result == mav_camera::Result::Success;
-    } else if (setting.setting_id == kVideoResolution) {
-        set_success = set_video_resolution(setting.option.option_id);
-    } else if (setting.setting_id == kIrCamPalette) {
-        set_success = set_ir_palette(setting.option.option_id);
-    } else if (setting.setting_id == kIrCamFFC) {
-        set_success = set_ir_FFC(setting.option.option_id);
-    } else {
-        base::LogError() << "Not implement setting" << setting.setting_id;
-        set_success = false;
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
     }
-
-    if (set_success) {  // update current setting
-        for (auto &it : _settings) {
-            if (it.setting_id == setting.setting_id) {
-                it.option.option_id = setting.option.option_id;
-                it.option.option_description = setting.option.option_description;
-            }
-        }
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    SettingId id;
+    SettingValue value;
+    if (parse_setting(setting, id, value) && apply_setting(id, value) == Camera::Result::Success) {
+        save_settings_snapshot();
+        _current_settings_subscriptions.notify(render_settings());
     }
     return Camera::Result::Success;
 }
 
 std::pair<Camera::Result, Camera::Setting> CameraImpl::get_setting(Camera::Setting setting) {
     base::LogDebug() << "call get_setting " << setting.setting_id;
-    for (auto &it : _settings) {
-        if (it.setting_id == setting.setting_id) {
-            setting.option.option_id = it.option.option_id;
-            setting.option.option_description = it.option.option_description;
-            return {Camera::Result::Success, setting};
-        }
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return {unavailable, setting};
     }
-    return {Camera::Result::WrongArgument, setting};
+    SettingId id;
+    if (!CameraSettings::find(setting.setting_id, id)) {
+        return {Camera::Result::WrongArgument, setting};
+    }
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    if (!_settings.has(id)) {
+        return {Camera::Result::WrongArgument, setting};
+    }
+    setting.option = CameraSettings::render(id, _settings.get(id)).option;
+    return {Camera::Result::Success, setting};
 }
 
 Camera::Result CameraImpl::format_storage(int32_t storage_id) {
     base::LogDebug() << "call format storage " << storage_id;
-    auto result = _mav_camera->format_storage(storage_id);
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
+    }
+    auto result = vendor_call("qcom/format_storage",
+                              [&] { return _mav_camera->format_storage(storage_id); });
+    watch_backend_result(result);
+    publish_status();
     return convert_camera_result_to_mav_result(result);
 }
 
@@ -510,33 +1156,214 @@ Camera::Result CameraImpl::select_camera(int32_t camera_id) {
 Camera::Result CameraImpl::reset_settings() {
     base::LogDebug() << "call reset settings";
     // reset all value to default value
-    set_mode(Camera::Mode::Photo);
-    set_camera_display_mode("0");
-    set_setting(build_setting(kCameraDisplayModeName, "0"));
-
-    set_whitebalance_mode("0");
-    set_setting(build_setting(kWhitebalanceModeName, "0"));
-
-    set_setting(build_setting("CAM_EXPMODE", "0"));
-    set_setting(build_setting("CAM_EV", "0"));
-    set_setting(build_setting("CAM_ISO", "125"));
-    set_setting(build_setting("CAM_SHUTTERSPD", "1/100"));
-    set_setting(build_setting("CAM_VIDFMT", "1"));
-    set_setting(build_setting("CAM_VIDRES", "0"));
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
+    }
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    bool changed = false;
+    for (auto id : kResetSettings) {
+        changed |= apply_setting(id, CameraSettings::default_value(id)) == Camera::Result::Success;
+    }
+    if (changed) {
+        save_settings_snapshot();
+        _current_settings_subscriptions.notify(render_settings());
+    }
     return Camera::Result::Success;
 }
 
 Camera::Result CameraImpl::set_timestamp(int64_t timestamp) {
     base::LogDebug() << "call set_timestamp " << timestamp;
-    if (_mav_camera != nullptr) {
-        _mav_camera->set_timestamp(timestamp);
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return unavailable;
+    }
+    vendor_call("qcom/set_timestamp", [&] { return _mav_camera->set_timestamp(timestamp); });
+    return Camera::Result::Success;
+}
+
+std::pair<Camera::Result, std::vector<Camera::AppliedSetting>> CameraImpl::set_settings(
+    std::vector<Camera::Setting> settings) {
+    base::LogDebug() << "call set_settings with " << settings.size() << " settings";
+    Camera::Result unavailable;
+    auto backend_lock = lock_backend(unavailable);
+    if (!backend_lock) {
+        return {unavailable, {}};
+    }
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    return apply_settings(settings);
+}
+
+std::pair<Camera::Result, std::vector<Camera::CallMetric>> CameraImpl::get_metrics() const {
+    std::vector<Camera::CallMetric> call_metrics;
+    for (const auto &metric : base::call_metrics().snapshot()) {
+        Camera::CallMetric call_metric;
+        call_metric.name = metric.name;
+        call_metric.count = metric.count;
+        call_metric.error_count = metric.error_count;
+        call_metric.total_latency_us = metric.total_latency_us;
+        call_metric.max_latency_us = metric.max_latency_us;
+        call_metric.p50_latency_us = metric.p50_latency_us;
+        call_metric.p90_latency_us = metric.p90_latency_us;
+        call_metric.p99_latency_us = metric.p99_latency_us;
+        call_metrics.push_back(call_metric);
+    }
+    return {Camera::Result::Success, call_metrics};
+}
+
+Camera::Result CameraImpl::apply_mode(Camera::Mode mode) {
+    std::unique_lock<std::mutex> lock(_mode_mutex);
+    if (_mode_state == ModeState::Idle) {
+        return Camera::Result::NoSystem;
+    }
+    // a switch only runs under _settings_mutex, held here, so a Switching one is claimed by a
+    // SetMode still waiting for it and is run here instead
+    if (_mode_state == ModeState::Ready) {
+        if (_current_mode == mode) {
+            return Camera::Result::Success;
+        }
+        _mode_state = ModeState::Switching;
+    }
+    _mode_target = mode;
+    return run_mode_switch(mode, lock);
+}
+
+Camera::Result CameraImpl::run_mode_switch(Camera::Mode mode, std::unique_lock<std::mutex> &lock) {
+    // captures and video calls already in the backend finish in the current mode
+    _mode_cv.wait(lock, [this]() { return _mode_users == 0; });
+    auto result = Camera::Result::Success;
+    while (result == Camera::Result::Success && _current_mode != _mode_target) {
+        auto target = _mode_target;
+        lock.unlock();
+        base::LogDebug() << "call set camera to mode " << target;
+        auto backend_mode =
+            target == Camera::Mode::Photo ? mav_camera::Mode::Photo : mav_camera::Mode::Video;
+        auto backend_result =
+            vendor_call("qcom/set_mode", [&] { return _mav_camera->set_mode(backend_mode); });
+        watch_backend_result(backend_result);
+        result = convert_camera_result_to_mav_result(backend_result);
+        if (result == Camera::Result::Success) {
+            // also need change mode in settings
+            _settings.set_int(SettingId::CamMode, target == Camera::Mode::Photo ? 0 : 1);
+        }
+        lock.lock();
+        if (result == Camera::Result::Success) {
+            // published only once the backend runs in it
+            _current_mode = target;
+            lock.unlock();
+            _mode_subscriptions.notify(target);
+            lock.lock();
+        } else {
+            base::LogWarn() << "Camera stays in mode " << _current_mode << ", switch to "
+                            << target << " failed : " << result;
+        }
+    }
+    _mode_state = ModeState::Ready;
+    _mode_switch_result = result;
+    ++_mode_switches;
+    auto current_mode = _current_mode;
+    lock.unlock();
+    _mode_cv.notify_all();
+    return current_mode == mode ? Camera::Result::Success : result;
+}
+
+void CameraImpl::hold_mode() {
+    std::unique_lock<std::mutex> lock(_mode_mutex);
+    _mode_cv.wait(lock, [this]() { return _mode_state != ModeState::Switching; });
+    ++_mode_users;
+}
+
+void CameraImpl::release_mode() {
+    {
+        std::lock_guard<std::mutex> lock(_mode_mutex);
+        --_mode_users;
+    }
+    _mode_cv.notify_all();
+}
+
+bool CameraImpl::parse_setting(const Camera::Setting &setting, SettingId &id,
+                               SettingValue &value) {
+    if (!CameraSettings::find(setting.setting_id, id)) {
+        base::LogError() << "Not implement setting" << setting.setting_id;
+        return false;
+    }
+    if (!CameraSettings::parse(id, setting.option.option_id, value)) {
+        base::LogError() << "Invalid value " << setting.option.option_id << " for "
+                         << setting.setting_id;
+        return false;
+    }
+    return true;
+}
+
+Camera::Result CameraImpl::apply_setting(SettingId id, const SettingValue &value) {
+    base::LogDebug() << "call set " << CameraSettings::schema(id).name << " to value "
+                     << CameraSettings::render(id, value).option.option_id;
+    auto apply = CameraSettingHandlers::kEntries[static_cast<std::size_t>(id)].apply;
+    if (apply == nullptr) {
+        base::LogError() << "Not implement setting" << CameraSettings::schema(id).name;
+        return Camera::Result::WrongArgument;
+    }
+    bool set_success = (this->*apply)(value);
+
+    if (!set_success) {
+        return Camera::Result::Error;
     }
+
+    // update current setting
+    _settings.set(id, value);
     return Camera::Result::Success;
 }
 
+std::pair<Camera::Result, std::vector<Camera::AppliedSetting>> CameraImpl::apply_settings(
+    const std::vector<Camera::Setting> &settings) {
+    std::vector<SettingId> ids(settings.size());
+    std::vector<SettingValue> values(settings.size());
+    std::vector<bool> valid(settings.size());
+    for (size_t index = 0; index < settings.size(); ++index) {
+        valid[index] = parse_setting(settings[index], ids[index], values[index]);
+    }
+
+    std::vector<size_t> order(settings.size());
+    std::iota(order.begin(), order.end(), 0);
+    // settings that do not parse are only reported, keep them last
+    auto apply_order = [&](size_t index) {
+        return valid[index] ? setting_apply_order(ids[index]) : 7;
+    };
+    std::stable_sort(order.begin(), order.end(), [&apply_order](size_t lhs, size_t rhs) {
+        return apply_order(lhs) < apply_order(rhs);
+    });
+
+    auto result = Camera::Result::Success;
+    bool changed = false;
+    std::vector<Camera::AppliedSetting> applied(settings.size());
+    for (auto index : order) {
+        applied[index].setting_id = settings[index].setting_id;
+        applied[index].result = valid[index] ? apply_setting(ids[index], values[index])
+                                             : Camera::Result::WrongArgument;
+        if (applied[index].result == Camera::Result::Success) {
+            changed = true;
+        } else {
+            result = Camera::Result::Error;
+        }
+    }
+
+    if (changed) {
+        save_settings_snapshot();
+        _current_settings_subscriptions.notify(render_settings());
+    }
+    return {result, applied};
+}
+
 void CameraImpl::close_camera() {
+    {
+        // the mode is kept for mode() but no switch runs until the backend opens again
+        std::lock_guard<std::mutex> lock(_mode_mutex);
+        _mode_state = ModeState::Idle;
+    }
     if (_mav_camera != nullptr) {
-        _mav_camera->close();
+        vendor_call("qcom/close", [&] { return _mav_camera->close(); });
         delete _mav_camera;
         _mav_camera = nullptr;
     }
@@ -546,220 +1373,216 @@ void CameraImpl::close_camera() {
     }
 }
 
-Camera::Setting CameraImpl::build_setting(std::string name, std::string value) {
-    Camera::Setting setting;
-    setting.setting_id = name;
-    setting.option.option_id = value;
-    return setting;
+bool CameraImpl::set_camera_mode(const SettingValue &value) {
+    auto mode = value.int_value == 0 ? Camera::Mode::Photo : Camera::Mode::Video;
+    // a SetMode joining the switch may have moved the camera on, CAM_MODE then follows it
+    return apply_mode(mode) == Camera::Result::Success && this->mode() == mode;
 }
 
-bool CameraImpl::set_camera_display_mode(std::string mode) {
+bool CameraImpl::set_camera_display_mode(const SettingValue &value) {
     mav_camera::Result result = mav_camera::Result::Unknown;
-    if (mode == "0") {
-        result = _mav_camera->set_preview_stream_output_type(
-            mav_camera::PreivewStreamOutputType::RGBStreamOnly);
-    } else if (mode == "1") {
-        result = _mav_camera->set_preview_stream_output_type(
-            mav_camera::PreivewStreamOutputType::InfraredStreamOnly);
-    } else if (mode == "2") {
-        result = _mav_camera->set_preview_stream_output_type(
-            mav_camera::PreivewStreamOutputType::MixSideBySide);
-    } else if (mode == "3") {
-        result = _mav_camera->set_preview_stream_output_type(
-            mav_camera::PreivewStreamOutputType::MixPIP);
-    }
-    base::LogDebug() << "set camera display mode to " << mode << " result " << int(result);
+    const auto *preview_type = hardware_value(kDisplayModeOptions, value.int_value);
+    if (preview_type != nullptr) {
+        result = vendor_call("qcom/set_preview_stream_output_type", [&] {
+            return _mav_camera->set_preview_stream_output_type(*preview_type);
+        });
+    }
+    base::LogDebug() << "set camera display mode to " << value.int_value << " result "
+                     << int(result);
     return result == mav_camera::Result::Success;
 }
 
-std::string CameraImpl::get_camera_display_mode() {
+bool CameraImpl::get_camera_display_mode(SettingValue &value) {
     mav_camera::Result result;
     mav_camera::PreivewStreamOutputType preview_type;
-    std::tie(result, preview_type) = _mav_camera->get_preview_stream_output_type();
-    if (result == mav_camera::Result::Success) {
-        switch (preview_type) {
-            case mav_camera::PreivewStreamOutputType::RGBStreamOnly:
-                return "0";
-                break;
-            case mav_camera::PreivewStreamOutputType::InfraredStreamOnly:
-                return "1";
-                break;
-            case mav_camera::PreivewStreamOutputType::MixSideBySide:
-                return "2";
-                break;
-            case mav_camera::PreivewStreamOutputType::MixPIP:
-                return "3";
-                break;
-        }
+    std::tie(result, preview_type) = vendor_call("qcom/get_preview_stream_output_type", [&] {
+        return _mav_camera->get_preview_stream_output_type();
+    });
+    if (result != mav_camera::Result::Success) {
+        return false;
     }
-    return 0;
+    return hardware_option(
+        kDisplayModeOptions,
+        [preview_type](mav_camera::PreivewStreamOutputType output_type) {
+            return output_type == preview_type;
+        },
+        value.int_value);
 }
 
-/**
-    <option name="Auto" value="0" />
-    <option name="Incandescent" value="1" />
-    <option name="Sunrise" value="2" />
-    <option name="Sunset" value="3" />
-    <option name="Sunny" value="4" />
-    <option name="Cloudy" value="5" />
-    <option name="Fluorescent" value="7" />
-*/
-bool CameraImpl::set_whitebalance_mode(std::string mode) {
-    mav_camera::Result result;
-    if (mode == "0") {  // Auto
-        result = _mav_camera->set_white_balance(mav_camera::kAutoWhitebalanceValue);
-    } else if (mode == "1") {  // Daylight
-        result = _mav_camera->set_white_balance(5500);
-    } else if (mode == "2") {  // Cloudy
-        result = _mav_camera->set_white_balance(6500);
-    } else if (mode == "3") {  // Shady
-        result = _mav_camera->set_white_balance(7500);
-    } else if (mode == "4") {  // Incandescent
-        result = _mav_camera->set_white_balance(2700);
-    } else if (mode == "5") {  // Fluorescent
-        result = _mav_camera->set_white_balance(4000);
-    }
-    base::LogDebug() << "set whitebalance mode to " << mode << " result " << (int)result;
+bool CameraImpl::set_photo_resolution(const SettingValue &value) {
+    const auto *size = hardware_value(kPhotoResolutionOptions, value.int_value);
+    if (size == nullptr) {
+        return false;
+    }
+    auto result = vendor_call("qcom/set_snapshot_resolution", [&] {
+        return _mav_camera->set_snapshot_resolution(size->width, size->height);
+    });
+    return result == mav_camera::Result::Success;
+}
+
+bool CameraImpl::set_whitebalance_mode(const SettingValue &value) {
+    mav_camera::Result result = mav_camera::Result::Unknown;
+    const auto *temperature = hardware_value(kWhitebalanceOptions, value.int_value);
+    if (temperature != nullptr) {
+        result = vendor_call("qcom/set_white_balance",
+                             [&] { return _mav_camera->set_white_balance(*temperature); });
+    }
+    base::LogDebug() << "set whitebalance mode to " << value.int_value << " result "
+                     << (int)result;
 
     return result == mav_camera::Result::Success;
 }
 
-std::string CameraImpl::get_whitebalance_mode() {
-    auto [result, value] = _mav_camera->get_white_balance();
+bool CameraImpl::get_whitebalance_mode(SettingValue &value) {
+    auto [result, white_balance] =
+        vendor_call("qcom/get_white_balance", [&] { return _mav_camera->get_white_balance(); });
     if (result != mav_camera::Result::Success) {
         base::LogError() << "Cannot get whitebalance mode"
                          << convert_camera_result_to_mav_result(result);
-        return "0";
-    }
-    if (value == mav_camera::kAutoWhitebalanceValue) {
-        return "0";
-    } else if (value == 5500) {
-        return "1";
-    } else if (value == 6500) {
-        return "2";
-    } else if (value == 7500) {
-        return "3";
-    } else if (value == 2700) {
-        return "4";
-    } else if (value == 4000) {
-        return "5";
-    }
-    base::LogWarn() << "invalid white balance value " << value;
-    return "0";
-}
-
-std::string CameraImpl::get_ev_value() {
-    auto [result, value] = _mav_camera->get_exposure_value();
+        return false;
+    }
+    if (!hardware_option(
+            kWhitebalanceOptions,
+            [&white_balance](int32_t temperature) { return temperature == white_balance; },
+            value.int_value)) {
+        base::LogWarn() << "invalid white balance value " << white_balance;
+        return false;
+    }
+    return true;
+}
+
+bool CameraImpl::set_exposure_mode(const SettingValue & /*value*/) {
+    // exposure mode not set to camera implement
+    return true;
+}
+
+bool CameraImpl::set_exposure_value(const SettingValue &value) {
+    return vendor_call("qcom/set_exposure_value", [&] {
+               return _mav_camera->set_exposure_value(value.float_value);
+           }) == mav_camera::Result::Success;
+}
+
+bool CameraImpl::set_iso(const SettingValue &value) {
+    return vendor_call("qcom/set_iso", [&] { return _mav_camera->set_iso(value.int_value); }) ==
+           mav_camera::Result::Success;
+}
+
+bool CameraImpl::set_shutter_speed(const SettingValue &value) {
+    // the camera takes the shutter speed as the option name, e.g. 1/100
+    const auto *option = CameraSettings::option(SettingId::CamShutterspd, value);
+    std::string shutter_speed;
+    if (option != nullptr) {
+        shutter_speed = std::string(option->name);
+    } else {
+        shutter_speed = CameraSettings::render(SettingId::CamShutterspd, value).option.option_id;
+    }
+    return vendor_call("qcom/set_shutter_speed",
+                       [&] { return _mav_camera->set_shutter_speed(shutter_speed); }) ==
+           mav_camera::Result::Success;
+}
+
+bool CameraImpl::get_ev_value(SettingValue &value) {
+    auto [result, exposure_value] =
+        vendor_call("qcom/get_exposure_value", [&] { return _mav_camera->get_exposure_value(); });
     if (result != mav_camera::Result::Success) {
         base::LogError() << "Cannot get exposure value"
                          << convert_camera_result_to_mav_result(result);
-        return "0.0";
+        return false;
     }
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(1) << value;
-    std::string ev_value = oss.str();
-    return ev_value;
+    // the settings offer one decimal
+    value.float_value = std::round(exposure_value * 10) / 10;
+    return true;
 }
 
-std::string CameraImpl::get_iso_value() {
-    auto [result, value] = _mav_camera->get_iso();
+bool CameraImpl::get_iso_value(SettingValue &value) {
+    auto [result, iso] = vendor_call("qcom/get_iso", [&] { return _mav_camera->get_iso(); });
     if (result != mav_camera::Result::Success) {
         base::LogError() << "Cannot get iso value" << convert_camera_result_to_mav_result(result);
-        return "100";
+        return false;
     }
-    return std::to_string(value);
+    value.int_value = iso;
+    return true;
 }
 
-std::string CameraImpl::get_shutter_speed_value() {
-    auto [result, value] = _mav_camera->get_shutter_speed();
+bool CameraImpl::get_shutter_speed_value(SettingValue &value) {
+    auto [result, shutter_speed] =
+        vendor_call("qcom/get_shutter_speed", [&] { return _mav_camera->get_shutter_speed(); });
     if (result != mav_camera::Result::Success) {
         base::LogDebug() << "Cannot get shutterspeed"
                          << convert_camera_result_to_mav_result(result);
-        return "0.01";  // default value
-    }
-    std::size_t pos = value.find('/');
-    if (pos != std::string::npos) {
-        // Split the string at '/'
-        std::string num_str = value.substr(0, pos);
-        std::string den_str = value.substr(pos + 1);
-
-        // Convert to float
-        float numerator = std::stof(num_str);
-        float denominator = std::stof(den_str);
-
-        // Perform the division
-        auto convert_result = std::to_string(numerator / denominator);
-        base::LogDebug() << "current shutter speed is : " << convert_result;
-        return convert_result;
-    } else {
-        // If there is no '/', assume it's a whole number
-        return value;
+        return false;
+    }
+    // reported like the option names, e.g. 1/100 or 2
+    if (!CameraSettings::parse(SettingId::CamShutterspd, shutter_speed, value)) {
+        base::LogError() << "Invalid shutter speed " << shutter_speed;
+        return false;
     }
+    base::LogDebug() << "current shutter speed is : " << value.float_value;
+    return true;
 }
 
-std::string CameraImpl::get_video_resolution() {
-    auto [result, width, height] = _mav_camera->get_video_resolution();
+bool CameraImpl::get_video_resolution(SettingValue &value) {
+    auto [result, width, height] = vendor_call("qcom/get_video_resolution",
+                                               [&] { return _mav_camera->get_video_resolution(); });
     if (result != mav_camera::Result::Success) {
         base::LogError() << "Cannot get video resolution"
                          << convert_camera_result_to_mav_result(result);
-        return "0";
+        return false;
     }
-    auto [result2, framerate] = _mav_camera->get_framerate();
+    auto [result2, framerate] =
+        vendor_call("qcom/get_framerate", [&] { return _mav_camera->get_framerate(); });
     if (result2 != mav_camera::Result::Success) {
         base::LogError() << "Cannot get framerate" << convert_camera_result_to_mav_result(result);
-        return "0";
+        return false;
     }
     base::LogDebug() << "Current video resolution is " << width << "x" << height << "@"
                      << framerate;
-    if (width == 3840 && height == 2160 && framerate == 60) {
-        return "0";
-    } else if (width == 3840 && height == 2160 && framerate == 30) {
-        return "1";
-    } else if (width == 1920 && height == 1080 && framerate == 60) {
-        return "2";
-    } else if (width == 1920 && height == 1080 && framerate == 30) {
-        return "3";
-    } else {
+    auto match = [&](const VideoFormat &format) {
+        return format.width == width && format.height == height && format.framerate == framerate;
+    };
+    if (!hardware_option(kVideoResolutionOptions, match, value.int_value)) {
         base::LogError() << "Not found match resolution : " << width << "x" << height << "@"
                          << framerate;
-        return "0";
-    }
-}
-
-bool CameraImpl::set_video_resolution(std::string value) {
-    int set_width = 0;
-    int set_height = 0;
-    int set_framerate = 0;
-    if (value == "0") {
-        set_width = 3840;
-        set_height = 2160;
-        set_framerate = 60;
-    } else if (value == "1") {
-        set_width = 3840;
-        set_height = 2160;
-        set_framerate = 30;
-    } else if (value == "2") {
-        set_width = 1920;
-        set_height = 1080;
-        set_framerate = 60;
-    } else if (value == "3") {
-        set_width = 1920;
-        set_height = 1080;
-        set_framerate = 30;
+        return false;
     }
+    return true;
+}
+
+bool CameraImpl::set_video_resolution(const SettingValue &value) {
+    VideoFormat format{0, 0, 0};
+    const auto *option_format = hardware_value(kVideoResolutionOptions, value.int_value);
+    if (option_format != nullptr) {
+        format = *option_format;
+    }
+    int set_width = format.width;
+    int set_height = format.height;
+    int set_framerate = format.framerate;
     base::LogDebug() << "Set video resolution to " << set_width << "x" << set_height << "@"
                      << set_framerate;
-    auto result = _mav_camera->set_video_resolution(set_width, set_height);
+    auto result = vendor_call("qcom/set_video_resolution", [&] {
+        return _mav_camera->set_video_resolution(set_width, set_height);
+    });
     if (result != mav_camera::Result::Success) {
         base::LogError() << "Failed to set video resolution : " << set_width << "x" << set_height;
     }
-    result = _mav_camera->set_framerate(set_framerate);
+    result = vendor_call("qcom/set_framerate",
+                         [&] { return _mav_camera->set_framerate(set_framerate); });
     if (result != mav_camera::Result::Success) {
         base::LogError() << "Failed to set video framerate : " << set_framerate;
     }
     return result == mav_camera::Result::Success;
 }
 
+bool CameraImpl::set_burst_count(const SettingValue &value) {
+    if (value.int_value < 1 || value.int_value > kMaxBurstCount) {
+        base::LogError() << "Invalid burst count : " << value.int_value;
+        return false;
+    }
+    base::LogDebug() << "Set burst count to " << value.int_value;
+    _burst_count.store(value.int_value, std::memory_order_relaxed);
+    return true;
+}
+
 Camera::Result CameraImpl::convert_camera_result_to_mav_result(mav_camera::Result input_result) {
     Camera::Result output_result = Camera::Result::Unknown;
     switch (input_result) {
@@ -795,71 +1618,350 @@ Camera::Result CameraImpl::convert_camera_result_to_mav_result(mav_camera::Resul
 }
 
 void CameraImpl::stop_video_async() {
-    _mav_camera->stop_video();
+    vendor_call("qcom/stop_video", [&] { return _mav_camera->stop_video(); });
 }
 
-bool CameraImpl::init_ir_camera() {
-    if (_ir_camera != nullptr) {
-        return true;
+std::shared_lock<std::shared_mutex> CameraImpl::lock_backend(Camera::Result &unavailable) {
+    std::shared_lock<std::shared_mutex> lock(_backend_mutex, std::defer_lock);
+    if (_backend_reloading || !lock.try_lock()) {
+        unavailable = Camera::Result::Busy;
+        return {};
+    }
+    if (_mav_camera == nullptr) {
+        unavailable = Camera::Result::NoSystem;
+        return {};
+    }
+    return lock;
+}
+
+void CameraImpl::watch_backend_result(mav_camera::Result result) {
+    if (result != mav_camera::Result::Timeout && result != mav_camera::Result::NoSystem) {
+        _backend_failures = 0;
+        return;
+    }
+    if (++_backend_failures < kBackendFailuresBeforeReload) {
+        return;
+    }
+    _backend_failures = 0;
+    base::LogError() << "Camera backend stopped answering, scheduling a reload";
+    std::lock_guard<std::mutex> lock(_backend_reload_thread_mutex);
+    if (_backend_reloading) {
+        return;
+    }
+    if (_backend_reload_thread.joinable()) {
+        // the previous reload is done, it cleared _backend_reloading on its way out
+        _backend_reload_thread.join();
+    }
+    // the caller still holds the backend, the reload starts once it returns
+    _backend_reload_thread = std::thread([this]() { reload_backend(); });
+}
+
+void CameraImpl::publish_status() {
+    std::lock_guard<std::mutex> lock(_publish_status_mutex);
+    auto current_status = status();
+    if (_status_published && current_status == _published_status) {
+        return;
+    }
+    _published_status = current_status;
+    _status_published = true;
+    _status_subscriptions.notify(current_status);
+}
+
+void CameraImpl::start_recording_timer() {
+    stop_recording_timer();
+    _recording_timer_stop = false;
+    _recording_timer = std::thread([this]() {
+        std::unique_lock<std::mutex> lock(_recording_timer_mutex);
+        while (!_recording_timer_cv.wait_for(lock, std::chrono::seconds(1),
+                                             [this]() { return _recording_timer_stop; })) {
+            // recording_time_s changes every second while recording
+            lock.unlock();
+            publish_status();
+            lock.lock();
+        }
+    });
+}
+
+void CameraImpl::stop_recording_timer() {
+    {
+        std::lock_guard<std::mutex> lock(_recording_timer_mutex);
+        _recording_timer_stop = true;
+    }
+    _recording_timer_cv.notify_all();
+    if (_recording_timer.joinable()) {
+        _recording_timer.join();
+    }
+}
+
+void CameraImpl::run_photo_interval(std::chrono::steady_clock::duration interval) {
+    int32_t photo_count = 0;
+    int64_t missed_slots = 0;
+    // the first photo is taken right away, like a single capture
+    auto deadline = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(_photo_interval_mutex);
+    while (!_photo_interval_cv.wait_until(lock, deadline,
+                                          [this]() { return _photo_interval_stop; })) {
+        lock.unlock();
+        auto result = take_photo();
+        lock.lock();
+        if (result == Camera::Result::Success) {
+            ++photo_count;
+        } else {
+            // Busy once the capture queue is full, the sensor is slower than the interval
+            ++missed_slots;
+            base::LogWarn() << "Photo interval slot missed : " << result;
+        }
+        // deadlines are absolute, the capture latency does not delay the following photos
+        deadline += interval;
+        auto now = std::chrono::steady_clock::now();
+        if (now > deadline) {
+            // the capture overran, resume at the next slot ahead rather than catching up
+            auto missed = (now - deadline) / interval + 1;
+            missed_slots += missed;
+            deadline += missed * interval;
+            base::LogWarn() << "Photo interval capture overran, missed " << missed << " slot(s)";
+        }
+    }
+    base::LogInfo() << "Photo interval stopped after " << photo_count << " photo(s), "
+                    << missed_slots << " missed slot(s)";
+}
+
+void CameraImpl::stop_photo_interval_thread() {
+    {
+        std::lock_guard<std::mutex> lock(_photo_interval_mutex);
+        _photo_interval_stop = true;
+    }
+    _photo_interval_cv.notify_all();
+    if (_photo_interval_thread.joinable()) {
+        _photo_interval_thread.join();
+    }
+}
+
+void CameraImpl::run_captures() {
+    std::unique_lock<std::mutex> lock(_capture_mutex);
+    while (true) {
+        _capture_cv.wait(lock,
+                         [this]() { return _capture_thread_stop || !_pending_captures.empty(); });
+        if (_capture_thread_stop) {
+            break;
+        }
+        auto request = _pending_captures.front();
+        _pending_captures.pop_front();
+        auto start = std::chrono::steady_clock::now();
+        // deadlines are absolute, a frame running past the next one is followed right away
+        auto deadline = start;
+        int32_t taken = 0;
+        int32_t failed = 0;
+        while (taken < request.count &&
+               !_capture_cv.wait_until(lock, deadline, [this]() { return _capture_thread_stop; })) {
+            lock.unlock();
+            auto is_success = capture_photo();
+            publish_capture_info(request.first_id + taken, is_success);
+            lock.lock();
+            ++taken;
+            if (!is_success) {
+                ++failed;
+            }
+            deadline += request.interval;
+        }
+        if (request.count > 1) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+            base::LogInfo() << "Burst of " << taken << "/" << request.count << " photo(s) in "
+                            << elapsed.count() << " ms, " << failed << " failed";
+        }
+        --_captures_in_flight;
+    }
+    if (!_pending_captures.empty()) {
+        base::LogWarn() << "Drop " << _pending_captures.size() << " queued capture request(s)";
+    }
+}
+
+bool CameraImpl::capture_photo() {
+    // waits for a running reload instead of failing the capture the caller was promised
+    std::shared_lock<std::shared_mutex> backend_lock(_backend_mutex);
+    if (_mav_camera == nullptr) {
+        return false;
+    }
+    // a capture queued during a mode switch waits for it to commit
+    hold_mode();
+    auto result = vendor_call("qcom/take_photo", [&] { return _mav_camera->take_photo(); });
+    release_mode();
+    watch_backend_result(result);
+    if (result != mav_camera::Result::Success) {
+        base::LogWarn() << "Capture failed : " << convert_camera_result_to_mav_result(result);
+        return false;
+    }
+    return true;
+}
+
+void CameraImpl::publish_capture_info(int32_t capture_id, bool is_success) {
+    Camera::CaptureInfo capture_info;
+    capture_info.time_utc_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::system_clock::now().time_since_epoch())
+                                   .count();
+    capture_info.is_success = is_success;
+    capture_info.index = capture_id;
+    if (_capture_records.is_open() && !_capture_records.append(capture_info)) {
+        base::LogWarn() << "Failed to add capture " << capture_id << " to the capture index";
+    }
+    {
+        std::lock_guard<std::mutex> lock(_capture_report_mutex);
+        if (!_capture_reports.push(std::move(capture_info))) {
+            base::LogWarn() << "Capture reports are full, drop the report of capture "
+                            << capture_id;
+            return;
+        }
     }
+    _capture_report_cv.notify_one();
+}
+
+void CameraImpl::run_capture_reports() {
+    std::unique_lock<std::mutex> lock(_capture_report_mutex);
+    while (true) {
+        _capture_report_cv.wait(
+            lock, [this]() { return _capture_report_thread_stop || !_capture_reports.empty(); });
+        if (_capture_reports.empty()) {
+            break;
+        }
+        auto capture_info = std::move(_capture_reports.front());
+        _capture_reports.pop();
+        lock.unlock();
+        _capture_info_subscriptions.notify(capture_info);
+        lock.lock();
+    }
+}
+
+struct boson_extension_api *CameraImpl::open_ir_camera(void *&library_handle) {
     typedef struct boson_extension_api *(*create_boson_extension_api_fun)();
-    _ir_camera_handle = dlopen(BOSON_CAMERA_LIBRARY, RTLD_NOW);
-    if (_ir_camera_handle == NULL) {
+    library_handle = dlopen(BOSON_CAMERA_LIBRARY, RTLD_NOW);
+    if (library_handle == NULL) {
         char const *err_str = dlerror();
         base::LogError() << "Load module " << BOSON_CAMERA_LIBRARY << " failed "
                          << (err_str != NULL ? err_str : "unknown");
-        return false;
+        return nullptr;
     }
 
     create_boson_extension_api_fun create_boson_extension_api =
-        (create_boson_extension_api_fun)dlsym(_ir_camera_handle, "create_boson_extension_api");
+        (create_boson_extension_api_fun)dlsym(library_handle, "create_boson_extension_api");
     if (create_boson_extension_api == NULL) {
         base::LogError() << "Cannot find symbol create_boson_extension_api";
-        dlclose(_ir_camera_handle);
-        _ir_camera_handle = NULL;
-        return false;
+        dlclose(library_handle);
+        library_handle = NULL;
+        return nullptr;
     }
 
-    _ir_camera = create_boson_extension_api();
-    if (_ir_camera == nullptr) {
+    auto *ir_camera = create_boson_extension_api();
+    if (ir_camera == nullptr) {
         base::LogError() << "Cannot create ir camera instance";
+        dlclose(library_handle);
+        library_handle = NULL;
+        return nullptr;
     }
 
-    if (_ir_camera->uart_boson_initialize(16, 921600) == 0) {
-        base::LogInfo() << "API uart_boson_initialize success.";
-    } else {
+    bool ready = false;
+    uint32_t camera_sn;
+    BOSON_SENSOR_PARTNUMBER part_num;
+    if (vendor_call("boson/uart_boson_initialize",
+                    [&] { return ir_camera->uart_boson_initialize(16, 921600); }) != 0) {
         base::LogError() << "Failed to initialize ir camera";
-        free(_ir_camera);
-        _ir_camera = nullptr;
-        return false;
+    } else if (vendor_call("boson/get_boson_camera_sn",
+                           [&] { return ir_camera->get_boson_camera_sn(&camera_sn); }) != 0) {
+        base::LogError() << "Failed to get_boson_camera_sn";
+    } else if (vendor_call("boson/get_boson_camera_pn",
+                           [&] { return ir_camera->get_boson_camera_pn(&part_num); }) != 0) {
+        base::LogError() << "Failed to get_boson_camera_pn";
+    } else {
+        base::LogInfo() << "API get_boson_camera_sn camera_sn: " << camera_sn;
+        base::LogInfo() << "API get_boson_camera_pn \"" << part_num.value << "\"";
+        ready = true;
     }
+    if (!ready) {
+        free(ir_camera);
+        dlclose(library_handle);
+        library_handle = NULL;
+        return nullptr;
+    }
+    base::LogDebug() << "Load ir camera success";
+    return ir_camera;
+}
 
-    uint32_t camera_sn;
-    if (_ir_camera->get_boson_camera_sn(&camera_sn) == 0) {
-        base::LogInfo() << "API get_boson_camera_sn camera_sn: " << camera_sn;
-    } else {
-        base::LogError() << "Failed to get_boson_camera_sn";
-        free(_ir_camera);
-        _ir_camera = nullptr;
-        return false;
+void CameraImpl::bring_up_ir_camera(bool open) {
+    auto start_time = std::chrono::steady_clock::now();
+    void *library_handle = NULL;
+    struct boson_extension_api *ir_camera = nullptr;
+    if (open) {
+        // no lock held, the RGB camera is opened and used meanwhile
+        ir_camera = open_ir_camera(library_handle);
+        if (ir_camera == nullptr) {
+            return;
+        }
     }
 
-    BOSON_SENSOR_PARTNUMBER part_num;
-    if (_ir_camera->get_boson_camera_pn(&part_num) == 0) {
-        base::LogInfo() << "API get_boson_camera_pn \"" << part_num.value << "\"";
+    std::shared_lock<std::shared_mutex> backend_lock(_backend_mutex);
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    if (ir_camera != nullptr) {
+        if (_ir_camera != nullptr) {
+            // only this thread brings the ir camera up, it is never up twice
+            base::LogError() << "Ir camera is already up";
+            vendor_call("boson/uart_boson_close", [&] { return ir_camera->uart_boson_close(); });
+            free(ir_camera);
+            dlclose(library_handle);
+            return;
+        }
+        _ir_camera = ir_camera;
+        _ir_camera_handle = library_handle;
+        _ir_commands.start(_ir_camera, [this](const IrCommand &command,
+                                              const IrCommandResult &result) {
+            on_ir_command_done(command, result);
+        });
+        std::lock_guard<std::mutex> bring_up_lock(_ir_bring_up_mutex);
+        _ir_camera_up = true;
+    }
+    if (_ir_camera == nullptr) {
+        // released by a reload since, which asked for another bring-up
+        return;
+    }
+    if (_restored_ir_palette) {
+        apply_setting(SettingId::IrcamPalette, *_restored_ir_palette);
+        _restored_ir_palette.reset();
     } else {
-        base::LogError() << "Failed to get_boson_camera_pn";
-        free(_ir_camera);
-        _ir_camera = nullptr;
-        return false;
+        // IRCAM_PALETTE appears once the camera answers
+        _ir_commands.get_color_mode();
+    }
+    _settings.set_int(SettingId::IrcamFfc, 0);
+    save_settings_snapshot();
+    _current_settings_subscriptions.notify(render_settings());
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start_time)
+                          .count();
+    base::LogInfo() << "Ir camera ready in " << elapsed_ms << " ms";
+}
+
+void CameraImpl::run_ir_bring_up() {
+    std::unique_lock<std::mutex> lock(_ir_bring_up_mutex);
+    while (true) {
+        _ir_bring_up_cv.wait(
+            lock, [this]() { return _ir_bring_up_thread_stop || _ir_bring_up_pending; });
+        if (_ir_bring_up_thread_stop) {
+            break;
+        }
+        _ir_bring_up_pending = false;
+        bool open = !_ir_camera_up;
+        lock.unlock();
+        bring_up_ir_camera(open);
+        lock.lock();
     }
-    base::LogDebug() << "Load ir camera success";
-    return true;
 }
 
 void CameraImpl::free_ir_camera() {
-    _ir_camera->uart_boson_close();
+    _ir_commands.stop();
+    {
+        std::lock_guard<std::mutex> lock(_ir_bring_up_mutex);
+        _ir_camera_up = false;
+    }
     if (_ir_camera != nullptr) {
+        vendor_call("boson/uart_boson_close", [&] { return _ir_camera->uart_boson_close(); });
         free(_ir_camera);
         _ir_camera = nullptr;
     }
@@ -869,21 +1971,47 @@ void CameraImpl::free_ir_camera() {
     }
 }
 
-bool CameraImpl::set_ir_palette(std::string color_mode) {
-    ColorMode convert_mode = (ColorMode)std::stoi(color_mode);
+bool CameraImpl::set_ir_palette(const SettingValue &value) {
+    ColorMode convert_mode = (ColorMode)value.int_value;
     if (_ir_camera != nullptr) {
-        auto result = _ir_camera->set_boson_color_mode(convert_mode);
-        return result == 0;
+        // a failure reads the palette back in on_ir_command_done
+        _ir_commands.set_color_mode(convert_mode);
+        return true;
     }
     return false;
 }
 
-bool CameraImpl::set_ir_FFC(std::string /*ignore*/) {
+bool CameraImpl::set_ir_FFC(const SettingValue & /*ignore*/) {
     if (_ir_camera != nullptr) {
-        auto result = _ir_camera->process_boson_run_ffc();
-        return result == 0;
+        _ir_commands.run_ffc();
+        return true;
     }
     return false;
 }
 
+void CameraImpl::on_ir_command_done(const IrCommand &command, const IrCommandResult &result) {
+    if (command.kind == IrCommand::Kind::SetColorMode && result.status != 0) {
+        base::LogError() << "Failed to set ir palette " << int(command.color_mode);
+        _ir_commands.get_color_mode();
+        return;
+    }
+    if (command.kind != IrCommand::Kind::GetColorMode || result.status != 0) {
+        return;
+    }
+    base::LogDebug() << "Current ir palette is " << int(result.color_mode);
+    // free_ir_camera waits for this thread with the backend held, a reload reads it again
+    std::shared_lock<std::shared_mutex> backend_lock(_backend_mutex, std::try_to_lock);
+    if (!backend_lock || _ir_camera == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_settings_mutex);
+    if (_settings.has(SettingId::IrcamPalette) &&
+        _settings.get(SettingId::IrcamPalette).int_value == result.color_mode) {
+        return;
+    }
+    _settings.set_int(SettingId::IrcamPalette, result.color_mode);
+    save_settings_snapshot();
+    _current_settings_subscriptions.notify(render_settings());
+}
+
 }  // namespace mavcam
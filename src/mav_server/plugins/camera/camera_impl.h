@@ -2,19 +2,33 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <thread>
 #include <vector>
 
+#include "base/callback_list.h"
+#include "base/ring_buffer.h"
 #include "boson-sdk-interface.h"
 #include "mav_camera.h"
 #include "plugins/camera/camera.h"
+#include "plugins/camera/camera_config.h"
+#include "plugins/camera/camera_settings.h"
+#include "plugins/camera/capture_index.h"
+#include "plugins/camera/ir_command_queue.h"
+#include "plugins/camera/storage_monitor.h"
 
 namespace mavcam {
 
 class CameraImpl final {
+    // the setting dispatch table in camera_impl.cpp names the private setters
+    friend struct CameraSettingHandlers;
 public:
-    explicit CameraImpl();
+    explicit CameraImpl(const CameraConfig &config);
     ~CameraImpl();
 
     /**
@@ -27,17 +41,47 @@ public:
     Camera::Result prepare();
 
     /**
-     * @brief Take one photo.
+     * @brief Close the vendor libraries and load them again, settings are read back from the
+     * camera.
+     *
+     * Calls reaching the camera meanwhile are answered Busy. Also run on its own after
+     * repeated Timeout or NoSystem results from the vendor library.
      *
      * This function is blocking.
      *
-     * @return Result of request.
+     * @return Result of request, InProgress if a reload is already running.
+     */
+    Camera::Result reload_backend();
+
+    /**
+     * @brief Queue one photo, or a burst of CAM_BURST photos taken back to back.
+     *
+     * Returns once the capture is queued, its capture info reports the result with the
+     * capture id as index.
+     *
+     * @return Result of request, Busy if the capture depth is reached.
      */
     Camera::Result take_photo();
 
+    /**
+     * @brief Queue a burst of count photos, interval_s apart or back to back with 0.
+     *
+     * Frames are taken at fixed deadlines from the start of the burst, a frame running past
+     * the next deadline is followed right away. The burst takes one place in the capture
+     * queue and reserves count consecutive capture ids, each photo is reported through
+     * capture info.
+     *
+     * @return Result of request, Busy if the capture depth is reached.
+     */
+    Camera::Result start_burst(int32_t count, float interval_s);
+
     /**
      * @brief Start photo timelapse with a given interval.
      *
+     * Photos are taken on the camera at fixed deadlines from the start, a capture running past
+     * the next deadline skips the missed slots. Each photo is reported through capture info.
+     * Starting again replaces the running interval.
+     *
      * This function is blocking.
      *
      * @return Result of request.
@@ -99,11 +143,11 @@ public:
     Camera::Result set_mode(Camera::Mode mode);
 
     /**
-     * @brief List photos available on the camera.
+     * @brief List the photos taken by the camera, read from the capture index.
      *
-     * This function is blocking.
+     * SinceConnection lists the photos taken since the server started.
      *
-     * @return Result of request.
+     * @return Result of request, Error if the capture index is not open.
      */
     std::pair<Camera::Result, std::vector<Camera::CaptureInfo>> list_photos(
         Camera::PhotosRange photos_range);
@@ -111,7 +155,12 @@ public:
     /**
      * @brief Subscribe to camera mode updates.
      */
-    void mode_async(const Camera::ModeCallback &callback);
+    Camera::ModeHandle subscribe_mode(const Camera::ModeCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_mode
+     */
+    void unsubscribe_mode(Camera::ModeHandle handle);
 
     /**
      * @brief Poll for 'Mode' (blocking).
@@ -123,7 +172,12 @@ public:
     /**
      * @brief Subscribe to camera information updates.
      */
-    void information_async(const Camera::InformationCallback &callback);
+    Camera::InformationHandle subscribe_information(const Camera::InformationCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_information
+     */
+    void unsubscribe_information(Camera::InformationHandle handle);
 
     /**
      * @brief Poll for 'Information' (blocking).
@@ -135,7 +189,13 @@ public:
     /**
      * @brief Subscribe to video stream info updates.
      */
-    void video_stream_info_async(const Camera::VideoStreamInfoCallback &callback);
+    Camera::VideoStreamInfoHandle subscribe_video_stream_info(
+        const Camera::VideoStreamInfoCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_video_stream_info
+     */
+    void unsubscribe_video_stream_info(Camera::VideoStreamInfoHandle handle);
 
     /**
      * @brief Poll for 'std::vector<VideoStreamInfo>' (blocking).
@@ -147,7 +207,12 @@ public:
     /**
      * @brief Subscribe to capture info updates.
      */
-    void capture_info_async(const Camera::CaptureInfoCallback &callback);
+    Camera::CaptureInfoHandle subscribe_capture_info(const Camera::CaptureInfoCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_capture_info
+     */
+    void unsubscribe_capture_info(Camera::CaptureInfoHandle handle);
 
     /**
      * @brief Poll for 'CaptureInfo' (blocking).
@@ -159,7 +224,12 @@ public:
     /**
      * @brief Subscribe to camera status updates.
      */
-    void status_async(const Camera::StatusCallback &callback);
+    Camera::StatusHandle subscribe_status(const Camera::StatusCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_status
+     */
+    void unsubscribe_status(Camera::StatusHandle handle);
 
     /**
      * @brief Poll for 'Status' (blocking).
@@ -171,7 +241,13 @@ public:
     /**
      * @brief Get the list of current camera settings.
      */
-    void current_settings_async(const Camera::CurrentSettingsCallback &callback);
+    Camera::CurrentSettingsHandle subscribe_current_settings(
+        const Camera::CurrentSettingsCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_current_settings
+     */
+    void unsubscribe_current_settings(Camera::CurrentSettingsHandle handle);
 
     /**
      * @brief Poll for 'std::vector<Setting>' (blocking).
@@ -183,7 +259,13 @@ public:
     /**
      * @brief Get the list of settings that can be changed.
      */
-    void possible_setting_options_async(const Camera::PossibleSettingOptionsCallback &callback);
+    Camera::PossibleSettingOptionsHandle subscribe_possible_setting_options(
+        const Camera::PossibleSettingOptionsCallback &callback);
+
+    /**
+     * @brief Unsubscribe from subscribe_possible_setting_options
+     */
+    void unsubscribe_possible_setting_options(Camera::PossibleSettingOptionsHandle handle);
 
     /**
      * @brief Poll for 'std::vector<SettingOptions>' (blocking).
@@ -255,51 +337,166 @@ public:
      * @return Result of request.
      */
     Camera::Result set_timestamp(int64_t timestamp);
+
+    /**
+     * @brief Apply several settings at once, dependent settings are applied first.
+     *
+     * Only setting_id of setting and option_id of option needs to be set.
+     *
+     * This function is blocking.
+     *
+     * @return Result of request.
+     */
+    std::pair<Camera::Result, std::vector<Camera::AppliedSetting>> set_settings(
+        std::vector<Camera::Setting> settings);
+
+    /**
+     * @brief Per method call counts and latency percentiles recorded by the server.
+     *
+     * Does not touch the camera, so it answers even before prepare.
+     *
+     * @return Result of request.
+     */
+    std::pair<Camera::Result, std::vector<Camera::CallMetric>> get_metrics() const;
 private:
+    /**
+     * @brief load the RGB camera library and restore or read the settings back, the ir camera
+     * follows on _ir_bring_up_thread, caller holds _backend_mutex exclusively
+     */
+    Camera::Result open_backend();
+    /**
+     * @brief apply a settings snapshot in one batch in dependency order, caller holds
+     * _backend_mutex exclusively
+     */
+    void restore_settings(const CameraSettings &snapshot);
+    /**
+     * @brief the cached settings as reported to the subscribers, caller holds _settings_mutex
+     * or _backend_mutex exclusively
+     */
+    std::vector<Camera::Setting> render_settings() const;
+    /**
+     * @brief write the settings to the snapshot file, caller holds _settings_mutex or
+     * _backend_mutex exclusively
+     */
+    void save_settings_snapshot();
+    /**
+     * @brief read the settings back from the camera and correct the ones a restored snapshot got
+     * wrong
+     */
+    void verify_settings();
+    /**
+     * @brief run verify_settings each time a snapshot is restored until
+     * _settings_verify_thread_stop is set
+     */
+    void run_settings_verification();
+    /**
+     * @brief hold the backend for one call, empty with unavailable set to Busy while it is
+     * reloaded or NoSystem if it is not opened
+     */
+    std::shared_lock<std::shared_mutex> lock_backend(Camera::Result &unavailable);
+    /**
+     * @brief count consecutive Timeout and NoSystem results and reload the backend on too many
+     */
+    void watch_backend_result(mav_camera::Result result);
     /**
      * @brief close camera and release resource
      */
     void close_camera();
     /**
-     * @brief build setting with name and value
+     * @brief switch camera mode and keep CAM_MODE in sync, requests made during the switch are
+     * taken in the same one, caller holds _settings_mutex
+     */
+    Camera::Result apply_mode(Camera::Mode mode);
+    /**
+     * @brief run the Switching switch until the backend is in _mode_target, caller holds
+     * _settings_mutex and lock on _mode_mutex, which is released on return
+     */
+    Camera::Result run_mode_switch(Camera::Mode mode, std::unique_lock<std::mutex> &lock);
+    /**
+     * @brief wait for a running mode switch to commit and keep the next one from starting until
+     * release_mode
+     */
+    void hold_mode();
+    void release_mode();
+    /**
+     * @brief look up and type a setting from the rpc, false if the camera has no such setting
+     * or the value does not fit it
+     */
+    bool parse_setting(const Camera::Setting &setting, SettingId &id, SettingValue &value);
+    /**
+     * @brief apply one setting and update the cache without notifying, caller holds
+     * _settings_mutex
+     */
+    Camera::Result apply_setting(SettingId id, const SettingValue &value);
+    /**
+     * @brief apply settings in dependency order and notify once, caller holds _settings_mutex
+     */
+    std::pair<Camera::Result, std::vector<Camera::AppliedSetting>> apply_settings(
+        const std::vector<Camera::Setting> &settings);
+    /**
+     * @brief set camera mode from CAM_MODE, caller holds _settings_mutex
      */
-    mavcam::Camera::Setting build_setting(std::string name, std::string value);
+    bool set_camera_mode(const SettingValue &value);
     /**
      * @brief set camera display mode
      */
-    bool set_camera_display_mode(std::string mode);
+    bool set_camera_display_mode(const SettingValue &value);
+    /**
+     * @brief get current camera display mode, false if the camera cannot report it
+     */
+    bool get_camera_display_mode(SettingValue &value);
     /**
-     * @brief get current camera display mode
+     * @brief set photo resolution
      */
-    std::string get_camera_display_mode();
+    bool set_photo_resolution(const SettingValue &value);
     /**
      * @brief set whitebalance mode
     */
-    bool set_whitebalance_mode(std::string mode);
+    bool set_whitebalance_mode(const SettingValue &value);
     /**
-     * @brief get camera whitebalance mode
+     * @brief get camera whitebalance mode, false if the camera cannot report it
     */
-    std::string get_whitebalance_mode();
+    bool get_whitebalance_mode(SettingValue &value);
+    /**
+     * @brief accept exposure mode, the camera has no setting for it
+     */
+    bool set_exposure_mode(const SettingValue &value);
     /**
-     * @brief get camera exposure value
+     * @brief set camera exposure value
      */
-    std::string get_ev_value();
+    bool set_exposure_value(const SettingValue &value);
     /**
-     * @brief get camera iso value
+     * @brief get camera exposure value, false if the camera cannot report it
      */
-    std::string get_iso_value();
+    bool get_ev_value(SettingValue &value);
     /**
-     * @brief get shutter speed value
+     * @brief set camera iso value
      */
-    std::string get_shutter_speed_value();
+    bool set_iso(const SettingValue &value);
     /**
-     * @brief get video resoltuion
+     * @brief get camera iso value, false if the camera cannot report it
      */
-    std::string get_video_resolution();
+    bool get_iso_value(SettingValue &value);
+    /**
+     * @brief set shutter speed value
+     */
+    bool set_shutter_speed(const SettingValue &value);
+    /**
+     * @brief get shutter speed value, false if the camera cannot report it
+     */
+    bool get_shutter_speed_value(SettingValue &value);
+    /**
+     * @brief get video resoltuion, false if the camera cannot report it
+     */
+    bool get_video_resolution(SettingValue &value);
     /**
      * @brief set video resoltuion
      */
-    bool set_video_resolution(std::string value);
+    bool set_video_resolution(const SettingValue &value);
+    /**
+     * @brief check the photos per trigger, CAM_BURST is read by take_photo
+     */
+    bool set_burst_count(const SettingValue &value);
     /**
      * @brief convert mav_camera::Result to mavcam::Camera::Result
      */
@@ -309,39 +506,196 @@ private:
      */
     void stop_video_async();
     /**
-     * @brief init ir camera
+     * @brief load the ir camera library and run the uart handshake, nullptr on failure
+     *
+     * Touches no member so it runs while the RGB camera is opened.
+     */
+    static struct boson_extension_api *open_ir_camera(void *&library_handle);
+    /**
+     * @brief bring up the ir camera unless it is up and fill in its settings
+     */
+    void bring_up_ir_camera(bool open);
+    /**
+     * @brief run bring_up_ir_camera each time the backend is opened until
+     * _ir_bring_up_thread_stop is set
      */
-    bool init_ir_camera();
+    void run_ir_bring_up();
     /**
      * @breif free ir camera
      */
     void free_ir_camera();
     /**
-     * @brief set ir camera palette
+     * @brief queue a palette change for the ir camera
+     */
+    bool set_ir_palette(const SettingValue &value);
+    /**
+     * @brief queue an ir camera FFC
+     */
+    bool set_ir_FFC(const SettingValue &ignore);
+    /**
+     * @brief keep IRCAM_PALETTE on what the ir camera answered, run on the ir command thread
+     */
+    void on_ir_command_done(const IrCommand &command, const IrCommandResult &result);
+    /**
+     * @brief copy the storage fields of a vendor library report into the status
+     */
+    static void fill_storage_status(const mav_camera::StorageInformation &storage_information,
+                                    Camera::Status &status);
+    /**
+     * @brief notify status subscribers if the status changed since the last notification
+     */
+    void publish_status();
+    /**
+     * @brief start publishing the recording time once per second
      */
-    bool set_ir_palette(std::string color_mode);
+    void start_recording_timer();
     /**
-     * @brief execute ir camera FFC
+     * @brief stop publishing the recording time
      */
-    bool set_ir_FFC(std::string ignore);
+    void stop_recording_timer();
+    /**
+     * @brief take a photo every interval until _photo_interval_stop is set
+     */
+    void run_photo_interval(std::chrono::steady_clock::duration interval);
+    /**
+     * @brief stop and join the photo interval thread, caller holds _photo_interval_control_mutex
+     */
+    void stop_photo_interval_thread();
+    /**
+     * @brief queue count photos taken interval apart as one capture request
+     */
+    Camera::Result queue_capture(int32_t count, std::chrono::steady_clock::duration interval);
+    /**
+     * @brief take the queued requests one at a time until _capture_thread_stop is set
+     */
+    void run_captures();
+    /**
+     * @brief take one photo with the vendor library, blocking
+     */
+    bool capture_photo();
+    /**
+     * @brief hand the capture info of a photo taken now to the report thread
+     */
+    void publish_capture_info(int32_t capture_id, bool is_success);
+    /**
+     * @brief notify capture info subscribers of the queued reports until
+     * _capture_report_thread_stop is set and the reports are drained
+     */
+    void run_capture_reports();
 private:
-    Camera::ModeCallback _camera_mode_callback;
-    Camera::CaptureInfoCallback _capture_info_callback;
-    mutable Camera::Status _status;
-    Camera::StatusCallback _status_callback;
+    // store prefix and init mode are read when the backend opens, the rest at construction
+    const CameraConfig _config;
+    base::CallbackList<Camera::Mode> _mode_subscriptions;
+    base::CallbackList<Camera::Information> _information_subscriptions;
+    base::CallbackList<std::vector<Camera::VideoStreamInfo>> _video_stream_info_subscriptions;
+    base::CallbackList<Camera::CaptureInfo> _capture_info_subscriptions;
+    base::CallbackList<Camera::Status> _status_subscriptions;
+    base::CallbackList<std::vector<Camera::Setting>> _current_settings_subscriptions;
+    base::CallbackList<std::vector<Camera::SettingOptions>> _possible_setting_options_subscriptions;
+    // status flags, storage is filled in from the snapshots by status()
+    Camera::Status _status;
+    std::mutex _publish_status_mutex;
+    Camera::Status _published_status;
+    bool _status_published{false};
+    std::thread _recording_timer;
+    std::mutex _recording_timer_mutex;
+    std::condition_variable _recording_timer_cv;
+    bool _recording_timer_stop{false};
+    std::thread _photo_interval_thread;
+    std::mutex _photo_interval_mutex;
+    std::condition_variable _photo_interval_cv;
+    bool _photo_interval_stop{false};
+    // serializes starting and stopping the photo interval thread
+    std::mutex _photo_interval_control_mutex;
+    std::thread _capture_thread;
+    std::mutex _capture_mutex;
+    std::condition_variable _capture_cv;
+    bool _capture_thread_stop{false};
+    struct CaptureRequest {
+        int32_t first_id;
+        int32_t count;
+        std::chrono::steady_clock::duration interval;
+    };
+    // single photos and bursts waiting for the sensor, oldest first
+    std::deque<CaptureRequest> _pending_captures;
+    // queued plus the one being taken, bounded by _capture_depth
+    std::size_t _captures_in_flight{0};
+    std::size_t _capture_depth;
+    int32_t _capture_index{0};
+    // capture info waits here so a slow subscriber never holds up the sensor
+    std::thread _capture_report_thread;
+    std::mutex _capture_report_mutex;
+    std::condition_variable _capture_report_cv;
+    bool _capture_report_thread_stop{false};
+    base::RingBuffer<Camera::CaptureInfo> _capture_reports;
+    // every capture reported, kept across restarts for list_photos
+    CaptureIndex _capture_records;
+    // captures already in the index when the server started
+    std::size_t _capture_records_at_start{0};
 private:
-    mutable Camera::Mode _current_mode{Camera::Mode::Unknown};
+    enum class ModeState { Idle, Switching, Ready };
+    // guards the mode state, the backend is reconfigured without it
+    mutable std::mutex _mode_mutex;
+    std::condition_variable _mode_cv;
+    // mode the backend committed, published to the subscribers
+    Camera::Mode _current_mode{Camera::Mode::Unknown};
+    // Idle while the backend is closed
+    ModeState _mode_state{ModeState::Idle};
+    // latest mode asked for, a running switch moves on to it before it ends
+    Camera::Mode _mode_target{Camera::Mode::Unknown};
+    // result and number of the switches ended, for the requests that joined one
+    Camera::Result _mode_switch_result{Camera::Result::Success};
+    uint64_t _mode_switches{0};
+    // captures and video calls in the backend, a switch waits for them
+    int _mode_users{0};
     mutable std::chrono::steady_clock::time_point _start_video_time;
-    mutable std::vector<Camera::Setting> _settings;
+    // guarded by _settings_mutex, or by _backend_mutex held exclusively while it is opened
+    CameraSettings _settings;
+    // serializes setting changes so a batch is applied without interleaving
+    mutable std::mutex _settings_mutex;
+    // CAM_BURST of _settings, take_photo reads it here so it never waits out a mode switch
+    std::atomic<int32_t> _burst_count{1};
+    // the settings saved on every change and restored when the backend opens, empty for none
+    std::string _settings_snapshot_path;
+    // a restored snapshot is checked against the camera here, off the start path
+    std::thread _settings_verify_thread;
+    std::mutex _settings_verify_mutex;
+    std::condition_variable _settings_verify_cv;
+    bool _settings_verify_pending{false};
+    bool _settings_verify_thread_stop{false};
+    // palette of a restored snapshot until the ir camera is up to take it, guarded by
+    // _settings_mutex
+    std::optional<SettingValue> _restored_ir_palette;
     mutable std::mutex _storage_information_mutex;
-    mutable mav_camera::StorageInformation _current_storage_information;
+    // last report of the vendor library, only touched through std::atomic_load and
+    // std::atomic_store
+    std::shared_ptr<const mav_camera::StorageInformation> _current_storage_information;
+    StorageMonitor _storage_monitor;
+private:
+    // shared by the calls using the vendor libraries, exclusive while they are (re)loaded
+    std::shared_mutex _backend_mutex;
+    std::atomic<bool> _backend_reloading{false};
+    std::atomic<int> _backend_failures{0};
+    std::thread _backend_reload_thread;
+    std::mutex _backend_reload_thread_mutex;
 private:
     void *_plugin_handle{NULL};
     mav_camera::MavCamera *_mav_camera{nullptr};
     int32_t _framerate;
 private:
     void *_ir_camera_handle{NULL};
+    // set under _backend_mutex shared and _settings_mutex, cleared with it exclusive
     struct boson_extension_api *_ir_camera{nullptr};
+    // owns the uart of _ir_camera while it is set
+    IrCommandQueue _ir_commands;
+    // the uart handshake of the ir camera runs here, next to the RGB bring-up
+    std::thread _ir_bring_up_thread;
+    std::mutex _ir_bring_up_mutex;
+    std::condition_variable _ir_bring_up_cv;
+    bool _ir_bring_up_pending{false};
+    // _ir_camera is set, read here without the backend
+    bool _ir_camera_up{false};
+    bool _ir_bring_up_thread_stop{false};
 };
 
 }  // namespace mavcam
\ No newline at end of file
@@ -1,156 +1,75 @@
 // WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
 // Edits need to be made to the proto files
-// (see https://github.com/aeroratech/MAVCam-Proto/tree/main/protos/camera/camera.proto)
+// (see protos/camera/camera.proto)
+
+#pragma once
+
+#include <google/protobuf/arena.h>
 
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <functional>
 #include <future>
 #include <limits>
 #include <memory>
-#include <sstream>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include "base/log.h"
+#include "base/slot_registry.h"
 #include "camera/camera.grpc.pb.h"
+#include "camera_registry.h"
 #include "plugins/camera/camera.h"
+#include "plugins/camera/camera_enum_table.h"
 
 namespace mavcam {
 
 class CameraServiceImpl final : public mavcam::rpc::camera::CameraService::Service {
 public:
-    CameraServiceImpl(std::shared_ptr<Camera> plugin) : _plugin(plugin) {}
+    CameraServiceImpl(std::shared_ptr<CameraRegistry> cameras) : _cameras(cameras) {}
+
+    CameraRegistry &cameras() { return *_cameras; }
 
     template <typename ResponseType>
     void fillResponseWithResult(ResponseType *response, mavcam::Camera::Result &result) const {
-        auto rpc_result = translateToRpcResult(result);
-
-        auto *rpc_camera_result = new mavcam::rpc::camera::CameraResult();
-        rpc_camera_result->set_result(rpc_result);
-        std::stringstream ss;
-        ss << result;
-        rpc_camera_result->set_result_str(ss.str());
-
-        response->set_allocated_camera_result(rpc_camera_result);
+        auto *rpc_camera_result = response->mutable_camera_result();
+        rpc_camera_result->set_result(translateToRpcResult(result));
+        auto result_str = base::enum_name(kCameraResultTable, result);
+        rpc_camera_result->set_result_str(result_str.data(), result_str.size());
     }
 
     static mavcam::rpc::camera::Mode translateToRpcMode(const mavcam::Camera::Mode &mode) {
-        switch (mode) {
-            default:
-                base::LogError() << "Unknown mode enum value: " << static_cast<int>(mode);
-            // FALLTHROUGH
-            case mavcam::Camera::Mode::Unknown:
-                return mavcam::rpc::camera::MODE_UNKNOWN;
-            case mavcam::Camera::Mode::Photo:
-                return mavcam::rpc::camera::MODE_PHOTO;
-            case mavcam::Camera::Mode::Video:
-                return mavcam::rpc::camera::MODE_VIDEO;
-        }
+        return base::enum_to_rpc(kCameraModeTable, mode);
     }
 
     static mavcam::Camera::Mode translateFromRpcMode(const mavcam::rpc::camera::Mode mode) {
-        switch (mode) {
-            default:
-                base::LogError() << "Unknown mode enum value: " << static_cast<int>(mode);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::MODE_UNKNOWN:
-                return mavcam::Camera::Mode::Unknown;
-            case mavcam::rpc::camera::MODE_PHOTO:
-                return mavcam::Camera::Mode::Photo;
-            case mavcam::rpc::camera::MODE_VIDEO:
-                return mavcam::Camera::Mode::Video;
-        }
+        return base::enum_from_rpc(kCameraModeTable, mode);
     }
 
     static mavcam::rpc::camera::PhotosRange translateToRpcPhotosRange(
         const mavcam::Camera::PhotosRange &photos_range) {
-        switch (photos_range) {
-            default:
-                base::LogError() << "Unknown photos_range enum value: "
-                                 << static_cast<int>(photos_range);
-            // FALLTHROUGH
-            case mavcam::Camera::PhotosRange::All:
-                return mavcam::rpc::camera::PHOTOS_RANGE_ALL;
-            case mavcam::Camera::PhotosRange::SinceConnection:
-                return mavcam::rpc::camera::PHOTOS_RANGE_SINCE_CONNECTION;
-        }
+        return base::enum_to_rpc(kCameraPhotosRangeTable, photos_range);
     }
 
     static mavcam::Camera::PhotosRange translateFromRpcPhotosRange(
         const mavcam::rpc::camera::PhotosRange photos_range) {
-        switch (photos_range) {
-            default:
-                base::LogError() << "Unknown photos_range enum value: "
-                                 << static_cast<int>(photos_range);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::PHOTOS_RANGE_ALL:
-                return mavcam::Camera::PhotosRange::All;
-            case mavcam::rpc::camera::PHOTOS_RANGE_SINCE_CONNECTION:
-                return mavcam::Camera::PhotosRange::SinceConnection;
-        }
+        return base::enum_from_rpc(kCameraPhotosRangeTable, photos_range);
     }
 
     static mavcam::rpc::camera::CameraResult::Result translateToRpcResult(
         const mavcam::Camera::Result &result) {
-        switch (result) {
-            default:
-                base::LogError() << "Unknown result enum value: " << static_cast<int>(result);
-            // FALLTHROUGH
-            case mavcam::Camera::Result::Unknown:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_UNKNOWN;
-            case mavcam::Camera::Result::Success:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_SUCCESS;
-            case mavcam::Camera::Result::InProgress:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_IN_PROGRESS;
-            case mavcam::Camera::Result::Busy:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_BUSY;
-            case mavcam::Camera::Result::Denied:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_DENIED;
-            case mavcam::Camera::Result::Error:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_ERROR;
-            case mavcam::Camera::Result::Timeout:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_TIMEOUT;
-            case mavcam::Camera::Result::WrongArgument:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_WRONG_ARGUMENT;
-            case mavcam::Camera::Result::NoSystem:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_NO_SYSTEM;
-            case mavcam::Camera::Result::ProtocolUnsupported:
-                return mavcam::rpc::camera::CameraResult_Result_RESULT_PROTOCOL_UNSUPPORTED;
-        }
+        return base::enum_to_rpc(kCameraResultTable, result);
     }
 
     static mavcam::Camera::Result translateFromRpcResult(
         const mavcam::rpc::camera::CameraResult::Result result) {
-        switch (result) {
-            default:
-                base::LogError() << "Unknown result enum value: " << static_cast<int>(result);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_UNKNOWN:
-                return mavcam::Camera::Result::Unknown;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_SUCCESS:
-                return mavcam::Camera::Result::Success;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_IN_PROGRESS:
-                return mavcam::Camera::Result::InProgress;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_BUSY:
-                return mavcam::Camera::Result::Busy;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_DENIED:
-                return mavcam::Camera::Result::Denied;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_ERROR:
-                return mavcam::Camera::Result::Error;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_TIMEOUT:
-                return mavcam::Camera::Result::Timeout;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_WRONG_ARGUMENT:
-                return mavcam::Camera::Result::WrongArgument;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_NO_SYSTEM:
-                return mavcam::Camera::Result::NoSystem;
-            case mavcam::rpc::camera::CameraResult_Result_RESULT_PROTOCOL_UNSUPPORTED:
-                return mavcam::Camera::Result::ProtocolUnsupported;
-        }
-    }
-
-    static std::unique_ptr<mavcam::rpc::camera::Position> translateToRpcPosition(
-        const mavcam::Camera::Position &position) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::Position>();
+        return base::enum_from_rpc(kCameraResultTable, result);
+    }
 
+    static void translateToRpcPosition(const mavcam::Camera::Position &position,
+                                       mavcam::rpc::camera::Position *rpc_obj) {
         rpc_obj->set_latitude_deg(position.latitude_deg);
 
         rpc_obj->set_longitude_deg(position.longitude_deg);
@@ -158,8 +77,6 @@ public:
         rpc_obj->set_absolute_altitude_m(position.absolute_altitude_m);
 
         rpc_obj->set_relative_altitude_m(position.relative_altitude_m);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::Position translateFromRpcPosition(
@@ -177,10 +94,8 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::Quaternion> translateToRpcQuaternion(
-        const mavcam::Camera::Quaternion &quaternion) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::Quaternion>();
-
+    static void translateToRpcQuaternion(const mavcam::Camera::Quaternion &quaternion,
+                                         mavcam::rpc::camera::Quaternion *rpc_obj) {
         rpc_obj->set_w(quaternion.w);
 
         rpc_obj->set_x(quaternion.x);
@@ -188,8 +103,6 @@ public:
         rpc_obj->set_y(quaternion.y);
 
         rpc_obj->set_z(quaternion.z);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::Quaternion translateFromRpcQuaternion(
@@ -207,17 +120,13 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::EulerAngle> translateToRpcEulerAngle(
-        const mavcam::Camera::EulerAngle &euler_angle) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::EulerAngle>();
-
+    static void translateToRpcEulerAngle(const mavcam::Camera::EulerAngle &euler_angle,
+                                         mavcam::rpc::camera::EulerAngle *rpc_obj) {
         rpc_obj->set_roll_deg(euler_angle.roll_deg);
 
         rpc_obj->set_pitch_deg(euler_angle.pitch_deg);
 
         rpc_obj->set_yaw_deg(euler_angle.yaw_deg);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::EulerAngle translateFromRpcEulerAngle(
@@ -233,17 +142,15 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::CaptureInfo> translateToRpcCaptureInfo(
-        const mavcam::Camera::CaptureInfo &capture_info) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::CaptureInfo>();
+    static void translateToRpcCaptureInfo(const mavcam::Camera::CaptureInfo &capture_info,
+                                          mavcam::rpc::camera::CaptureInfo *rpc_obj) {
+        translateToRpcPosition(capture_info.position, rpc_obj->mutable_position());
 
-        rpc_obj->set_allocated_position(translateToRpcPosition(capture_info.position).release());
+        translateToRpcQuaternion(capture_info.attitude_quaternion,
+                                 rpc_obj->mutable_attitude_quaternion());
 
-        rpc_obj->set_allocated_attitude_quaternion(
-            translateToRpcQuaternion(capture_info.attitude_quaternion).release());
-
-        rpc_obj->set_allocated_attitude_euler_angle(
-            translateToRpcEulerAngle(capture_info.attitude_euler_angle).release());
+        translateToRpcEulerAngle(capture_info.attitude_euler_angle,
+                                 rpc_obj->mutable_attitude_euler_angle());
 
         rpc_obj->set_time_utc_us(capture_info.time_utc_us);
 
@@ -252,8 +159,6 @@ public:
         rpc_obj->set_index(capture_info.index);
 
         rpc_obj->set_file_url(capture_info.file_url);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::CaptureInfo translateFromRpcCaptureInfo(
@@ -277,11 +182,9 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::VideoStreamSettings>
-    translateToRpcVideoStreamSettings(
-        const mavcam::Camera::VideoStreamSettings &video_stream_settings) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::VideoStreamSettings>();
-
+    static void translateToRpcVideoStreamSettings(
+        const mavcam::Camera::VideoStreamSettings &video_stream_settings,
+        mavcam::rpc::camera::VideoStreamSettings *rpc_obj) {
         rpc_obj->set_frame_rate_hz(video_stream_settings.frame_rate_hz);
 
         rpc_obj->set_horizontal_resolution_pix(video_stream_settings.horizontal_resolution_pix);
@@ -295,8 +198,6 @@ public:
         rpc_obj->set_uri(video_stream_settings.uri);
 
         rpc_obj->set_horizontal_fov_deg(video_stream_settings.horizontal_fov_deg);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::VideoStreamSettings translateFromRpcVideoStreamSettings(
@@ -322,89 +223,35 @@ public:
 
     static mavcam::rpc::camera::VideoStreamInfo::VideoStreamStatus translateToRpcVideoStreamStatus(
         const mavcam::Camera::VideoStreamInfo::VideoStreamStatus &video_stream_status) {
-        switch (video_stream_status) {
-            default:
-                base::LogError() << "Unknown video_stream_status enum value: "
-                                 << static_cast<int>(video_stream_status);
-            // FALLTHROUGH
-            case mavcam::Camera::VideoStreamInfo::VideoStreamStatus::NotRunning:
-                return mavcam::rpc::camera::
-                    VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING;
-            case mavcam::Camera::VideoStreamInfo::VideoStreamStatus::InProgress:
-                return mavcam::rpc::camera::
-                    VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS;
-        }
+        return base::enum_to_rpc(kCameraVideoStreamStatusTable, video_stream_status);
     }
 
     static mavcam::Camera::VideoStreamInfo::VideoStreamStatus translateFromRpcVideoStreamStatus(
         const mavcam::rpc::camera::VideoStreamInfo::VideoStreamStatus video_stream_status) {
-        switch (video_stream_status) {
-            default:
-                base::LogError() << "Unknown video_stream_status enum value: "
-                                 << static_cast<int>(video_stream_status);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::
-                VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_NOT_RUNNING:
-                return mavcam::Camera::VideoStreamInfo::VideoStreamStatus::NotRunning;
-            case mavcam::rpc::camera::
-                VideoStreamInfo_VideoStreamStatus_VIDEO_STREAM_STATUS_IN_PROGRESS:
-                return mavcam::Camera::VideoStreamInfo::VideoStreamStatus::InProgress;
-        }
+        return base::enum_from_rpc(kCameraVideoStreamStatusTable, video_stream_status);
     }
 
     static mavcam::rpc::camera::VideoStreamInfo::VideoStreamSpectrum
     translateToRpcVideoStreamSpectrum(
         const mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum &video_stream_spectrum) {
-        switch (video_stream_spectrum) {
-            default:
-                base::LogError() << "Unknown video_stream_spectrum enum value: "
-                                 << static_cast<int>(video_stream_spectrum);
-            // FALLTHROUGH
-            case mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::Unknown:
-                return mavcam::rpc::camera::
-                    VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN;
-            case mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::VisibleLight:
-                return mavcam::rpc::camera::
-                    VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT;
-            case mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::Infrared:
-                return mavcam::rpc::camera::
-                    VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED;
-        }
+        return base::enum_to_rpc(kCameraVideoStreamSpectrumTable, video_stream_spectrum);
     }
 
     static mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum translateFromRpcVideoStreamSpectrum(
         const mavcam::rpc::camera::VideoStreamInfo::VideoStreamSpectrum video_stream_spectrum) {
-        switch (video_stream_spectrum) {
-            default:
-                base::LogError() << "Unknown video_stream_spectrum enum value: "
-                                 << static_cast<int>(video_stream_spectrum);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::
-                VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_UNKNOWN:
-                return mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::Unknown;
-            case mavcam::rpc::camera::
-                VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_VISIBLE_LIGHT:
-                return mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::VisibleLight;
-            case mavcam::rpc::camera::
-                VideoStreamInfo_VideoStreamSpectrum_VIDEO_STREAM_SPECTRUM_INFRARED:
-                return mavcam::Camera::VideoStreamInfo::VideoStreamSpectrum::Infrared;
-        }
-    }
-
-    static std::unique_ptr<mavcam::rpc::camera::VideoStreamInfo> translateToRpcVideoStreamInfo(
-        const mavcam::Camera::VideoStreamInfo &video_stream_info) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::VideoStreamInfo>();
+        return base::enum_from_rpc(kCameraVideoStreamSpectrumTable, video_stream_spectrum);
+    }
 
+    static void translateToRpcVideoStreamInfo(
+        const mavcam::Camera::VideoStreamInfo &video_stream_info,
+        mavcam::rpc::camera::VideoStreamInfo *rpc_obj) {
         rpc_obj->set_stream_id(video_stream_info.stream_id);
 
-        rpc_obj->set_allocated_settings(
-            translateToRpcVideoStreamSettings(video_stream_info.settings).release());
+        translateToRpcVideoStreamSettings(video_stream_info.settings, rpc_obj->mutable_settings());
 
         rpc_obj->set_status(translateToRpcVideoStreamStatus(video_stream_info.status));
 
         rpc_obj->set_spectrum(translateToRpcVideoStreamSpectrum(video_stream_info.spectrum));
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::VideoStreamInfo translateFromRpcVideoStreamInfo(
@@ -424,88 +271,26 @@ public:
 
     static mavcam::rpc::camera::Status::StorageStatus translateToRpcStorageStatus(
         const mavcam::Camera::Status::StorageStatus &storage_status) {
-        switch (storage_status) {
-            default:
-                base::LogError() << "Unknown storage_status enum value: "
-                                 << static_cast<int>(storage_status);
-            // FALLTHROUGH
-            case mavcam::Camera::Status::StorageStatus::NotAvailable:
-                return mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_AVAILABLE;
-            case mavcam::Camera::Status::StorageStatus::Unformatted:
-                return mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_UNFORMATTED;
-            case mavcam::Camera::Status::StorageStatus::Formatted:
-                return mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_FORMATTED;
-            case mavcam::Camera::Status::StorageStatus::NotSupported:
-                return mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_SUPPORTED;
-        }
+        return base::enum_to_rpc(kCameraStorageStatusTable, storage_status);
     }
 
     static mavcam::Camera::Status::StorageStatus translateFromRpcStorageStatus(
         const mavcam::rpc::camera::Status::StorageStatus storage_status) {
-        switch (storage_status) {
-            default:
-                base::LogError() << "Unknown storage_status enum value: "
-                                 << static_cast<int>(storage_status);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_AVAILABLE:
-                return mavcam::Camera::Status::StorageStatus::NotAvailable;
-            case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_UNFORMATTED:
-                return mavcam::Camera::Status::StorageStatus::Unformatted;
-            case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_FORMATTED:
-                return mavcam::Camera::Status::StorageStatus::Formatted;
-            case mavcam::rpc::camera::Status_StorageStatus_STORAGE_STATUS_NOT_SUPPORTED:
-                return mavcam::Camera::Status::StorageStatus::NotSupported;
-        }
+        return base::enum_from_rpc(kCameraStorageStatusTable, storage_status);
     }
 
     static mavcam::rpc::camera::Status::StorageType translateToRpcStorageType(
         const mavcam::Camera::Status::StorageType &storage_type) {
-        switch (storage_type) {
-            default:
-                base::LogError() << "Unknown storage_type enum value: "
-                                 << static_cast<int>(storage_type);
-            // FALLTHROUGH
-            case mavcam::Camera::Status::StorageType::Unknown:
-                return mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_UNKNOWN;
-            case mavcam::Camera::Status::StorageType::UsbStick:
-                return mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_USB_STICK;
-            case mavcam::Camera::Status::StorageType::Sd:
-                return mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_SD;
-            case mavcam::Camera::Status::StorageType::Microsd:
-                return mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_MICROSD;
-            case mavcam::Camera::Status::StorageType::Hd:
-                return mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_HD;
-            case mavcam::Camera::Status::StorageType::Other:
-                return mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_OTHER;
-        }
+        return base::enum_to_rpc(kCameraStorageTypeTable, storage_type);
     }
 
     static mavcam::Camera::Status::StorageType translateFromRpcStorageType(
         const mavcam::rpc::camera::Status::StorageType storage_type) {
-        switch (storage_type) {
-            default:
-                base::LogError() << "Unknown storage_type enum value: "
-                                 << static_cast<int>(storage_type);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_UNKNOWN:
-                return mavcam::Camera::Status::StorageType::Unknown;
-            case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_USB_STICK:
-                return mavcam::Camera::Status::StorageType::UsbStick;
-            case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_SD:
-                return mavcam::Camera::Status::StorageType::Sd;
-            case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_MICROSD:
-                return mavcam::Camera::Status::StorageType::Microsd;
-            case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_HD:
-                return mavcam::Camera::Status::StorageType::Hd;
-            case mavcam::rpc::camera::Status_StorageType_STORAGE_TYPE_OTHER:
-                return mavcam::Camera::Status::StorageType::Other;
-        }
-    }
-
-    static std::unique_ptr<mavcam::rpc::camera::Status> translateToRpcStatus(
-        const mavcam::Camera::Status &status) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::Status>();
+        return base::enum_from_rpc(kCameraStorageTypeTable, storage_type);
+    }
 
+    static void translateToRpcStatus(const mavcam::Camera::Status &status,
+                                     mavcam::rpc::camera::Status *rpc_obj) {
         rpc_obj->set_video_on(status.video_on);
 
         rpc_obj->set_photo_interval_on(status.photo_interval_on);
@@ -525,8 +310,6 @@ public:
         rpc_obj->set_storage_id(status.storage_id);
 
         rpc_obj->set_storage_type(translateToRpcStorageType(status.storage_type));
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::Status translateFromRpcStatus(
@@ -556,15 +339,11 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::Option> translateToRpcOption(
-        const mavcam::Camera::Option &option) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::Option>();
-
+    static void translateToRpcOption(const mavcam::Camera::Option &option,
+                                     mavcam::rpc::camera::Option *rpc_obj) {
         rpc_obj->set_option_id(option.option_id);
 
         rpc_obj->set_option_description(option.option_description);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::Option translateFromRpcOption(
@@ -578,19 +357,15 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::Setting> translateToRpcSetting(
-        const mavcam::Camera::Setting &setting) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::Setting>();
-
+    static void translateToRpcSetting(const mavcam::Camera::Setting &setting,
+                                      mavcam::rpc::camera::Setting *rpc_obj) {
         rpc_obj->set_setting_id(setting.setting_id);
 
         rpc_obj->set_setting_description(setting.setting_description);
 
-        rpc_obj->set_allocated_option(translateToRpcOption(setting.option).release());
+        translateToRpcOption(setting.option, rpc_obj->mutable_option());
 
         rpc_obj->set_is_range(setting.is_range);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::Setting translateFromRpcSetting(
@@ -608,22 +383,17 @@ public:
         return obj;
     }
 
-    static std::unique_ptr<mavcam::rpc::camera::SettingOptions> translateToRpcSettingOptions(
-        const mavcam::Camera::SettingOptions &setting_options) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::SettingOptions>();
-
+    static void translateToRpcSettingOptions(const mavcam::Camera::SettingOptions &setting_options,
+                                             mavcam::rpc::camera::SettingOptions *rpc_obj) {
         rpc_obj->set_setting_id(setting_options.setting_id);
 
         rpc_obj->set_setting_description(setting_options.setting_description);
 
         for (const auto &elem : setting_options.options) {
-            auto *ptr = rpc_obj->add_options();
-            ptr->CopyFrom(*translateToRpcOption(elem).release());
+            translateToRpcOption(elem, rpc_obj->add_options());
         }
 
         rpc_obj->set_is_range(setting_options.is_range);
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::SettingOptions translateFromRpcSettingOptions(
@@ -644,95 +414,78 @@ public:
         return obj;
     }
 
+    static void translateToRpcAppliedSetting(const mavcam::Camera::AppliedSetting &applied_setting,
+                                             mavcam::rpc::camera::AppliedSetting *rpc_obj) {
+        rpc_obj->set_result(translateToRpcResult(applied_setting.result));
+
+        rpc_obj->set_setting_id(applied_setting.setting_id);
+    }
+
+    static mavcam::Camera::AppliedSetting translateFromRpcAppliedSetting(
+        const mavcam::rpc::camera::AppliedSetting &applied_setting) {
+        mavcam::Camera::AppliedSetting obj;
+
+        obj.result = translateFromRpcResult(applied_setting.result());
+
+        obj.setting_id = applied_setting.setting_id();
+
+        return obj;
+    }
+
+    static void translateToRpcCallMetric(const mavcam::Camera::CallMetric &call_metric,
+                                         mavcam::rpc::camera::CallMetric *rpc_obj) {
+        rpc_obj->set_name(call_metric.name);
+
+        rpc_obj->set_count(call_metric.count);
+
+        rpc_obj->set_error_count(call_metric.error_count);
+
+        rpc_obj->set_total_latency_us(call_metric.total_latency_us);
+
+        rpc_obj->set_max_latency_us(call_metric.max_latency_us);
+
+        rpc_obj->set_p50_latency_us(call_metric.p50_latency_us);
+
+        rpc_obj->set_p90_latency_us(call_metric.p90_latency_us);
+
+        rpc_obj->set_p99_latency_us(call_metric.p99_latency_us);
+    }
+
+    static mavcam::Camera::CallMetric translateFromRpcCallMetric(
+        const mavcam::rpc::camera::CallMetric &call_metric) {
+        mavcam::Camera::CallMetric obj;
+
+        obj.name = call_metric.name();
+
+        obj.count = call_metric.count();
+
+        obj.error_count = call_metric.error_count();
+
+        obj.total_latency_us = call_metric.total_latency_us();
+
+        obj.max_latency_us = call_metric.max_latency_us();
+
+        obj.p50_latency_us = call_metric.p50_latency_us();
+
+        obj.p90_latency_us = call_metric.p90_latency_us();
+
+        obj.p99_latency_us = call_metric.p99_latency_us();
+
+        return obj;
+    }
+
     static mavcam::rpc::camera::Information::CameraCapFlags translateToRpcCameraCapFlags(
         const mavcam::Camera::Information::CameraCapFlags &camera_cap_flags) {
-        switch (camera_cap_flags) {
-            default:
-                base::LogError() << "Unknown camera_cap_flags enum value: "
-                                 << static_cast<int>(camera_cap_flags);
-            // FALLTHROUGH
-            case mavcam::Camera::Information::CameraCapFlags::CaptureVideo:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_VIDEO;
-            case mavcam::Camera::Information::CameraCapFlags::CaptureImage:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_IMAGE;
-            case mavcam::Camera::Information::CameraCapFlags::HasModes:
-                return mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_MODES;
-            case mavcam::Camera::Information::CameraCapFlags::CanCaptureImageInVideoMode:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_IMAGE_IN_VIDEO_MODE;
-            case mavcam::Camera::Information::CameraCapFlags::CanCaptureVideoInImageMode:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_VIDEO_IN_IMAGE_MODE;
-            case mavcam::Camera::Information::CameraCapFlags::HasImageSurveyMode:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_IMAGE_SURVEY_MODE;
-            case mavcam::Camera::Information::CameraCapFlags::HasBasicZoom:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_ZOOM;
-            case mavcam::Camera::Information::CameraCapFlags::HasBasicFocus:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_FOCUS;
-            case mavcam::Camera::Information::CameraCapFlags::HasVideoStream:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_VIDEO_STREAM;
-            case mavcam::Camera::Information::CameraCapFlags::HasTrackingPoint:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_POINT;
-            case mavcam::Camera::Information::CameraCapFlags::HasTrackingRectangle:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_RECTANGLE;
-            case mavcam::Camera::Information::CameraCapFlags::HasTrackingGeoStatus:
-                return mavcam::rpc::camera::
-                    Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_GEO_STATUS;
-        }
+        return base::enum_to_rpc(kCameraCameraCapFlagsTable, camera_cap_flags);
     }
 
     static mavcam::Camera::Information::CameraCapFlags translateFromRpcCameraCapFlags(
         const mavcam::rpc::camera::Information::CameraCapFlags camera_cap_flags) {
-        switch (camera_cap_flags) {
-            default:
-                base::LogError() << "Unknown camera_cap_flags enum value: "
-                                 << static_cast<int>(camera_cap_flags);
-            // FALLTHROUGH
-            case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_VIDEO:
-                return mavcam::Camera::Information::CameraCapFlags::CaptureVideo;
-            case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAPTURE_IMAGE:
-                return mavcam::Camera::Information::CameraCapFlags::CaptureImage;
-            case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_MODES:
-                return mavcam::Camera::Information::CameraCapFlags::HasModes;
-            case mavcam::rpc::camera::
-                Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_IMAGE_IN_VIDEO_MODE:
-                return mavcam::Camera::Information::CameraCapFlags::CanCaptureImageInVideoMode;
-            case mavcam::rpc::camera::
-                Information_CameraCapFlags_CAMERA_CAP_FLAGS_CAN_CAPTURE_VIDEO_IN_IMAGE_MODE:
-                return mavcam::Camera::Information::CameraCapFlags::CanCaptureVideoInImageMode;
-            case mavcam::rpc::camera::
-                Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_IMAGE_SURVEY_MODE:
-                return mavcam::Camera::Information::CameraCapFlags::HasImageSurveyMode;
-            case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_ZOOM:
-                return mavcam::Camera::Information::CameraCapFlags::HasBasicZoom;
-            case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_BASIC_FOCUS:
-                return mavcam::Camera::Information::CameraCapFlags::HasBasicFocus;
-            case mavcam::rpc::camera::Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_VIDEO_STREAM:
-                return mavcam::Camera::Information::CameraCapFlags::HasVideoStream;
-            case mavcam::rpc::camera::
-                Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_POINT:
-                return mavcam::Camera::Information::CameraCapFlags::HasTrackingPoint;
-            case mavcam::rpc::camera::
-                Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_RECTANGLE:
-                return mavcam::Camera::Information::CameraCapFlags::HasTrackingRectangle;
-            case mavcam::rpc::camera::
-                Information_CameraCapFlags_CAMERA_CAP_FLAGS_HAS_TRACKING_GEO_STATUS:
-                return mavcam::Camera::Information::CameraCapFlags::HasTrackingGeoStatus;
-        }
-    }
-
-    static std::unique_ptr<mavcam::rpc::camera::Information> translateToRpcInformation(
-        const mavcam::Camera::Information &information) {
-        auto rpc_obj = std::make_unique<mavcam::rpc::camera::Information>();
+        return base::enum_from_rpc(kCameraCameraCapFlagsTable, camera_cap_flags);
+    }
 
+    static void translateToRpcInformation(const mavcam::Camera::Information &information,
+                                          mavcam::rpc::camera::Information *rpc_obj) {
         rpc_obj->set_vendor_name(information.vendor_name);
 
         rpc_obj->set_model_name(information.model_name);
@@ -758,8 +511,6 @@ public:
         for (const auto &elem : information.camera_cap_flags) {
             rpc_obj->add_camera_cap_flags(translateToRpcCameraCapFlags(elem));
         }
-
-        return rpc_obj;
     }
 
     static mavcam::Camera::Information translateFromRpcInformation(
@@ -796,10 +547,17 @@ public:
         return obj;
     }
 
-    grpc::Status Prepare(grpc::ServerContext * /* context */,
+    grpc::Status Prepare(grpc::ServerContext *context,
                          const mavcam::rpc::camera::PrepareRequest * /* request */,
                          mavcam::rpc::camera::PrepareResponse *response) override {
-        auto result = _plugin->prepare();
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->prepare();
+        if (_prepared_callback) {
+            _prepared_callback(_cameras->camera_id(context), result);
+        }
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -808,10 +566,14 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status TakePhoto(grpc::ServerContext * /* context */,
+    grpc::Status TakePhoto(grpc::ServerContext *context,
                            const mavcam::rpc::camera::TakePhotoRequest * /* request */,
                            mavcam::rpc::camera::TakePhotoResponse *response) override {
-        auto result = _plugin->take_photo();
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->take_photo();
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -821,7 +583,7 @@ public:
     }
 
     grpc::Status StartPhotoInterval(
-        grpc::ServerContext * /* context */,
+        grpc::ServerContext *context,
         const mavcam::rpc::camera::StartPhotoIntervalRequest *request,
         mavcam::rpc::camera::StartPhotoIntervalResponse *response) override {
         if (request == nullptr) {
@@ -829,7 +591,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->start_photo_interval(request->interval_s());
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->start_photo_interval(request->interval_s());
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -839,10 +605,14 @@ public:
     }
 
     grpc::Status StopPhotoInterval(
-        grpc::ServerContext * /* context */,
+        grpc::ServerContext *context,
         const mavcam::rpc::camera::StopPhotoIntervalRequest * /* request */,
         mavcam::rpc::camera::StopPhotoIntervalResponse *response) override {
-        auto result = _plugin->stop_photo_interval();
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->stop_photo_interval();
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -851,10 +621,14 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status StartVideo(grpc::ServerContext * /* context */,
+    grpc::Status StartVideo(grpc::ServerContext *context,
                             const mavcam::rpc::camera::StartVideoRequest * /* request */,
                             mavcam::rpc::camera::StartVideoResponse *response) override {
-        auto result = _plugin->start_video();
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->start_video();
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -863,10 +637,14 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status StopVideo(grpc::ServerContext * /* context */,
+    grpc::Status StopVideo(grpc::ServerContext *context,
                            const mavcam::rpc::camera::StopVideoRequest * /* request */,
                            mavcam::rpc::camera::StopVideoResponse *response) override {
-        auto result = _plugin->stop_video();
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->stop_video();
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -876,7 +654,7 @@ public:
     }
 
     grpc::Status StartVideoStreaming(
-        grpc::ServerContext * /* context */,
+        grpc::ServerContext *context,
         const mavcam::rpc::camera::StartVideoStreamingRequest *request,
         mavcam::rpc::camera::StartVideoStreamingResponse *response) override {
         if (request == nullptr) {
@@ -884,7 +662,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->start_video_streaming(request->stream_id());
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->start_video_streaming(request->stream_id());
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -894,7 +676,7 @@ public:
     }
 
     grpc::Status StopVideoStreaming(
-        grpc::ServerContext * /* context */,
+        grpc::ServerContext *context,
         const mavcam::rpc::camera::StopVideoStreamingRequest *request,
         mavcam::rpc::camera::StopVideoStreamingResponse *response) override {
         if (request == nullptr) {
@@ -902,7 +684,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->stop_video_streaming(request->stream_id());
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->stop_video_streaming(request->stream_id());
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -911,7 +697,7 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status SetMode(grpc::ServerContext * /* context */,
+    grpc::Status SetMode(grpc::ServerContext *context,
                          const mavcam::rpc::camera::SetModeRequest *request,
                          mavcam::rpc::camera::SetModeResponse *response) override {
         if (request == nullptr) {
@@ -919,7 +705,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->set_mode(translateFromRpcMode(request->mode()));
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->set_mode(translateFromRpcMode(request->mode()));
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -928,7 +718,7 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status ListPhotos(grpc::ServerContext * /* context */,
+    grpc::Status ListPhotos(grpc::ServerContext *context,
                             const mavcam::rpc::camera::ListPhotosRequest *request,
                             mavcam::rpc::camera::ListPhotosResponse *response) override {
         if (request == nullptr) {
@@ -936,203 +726,458 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->list_photos(translateFromRpcPhotosRange(request->photos_range()));
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->list_photos(translateFromRpcPhotosRange(request->photos_range()));
 
         if (response != nullptr) {
             fillResponseWithResult(response, result.first);
 
             for (auto elem : result.second) {
-                auto *ptr = response->add_capture_infos();
-                ptr->CopyFrom(*translateToRpcCaptureInfo(elem).release());
+                translateToRpcCaptureInfo(elem, response->add_capture_infos());
             }
         }
 
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeMode(
-        grpc::ServerContext * /* context */,
+    mavcam::Camera::ModeHandle subscribeModeUpdates(
+        const std::shared_ptr<Camera> &plugin,
         const mavcam::rpc::camera::SubscribeModeRequest * /* request */,
+        const std::function<void(const mavcam::rpc::camera::ModeResponse &)> &callback) {
+        return plugin->subscribe_mode([callback](const mavcam::Camera::Mode mode) {
+            google::protobuf::Arena arena;
+            auto *rpc_response =
+                google::protobuf::Arena::CreateMessage<mavcam::rpc::camera::ModeResponse>(&arena);
+
+            rpc_response->set_mode(translateToRpcMode(mode));
+
+            callback(*rpc_response);
+        });
+    }
+
+    void unsubscribeModeUpdates(const std::shared_ptr<Camera> &plugin,
+                                mavcam::Camera::ModeHandle handle) {
+        plugin->unsubscribe_mode(handle);
+    }
+
+    grpc::Status SubscribeMode(
+        grpc::ServerContext *context, const mavcam::rpc::camera::SubscribeModeRequest *request,
         grpc::ServerWriter<mavcam::rpc::camera::ModeResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
         auto stream_closed_promise = std::make_shared<std::promise<void>>();
         auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribeModeUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::ModeResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
+                }
+            });
 
-        _plugin->mode_async(
-            [this, &writer, &stream_closed_promise](const mavcam::Camera::Mode mode) {
-                mavcam::rpc::camera::ModeResponse rpc_response;
+        wait_for_stream_closed(context, stream_closed_future);
 
-                rpc_response.set_mode(translateToRpcMode(mode));
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribeModeUpdates(plugin, handle);
 
-                writer->Write(rpc_response);
-                unregister_stream_stop_promise(stream_closed_promise);
-                stream_closed_promise->set_value();
-            });
+        return ::grpc::Status::OK;
+    }
+
+    mavcam::Camera::InformationHandle subscribeInformationUpdates(
+        const std::shared_ptr<Camera> &plugin,
+        const mavcam::rpc::camera::SubscribeInformationRequest * /* request */,
+        const std::function<void(const mavcam::rpc::camera::InformationResponse &)> &callback) {
+        return plugin->subscribe_information(
+            [callback](const mavcam::Camera::Information information) {
+                google::protobuf::Arena arena;
+                auto *rpc_response = google::protobuf::Arena::CreateMessage<
+                    mavcam::rpc::camera::InformationResponse>(&arena);
 
-        stream_closed_future.wait();
+                translateToRpcInformation(information, rpc_response->mutable_information());
 
-        return ::grpc::Status::OK;
+                callback(*rpc_response);
+            });
+    }
+
+    void unsubscribeInformationUpdates(const std::shared_ptr<Camera> &plugin,
+                                       mavcam::Camera::InformationHandle handle) {
+        plugin->unsubscribe_information(handle);
     }
 
     grpc::Status SubscribeInformation(
-        grpc::ServerContext * /* context */,
-        const mavcam::rpc::camera::SubscribeInformationRequest * /* request */,
+        grpc::ServerContext *context,
+        const mavcam::rpc::camera::SubscribeInformationRequest *request,
         grpc::ServerWriter<mavcam::rpc::camera::InformationResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
         auto stream_closed_promise = std::make_shared<std::promise<void>>();
         auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribeInformationUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::InformationResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
+                }
+            });
 
-        _plugin->information_async(
-            [this, &writer, &stream_closed_promise](const mavcam::Camera::Information information) {
-                mavcam::rpc::camera::InformationResponse rpc_response;
+        wait_for_stream_closed(context, stream_closed_future);
 
-                rpc_response.set_allocated_information(
-                    translateToRpcInformation(information).release());
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribeInformationUpdates(plugin, handle);
 
-                writer->Write(rpc_response);
-                unregister_stream_stop_promise(stream_closed_promise);
-                stream_closed_promise->set_value();
-            });
+        return ::grpc::Status::OK;
+    }
 
-        stream_closed_future.wait();
+    mavcam::Camera::VideoStreamInfoHandle subscribeVideoStreamInfoUpdates(
+        const std::shared_ptr<Camera> &plugin,
+        const mavcam::rpc::camera::SubscribeVideoStreamInfoRequest * /* request */,
+        const std::function<void(const mavcam::rpc::camera::VideoStreamInfoResponse &)>
+            &callback) {
+        return plugin->subscribe_video_stream_info(
+            [callback](const std::vector<mavcam::Camera::VideoStreamInfo> video_stream_info) {
+                google::protobuf::Arena arena;
+                auto *rpc_response = google::protobuf::Arena::CreateMessage<
+                    mavcam::rpc::camera::VideoStreamInfoResponse>(&arena);
 
-        return ::grpc::Status::OK;
+                for (const auto &elem : video_stream_info) {
+                    translateToRpcVideoStreamInfo(elem, rpc_response->add_video_stream_infos());
+                }
+
+                callback(*rpc_response);
+            });
+    }
+
+    void unsubscribeVideoStreamInfoUpdates(const std::shared_ptr<Camera> &plugin,
+                                           mavcam::Camera::VideoStreamInfoHandle handle) {
+        plugin->unsubscribe_video_stream_info(handle);
     }
 
     grpc::Status SubscribeVideoStreamInfo(
-        grpc::ServerContext * /* context */,
-        const mavcam::rpc::camera::SubscribeVideoStreamInfoRequest * /* request */,
+        grpc::ServerContext *context,
+        const mavcam::rpc::camera::SubscribeVideoStreamInfoRequest *request,
         grpc::ServerWriter<mavcam::rpc::camera::VideoStreamInfoResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
         auto stream_closed_promise = std::make_shared<std::promise<void>>();
         auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
-
-        _plugin->video_stream_info_async(
-            [this, &writer, &stream_closed_promise](
-                const std::vector<mavcam::Camera::VideoStreamInfo> video_stream_info) {
-                mavcam::rpc::camera::VideoStreamInfoResponse rpc_response;
-
-                for (const auto &elem : video_stream_info) {
-                    auto *ptr = rpc_response.add_video_stream_infos();
-                    ptr->CopyFrom(*translateToRpcVideoStreamInfo(elem).release());
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribeVideoStreamInfoUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::VideoStreamInfoResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
                 }
-
-                writer->Write(rpc_response);
-                unregister_stream_stop_promise(stream_closed_promise);
-                stream_closed_promise->set_value();
             });
 
-        stream_closed_future.wait();
+        wait_for_stream_closed(context, stream_closed_future);
+
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribeVideoStreamInfoUpdates(plugin, handle);
 
         return ::grpc::Status::OK;
     }
 
-    grpc::Status SubscribeCaptureInfo(
-        grpc::ServerContext * /* context */,
+    mavcam::Camera::CaptureInfoHandle subscribeCaptureInfoUpdates(
+        const std::shared_ptr<Camera> &plugin,
         const mavcam::rpc::camera::SubscribeCaptureInfoRequest * /* request */,
+        const std::function<void(const mavcam::rpc::camera::CaptureInfoResponse &)> &callback) {
+        return plugin->subscribe_capture_info(
+            [callback](const mavcam::Camera::CaptureInfo capture_info) {
+                google::protobuf::Arena arena;
+                auto *rpc_response = google::protobuf::Arena::CreateMessage<
+                    mavcam::rpc::camera::CaptureInfoResponse>(&arena);
+
+                translateToRpcCaptureInfo(capture_info, rpc_response->mutable_capture_info());
+
+                callback(*rpc_response);
+            });
+    }
+
+    void unsubscribeCaptureInfoUpdates(const std::shared_ptr<Camera> &plugin,
+                                       mavcam::Camera::CaptureInfoHandle handle) {
+        plugin->unsubscribe_capture_info(handle);
+    }
+
+    grpc::Status SubscribeCaptureInfo(
+        grpc::ServerContext *context,
+        const mavcam::rpc::camera::SubscribeCaptureInfoRequest *request,
         grpc::ServerWriter<mavcam::rpc::camera::CaptureInfoResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
         auto stream_closed_promise = std::make_shared<std::promise<void>>();
         auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribeCaptureInfoUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::CaptureInfoResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
+                }
+            });
 
-        _plugin->capture_info_async([this, &writer, &stream_closed_promise](
-                                        const mavcam::Camera::CaptureInfo capture_info) {
-            mavcam::rpc::camera::CaptureInfoResponse rpc_response;
+        wait_for_stream_closed(context, stream_closed_future);
 
-            rpc_response.set_allocated_capture_info(
-                translateToRpcCaptureInfo(capture_info).release());
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribeCaptureInfoUpdates(plugin, handle);
 
-            writer->Write(rpc_response);
-            unregister_stream_stop_promise(stream_closed_promise);
-            stream_closed_promise->set_value();
-        });
+        return ::grpc::Status::OK;
+    }
+
+    mavcam::Camera::StatusHandle subscribeStatusUpdates(
+        const std::shared_ptr<Camera> &plugin,
+        const mavcam::rpc::camera::SubscribeStatusRequest * /* request */,
+        const std::function<void(const mavcam::rpc::camera::StatusResponse &)> &callback) {
+        return plugin->subscribe_status([callback](const mavcam::Camera::Status status) {
+            google::protobuf::Arena arena;
+            auto *rpc_response =
+                google::protobuf::Arena::CreateMessage<mavcam::rpc::camera::StatusResponse>(&arena);
 
-        stream_closed_future.wait();
+            translateToRpcStatus(status, rpc_response->mutable_camera_status());
 
-        return ::grpc::Status::OK;
+            callback(*rpc_response);
+        });
+    }
+
+    void unsubscribeStatusUpdates(const std::shared_ptr<Camera> &plugin,
+                                  mavcam::Camera::StatusHandle handle) {
+        plugin->unsubscribe_status(handle);
     }
 
     grpc::Status SubscribeStatus(
-        grpc::ServerContext * /* context */,
-        const mavcam::rpc::camera::SubscribeStatusRequest * /* request */,
+        grpc::ServerContext *context, const mavcam::rpc::camera::SubscribeStatusRequest *request,
         grpc::ServerWriter<mavcam::rpc::camera::StatusResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
         auto stream_closed_promise = std::make_shared<std::promise<void>>();
         auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribeStatusUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::StatusResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
+                }
+            });
 
-        _plugin->status_async(
-            [this, &writer, &stream_closed_promise](const mavcam::Camera::Status status) {
-                mavcam::rpc::camera::StatusResponse rpc_response;
+        wait_for_stream_closed(context, stream_closed_future);
 
-                rpc_response.set_allocated_camera_status(translateToRpcStatus(status).release());
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribeStatusUpdates(plugin, handle);
 
-                writer->Write(rpc_response);
-                unregister_stream_stop_promise(stream_closed_promise);
-                stream_closed_promise->set_value();
-            });
+        return ::grpc::Status::OK;
+    }
 
-        stream_closed_future.wait();
+    mavcam::Camera::CurrentSettingsHandle subscribeCurrentSettingsUpdates(
+        const std::shared_ptr<Camera> &plugin,
+        const mavcam::rpc::camera::SubscribeCurrentSettingsRequest * /* request */,
+        const std::function<void(const mavcam::rpc::camera::CurrentSettingsResponse &)>
+            &callback) {
+        return plugin->subscribe_current_settings(
+            [callback](const std::vector<mavcam::Camera::Setting> current_settings) {
+                google::protobuf::Arena arena;
+                auto *rpc_response = google::protobuf::Arena::CreateMessage<
+                    mavcam::rpc::camera::CurrentSettingsResponse>(&arena);
 
-        return ::grpc::Status::OK;
+                for (const auto &elem : current_settings) {
+                    translateToRpcSetting(elem, rpc_response->add_current_settings());
+                }
+
+                callback(*rpc_response);
+            });
+    }
+
+    void unsubscribeCurrentSettingsUpdates(const std::shared_ptr<Camera> &plugin,
+                                           mavcam::Camera::CurrentSettingsHandle handle) {
+        plugin->unsubscribe_current_settings(handle);
     }
 
     grpc::Status SubscribeCurrentSettings(
-        grpc::ServerContext * /* context */,
-        const mavcam::rpc::camera::SubscribeCurrentSettingsRequest * /* request */,
+        grpc::ServerContext *context,
+        const mavcam::rpc::camera::SubscribeCurrentSettingsRequest *request,
         grpc::ServerWriter<mavcam::rpc::camera::CurrentSettingsResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
         auto stream_closed_promise = std::make_shared<std::promise<void>>();
         auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
-
-        _plugin->current_settings_async(
-            [this, &writer,
-             &stream_closed_promise](const std::vector<mavcam::Camera::Setting> current_settings) {
-                mavcam::rpc::camera::CurrentSettingsResponse rpc_response;
-
-                for (const auto &elem : current_settings) {
-                    auto *ptr = rpc_response.add_current_settings();
-                    ptr->CopyFrom(*translateToRpcSetting(elem).release());
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribeCurrentSettingsUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::CurrentSettingsResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
                 }
-
-                writer->Write(rpc_response);
-                unregister_stream_stop_promise(stream_closed_promise);
-                stream_closed_promise->set_value();
             });
 
-        stream_closed_future.wait();
+        wait_for_stream_closed(context, stream_closed_future);
+
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribeCurrentSettingsUpdates(plugin, handle);
 
         return ::grpc::Status::OK;
     }
 
-    grpc::Status SubscribePossibleSettingOptions(
-        grpc::ServerContext * /* context */,
+    mavcam::Camera::PossibleSettingOptionsHandle subscribePossibleSettingOptionsUpdates(
+        const std::shared_ptr<Camera> &plugin,
         const mavcam::rpc::camera::SubscribePossibleSettingOptionsRequest * /* request */,
-        grpc::ServerWriter<mavcam::rpc::camera::PossibleSettingOptionsResponse> *writer) override {
-        auto stream_closed_promise = std::make_shared<std::promise<void>>();
-        auto stream_closed_future = stream_closed_promise->get_future();
-        register_stream_stop_promise(stream_closed_promise);
-
-        _plugin->possible_setting_options_async(
-            [this, &writer, &stream_closed_promise](
+        const std::function<void(const mavcam::rpc::camera::PossibleSettingOptionsResponse &)>
+            &callback) {
+        return plugin->subscribe_possible_setting_options(
+            [callback](
                 const std::vector<mavcam::Camera::SettingOptions> possible_setting_options) {
-                mavcam::rpc::camera::PossibleSettingOptionsResponse rpc_response;
+                google::protobuf::Arena arena;
+                auto *rpc_response = google::protobuf::Arena::CreateMessage<
+                    mavcam::rpc::camera::PossibleSettingOptionsResponse>(&arena);
 
                 for (const auto &elem : possible_setting_options) {
-                    auto *ptr = rpc_response.add_setting_options();
-                    ptr->CopyFrom(*translateToRpcSettingOptions(elem).release());
+                    translateToRpcSettingOptions(elem, rpc_response->add_setting_options());
                 }
 
-                writer->Write(rpc_response);
-                unregister_stream_stop_promise(stream_closed_promise);
-                stream_closed_promise->set_value();
+                callback(*rpc_response);
             });
+    }
 
-        stream_closed_future.wait();
+    void unsubscribePossibleSettingOptionsUpdates(
+        const std::shared_ptr<Camera> &plugin,
+        mavcam::Camera::PossibleSettingOptionsHandle handle) {
+        plugin->unsubscribe_possible_setting_options(handle);
+    }
+
+    grpc::Status SubscribePossibleSettingOptions(
+        grpc::ServerContext *context,
+        const mavcam::rpc::camera::SubscribePossibleSettingOptionsRequest *request,
+        grpc::ServerWriter<mavcam::rpc::camera::PossibleSettingOptionsResponse> *writer) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto stream_closed_promise = std::make_shared<std::promise<void>>();
+        auto stream_closed_future = stream_closed_promise->get_future();
+        const auto stop_key = register_stream_stop_promise(stream_closed_promise);
+
+        auto is_finished = std::make_shared<bool>(false);
+        auto subscribe_mutex = std::make_shared<std::mutex>();
+
+        const auto handle = subscribePossibleSettingOptionsUpdates(
+            plugin, request,
+            [this, writer, stream_closed_promise, stop_key, is_finished, subscribe_mutex](
+                const mavcam::rpc::camera::PossibleSettingOptionsResponse &rpc_response) {
+                std::unique_lock<std::mutex> lock(*subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_response)) {
+                    *is_finished = true;
+                    if (unregister_stream_stop_promise(stop_key)) {
+                        stream_closed_promise->set_value();
+                    }
+                }
+            });
+
+        wait_for_stream_closed(context, stream_closed_future);
+
+        std::unique_lock<std::mutex> lock(*subscribe_mutex);
+        if (!*is_finished) {
+            *is_finished = true;
+            unregister_stream_stop_promise(stop_key);
+        }
+        unsubscribePossibleSettingOptionsUpdates(plugin, handle);
 
         return ::grpc::Status::OK;
     }
 
-    grpc::Status SetSetting(grpc::ServerContext * /* context */,
+    grpc::Status SetSetting(grpc::ServerContext *context,
                             const mavcam::rpc::camera::SetSettingRequest *request,
                             mavcam::rpc::camera::SetSettingResponse *response) override {
         if (request == nullptr) {
@@ -1140,7 +1185,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->set_setting(translateFromRpcSetting(request->setting()));
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->set_setting(translateFromRpcSetting(request->setting()));
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -1149,7 +1198,7 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status GetSetting(grpc::ServerContext * /* context */,
+    grpc::Status GetSetting(grpc::ServerContext *context,
                             const mavcam::rpc::camera::GetSettingRequest *request,
                             mavcam::rpc::camera::GetSettingResponse *response) override {
         if (request == nullptr) {
@@ -1157,18 +1206,22 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->get_setting(translateFromRpcSetting(request->setting()));
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->get_setting(translateFromRpcSetting(request->setting()));
 
         if (response != nullptr) {
             fillResponseWithResult(response, result.first);
 
-            response->set_allocated_setting(translateToRpcSetting(result.second).release());
+            translateToRpcSetting(result.second, response->mutable_setting());
         }
 
         return grpc::Status::OK;
     }
 
-    grpc::Status FormatStorage(grpc::ServerContext * /* context */,
+    grpc::Status FormatStorage(grpc::ServerContext *context,
                                const mavcam::rpc::camera::FormatStorageRequest *request,
                                mavcam::rpc::camera::FormatStorageResponse *response) override {
         if (request == nullptr) {
@@ -1176,7 +1229,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->format_storage(request->storage_id());
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->format_storage(request->storage_id());
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -1193,7 +1250,9 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->select_camera(request->camera_id());
+        // the camera answering calls that carry no camera id
+        auto result = _cameras->select(request->camera_id()) ? Camera::Result::Success
+                                                              : Camera::Result::WrongArgument;
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -1202,10 +1261,14 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status ResetSettings(grpc::ServerContext * /* context */,
+    grpc::Status ResetSettings(grpc::ServerContext *context,
                                const mavcam::rpc::camera::ResetSettingsRequest * /* request */,
                                mavcam::rpc::camera::ResetSettingsResponse *response) override {
-        auto result = _plugin->reset_settings();
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->reset_settings();
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -1214,7 +1277,7 @@ public:
         return ::grpc::Status::OK;
     }
 
-    grpc::Status SetTimestamp(grpc::ServerContext * /* context */,
+    grpc::Status SetTimestamp(grpc::ServerContext *context,
                               const mavcam::rpc::camera::SetTimestampRequest *request,
                               mavcam::rpc::camera::SetTimestampResponse *response) override {
         if (request == nullptr) {
@@ -1222,7 +1285,11 @@ public:
             return grpc::Status::OK;
         }
 
-        auto result = _plugin->set_timestamp(request->timestamp());
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->set_timestamp(request->timestamp());
 
         if (response != nullptr) {
             fillResponseWithResult(response, result);
@@ -1231,40 +1298,133 @@ public:
         return ::grpc::Status::OK;
     }
 
-    void stop() {
-        _stopped.store(true);
-        for (auto &prom : _stream_stop_promises) {
-            if (auto handle = prom.lock()) {
-                handle->set_value();
+    grpc::Status SetSettings(grpc::ServerContext *context,
+                             const mavcam::rpc::camera::SetSettingsRequest *request,
+                             mavcam::rpc::camera::SetSettingsResponse *response) override {
+        if (request == nullptr) {
+            base::LogWarn() << "SetSettings sent with a null request! Ignoring...";
+            return grpc::Status::OK;
+        }
+
+        std::vector<mavcam::Camera::Setting> settings_vec;
+        for (const auto &elem : request->settings()) {
+            settings_vec.push_back(translateFromRpcSetting(elem));
+        }
+
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->set_settings(settings_vec);
+
+        if (response != nullptr) {
+            fillResponseWithResult(response, result.first);
+
+            for (auto elem : result.second) {
+                translateToRpcAppliedSetting(elem, response->add_applied_settings());
             }
         }
+
+        return grpc::Status::OK;
     }
-private:
-    void register_stream_stop_promise(std::weak_ptr<std::promise<void>> prom) {
-        // If we have already stopped, set promise immediately and don't add it to list.
-        if (_stopped.load()) {
-            if (auto handle = prom.lock()) {
-                handle->set_value();
+
+    grpc::Status GetMetrics(grpc::ServerContext *context,
+                            const mavcam::rpc::camera::GetMetricsRequest * /* request */,
+                            mavcam::rpc::camera::GetMetricsResponse *response) override {
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->get_metrics();
+
+        if (response != nullptr) {
+            fillResponseWithResult(response, result.first);
+
+            for (auto elem : result.second) {
+                translateToRpcCallMetric(elem, response->add_call_metrics());
             }
-        } else {
-            _stream_stop_promises.push_back(prom);
         }
+
+        return grpc::Status::OK;
+    }
+
+    grpc::Status StartBurst(grpc::ServerContext *context,
+                            const mavcam::rpc::camera::StartBurstRequest *request,
+                            mavcam::rpc::camera::StartBurstResponse *response) override {
+        if (request == nullptr) {
+            base::LogWarn() << "StartBurst sent with a null request! Ignoring...";
+            return grpc::Status::OK;
+        }
+
+        auto plugin = _cameras->camera(context);
+        if (plugin == nullptr) {
+            return unknownCameraStatus();
+        }
+        auto result = plugin->start_burst(request->count(), request->interval_s());
+
+        if (response != nullptr) {
+            fillResponseWithResult(response, result);
+        }
+
+        return ::grpc::Status::OK;
+    }
+
+    /**
+     * @brief Wake every open stream so its handler returns, streams opened afterwards end at once.
+     */
+    void stop() {
+        for (auto &prom : _stream_stop_promises.close()) {
+            prom->set_value();
+        }
+    }
+
+    /**
+     * @brief Called with the camera id and result of every Prepare, set it before the server
+     * starts.
+     */
+    void set_prepared_callback(std::function<void(int32_t, Camera::Result)> callback) {
+        _prepared_callback = std::move(callback);
     }
 
-    void unregister_stream_stop_promise(std::shared_ptr<std::promise<void>> prom) {
-        for (auto it = _stream_stop_promises.begin(); it != _stream_stop_promises.end();
-             /* ++it */) {
-            if (it->lock() == prom) {
-                it = _stream_stop_promises.erase(it);
-            } else {
-                ++it;
+    static grpc::Status unknownCameraStatus() {
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "no camera with the requested id");
+    }
+private:
+    /**
+     * @brief Block until the stream is closed, stopped or cancelled by the client.
+     *
+     * A synchronous stream only sees a cancelled client on the next write, which may never come
+     * for a persistent subscription.
+     */
+    void wait_for_stream_closed(grpc::ServerContext *context,
+                                std::future<void> &stream_closed_future) {
+        while (stream_closed_future.wait_for(std::chrono::milliseconds(500)) !=
+               std::future_status::ready) {
+            if (context != nullptr && context->IsCancelled()) {
+                return;
             }
         }
     }
+
+    base::SlotKey register_stream_stop_promise(std::shared_ptr<std::promise<void>> prom) {
+        auto key = _stream_stop_promises.add(prom);
+        if (!key.valid()) {
+            // already stopped, end the stream right away
+            prom->set_value();
+        }
+        return key;
+    }
+
+    /**
+     * @brief Returns true if the caller still owns the promise and has to set it.
+     */
+    bool unregister_stream_stop_promise(base::SlotKey key) {
+        return _stream_stop_promises.remove(key);
+    }
 private:
-    std::shared_ptr<Camera> _plugin;
-    std::atomic<bool> _stopped{false};
-    std::vector<std::weak_ptr<std::promise<void>>> _stream_stop_promises{};
+    std::shared_ptr<CameraRegistry> _cameras;
+    base::SlotRegistry<std::shared_ptr<std::promise<void>>> _stream_stop_promises{};
+    std::function<void(int32_t, Camera::Result)> _prepared_callback{};
 };
 
 }  // namespace mavcam
\ No newline at end of file
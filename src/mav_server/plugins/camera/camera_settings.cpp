@@ -0,0 +1,303 @@
+#include "camera_settings.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+#include "base/log.h"
+
+namespace mavcam {
+
+const char kSnapshotMagic[4] = {'M', 'C', 'S', 'S'};
+const uint32_t kSnapshotVersion = 1;
+
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    // definition_fingerprint() of the schema the snapshot was written with
+    uint32_t fingerprint;
+    uint32_t entry_count;
+};
+
+struct SnapshotEntry {
+    uint32_t id;
+    int32_t int_value;
+    float float_value;
+};
+
+// the file is the header, entry_count entries and the checksum of both
+const std::size_t kSnapshotMaxSize =
+    sizeof(SnapshotHeader) + kSettingCount * sizeof(SnapshotEntry) + sizeof(uint32_t);
+
+static uint32_t fnv1a(const void *data, std::size_t size, uint32_t hash = 2166136261u) {
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    for (std::size_t index = 0; index < size; ++index) {
+        hash = (hash ^ bytes[index]) * 16777619u;
+    }
+    return hash;
+}
+
+// changes when a setting is added, removed, renamed or retyped, options may change freely as
+// the restored values are checked again when they are applied
+static uint32_t definition_fingerprint() {
+    uint32_t hash = fnv1a(&kSettingCount, sizeof(kSettingCount));
+    for (std::size_t index = 0; index < kSettingCount; ++index) {
+        const auto &setting_schema = kSettingSchema[index];
+        hash = fnv1a(setting_schema.name.data(), setting_schema.name.size(), hash);
+        auto type = static_cast<uint8_t>(setting_schema.type);
+        hash = fnv1a(&type, sizeof(type), hash);
+    }
+    return hash;
+}
+
+static bool write_all(int fd, const char *data, std::size_t size) {
+    while (size > 0) {
+        auto written = write(fd, data, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+static bool parse_number(const std::string &text, double &number) {
+    if (text.empty()) {
+        return false;
+    }
+    char *end = nullptr;
+    number = std::strtod(text.c_str(), &end);
+    if (*end == '\0') {
+        return true;
+    }
+    if (*end != '/') {
+        return false;
+    }
+    const char *denominator_text = end + 1;
+    auto denominator = std::strtod(denominator_text, &end);
+    if (end == denominator_text || *end != '\0' || denominator == 0) {
+        return false;
+    }
+    number /= denominator;
+    return true;
+}
+
+bool CameraSettings::find(const std::string &name, SettingId &id) {
+    static const auto *ids = []() {
+        auto *by_name = new std::unordered_map<std::string_view, SettingId>();
+        for (std::size_t index = 0; index < kSettingCount; ++index) {
+            by_name->emplace(kSettingSchema[index].name, static_cast<SettingId>(index));
+        }
+        return by_name;
+    }();
+    auto it = ids->find(name);
+    if (it == ids->end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+bool CameraSettings::parse(SettingId id, const std::string &text, SettingValue &value) {
+    double number = 0;
+    if (!parse_number(text, number)) {
+        return false;
+    }
+    const auto &setting_schema = schema(id);
+    switch (setting_schema.type) {
+        case SettingType::Float:
+            value.float_value = static_cast<float>(number);
+            return true;
+        case SettingType::Int32:
+        case SettingType::Enum:
+            if (number != std::trunc(number) || number < INT32_MIN || number > INT32_MAX) {
+                return false;
+            }
+            value.int_value = static_cast<int32_t>(number);
+            return setting_schema.type == SettingType::Int32 || option(id, value) != nullptr;
+    }
+    return false;
+}
+
+const SettingOptionSchema *CameraSettings::option(SettingId id, const SettingValue &value) {
+    const auto &setting_schema = schema(id);
+    for (std::size_t index = 0; index < setting_schema.option_count; ++index) {
+        const auto &option_schema = setting_schema.options[index];
+        if (setting_schema.type == SettingType::Float) {
+            // option values are written with a limited number of digits
+            if (std::fabs(option_schema.number - value.float_value) <=
+                1e-6 * std::fmax(1.0, std::fabs(option_schema.number))) {
+                return &option_schema;
+            }
+        } else if (option_schema.number == value.int_value) {
+            return &option_schema;
+        }
+    }
+    return nullptr;
+}
+
+Camera::Setting CameraSettings::render(SettingId id, const SettingValue &value) {
+    Camera::Setting setting;
+    setting.setting_id = std::string(schema(id).name);
+    const auto *option_schema = option(id, value);
+    if (option_schema != nullptr) {
+        setting.option.option_id = std::string(option_schema->value);
+        setting.option.option_description = std::string(option_schema->name);
+    } else if (schema(id).type == SettingType::Float) {
+        std::ostringstream oss;
+        oss << value.float_value;
+        setting.option.option_id = oss.str();
+    } else {
+        setting.option.option_id = std::to_string(value.int_value);
+    }
+    return setting;
+}
+
+SettingValue CameraSettings::default_value(SettingId id) {
+    SettingValue value;
+    if (schema(id).type == SettingType::Float) {
+        value.float_value = static_cast<float>(schema(id).default_number);
+    } else {
+        value.int_value = static_cast<int32_t>(schema(id).default_number);
+    }
+    return value;
+}
+
+std::vector<Camera::Setting> CameraSettings::render_all() const {
+    std::vector<Camera::Setting> settings;
+    settings.reserve(_present.count());
+    for (std::size_t index = 0; index < kSettingCount; ++index) {
+        if (_present[index]) {
+            settings.push_back(render(static_cast<SettingId>(index), _values[index]));
+        }
+    }
+    return settings;
+}
+
+bool CameraSettings::save(const std::string &path) const {
+    std::string buffer(sizeof(SnapshotHeader), '\0');
+    SnapshotHeader header;
+    memcpy(header.magic, kSnapshotMagic, 4);
+    header.version = kSnapshotVersion;
+    header.fingerprint = definition_fingerprint();
+    header.entry_count = static_cast<uint32_t>(_present.count());
+    memcpy(&buffer[0], &header, sizeof(header));
+    for (std::size_t index = 0; index < kSettingCount; ++index) {
+        if (!_present[index]) {
+            continue;
+        }
+        SnapshotEntry entry{static_cast<uint32_t>(index), _values[index].int_value,
+                            _values[index].float_value};
+        buffer.append(reinterpret_cast<const char *>(&entry), sizeof(entry));
+    }
+    auto checksum = fnv1a(buffer.data(), buffer.size());
+    buffer.append(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+
+    // the new snapshot is complete on disk before it takes the place of the old one
+    auto temporary_path = path + ".tmp";
+    int fd = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        base::LogError() << "Failed to open settings snapshot " << temporary_path << " : "
+                         << std::strerror(errno);
+        return false;
+    }
+    bool written = write_all(fd, buffer.data(), buffer.size()) && fsync(fd) == 0;
+    auto error = errno;
+    close(fd);
+    if (!written || rename(temporary_path.c_str(), path.c_str()) != 0) {
+        if (written) {
+            error = errno;
+        }
+        base::LogError() << "Failed to write settings snapshot " << path << " : "
+                         << std::strerror(error);
+        unlink(temporary_path.c_str());
+        return false;
+    }
+    // the rename itself survives a power loss once the folder is synced
+    auto slash = path.rfind('/');
+    auto folder = slash == std::string::npos ? std::string(".") : path.substr(0, slash + 1);
+    int folder_fd = open(folder.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (folder_fd >= 0) {
+        fsync(folder_fd);
+        close(folder_fd);
+    }
+    return true;
+}
+
+bool CameraSettings::load(const std::string &path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno != ENOENT) {
+            base::LogError() << "Failed to open settings snapshot " << path << " : "
+                             << std::strerror(errno);
+        }
+        return false;
+    }
+    // one byte more than the largest valid snapshot to catch a longer file
+    char buffer[kSnapshotMaxSize + 1];
+    std::size_t size = 0;
+    ssize_t length;
+    while (size < sizeof(buffer) &&
+           ((length = read(fd, buffer + size, sizeof(buffer) - size)) > 0 ||
+            (length < 0 && errno == EINTR))) {
+        size += length > 0 ? static_cast<std::size_t>(length) : 0;
+    }
+    close(fd);
+
+    SnapshotHeader header;
+    if (size < sizeof(header) + sizeof(uint32_t)) {
+        base::LogWarn() << "Settings snapshot " << path << " is truncated";
+        return false;
+    }
+    memcpy(&header, buffer, sizeof(header));
+    auto expected_size = sizeof(header) +
+                         static_cast<std::size_t>(header.entry_count) * sizeof(SnapshotEntry) +
+                         sizeof(uint32_t);
+    if (header.entry_count > kSettingCount || size != expected_size) {
+        base::LogWarn() << "Settings snapshot " << path << " is truncated";
+        return false;
+    }
+    uint32_t checksum;
+    memcpy(&checksum, buffer + size - sizeof(checksum), sizeof(checksum));
+    if (checksum != fnv1a(buffer, size - sizeof(checksum))) {
+        base::LogWarn() << "Settings snapshot " << path << " is damaged";
+        return false;
+    }
+    if (memcmp(header.magic, kSnapshotMagic, 4) != 0 || header.version != kSnapshotVersion ||
+        header.fingerprint != definition_fingerprint()) {
+        base::LogWarn() << "Settings snapshot " << path
+                        << " was written for another camera definition";
+        return false;
+    }
+
+    CameraSettings settings;
+    for (uint32_t index = 0; index < header.entry_count; ++index) {
+        SnapshotEntry entry;
+        memcpy(&entry, buffer + sizeof(header) + index * sizeof(entry), sizeof(entry));
+        if (entry.id >= kSettingCount) {
+            base::LogWarn() << "Settings snapshot " << path << " has unknown setting "
+                            << entry.id;
+            return false;
+        }
+        SettingValue value;
+        value.int_value = entry.int_value;
+        value.float_value = entry.float_value;
+        settings.set(static_cast<SettingId>(entry.id), value);
+    }
+    *this = settings;
+    return true;
+}
+
+}  // namespace mavcam
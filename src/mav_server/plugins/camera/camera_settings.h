@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "plugins/camera/camera.h"
+#include "plugins/camera/camera_settings_schema.h"
+
+namespace mavcam {
+
+/**
+ * @brief Typed value of one setting, int_value for Int32 and Enum settings, float_value for
+ * Float settings.
+ */
+struct SettingValue {
+    int32_t int_value{0};
+    float float_value{0};
+};
+
+/**
+ * @brief Current camera settings indexed by SettingId, typed as in the camera definition.
+ *
+ * Text only appears at the rpc boundary: find() and parse() read a Camera::Setting, render()
+ * writes one. Not thread safe, CameraImpl guards it with its settings mutex.
+ */
+class CameraSettings final {
+public:
+    static const SettingSchema &schema(SettingId id) {
+        return kSettingSchema[static_cast<std::size_t>(id)];
+    }
+    /**
+     * @brief id of a setting name, false if the definition has no such setting
+     */
+    static bool find(const std::string &name, SettingId &id);
+    /**
+     * @brief read option text into the type of the setting, false if it is malformed or not one
+     * of the options of an Enum setting
+     *
+     * Float settings also accept a fraction such as 1/100.
+     */
+    static bool parse(SettingId id, const std::string &text, SettingValue &value);
+    /**
+     * @brief the definition option matching the value, nullptr if there is none
+     */
+    static const SettingOptionSchema *option(SettingId id, const SettingValue &value);
+    static Camera::Setting render(SettingId id, const SettingValue &value);
+    static SettingValue default_value(SettingId id);
+
+    bool has(SettingId id) const { return _present[static_cast<std::size_t>(id)]; }
+    const SettingValue &get(SettingId id) const {
+        return _values[static_cast<std::size_t>(id)];
+    }
+    void set(SettingId id, const SettingValue &value) {
+        _values[static_cast<std::size_t>(id)] = value;
+        _present.set(static_cast<std::size_t>(id));
+    }
+    void set_int(SettingId id, int32_t value) {
+        SettingValue setting_value;
+        setting_value.int_value = value;
+        set(id, setting_value);
+    }
+    void set_float(SettingId id, float value) {
+        SettingValue setting_value;
+        setting_value.float_value = value;
+        set(id, setting_value);
+    }
+    void clear() { _present.reset(); }
+    /**
+     * @brief write the settings the camera has to path, replacing the previous file in one
+     * rename so a crash leaves either the old or the new snapshot, false on an io error
+     */
+    bool save(const std::string &path) const;
+    /**
+     * @brief replace the settings with the snapshot at path, false and unchanged if it is
+     * missing, damaged or written for another camera definition
+     */
+    bool load(const std::string &path);
+    /**
+     * @brief render the settings the camera has, in definition order
+     */
+    std::vector<Camera::Setting> render_all() const;
+private:
+    std::array<SettingValue, kSettingCount> _values{};
+    std::bitset<kSettingCount> _present;
+};
+
+}  // namespace mavcam
@@ -0,0 +1,226 @@
+// WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
+// Edits need to be made to the camera definition
+// (see src/definition/D64TR.xml, regenerate with tools/generate_settings_schema.py)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace mavcam {
+
+enum class SettingType : uint8_t {
+    Int32,
+    Float,
+    // int32 restricted to the option values
+    Enum,
+};
+
+struct SettingOptionSchema {
+    std::string_view name;
+    // value text as written in the definition
+    std::string_view value;
+    double number;
+};
+
+struct SettingSchema {
+    std::string_view name;
+    SettingType type;
+    double default_number;
+    const SettingOptionSchema *options;
+    std::size_t option_count;
+};
+
+// dense ids in definition order, index into kSettingSchema
+enum class SettingId : uint8_t {
+    CamMode,
+    CamDisplayMode,
+    CamPhotoRes,
+    CamBurst,
+    CamWbmode,
+    CamExpmode,
+    CamShutterspd,
+    CamIso,
+    CamEv,
+    CamVidres,
+    CamVidfmt,
+    IrcamPalette,
+    IrcamFfc,
+};
+
+inline constexpr std::size_t kSettingCount = 13;
+
+inline constexpr SettingOptionSchema kCamModeOptions[] = {
+    {"Photo", "0", 0.0},
+    {"Video", "1", 1.0},
+};
+
+inline constexpr SettingOptionSchema kCamDisplayModeOptions[] = {
+    {"RGB Only", "0", 0.0},
+    {"IR Only", "1", 1.0},
+    {"Side by Side", "2", 2.0},
+    {"PIP", "3", 3.0},
+};
+
+inline constexpr SettingOptionSchema kCamPhotoResOptions[] = {
+    {"Full", "0", 0.0},
+    {"1/4", "1", 1.0},
+};
+
+inline constexpr SettingOptionSchema kCamBurstOptions[] = {
+    {"1", "1", 1.0},
+    {"3", "3", 3.0},
+    {"5", "5", 5.0},
+    {"10", "10", 10.0},
+};
+
+inline constexpr SettingOptionSchema kCamWbmodeOptions[] = {
+    {"Auto", "0", 0.0},
+    {"Daylight", "1", 1.0},
+    {"Cloudy", "2", 2.0},
+    {"Shady", "3", 3.0},
+    {"Incandescent", "4", 4.0},
+    {"Fluorescent", "5", 5.0},
+};
+
+inline constexpr SettingOptionSchema kCamExpmodeOptions[] = {
+    {"Auto", "0", 0.0},
+    {"Manual", "1", 1.0},
+};
+
+inline constexpr SettingOptionSchema kCamShutterspdOptions[] = {
+    {"8", "8", 8.0},
+    {"6", "6", 6.0},
+    {"5", "5", 5.0},
+    {"4", "4", 4.0},
+    {"3.2", "3.2", 3.2},
+    {"2.5", "2.5", 2.5},
+    {"2", "2", 2.0},
+    {"1.6", "1.6", 1.6},
+    {"1.3", "1.3", 1.3},
+    {"1", "1", 1.0},
+    {"1/1.3", "0.769230769", 0.769230769},
+    {"1/1.6", "0.625", 0.625},
+    {"1/2", "0.5", 0.5},
+    {"1/2.5", "0.4", 0.4},
+    {"1/3", "0.333333333", 0.333333333},
+    {"1/4", "0.25", 0.25},
+    {"1/5", "0.2", 0.2},
+    {"1/6", "0.166666667", 0.166666667},
+    {"1/8", "0.125", 0.125},
+    {"1/10", "0.1", 0.1},
+    {"1/13", "0.076923077", 0.076923077},
+    {"1/15", "0.066666667", 0.066666667},
+    {"1/20", "0.05", 0.05},
+    {"1/25", "0.04", 0.04},
+    {"1/30", "0.033333333", 0.033333333},
+    {"1/40", "0.025", 0.025},
+    {"1/50", "0.02", 0.02},
+    {"1/60", "0.016666667", 0.016666667},
+    {"1/80", "0.0125", 0.0125},
+    {"1/100", "0.01", 0.01},
+    {"1/125", "0.008", 0.008},
+    {"1/160", "0.00625", 0.00625},
+    {"1/200", "0.005", 0.005},
+    {"1/250", "0.004", 0.004},
+    {"1/320", "0.003125", 0.003125},
+    {"1/400", "0.0025", 0.0025},
+    {"1/500", "0.002", 0.002},
+    {"1/640", "0.0015625", 0.0015625},
+    {"1/800", "0.00125", 0.00125},
+    {"1/1000", "0.001", 0.001},
+    {"1/1250", "0.0008", 0.0008},
+    {"1/1600", "0.000625", 0.000625},
+    {"1/2000", "0.0005", 0.0005},
+    {"1/2500", "0.0004", 0.0004},
+    {"1/3200", "0.0003125", 0.0003125},
+    {"1/4000", "0.00025", 0.00025},
+    {"1/5000", "0.0002", 0.0002},
+    {"1/6400", "0.00015625", 0.00015625},
+    {"1/8000", "0.000125", 0.000125},
+};
+
+inline constexpr SettingOptionSchema kCamIsoOptions[] = {
+    {"125", "125", 125.0},
+    {"160", "160", 160.0},
+    {"200", "200", 200.0},
+    {"250", "250", 250.0},
+    {"400", "400", 400.0},
+    {"500", "500", 500.0},
+    {"640", "640", 640.0},
+    {"800", "800", 800.0},
+    {"1000", "1000", 1000.0},
+    {"1250", "1250", 1250.0},
+    {"1600", "1600", 1600.0},
+    {"2000", "2000", 2000.0},
+    {"2500", "2500", 2500.0},
+    {"3200", "3200", 3200.0},
+    {"4000", "4000", 4000.0},
+    {"5000", "5000", 5000.0},
+    {"6400", "6400", 6400.0},
+};
+
+inline constexpr SettingOptionSchema kCamEvOptions[] = {
+    {"-2.0", "-2.0", -2.0},
+    {"-1.7", "-1.7", -1.7},
+    {"-1.3", "-1.3", -1.3},
+    {"-1.0", "-1.0", -1.0},
+    {"-0.7", "-0.7", -0.7},
+    {"-0.3", "-0.3", -0.3},
+    {"0.0", "0.0", 0.0},
+    {"+0.3", "0.3", 0.3},
+    {"+0.7", "0.7", 0.7},
+    {"+1.0", "1.0", 1.0},
+    {"+1.3", "1.3", 1.3},
+    {"+1.7", "1.7", 1.7},
+    {"+2.0", "2.0", 2.0},
+};
+
+inline constexpr SettingOptionSchema kCamVidresOptions[] = {
+    {"3840 x 2160 60fps (UHD)", "0", 0.0},
+    {"3840 x 2160 30fps (UHD)", "1", 1.0},
+    {"1920 x 1080 60fps (FHD)", "2", 2.0},
+    {"1920 x 1080 30fps (FHD)", "3", 3.0},
+};
+
+inline constexpr SettingOptionSchema kCamVidfmtOptions[] = {
+    {"H264", "1", 1.0},
+    {"HEVC", "2", 2.0},
+};
+
+inline constexpr SettingOptionSchema kIrcamPaletteOptions[] = {
+    {"COLOR_WHITEHOT", "0", 0.0},
+    {"COLOR_BLACKHOT", "1", 1.0},
+    {"COLOR_RAINBOW", "2", 2.0},
+    {"COLOR_RAINBOWHC", "3", 3.0},
+    {"COLOR_IRONBOW", "4", 4.0},
+    {"COLOR_LAVA", "5", 5.0},
+    {"COLOR_ARCTIC", "6", 6.0},
+    {"COLOR_GLOBOW", "7", 7.0},
+    {"COLOR_GRADEDFIRE", "8", 8.0},
+    {"COLOR_HOTTEST", "9", 9.0},
+};
+
+inline constexpr SettingOptionSchema kIrcamFfcOptions[] = {
+    {"NOTHING", "0", 0.0},
+    {"EXECUTE", "1", 1.0},
+};
+
+inline constexpr SettingSchema kSettingSchema[kSettingCount] = {
+    {"CAM_MODE", SettingType::Enum, 0.0, kCamModeOptions, 2},
+    {"CAM_DISPLAY_MODE", SettingType::Enum, 0.0, kCamDisplayModeOptions, 4},
+    {"CAM_PHOTO_RES", SettingType::Enum, 1.0, kCamPhotoResOptions, 2},
+    {"CAM_BURST", SettingType::Int32, 1.0, kCamBurstOptions, 4},
+    {"CAM_WBMODE", SettingType::Enum, 0.0, kCamWbmodeOptions, 6},
+    {"CAM_EXPMODE", SettingType::Enum, 0.0, kCamExpmodeOptions, 2},
+    {"CAM_SHUTTERSPD", SettingType::Float, 0.01, kCamShutterspdOptions, 49},
+    {"CAM_ISO", SettingType::Int32, 125.0, kCamIsoOptions, 17},
+    {"CAM_EV", SettingType::Float, 0.0, kCamEvOptions, 13},
+    {"CAM_VIDRES", SettingType::Enum, 0.0, kCamVidresOptions, 4},
+    {"CAM_VIDFMT", SettingType::Enum, 1.0, kCamVidfmtOptions, 2},
+    {"IRCAM_PALETTE", SettingType::Enum, 0.0, kIrcamPaletteOptions, 10},
+    {"IRCAM_FFC", SettingType::Enum, 0.0, kIrcamFfcOptions, 2},
+};
+
+}  // namespace mavcam
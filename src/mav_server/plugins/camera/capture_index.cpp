@@ -0,0 +1,211 @@
+#include "capture_index.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "base/log.h"
+
+namespace mavcam {
+
+const char kCaptureIndexMagic[4] = {'M', 'C', 'I', 'X'};
+const uint32_t kCaptureIndexVersion = 1;
+// the file grows by this many records, 128 KiB
+const std::size_t kCaptureIndexGrowth = 1024;
+
+struct CaptureIndexRecord {
+    int32_t capture_id;
+    uint8_t is_success;
+    uint8_t reserved[3];
+    uint64_t time_utc_us;
+    double latitude_deg;
+    double longitude_deg;
+    float absolute_altitude_m;
+    float relative_altitude_m;
+    // file_url of the capture, cut to fit
+    char path[88];
+};
+
+// the header takes the first record slot so records stay aligned
+struct CaptureIndexHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t reserved;
+    uint64_t record_count;
+    uint8_t padding[sizeof(CaptureIndexRecord) - 24];
+};
+
+static_assert(sizeof(CaptureIndexRecord) == 128, "capture index records are 128 bytes");
+static_assert(sizeof(CaptureIndexHeader) == sizeof(CaptureIndexRecord),
+              "the capture index header fills one record slot");
+
+CaptureIndex::~CaptureIndex() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    close();
+}
+
+bool CaptureIndex::open(const std::string &path) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    close();
+    _path = path;
+    _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (_fd < 0) {
+        base::LogError() << "Failed to open capture index " << path << " : "
+                         << std::strerror(errno);
+        return false;
+    }
+    struct stat info;
+    if (fstat(_fd, &info) != 0) {
+        base::LogError() << "Failed to stat capture index " << path << " : "
+                         << std::strerror(errno);
+        close();
+        return false;
+    }
+    auto file_size = static_cast<std::size_t>(info.st_size);
+    std::size_t capacity = 0;
+    if (file_size > sizeof(CaptureIndexHeader)) {
+        capacity = (file_size - sizeof(CaptureIndexHeader)) / sizeof(CaptureIndexRecord);
+    }
+    if (!map(std::max(capacity, kCaptureIndexGrowth))) {
+        close();
+        return false;
+    }
+    auto *header = static_cast<CaptureIndexHeader *>(_mapping);
+    if (file_size < sizeof(CaptureIndexHeader) ||
+        memcmp(header->magic, kCaptureIndexMagic, 4) != 0 ||
+        header->version != kCaptureIndexVersion ||
+        header->record_size != sizeof(CaptureIndexRecord) || header->record_count > capacity) {
+        if (file_size > 0) {
+            base::LogWarn() << "Capture index " << path << " is invalid, start a new one";
+        }
+        memset(header, 0, sizeof(CaptureIndexHeader));
+        memcpy(header->magic, kCaptureIndexMagic, 4);
+        header->version = kCaptureIndexVersion;
+        header->record_size = sizeof(CaptureIndexRecord);
+    }
+    auto *records = reinterpret_cast<CaptureIndexRecord *>(header + 1);
+    _next_capture_id = 0;
+    for (uint64_t index = 0; index < header->record_count; ++index) {
+        _next_capture_id = std::max(_next_capture_id, records[index].capture_id + 1);
+    }
+    return true;
+}
+
+bool CaptureIndex::is_open() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _mapping != nullptr;
+}
+
+bool CaptureIndex::append(const Camera::CaptureInfo &capture_info) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_mapping == nullptr) {
+        return false;
+    }
+    auto count = static_cast<CaptureIndexHeader *>(_mapping)->record_count;
+    if (count == _capacity && !map(_capacity + kCaptureIndexGrowth)) {
+        return false;
+    }
+    auto *header = static_cast<CaptureIndexHeader *>(_mapping);
+    auto &record = reinterpret_cast<CaptureIndexRecord *>(header + 1)[count];
+    memset(&record, 0, sizeof(CaptureIndexRecord));
+    record.capture_id = capture_info.index;
+    record.is_success = capture_info.is_success ? 1 : 0;
+    record.time_utc_us = capture_info.time_utc_us;
+    record.latitude_deg = capture_info.position.latitude_deg;
+    record.longitude_deg = capture_info.position.longitude_deg;
+    record.absolute_altitude_m = capture_info.position.absolute_altitude_m;
+    record.relative_altitude_m = capture_info.position.relative_altitude_m;
+    strncpy(record.path, capture_info.file_url.c_str(), sizeof(record.path) - 1);
+    // publish the record only once it is complete
+    header->record_count = count + 1;
+    _next_capture_id = std::max(_next_capture_id, capture_info.index + 1);
+    return true;
+}
+
+std::size_t CaptureIndex::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_mapping == nullptr) {
+        return 0;
+    }
+    return static_cast<CaptureIndexHeader *>(_mapping)->record_count;
+}
+
+int32_t CaptureIndex::next_capture_id() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _next_capture_id;
+}
+
+std::vector<Camera::CaptureInfo> CaptureIndex::list(std::size_t first) const {
+    // copy the records out so appending is not held up while they are converted
+    std::vector<CaptureIndexRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_mapping == nullptr) {
+            return {};
+        }
+        const auto *header = static_cast<const CaptureIndexHeader *>(_mapping);
+        if (first < header->record_count) {
+            const auto *begin = reinterpret_cast<const CaptureIndexRecord *>(header + 1);
+            records.assign(begin + first, begin + header->record_count);
+        }
+    }
+    std::vector<Camera::CaptureInfo> capture_infos(records.size());
+    for (std::size_t index = 0; index < records.size(); ++index) {
+        const auto &record = records[index];
+        auto &capture_info = capture_infos[index];
+        capture_info.index = record.capture_id;
+        capture_info.is_success = record.is_success != 0;
+        capture_info.time_utc_us = record.time_utc_us;
+        capture_info.position.latitude_deg = record.latitude_deg;
+        capture_info.position.longitude_deg = record.longitude_deg;
+        capture_info.position.absolute_altitude_m = record.absolute_altitude_m;
+        capture_info.position.relative_altitude_m = record.relative_altitude_m;
+        capture_info.file_url =
+            std::string(record.path, strnlen(record.path, sizeof(record.path)));
+    }
+    return capture_infos;
+}
+
+bool CaptureIndex::map(std::size_t capacity) {
+    auto size = sizeof(CaptureIndexHeader) + capacity * sizeof(CaptureIndexRecord);
+    if (ftruncate(_fd, static_cast<off_t>(size)) != 0) {
+        base::LogError() << "Failed to grow capture index " << _path << " : "
+                         << std::strerror(errno);
+        return false;
+    }
+    void *mapping;
+    if (_mapping == nullptr) {
+        mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    } else {
+        auto old_size = sizeof(CaptureIndexHeader) + _capacity * sizeof(CaptureIndexRecord);
+        mapping = mremap(_mapping, old_size, size, MREMAP_MAYMOVE);
+    }
+    if (mapping == MAP_FAILED) {
+        base::LogError() << "Failed to map capture index " << _path << " : "
+                         << std::strerror(errno);
+        return false;
+    }
+    _mapping = mapping;
+    _capacity = capacity;
+    return true;
+}
+
+void CaptureIndex::close() {
+    if (_mapping != nullptr) {
+        munmap(_mapping, sizeof(CaptureIndexHeader) + _capacity * sizeof(CaptureIndexRecord));
+        _mapping = nullptr;
+        _capacity = 0;
+    }
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+}  // namespace mavcam
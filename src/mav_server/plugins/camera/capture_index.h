@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "plugins/camera/camera.h"
+
+namespace mavcam {
+
+/**
+ * @brief Append-only capture index kept in a memory mapped file of fixed size records.
+ *
+ * One record per capture, written in place so appending is a copy into the mapping and listing
+ * never walks the storage. A record counts once the header count covers it, a file whose
+ * header does not match is started again. Thread safe.
+ */
+class CaptureIndex final {
+public:
+    CaptureIndex() = default;
+    ~CaptureIndex();
+    CaptureIndex(const CaptureIndex &) = delete;
+    CaptureIndex &operator=(const CaptureIndex &) = delete;
+
+    /**
+     * @brief map the index file, created if missing, false if it cannot be opened or mapped
+     */
+    bool open(const std::string &path);
+    bool is_open() const;
+    /**
+     * @brief add the capture at the end of the index, false if it is not open or cannot grow
+     */
+    bool append(const Camera::CaptureInfo &capture_info);
+    /**
+     * @brief number of captures in the index
+     */
+    std::size_t size() const;
+    /**
+     * @brief one past the highest capture id in the index, 0 if it is empty
+     */
+    int32_t next_capture_id() const;
+    /**
+     * @brief the captures from position first on, oldest first
+     */
+    std::vector<Camera::CaptureInfo> list(std::size_t first) const;
+private:
+    /**
+     * @brief map room for capacity records, growing the file, caller holds _mutex
+     */
+    bool map(std::size_t capacity);
+    void close();
+
+    mutable std::mutex _mutex;
+    std::string _path;
+    int _fd{-1};
+    void *_mapping{nullptr};
+    std::size_t _capacity{0};
+    int32_t _next_capture_id{0};
+};
+
+}  // namespace mavcam
@@ -0,0 +1,123 @@
+#include "ir_command_queue.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/log.h"
+#include "plugins/camera/vendor_call.h"
+
+namespace mavcam {
+
+IrCommandQueue::~IrCommandQueue() {
+    stop();
+}
+
+void IrCommandQueue::start(struct boson_extension_api *ir_camera, Completion on_done) {
+    stop();
+    _ir_camera = ir_camera;
+    _on_done = std::move(on_done);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = false;
+    }
+    _thread = std::thread(&IrCommandQueue::run, this);
+}
+
+void IrCommandQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _cv.notify_one();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    _ir_camera = nullptr;
+    _on_done = nullptr;
+}
+
+std::shared_future<IrCommandResult> IrCommandQueue::set_color_mode(ColorMode color_mode) {
+    IrCommand command{IrCommand::Kind::SetColorMode, color_mode};
+    return submit(command);
+}
+
+std::shared_future<IrCommandResult> IrCommandQueue::get_color_mode() {
+    return submit(IrCommand{IrCommand::Kind::GetColorMode});
+}
+
+std::shared_future<IrCommandResult> IrCommandQueue::run_ffc() {
+    return submit(IrCommand{IrCommand::Kind::RunFfc});
+}
+
+std::shared_future<IrCommandResult> IrCommandQueue::submit(const IrCommand &command) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_stopping) {
+        std::promise<IrCommandResult> stopped;
+        stopped.set_value(IrCommandResult{});
+        return stopped.get_future().share();
+    }
+    if (!_pending.empty() && _pending.back().command.kind == command.kind) {
+        // not started yet, the later palette replaces the earlier one
+        _pending.back().command = command;
+        return _pending.back().result;
+    }
+    Pending pending;
+    pending.command = command;
+    pending.promise = std::make_shared<std::promise<IrCommandResult>>();
+    pending.result = pending.promise->get_future().share();
+    _pending.push_back(pending);
+    _cv.notify_one();
+    return pending.result;
+}
+
+IrCommandResult IrCommandQueue::execute(const IrCommand &command) {
+    IrCommandResult result;
+    switch (command.kind) {
+        case IrCommand::Kind::SetColorMode:
+            result.status = vendor_call("boson/set_boson_color_mode", [&] {
+                return _ir_camera->set_boson_color_mode(command.color_mode);
+            });
+            break;
+        case IrCommand::Kind::GetColorMode:
+            result.status = vendor_call("boson/get_boson_color_mode", [&] {
+                return _ir_camera->get_boson_color_mode(&result.color_mode);
+            });
+            break;
+        case IrCommand::Kind::RunFfc:
+            result.status = vendor_call("boson/process_boson_run_ffc",
+                                        [&] { return _ir_camera->process_boson_run_ffc(); });
+            break;
+    }
+    return result;
+}
+
+void IrCommandQueue::run() {
+    std::vector<Pending> batch;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _cv.wait(lock, [this]() { return _stopping || !_pending.empty(); });
+        if (_pending.empty()) {
+            // stopping and drained
+            return;
+        }
+        batch.assign(std::make_move_iterator(_pending.begin()),
+                     std::make_move_iterator(_pending.end()));
+        _pending.clear();
+        lock.unlock();
+        for (auto &pending : batch) {
+            auto result = execute(pending.command);
+            if (result.status != 0) {
+                base::LogWarn() << "Ir command " << static_cast<int>(pending.command.kind)
+                                << " failed : " << result.status;
+            }
+            pending.promise->set_value(result);
+            if (_on_done) {
+                _on_done(pending.command, result);
+            }
+        }
+        batch.clear();
+        lock.lock();
+    }
+}
+
+}  // namespace mavcam
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "boson-sdk-interface.h"
+
+namespace mavcam {
+
+/**
+ * @brief One command for the ir camera.
+ */
+struct IrCommand {
+    enum class Kind { SetColorMode, GetColorMode, RunFfc };
+    Kind kind;
+    // the palette to set for SetColorMode
+    ColorMode color_mode{WHITEHOT};
+};
+
+/**
+ * @brief Answer of the ir camera to a command.
+ */
+struct IrCommandResult {
+    // 0 on success as returned by the boson library, -1 if the queue was stopped
+    int status{-1};
+    // the palette read for GetColorMode
+    ColorMode color_mode{WHITEHOT};
+};
+
+/**
+ * @brief Runs the uart transactions of the ir camera on one thread, in submission order.
+ *
+ * Submitting only queues the command so the caller never waits on the uart. A command queued
+ * right behind one of the same kind is merged into it: the later palette wins and both callers
+ * share its result. The thread takes every queued command at once and runs them back to back.
+ * Thread safe.
+ */
+class IrCommandQueue final {
+public:
+    using Completion = std::function<void(const IrCommand &, const IrCommandResult &)>;
+
+    IrCommandQueue() = default;
+    ~IrCommandQueue();
+    IrCommandQueue(const IrCommandQueue &) = delete;
+    IrCommandQueue &operator=(const IrCommandQueue &) = delete;
+
+    /**
+     * @brief take over the ir camera, on_done runs on the queue thread after each command
+     */
+    void start(struct boson_extension_api *ir_camera, Completion on_done);
+    /**
+     * @brief run the queued commands and give the ir camera back, later ones answer -1
+     */
+    void stop();
+
+    std::shared_future<IrCommandResult> set_color_mode(ColorMode color_mode);
+    std::shared_future<IrCommandResult> get_color_mode();
+    std::shared_future<IrCommandResult> run_ffc();
+private:
+    struct Pending {
+        IrCommand command;
+        std::shared_ptr<std::promise<IrCommandResult>> promise;
+        std::shared_future<IrCommandResult> result;
+    };
+
+    std::shared_future<IrCommandResult> submit(const IrCommand &command);
+    IrCommandResult execute(const IrCommand &command);
+    void run();
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<Pending> _pending;
+    bool _stopping{false};
+    std::thread _thread;
+    // only used by the queue thread while it runs
+    struct boson_extension_api *_ir_camera{nullptr};
+    Completion _on_done;
+};
+
+}  // namespace mavcam
@@ -0,0 +1,238 @@
+#include "storage_monitor.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/fanotify.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "base/log.h"
+
+namespace mavcam {
+
+// a 4624x3472 jpeg, until photos have been written
+const double kDefaultPhotoBytes = 6.0 * 1024 * 1024;
+// 4K recording at about 100 Mbit/s
+const double kVideoBytesPerSecond = 12.5 * 1000 * 1000;
+// weight of a new photo in the running average of the photo size
+const double kPhotoBytesWeight = 0.2;
+const double kBytesPerMib = 1024.0 * 1024.0;
+
+static bool is_photo(const std::string &name) {
+    auto dot = name.rfind('.');
+    if (dot == std::string::npos) {
+        return false;
+    }
+    auto extension = name.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return extension == "jpg" || extension == "jpeg" || extension == "dng";
+}
+
+StorageMonitor::~StorageMonitor() {
+    stop();
+}
+
+bool StorageMonitor::start(const std::string &media_path, ChangeCallback on_change) {
+    stop();
+    _media_path = media_path;
+    _on_change = std::move(on_change);
+    _photo_bytes = kDefaultPhotoBytes;
+
+    _fanotify_fd = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK,
+                                 O_RDONLY | O_LARGEFILE);
+    if (_fanotify_fd >= 0 && fanotify_mark(_fanotify_fd, FAN_MARK_ADD | FAN_MARK_MOUNT,
+                                           FAN_CLOSE_WRITE, AT_FDCWD, media_path.c_str()) != 0) {
+        auto error = errno;
+        close(_fanotify_fd);
+        _fanotify_fd = -1;
+        errno = error;
+    }
+    uint32_t inotify_mask = IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+    if (_fanotify_fd < 0) {
+        base::LogWarn() << "No fanotify on " << media_path << " : " << std::strerror(errno)
+                        << ", follow the writes in the media folder only";
+        inotify_mask |= IN_CLOSE_WRITE;
+    }
+    _inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_inotify_fd < 0 || inotify_add_watch(_inotify_fd, media_path.c_str(), inotify_mask) < 0) {
+        base::LogError() << "Failed to watch media folder " << media_path << " : "
+                         << std::strerror(errno);
+        stop();
+        return false;
+    }
+    _stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_stop_fd < 0) {
+        base::LogError() << "Failed to create storage monitor event : " << std::strerror(errno);
+        stop();
+        return false;
+    }
+    sample();
+    _thread = std::thread(&StorageMonitor::run, this);
+    return true;
+}
+
+void StorageMonitor::stop() {
+    if (_thread.joinable()) {
+        uint64_t wake = 1;
+        if (write(_stop_fd, &wake, sizeof(wake)) < 0) {
+            base::LogError() << "Failed to stop storage monitor : " << std::strerror(errno);
+        }
+        _thread.join();
+    }
+    for (auto *fd : {&_stop_fd, &_fanotify_fd, &_inotify_fd}) {
+        if (*fd >= 0) {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+std::shared_ptr<const StorageSnapshot> StorageMonitor::snapshot() const {
+    return std::atomic_load(&_snapshot);
+}
+
+void StorageMonitor::run() {
+    auto next_sample = std::chrono::steady_clock::now() + kRefreshInterval;
+    bool sample_pending = false;
+    while (true) {
+        auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+            next_sample - std::chrono::steady_clock::now());
+        // poll skips the negative fd when there is no fanotify
+        pollfd fds[] = {
+            {_stop_fd, POLLIN, 0}, {_inotify_fd, POLLIN, 0}, {_fanotify_fd, POLLIN, 0}};
+        if (poll(fds, 3, static_cast<int>(std::max<int64_t>(0, timeout.count() + 1))) < 0 &&
+            errno != EINTR) {
+            base::LogError() << "Storage monitor stopped : " << std::strerror(errno);
+            return;
+        }
+        if (fds[0].revents & POLLIN) {
+            return;
+        }
+        bool changed = false;
+        if ((fds[1].revents & POLLIN) && read_inotify_events()) {
+            changed = true;
+        }
+        if ((fds[2].revents & POLLIN) && read_fanotify_events()) {
+            changed = true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (changed && !sample_pending) {
+            // sampled kSampleInterval after the first change, once for a burst of writes and
+            // late enough for the space of a removed file to be released
+            sample_pending = true;
+            next_sample = std::min(next_sample, now + kSampleInterval);
+        }
+        if (now >= next_sample) {
+            sample();
+            sample_pending = false;
+            next_sample = std::chrono::steady_clock::now() + kRefreshInterval;
+        }
+    }
+}
+
+bool StorageMonitor::read_fanotify_events() {
+    alignas(fanotify_event_metadata) char buffer[4096];
+    bool written = false;
+    ssize_t length;
+    while ((length = read(_fanotify_fd, buffer, sizeof(buffer))) > 0) {
+        auto *event = reinterpret_cast<fanotify_event_metadata *>(buffer);
+        for (; FAN_EVENT_OK(event, length); event = FAN_EVENT_NEXT(event, length)) {
+            if (event->mask & FAN_Q_OVERFLOW) {
+                // events were lost, only a sample has the right numbers
+                written = true;
+            }
+            if (event->fd < 0) {
+                continue;
+            }
+            char link[32];
+            char path[PATH_MAX];
+            snprintf(link, sizeof(link), "/proc/self/fd/%d", event->fd);
+            auto path_length = readlink(link, path, sizeof(path) - 1);
+            struct stat info;
+            if (path_length > 0 && fstat(event->fd, &info) == 0 && S_ISREG(info.st_mode)) {
+                add_written_file(std::string(path, path_length), info.st_size);
+                written = true;
+            }
+            close(event->fd);
+        }
+    }
+    return written;
+}
+
+bool StorageMonitor::read_inotify_events() {
+    alignas(inotify_event) char buffer[4096];
+    bool changed = false;
+    ssize_t length;
+    while ((length = read(_inotify_fd, buffer, sizeof(buffer))) > 0) {
+        const char *position = buffer;
+        while (position < buffer + length) {
+            const auto *event = reinterpret_cast<const inotify_event *>(position);
+            position += sizeof(inotify_event) + event->len;
+            changed = true;
+            if (!(event->mask & IN_CLOSE_WRITE) || event->len == 0) {
+                continue;
+            }
+            std::string path = _media_path + "/" + event->name;
+            struct stat info;
+            if (stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+                add_written_file(path, info.st_size);
+            }
+        }
+    }
+    return changed;
+}
+
+void StorageMonitor::add_written_file(const std::string &name, int64_t size) {
+    if (is_photo(name)) {
+        _photo_bytes += kPhotoBytesWeight * (static_cast<double>(size) - _photo_bytes);
+    }
+    auto current = snapshot();
+    if (current == nullptr) {
+        return;
+    }
+    // the file is taken off right away, the next sample settles the exact numbers
+    auto size_mib = static_cast<float>(size / kBytesPerMib);
+    publish(current->used_mib + size_mib, std::max(0.0f, current->available_mib - size_mib),
+            current->total_mib);
+}
+
+bool StorageMonitor::sample() {
+    struct statvfs info;
+    if (statvfs(_media_path.c_str(), &info) != 0) {
+        base::LogWarn() << "Failed to read capacity of " << _media_path << " : "
+                        << std::strerror(errno);
+        return false;
+    }
+    auto block_mib = static_cast<double>(info.f_frsize) / kBytesPerMib;
+    publish(static_cast<float>((info.f_blocks - info.f_bfree) * block_mib),
+            static_cast<float>(info.f_bavail * block_mib),
+            static_cast<float>(info.f_blocks * block_mib));
+    return true;
+}
+
+void StorageMonitor::publish(float used_mib, float available_mib, float total_mib) {
+    auto snapshot = std::make_shared<StorageSnapshot>();
+    snapshot->used_mib = used_mib;
+    snapshot->available_mib = available_mib;
+    snapshot->total_mib = total_mib;
+    auto available_bytes = static_cast<double>(available_mib) * kBytesPerMib;
+    snapshot->remaining_photos = static_cast<int64_t>(available_bytes / _photo_bytes);
+    snapshot->remaining_video_s = static_cast<int64_t>(available_bytes / kVideoBytesPerSecond);
+    std::atomic_store(&_snapshot, std::shared_ptr<const StorageSnapshot>(std::move(snapshot)));
+    if (_on_change) {
+        _on_change();
+    }
+}
+
+}  // namespace mavcam
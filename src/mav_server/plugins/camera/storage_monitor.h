@@ -0,0 +1,89 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace mavcam {
+
+/**
+ * @brief Capacity of the media storage at one point in time, never modified once published.
+ */
+struct StorageSnapshot {
+    float used_mib{0};
+    float available_mib{0};
+    float total_mib{0};
+    // photos and seconds of video that still fit at the observed file sizes
+    int64_t remaining_photos{0};
+    int64_t remaining_video_s{0};
+};
+
+/**
+ * @brief Follows the free space of the media storage without polling it on every request.
+ *
+ * fanotify reports every file written on the mount holding the media folder and inotify the
+ * files removed from it. A write takes the file size off the last snapshot right away,
+ * statvfs corrects the numbers kSampleInterval after the first change and every
+ * kRefreshInterval when nothing happens. Without the privilege for fanotify, files written in
+ * the media folder are followed with inotify instead.
+ *
+ * Readers load the current snapshot without locking.
+ */
+class StorageMonitor final {
+public:
+    using ChangeCallback = std::function<void()>;
+
+    static constexpr std::chrono::milliseconds kSampleInterval{500};
+    static constexpr std::chrono::seconds kRefreshInterval{5};
+
+    StorageMonitor() = default;
+    ~StorageMonitor();
+    StorageMonitor(const StorageMonitor &) = delete;
+    StorageMonitor &operator=(const StorageMonitor &) = delete;
+
+    /**
+     * @brief watch the media folder, on_change runs on the monitor thread after each new
+     * snapshot, false if the folder cannot be watched
+     */
+    bool start(const std::string &media_path, ChangeCallback on_change);
+    void stop();
+    /**
+     * @brief the latest snapshot, nullptr before the first sample
+     */
+    std::shared_ptr<const StorageSnapshot> snapshot() const;
+private:
+    void run();
+    /**
+     * @brief read the fanotify events, true if media was written
+     */
+    bool read_fanotify_events();
+    /**
+     * @brief read the inotify events, true if the storage should be sampled again
+     */
+    bool read_inotify_events();
+    /**
+     * @brief account for a file written in the media storage
+     */
+    void add_written_file(const std::string &name, int64_t size);
+    /**
+     * @brief read the file system capacity with statvfs
+     */
+    bool sample();
+    void publish(float used_mib, float available_mib, float total_mib);
+
+    std::string _media_path;
+    ChangeCallback _on_change;
+    std::thread _thread;
+    int _stop_fd{-1};
+    int _fanotify_fd{-1};
+    int _inotify_fd{-1};
+    // running average of the photo files seen, starts from a full resolution jpeg
+    double _photo_bytes{0};
+    // only touched through std::atomic_load and std::atomic_store
+    std::shared_ptr<const StorageSnapshot> _snapshot;
+};
+
+}  // namespace mavcam
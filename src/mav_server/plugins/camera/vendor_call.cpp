@@ -0,0 +1,33 @@
+#include "vendor_call.h"
+
+#include <atomic>
+
+#include "base/call_metrics.h"
+#include "base/log.h"
+
+namespace mavcam {
+
+// above the isp open and the boson handshake, CameraConfig::vendor_call_log_threshold overrides it
+static std::atomic<int64_t> vendor_call_log_threshold_us{1500 * 1000};
+
+void set_vendor_call_log_threshold(std::chrono::milliseconds threshold) {
+    vendor_call_log_threshold_us.store(
+        std::chrono::duration_cast<std::chrono::microseconds>(threshold).count(),
+        std::memory_order_relaxed);
+}
+
+void record_vendor_call(const char *name, std::chrono::steady_clock::duration latency,
+                        bool success) {
+    auto &stats = base::call_metrics().stats(name);
+    stats.record(latency, success);
+    const auto latency_us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    if (latency_us < vendor_call_log_threshold_us.load(std::memory_order_relaxed)) {
+        return;
+    }
+    const auto metric = stats.snapshot();
+    base::LogWarn() << "Vendor call " << name << (success ? "" : " failed and") << " took "
+                    << latency_us / 1000 << " ms, p50 " << metric.p50_latency_us / 1000
+                    << " ms of " << metric.count << " call(s)";
+}
+
+}  // namespace mavcam
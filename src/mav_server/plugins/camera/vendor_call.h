@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "mav_camera.h"
+
+namespace mavcam {
+
+/**
+ * @brief Calls into the camera vendor libraries taking at least this long are logged.
+ */
+void set_vendor_call_log_threshold(std::chrono::milliseconds threshold);
+
+/**
+ * @brief Count one vendor call and its latency in base::call_metrics() under name, log it if it
+ * took longer than the threshold.
+ */
+void record_vendor_call(const char *name, std::chrono::steady_clock::duration latency,
+                        bool success);
+
+inline bool vendor_call_succeeded(mav_camera::Result result) {
+    return result == mav_camera::Result::Success;
+}
+
+// the boson library answers 0 on success
+inline bool vendor_call_succeeded(int status) {
+    return status == 0;
+}
+
+template <typename First, typename Second>
+bool vendor_call_succeeded(const std::pair<First, Second> &result) {
+    return vendor_call_succeeded(result.first);
+}
+
+template <typename... Values>
+bool vendor_call_succeeded(const std::tuple<Values...> &result) {
+    return vendor_call_succeeded(std::get<0>(result));
+}
+
+/**
+ * @brief Run one call into a camera vendor library and record it, e.g.
+ * vendor_call("qcom/take_photo", [&] { return _mav_camera->take_photo(); }).
+ *
+ * Names start with the library, qcom for the isp and boson for the ir camera uart, so the time
+ * of an rpc splits into the vendor calls it made and the server's own work.
+ */
+template <typename Call>
+auto vendor_call(const char *name, Call &&call) -> decltype(call()) {
+    const auto start = std::chrono::steady_clock::now();
+    if constexpr (std::is_void_v<decltype(call())>) {
+        call();
+        record_vendor_call(name, std::chrono::steady_clock::now() - start, true);
+    } else {
+        auto result = call();
+        record_vendor_call(name, std::chrono::steady_clock::now() - start,
+                           vendor_call_succeeded(result));
+        return result;
+    }
+}
+
+}  // namespace mavcam
@@ -0,0 +1,73 @@
+#include "rpc_metrics_interceptor.h"
+
+#include <google/protobuf/message.h>
+
+#include <chrono>
+#include <string>
+
+#include "base/call_metrics.h"
+#include "camera/camera.grpc.pb.h"
+#include "camera/camera.pb.h"
+
+namespace mavcam {
+
+using grpc::experimental::InterceptionHookPoints;
+
+class RpcMetricsInterceptor final : public grpc::experimental::Interceptor {
+public:
+    RpcMetricsInterceptor(base::CallStats &stats, bool has_camera_result)
+        : _stats(stats),
+          _has_camera_result(has_camera_result),
+          _start(std::chrono::steady_clock::now()) {}
+
+    void Intercept(grpc::experimental::InterceptorBatchMethods *methods) override {
+        if (_has_camera_result &&
+            methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_MESSAGE)) {
+            const auto *message =
+                static_cast<const google::protobuf::Message *>(methods->GetSendMessage());
+            if (message != nullptr && has_failed_camera_result(*message)) {
+                _success = false;
+            }
+        }
+        if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_STATUS)) {
+            if (!methods->GetSendStatus().ok()) {
+                _success = false;
+            }
+            _stats.record(std::chrono::steady_clock::now() - _start, _success);
+        }
+        methods->Proceed();
+    }
+private:
+    static bool has_failed_camera_result(const google::protobuf::Message &message) {
+        const auto *field = message.GetDescriptor()->FindFieldByName("camera_result");
+        if (field == nullptr ||
+            field->message_type() != rpc::camera::CameraResult::descriptor()) {
+            return false;
+        }
+        const auto *reflection = message.GetReflection();
+        if (!reflection->HasField(message, field)) {
+            return false;
+        }
+        const auto &camera_result =
+            static_cast<const rpc::camera::CameraResult &>(reflection->GetMessage(message, field));
+        return camera_result.result() != rpc::camera::CameraResult::RESULT_SUCCESS &&
+               camera_result.result() != rpc::camera::CameraResult::RESULT_IN_PROGRESS;
+    }
+private:
+    base::CallStats &_stats;
+    bool _has_camera_result;
+    std::chrono::steady_clock::time_point _start;
+    bool _success{true};
+};
+
+grpc::experimental::Interceptor *RpcMetricsInterceptorFactory::CreateServerInterceptor(
+    grpc::experimental::ServerRpcInfo *info) {
+    // only the camera service sends generated messages, e.g. the health service sends raw bytes
+    const std::string method = info->method();
+    const std::string camera_service_prefix =
+        std::string("/") + rpc::camera::CameraService::service_full_name() + "/";
+    return new RpcMetricsInterceptor(base::call_metrics().stats(method),
+                                     method.rfind(camera_service_prefix, 0) == 0);
+}
+
+}  // namespace mavcam
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <grpcpp/support/server_interceptor.h>
+
+namespace mavcam {
+
+/**
+ * @brief Creates one interceptor per call, it records count, errors and latency of the method.
+ *
+ * The latency runs from the moment the call is handed to the server until its status is sent,
+ * for streams that is the lifetime of the stream. A call counts as failed when its status is not
+ * OK or when a camera service response carries a camera_result other than success or in progress.
+ */
+class RpcMetricsInterceptorFactory final
+    : public grpc::experimental::ServerInterceptorFactoryInterface {
+public:
+    grpc::experimental::Interceptor *CreateServerInterceptor(
+        grpc::experimental::ServerRpcInfo *info) override;
+};
+
+}  // namespace mavcam
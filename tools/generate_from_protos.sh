@@ -3,7 +3,7 @@
 set -e
 
 script_dir="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
-proto_dir="${script_dir}/../proto/protos"
+proto_dir="${script_dir}/../protos"
 
 build_dir="${script_dir}/../build"
 
@@ -31,6 +31,16 @@ if ! command -v ${protoc_binary} > /dev/null; then
 fi
 echo "Found protoc ($(${protoc_binary} --version)): ${protoc_binary}"
 
+# The generated code has to come from the protobuf the server links against.
+protobuf_version="$(sed -n 's/^set(PROTOBUF_VERSION \(.*\))$/\1/p' ${script_dir}/../third_party/protobuf/CMakeLists.txt)"
+if [[ "$(${protoc_binary} --version)" != "libprotoc ${protobuf_version}" ]]; then
+    echo >&2 "protoc ${protobuf_version} is required, build third_party first:"
+    echo >&2 ""
+    echo >&2 "    cmake -DBUILD_MAVSDK_SERVER=ON -Bbuild/default -H."
+    echo >&2 ""
+    exit 1
+fi
+
 echo "Looking for ${protoc_grpc_binary}"
 if ! command -v ${protoc_grpc_binary} > /dev/null; then
 echo "Falling back to looking for grpc_cpp_plugin in PATH"
@@ -61,7 +71,7 @@ command -v ${protoc_binary} > /dev/null && command -v ${protoc_grpc_binary} > /d
 }
 
 echo "Installing protoc-gen-mavcam locally into build folder"
-python3 -m pip install --upgrade --target=${build_dir}/pb_plugins ${script_dir}/../proto/pb_plugins
+python3 -m pip install --upgrade --target=${build_dir}/pb_plugins ${script_dir}/../pb_plugins
 
 protoc_gen_mavcam="${build_dir}/pb_plugins/bin/protoc-gen-mavcam"
 export PYTHONPATH="${build_dir}/pb_plugins:${PYTHONPATH}"
@@ -89,6 +99,8 @@ template_path_plugin_cpp="${script_dir}/../templates/mav_server/plugin_cpp"
 template_path_plugin_impl_h="${script_dir}/../templates/mav_server/plugin_impl_h"
 template_path_plugin_impl_cpp="${script_dir}/../templates/mav_server/plugin_impl_cpp"
 template_path_plugin_service_impl_h="${script_dir}/../templates/mav_server/plugin_service_impl_h"
+template_path_plugin_async_service_impl_h="${script_dir}/../templates/mav_server/plugin_async_service_impl_h"
+template_path_plugin_enum_table_h="${script_dir}/../templates/mav_server/plugin_enum_table_h"
 
 server_plugin_list=("camera" )
 server_plugin_count=${#server_plugin_list[*]}
@@ -104,6 +116,10 @@ do
     ${protoc_binary} -I ${proto_dir} --custom_out=${tmp_output_dir} --plugin=protoc-gen-custom=${protoc_gen_mavcam} --custom_opt="file_ext=h,template_path=${template_path_plugin_h}" ${proto_dir}/${plugin}/${plugin}.proto
     mv ${tmp_output_dir}/${plugin}/$(snake_case_to_camel_case ${plugin}).h ${file_h}
 
+    file_enum_table_h="${script_dir}/../src/mav_server/plugins/${plugin}/${plugin}_enum_table.h"
+    ${protoc_binary} -I ${proto_dir} --custom_out=${tmp_output_dir} --plugin=protoc-gen-custom=${protoc_gen_mavcam} --custom_opt="file_ext=h,template_path=${template_path_plugin_enum_table_h}" ${proto_dir}/${plugin}/${plugin}.proto
+    mv ${tmp_output_dir}/${plugin}/$(snake_case_to_camel_case ${plugin}).h ${file_enum_table_h}
+
     file_cpp=${script_dir}/../src/mav_server/plugins/${plugin}/${plugin}.cpp
     ${protoc_binary} -I ${proto_dir} --custom_out=${tmp_output_dir} --plugin=protoc-gen-custom=${protoc_gen_mavcam} --custom_opt="file_ext=cpp,template_path=${template_path_plugin_cpp}" ${proto_dir}/${plugin}/${plugin}.proto
     mv ${tmp_output_dir}/${plugin}/$(snake_case_to_camel_case ${plugin}).cpp ${file_cpp}
@@ -135,4 +151,11 @@ do
     file_service_impl_h=" ${script_dir}/../src/mav_server/plugins/${plugin}/${plugin}_service_impl.h"
     ${protoc_binary} -I ${proto_dir} --custom_out=${tmp_output_dir} --plugin=protoc-gen-custom=${protoc_gen_mavcam} --custom_opt="file_ext=h,template_path=${template_path_plugin_service_impl_h}" ${proto_dir}/${plugin}/${plugin}.proto
     mv ${tmp_output_dir}/${plugin}/$(snake_case_to_camel_case ${plugin}).h ${file_service_impl_h}
-done
\ No newline at end of file
+
+    file_async_service_impl_h="${script_dir}/../src/mav_server/plugins/${plugin}/${plugin}_async_service_impl.h"
+    ${protoc_binary} -I ${proto_dir} --custom_out=${tmp_output_dir} --plugin=protoc-gen-custom=${protoc_gen_mavcam} --custom_opt="file_ext=h,template_path=${template_path_plugin_async_service_impl_h}" ${proto_dir}/${plugin}/${plugin}.proto
+    mv ${tmp_output_dir}/${plugin}/$(snake_case_to_camel_case ${plugin}).h ${file_async_service_impl_h}
+done
+
+echo "Processing camera definition D64TR.xml"
+python3 ${script_dir}/generate_settings_schema.py ${script_dir}/../src/definition/D64TR.xml ${script_dir}/../src/mav_server/plugins/camera/camera_settings_schema.h
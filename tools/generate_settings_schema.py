@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+
+# This script generates the camera settings schema header from a camera
+# definition file, e.g.
+#
+#     ./tools/generate_settings_schema.py src/definition/D64TR.xml \
+#         src/mav_server/plugins/camera/camera_settings_schema.h
+
+import os
+import sys
+import xml.etree.ElementTree as ElementTree
+
+HEADER = """// WARNING: THIS FILE IS AUTOGENERATED! As such, it should not be edited.
+// Edits need to be made to the camera definition
+// (see src/definition/{definition}, regenerate with tools/generate_settings_schema.py)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace mavcam {{
+
+enum class SettingType : uint8_t {{
+    Int32,
+    Float,
+    // int32 restricted to the option values
+    Enum,
+}};
+
+struct SettingOptionSchema {{
+    std::string_view name;
+    // value text as written in the definition
+    std::string_view value;
+    double number;
+}};
+
+struct SettingSchema {{
+    std::string_view name;
+    SettingType type;
+    double default_number;
+    const SettingOptionSchema *options;
+    std::size_t option_count;
+}};
+"""
+
+
+def camel_case(name):
+    return "".join(part.capitalize() for part in name.lower().split("_"))
+
+
+def setting_type(parameter, options):
+    if parameter.get("type") == "float":
+        return "Float"
+    if parameter.get("type") != "int32":
+        sys.exit("unsupported type {} of {}".format(parameter.get("type"), parameter.get("name")))
+    # a list of plain numbers such as iso values is a number, named choices are an enum
+    if options and any(option.get("name") != option.get("value") for option in options):
+        return "Enum"
+    return "Int32"
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: {} <definition.xml> <output.h>".format(sys.argv[0]))
+    definition_path, output_path = sys.argv[1:]
+    parameters = ElementTree.parse(definition_path).getroot().find("parameters")
+
+    ids = []
+    options_tables = []
+    schema_rows = []
+    for parameter in parameters.findall("parameter"):
+        name = parameter.get("name")
+        options = parameter.findall("options/option")
+        ids.append(camel_case(name))
+        table = "k{}Options".format(camel_case(name))
+        options_tables.append("inline constexpr SettingOptionSchema {}[] = {{".format(table))
+        for option in options:
+            options_tables.append('    {{"{}", "{}", {}}},'.format(
+                option.get("name"), option.get("value"), float(option.get("value"))))
+        options_tables.append("};\n")
+        schema_rows.append('    {{"{}", SettingType::{}, {}, {}, {}}},'.format(
+            name, setting_type(parameter, options), float(parameter.get("default")), table,
+            len(options)))
+
+    with open(output_path, "w") as output:
+        output.write(HEADER.format(definition=os.path.basename(definition_path)))
+        output.write("\n// dense ids in definition order, index into kSettingSchema\n")
+        output.write("enum class SettingId : uint8_t {\n")
+        for setting_id in ids:
+            output.write("    {},\n".format(setting_id))
+        output.write("};\n\n")
+        output.write("inline constexpr std::size_t kSettingCount = {};\n\n".format(len(ids)))
+        output.write("\n".join(options_tables))
+        output.write("\ninline constexpr SettingSchema kSettingSchema[kSettingCount] = {\n")
+        output.write("\n".join(schema_rows))
+        output.write("\n};\n\n}  // namespace mavcam\n")
+
+
+if __name__ == "__main__":
+    main()